@@ -0,0 +1,320 @@
+#include "neighbour.h"
+
+#include <string.h>
+#include <net/if.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <linux/if_ether.h>
+#include <netlink/msg.h>
+#include <netlink/attr.h>
+
+#include "logger.h"
+#include "macaddress.h"
+#include "fdbnlwriter.h"
+
+using namespace std;
+using namespace swss;
+
+/* Room for the acks of a full batch, an ack echoes the request header */
+#define FDB_NL_SOCK_BUF_SIZE (1024 * 1024)
+
+string FdbNlRequest::str() const
+{
+    string s;
+
+    if (msgType == RTM_DELNEIGH)
+    {
+        s = "del";
+    }
+    else
+    {
+        s = (msgFlags & NLM_F_REPLACE) ? "replace" : "add";
+    }
+
+    s += " " + mac + " dev " + ifname;
+    if (!dst.empty())
+    {
+        s += " dst " + dst;
+    }
+    if (nhid)
+    {
+        s += " nhid " + to_string(nhid);
+    }
+    if (ndmFlags & NTF_MASTER)
+    {
+        s += " master";
+    }
+    if (ndmFlags & NTF_SELF)
+    {
+        s += " self";
+    }
+    if (state & NUD_NOARP)
+    {
+        s += " static";
+    }
+    else if (state & NUD_REACHABLE)
+    {
+        s += " dynamic";
+    }
+    if (ndmFlags & NTF_EXT_LEARNED)
+    {
+        s += " extern_learn";
+    }
+    if (vlan)
+    {
+        s += " vlan " + to_string(vlan);
+    }
+    if (protocol)
+    {
+        s += " proto " + to_string(protocol);
+    }
+    return s;
+}
+
+FdbNlWriter::FdbNlWriter()
+{
+}
+
+FdbNlWriter::~FdbNlWriter()
+{
+    if (m_sock)
+    {
+        nl_socket_free(m_sock);
+    }
+}
+
+bool FdbNlWriter::open()
+{
+    if (m_sock)
+    {
+        return true;
+    }
+
+    m_sock = nl_socket_alloc();
+    if (!m_sock)
+    {
+        SWSS_LOG_ERROR("Unable to allocate netlink socket");
+        return false;
+    }
+
+    int err = nl_connect(m_sock, NETLINK_ROUTE);
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("Unable to connect netlink socket: %s", nl_geterror(err));
+        nl_socket_free(m_sock);
+        m_sock = nullptr;
+        return false;
+    }
+
+    nl_socket_set_buffer_size(m_sock, FDB_NL_SOCK_BUF_SIZE, FDB_NL_SOCK_BUF_SIZE);
+
+    struct timeval tv = { ACK_TIMEOUT_MSEC / 1000, (ACK_TIMEOUT_MSEC % 1000) * 1000 };
+    setsockopt(nl_socket_get_fd(m_sock), SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+    return true;
+}
+
+bool FdbNlWriter::encode(const FdbNlRequest &req, int ifindex, uint32_t seq, vector<char> &buf)
+{
+    uint8_t mac[ETH_ALEN];
+    if (!MacAddress::parseMacString(req.mac, mac))
+    {
+        SWSS_LOG_ERROR("Invalid MAC in %s", req.str().c_str());
+        return false;
+    }
+
+    struct nl_msg *msg = nlmsg_alloc();
+    if (!msg)
+    {
+        SWSS_LOG_ERROR("Netlink message alloc failed for %s", req.str().c_str());
+        return false;
+    }
+
+    struct nlmsghdr *hdr = nlmsg_put(msg, NL_AUTO_PORT, seq, req.msgType, 0,
+                                     NLM_F_REQUEST | NLM_F_ACK | req.msgFlags);
+    if (!hdr)
+    {
+        SWSS_LOG_ERROR("Netlink message header alloc failed for %s", req.str().c_str());
+        nlmsg_free(msg);
+        return false;
+    }
+
+    struct ndmsg ndm;
+    memset(&ndm, 0, sizeof(ndm));
+    ndm.ndm_family = AF_BRIDGE;
+    ndm.ndm_ifindex = ifindex;
+    ndm.ndm_state = req.state;
+    ndm.ndm_flags = req.ndmFlags;
+
+    int err = nlmsg_append(msg, &ndm, sizeof(ndm), NLMSG_ALIGNTO);
+    if (!err)
+    {
+        err = nla_put(msg, NDA_LLADDR, ETH_ALEN, mac);
+    }
+    if (!err && req.vlan)
+    {
+        err = nla_put_u16(msg, NDA_VLAN, req.vlan);
+    }
+    if (!err && !req.dst.empty())
+    {
+        struct in6_addr addr;
+        if (inet_pton(AF_INET, req.dst.c_str(), &addr) == 1)
+        {
+            err = nla_put(msg, NDA_DST, sizeof(struct in_addr), &addr);
+        }
+        else if (inet_pton(AF_INET6, req.dst.c_str(), &addr) == 1)
+        {
+            err = nla_put(msg, NDA_DST, sizeof(struct in6_addr), &addr);
+        }
+        else
+        {
+            SWSS_LOG_ERROR("Invalid destination in %s", req.str().c_str());
+            nlmsg_free(msg);
+            return false;
+        }
+    }
+    if (!err && req.nhid)
+    {
+        err = nla_put_u32(msg, NDA_NH_ID, req.nhid);
+    }
+    if (!err && req.protocol)
+    {
+        err = nla_put_u8(msg, NDA_PROTOCOL, req.protocol);
+    }
+    if (err)
+    {
+        SWSS_LOG_ERROR("Netlink message build failed for %s: %s", req.str().c_str(), nl_geterror(err));
+        nlmsg_free(msg);
+        return false;
+    }
+
+    hdr = nlmsg_hdr(msg);
+    const char *data = reinterpret_cast<const char *>(hdr);
+    buf.insert(buf.end(), data, data + NLMSG_ALIGN(hdr->nlmsg_len));
+    nlmsg_free(msg);
+    return true;
+}
+
+size_t FdbNlWriter::sendBatch(size_t begin, size_t end, unordered_map<string, int> &ifindexes)
+{
+    size_t failed = 0;
+    vector<char> buf;
+    unordered_map<uint32_t, size_t> inflight;
+
+    for (size_t i = begin; i < end; i++)
+    {
+        const FdbNlRequest &req = m_pending[i];
+
+        auto it = ifindexes.find(req.ifname);
+        if (it == ifindexes.end())
+        {
+            it = ifindexes.emplace(req.ifname, if_nametoindex(req.ifname.c_str())).first;
+        }
+        if (it->second == 0)
+        {
+            SWSS_LOG_ERROR("Failed %s: no such device", req.str().c_str());
+            failed++;
+            continue;
+        }
+
+        /* Sequence 0 is what unsolicited kernel messages carry */
+        if (++m_seq == 0)
+        {
+            ++m_seq;
+        }
+        if (!encode(req, it->second, m_seq, buf))
+        {
+            failed++;
+            continue;
+        }
+        inflight[m_seq] = i;
+    }
+
+    if (inflight.empty())
+    {
+        return failed;
+    }
+
+    int err = nl_sendto(m_sock, buf.data(), buf.size());
+    if (err < 0)
+    {
+        SWSS_LOG_ERROR("Failed to send %zu FDB requests: %s", inflight.size(), nl_geterror(err));
+        return failed + inflight.size();
+    }
+
+    while (!inflight.empty())
+    {
+        struct sockaddr_nl nla;
+        unsigned char *data = nullptr;
+
+        int len = nl_recv(m_sock, &nla, &data, nullptr);
+        if (len <= 0)
+        {
+            for (auto &entry : inflight)
+            {
+                SWSS_LOG_ERROR("Failed %s: no ack", m_pending[entry.second].str().c_str());
+            }
+            failed += inflight.size();
+            free(data);
+            break;
+        }
+
+        for (struct nlmsghdr *h = reinterpret_cast<struct nlmsghdr *>(data);
+             nlmsg_ok(h, len); h = nlmsg_next(h, &len))
+        {
+            if (h->nlmsg_type != NLMSG_ERROR)
+            {
+                continue;
+            }
+
+            auto it = inflight.find(h->nlmsg_seq);
+            if (it == inflight.end())
+            {
+                continue;
+            }
+
+            const FdbNlRequest &req = m_pending[it->second];
+            struct nlmsgerr *nlerr = static_cast<struct nlmsgerr *>(nlmsg_data(h));
+            if (nlerr->error)
+            {
+                SWSS_LOG_ERROR("Failed %s: %s", req.str().c_str(), strerror(-nlerr->error));
+                failed++;
+            }
+            else
+            {
+                SWSS_LOG_INFO("Success %s", req.str().c_str());
+            }
+            inflight.erase(it);
+        }
+        free(data);
+    }
+
+    return failed;
+}
+
+size_t FdbNlWriter::flush()
+{
+    if (m_pending.empty())
+    {
+        return 0;
+    }
+
+    size_t failed = 0;
+    if (!open())
+    {
+        failed = m_pending.size();
+        m_pending.clear();
+        return failed;
+    }
+
+    /* Interfaces can be recreated between flushes, resolve names per flush */
+    unordered_map<string, int> ifindexes;
+    for (size_t begin = 0; begin < m_pending.size(); begin += MAX_BATCH)
+    {
+        failed += sendBatch(begin, min(begin + MAX_BATCH, m_pending.size()), ifindexes);
+    }
+
+    SWSS_LOG_INFO("Sent %zu kernel FDB requests, %zu failed", m_pending.size(), failed);
+    m_pending.clear();
+    return failed;
+}
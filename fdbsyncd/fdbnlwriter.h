@@ -0,0 +1,77 @@
+#ifndef __FDBNLWRITER__
+#define __FDBNLWRITER__
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <linux/rtnetlink.h>
+#include <netlink/netlink.h>
+
+namespace swss {
+
+/*
+ * One AF_BRIDGE neighbour request, the netlink equivalent of a
+ * "bridge fdb add|replace|del" command line.
+ */
+struct FdbNlRequest
+{
+    uint16_t msgType = RTM_NEWNEIGH;    /* RTM_NEWNEIGH or RTM_DELNEIGH */
+    uint16_t msgFlags = 0;              /* NLM_F_CREATE, NLM_F_REPLACE */
+    std::string ifname;
+    std::string mac;
+    uint16_t vlan = 0;                  /* NDA_VLAN, omitted when 0 */
+    uint8_t ndmFlags = 0;               /* NTF_MASTER, NTF_SELF, NTF_EXT_LEARNED */
+    uint16_t state = 0;                 /* NUD_REACHABLE, NUD_NOARP, NUD_PERMANENT */
+    std::string dst;                    /* NDA_DST, remote VTEP */
+    uint32_t nhid = 0;                  /* NDA_NH_ID, omitted when 0 */
+    uint8_t protocol = 0;               /* NDA_PROTOCOL, omitted when RTPROT_UNSPEC */
+
+    /* bridge(8) like description used in logs */
+    std::string str() const;
+};
+
+/*
+ * Queues kernel FDB requests and sends them in batches over a single
+ * NETLINK_ROUTE socket. Every request carries NLM_F_ACK and its own
+ * sequence number, so the kernel answer is matched to the request it
+ * belongs to even though a whole batch goes out in one sendmsg().
+ */
+class FdbNlWriter
+{
+public:
+    /* Requests per sendmsg(), keeps the acks within the socket buffer */
+    static const size_t MAX_BATCH = 128;
+    /* How long to wait for the acks of a batch */
+    static const int ACK_TIMEOUT_MSEC = 1000;
+
+    FdbNlWriter();
+    ~FdbNlWriter();
+
+    void add(const FdbNlRequest &req)
+    {
+        m_pending.push_back(req);
+    }
+
+    const std::vector<FdbNlRequest> &pending() const
+    {
+        return m_pending;
+    }
+
+    /* Sends all queued requests, returns the number that failed */
+    size_t flush();
+
+    /* Appends the netlink message for req to buf */
+    static bool encode(const FdbNlRequest &req, int ifindex, uint32_t seq, std::vector<char> &buf);
+
+private:
+    bool open();
+    size_t sendBatch(size_t begin, size_t end, std::unordered_map<std::string, int> &ifindexes);
+
+    struct nl_sock *m_sock = nullptr;
+    uint32_t m_seq = 0;
+    std::vector<FdbNlRequest> m_pending;
+};
+
+}
+
+#endif
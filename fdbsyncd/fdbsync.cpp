@@ -16,7 +16,6 @@
 #include "ipaddress.h"
 #include "netmsg.h"
 #include "macaddress.h"
-#include "exec.h"
 #include "fdbsync.h"
 #include "warm_restart.h"
 #include "errno.h"
@@ -56,27 +55,64 @@ FdbSync::~FdbSync()
 
 bool FdbSync::checkFdbProtoSupport()
 {
-    /* Test whether the local bridge command and kernel both support the
-     * exact proto syntax used below. Some iproute2 versions advertise a
-     * protocol field but still reject the "proto hw" spelling/name. */
-    std::string res;
-    int ret = swss::exec("bridge fdb help 2>&1 | grep -q proto", res);
-    if (ret != 0)
+    /* Test whether the kernel accepts a FDB entry carrying a protocol */
+    FdbNlRequest req;
+    req.msgType = RTM_NEWNEIGH;
+    req.msgFlags = NLM_F_CREATE;
+    req.ifname = "lo";
+    req.mac = "00:00:00:00:00:00";
+    req.ndmFlags = NTF_SELF;
+    req.state = NUD_PERMANENT;
+    req.protocol = RTPROT_HW;
+
+    m_fdbWriter.add(req);
+    bool supported = (m_fdbWriter.flush() == 0);
+
+    req.msgType = RTM_DELNEIGH;
+    req.msgFlags = 0;
+    req.protocol = RTPROT_UNSPEC;
+    m_fdbWriter.add(req);
+    m_fdbWriter.flush();
+
+    if (!supported)
     {
         SWSS_LOG_NOTICE("bridge fdb proto support not detected");
         return false;
     }
 
-    ret = swss::exec("bridge fdb add 00:00:00:00:00:00 dev lo proto hw 2>/dev/null", res);
-    swss::exec("bridge fdb del 00:00:00:00:00:00 dev lo 2>/dev/null", res);
-    if (ret != 0)
+    SWSS_LOG_NOTICE("bridge fdb proto support detected");
+    return true;
+}
+
+void FdbSync::flushKernelFdb()
+{
+    m_fdbWriter.flush();
+}
+
+void FdbSync::queueBridgeFdb(bool add, const string &mac, const string &port_name,
+                             uint16_t vlan, short fdb_type, uint8_t protocol)
+{
+    FdbNlRequest req;
+
+    /* bridge fdb replace|del <mac> dev <port> master dynamic extern_learn|static vlan <vlan> */
+    req.msgType = add ? RTM_NEWNEIGH : RTM_DELNEIGH;
+    req.msgFlags = add ? (NLM_F_CREATE | NLM_F_REPLACE) : 0;
+    req.ifname = port_name;
+    req.mac = mac;
+    req.vlan = vlan;
+    req.ndmFlags = NTF_MASTER;
+    if (fdb_type == FDB_TYPE_DYNAMIC)
     {
-        SWSS_LOG_NOTICE("bridge fdb proto support not detected");
-        return false;
+        req.ndmFlags |= NTF_EXT_LEARNED;
+        req.state = NUD_REACHABLE;
     }
+    else
+    {
+        req.state = NUD_NOARP;
+    }
+    req.protocol = m_isFdbProtoSupported ? protocol : RTPROT_UNSPEC;
 
-    SWSS_LOG_NOTICE("bridge fdb proto support detected");
-    return true;
+    m_fdbWriter.add(req);
 }
 
 // Check if interface entries are restored in kernel
@@ -320,7 +356,6 @@ bool FdbSync::macCheckSrcDB(struct m_fdb_info *info)
 
 void FdbSync::macDelVxlanEntry(struct m_fdb_info *info)
 {
-    std::string cmds;
     auto mac = info->mac;
     auto vid =  info->vid.substr(4);
     string auxkey = info->vid + ":" + info->mac;
@@ -332,29 +367,24 @@ void FdbSync::macDelVxlanEntry(struct m_fdb_info *info)
         return;
     }
 
-    auto ifname = it->second.ifname;
+    // The usage of self allow the avoidance of
+    // deleting both bridge and VxLAN FDB.
+    FdbNlRequest req;
+    req.msgType = RTM_DELNEIGH;
+    req.ifname = it->second.ifname;
+    req.mac = mac;
+    req.vlan = static_cast<uint16_t>(strtoul(vid.c_str(), NULL, 10));
+    req.ndmFlags = NTF_SELF;
+
     if (it->second.nhtype == FdbDest::VTEP)
     {
-        std::string vtep = it->second.nexthop_value;
-
-        // The usage of self allow the avoidance of
-        // deleting both bridge and VxLAN FDB.
-        cmds = std::string("")
-            + " bridge fdb del " + mac + " dev "
-            + ifname + " dst " + vtep + " vlan " + vid + " self";
-        //bridge fdb del 00:00:00:00:66:66 dev Ethernet1_13 vlan 10 master
-
+        //bridge fdb del 00:00:00:00:66:66 dev VXLAN-10 dst 10.0.0.1 vlan 10 self
+        req.dst = it->second.nexthop_value;
     }
     else if (it->second.nhtype == FdbDest::NEXTHOPGROUP)
     {
-        std::string nexthop_group = it->second.nexthop_value;
-
-        // The usage of self allow the avoidance of
-        // deleting both bridge and VxLAN FDB.
-        cmds = std::string("")
-            + " bridge fdb del " + mac + " dev "
-            + ifname + " nhid " + nexthop_group + " vlan " + vid + " self";
-        //00:00:00:22:22:22 dev VXLAN-10 nhid 536870913 self static
+        //bridge fdb del 00:00:00:22:22:22 dev VXLAN-10 nhid 536870913 vlan 10 self
+        req.nhid = static_cast<uint32_t>(strtoul(it->second.nexthop_value.c_str(), NULL, 10));
     }
     else
     {
@@ -364,23 +394,12 @@ void FdbSync::macDelVxlanEntry(struct m_fdb_info *info)
         return;
     }
 
-    std::string res;
-    int ret = swss::exec(cmds, res);
-    if (ret != 0)
-    {
-        SWSS_LOG_ERROR("Failed cmd:%s, res=%s, ret=%d", cmds.c_str(), res.c_str(), ret);
-    }
-    else
-    {
-        SWSS_LOG_INFO("Success cmd:%s, res=%s, ret=%d", cmds.c_str(), res.c_str(), ret);
-    }
+    m_fdbWriter.add(req);
 }
 
 void FdbSync::updateLocalMac (struct m_fdb_info *info)
 {
-    char *op;
-    char *type;
-    std::string proto_string = "";
+    bool add;
     string port_name = "";
     string key = info->vid + ":" + info->mac;
     short fdb_type;    /*dynamic or static*/
@@ -388,13 +407,13 @@ void FdbSync::updateLocalMac (struct m_fdb_info *info)
     if (info->op_type == FDB_OPER_ADD)
     {
         macUpdateCache(info);
-        op = "replace";
+        add = true;
         port_name = info->port_name;
         fdb_type = info->type;
     }
     else
     {
-        op = "del";
+        add = false;
         port_name = m_fdb_mac[key].port_name;
         fdb_type = m_fdb_mac[key].type;
         m_fdb_mac.erase(key);
@@ -406,30 +425,9 @@ void FdbSync::updateLocalMac (struct m_fdb_info *info)
         return;
     }
 
-    if (fdb_type == FDB_TYPE_DYNAMIC)
-    {
-        type = "dynamic extern_learn";
-        proto_string = m_isFdbProtoSupported ? " proto hw" : "";
-    }
-    else
-    {
-        type = "static";
-    }
-
-    const std::string cmds = std::string("")
-        + " bridge fdb " + op + " " + info->mac + " dev "
-        + port_name + " master " + type + " vlan " + info->vid.substr(4) + proto_string;
-
-    std::string res;
-    int ret = swss::exec(cmds, res);
-    if (ret != 0)
-    {
-        SWSS_LOG_ERROR("Failed cmd:%s, res=%s, ret=%d", cmds.c_str(), res.c_str(), ret);
-    }
-    else
-    {
-        SWSS_LOG_INFO("Success cmd:%s, res=%s, ret=%d", cmds.c_str(), res.c_str(), ret);
-    }
+    queueBridgeFdb(add, info->mac, port_name,
+                   static_cast<uint16_t>(strtoul(info->vid.substr(4).c_str(), NULL, 10)),
+                   fdb_type, fdb_type == FDB_TYPE_DYNAMIC ? RTPROT_HW : RTPROT_UNSPEC);
 
     if (info->op_type == FDB_OPER_ADD)
     {
@@ -447,12 +445,10 @@ void FdbSync::updateLocalMac (struct m_fdb_info *info)
 
 void FdbSync::addLocalMac(string key, string op)
 {
-    char *type;
     string port_name = "";
     string mac = "";
     string vlan = "";
     size_t str_loc = string::npos;
-    std::string proto_string = "";
 
     str_loc = key.find(":");
     if (str_loc == string::npos)
@@ -474,75 +470,39 @@ void FdbSync::addLocalMac(string key, string op)
             return;
         }
 
-        if (m_fdb_mac[key].type == FDB_TYPE_DYNAMIC)
-        {
-            type = "dynamic extern_learn";
-            proto_string = m_isFdbProtoSupported ? " proto hw" : "";
-        }
-        else
-        {
-            type = "static";
-        }
-
-        const std::string cmds = std::string("")
-                + " bridge fdb " + op + " " + mac + " dev "
-                + port_name + " master " + type  + " vlan " + vlan
-                + proto_string;
-
-        std::string res;
-        int ret = swss::exec(cmds, res);
-        if (ret != 0)
-        {
-            SWSS_LOG_INFO("Failed cmd:%s, res=%s, ret=%d", cmds.c_str(), res.c_str(), ret);
-        }
-
-        SWSS_LOG_INFO("Config triggered cmd:%s, res=%s, ret=%d", cmds.c_str(), res.c_str(), ret);
+        short fdb_type = m_fdb_mac[key].type;
+        queueBridgeFdb(op != "del", mac, port_name,
+                       static_cast<uint16_t>(strtoul(vlan.c_str(), NULL, 10)),
+                       fdb_type, fdb_type == FDB_TYPE_DYNAMIC ? RTPROT_HW : RTPROT_UNSPEC);
     }
     return;
 }
 
 void FdbSync::updateMclagRemoteMac (struct m_fdb_info *info)
 {
-    char *op;
-    char *type;
+    bool add;
     string port_name = "";
     string key = info->vid + ":" + info->mac;
     short fdb_type;    /*dynamic or static*/
-    std::string proto_string = "";
 
     if (info->op_type == FDB_OPER_ADD)
     {
         macUpdateMclagRemoteCache(info);
-        op = "replace";
+        add = true;
         port_name = info->port_name;
         fdb_type = info->type;
     }
     else
     {
-        op = "del";
+        add = false;
         port_name = m_mclag_remote_fdb_mac[key].port_name;
         fdb_type = m_mclag_remote_fdb_mac[key].type;
         m_mclag_remote_fdb_mac.erase(key);
     }
 
-    if (fdb_type == FDB_TYPE_DYNAMIC)
-    {
-        type = "dynamic extern_learn";
-        proto_string = m_isFdbProtoSupported ? " proto hw" : "";
-    }
-    else
-    {
-        type = "static";
-    }
-
-    const std::string cmds = std::string("")
-        + " bridge fdb " + op + " " + info->mac + " dev "
-        + port_name + " master " + type + " vlan " + info->vid.substr(4) + proto_string;
-
-    std::string res;
-    int ret = swss::exec(cmds, res);
-
-    SWSS_LOG_INFO("cmd:%s, res=%s, ret=%d", cmds.c_str(), res.c_str(), ret);
+    queueBridgeFdb(add, info->mac, port_name,
+                   static_cast<uint16_t>(strtoul(info->vid.substr(4).c_str(), NULL, 10)),
+                   fdb_type, fdb_type == FDB_TYPE_DYNAMIC ? RTPROT_HW : RTPROT_UNSPEC);
 
     return;
 }
@@ -552,7 +512,6 @@ void FdbSync::updateMclagRemoteMacPort(int ifindex, int vlan, std::string mac, u
     string key = "Vlan" + to_string(vlan) + ":" + mac;
     int type = 0;
     string port_name = "";
-    std::string proto_string = "";
 
     SWSS_LOG_INFO("Updating Intf %d, Vlan:%d MAC:%s Key %s", ifindex, vlan, mac.c_str(), key.c_str());
 
@@ -560,28 +519,14 @@ void FdbSync::updateMclagRemoteMacPort(int ifindex, int vlan, std::string mac, u
     {
         type = m_mclag_remote_fdb_mac[key].type;
         port_name = m_mclag_remote_fdb_mac[key].port_name;
-        if (protocol == RTPROT_ZEBRA)
-            proto_string = m_isFdbProtoSupported ? " proto zebra" : "";
-        else if (protocol == RTPROT_HW)
-            /* Unlikely this can happen, but keeping just in case */
-            proto_string = m_isFdbProtoSupported ? " proto hw" : "";
-        SWSS_LOG_INFO(" port %s, type %d %s\n", port_name.c_str(), type, proto_string.c_str());
+        /* Only zebra and, unlikely as it is, hw owned entries keep their protocol */
+        if (protocol != RTPROT_ZEBRA && protocol != RTPROT_HW)
+            protocol = RTPROT_UNSPEC;
+        SWSS_LOG_INFO(" port %s, type %d proto %u\n", port_name.c_str(), type, protocol);
 
         if (type == FDB_TYPE_STATIC)
         {
-            const std::string cmds = std::string("")
-                + " bridge fdb replace" + " " + mac + " dev "
-                + port_name + " master static vlan " + to_string(vlan) + proto_string;
-
-            std::string res;
-            int ret = swss::exec(cmds, res);
-            if (ret != 0)
-            {
-                SWSS_LOG_NOTICE("Failed cmd:%s, res=%s, ret=%d", cmds.c_str(), res.c_str(), ret);
-                return;
-            }
-
-            SWSS_LOG_NOTICE("Update cmd:%s, res=%s, ret=%d", cmds.c_str(), res.c_str(), ret);
+            queueBridgeFdb(true, mac, port_name, static_cast<uint16_t>(vlan), FDB_TYPE_STATIC, protocol);
         }
     }
     return;
@@ -597,9 +542,7 @@ void FdbSync::updateMclagRemoteMacPort(int ifindex, int vlan, std::string mac, u
 void FdbSync::macRefreshStateDB(int vlan, string kmac, uint8_t protocol)
 {
     string key = "Vlan" + to_string(vlan) + ":" + kmac;
-    char *type;
     string port_name = "";
-    std::string proto_string = "";
 
     SWSS_LOG_INFO("Refreshing Vlan:%d MAC route MAC:%s Key %s", vlan, kmac.c_str(), key.c_str());
 
@@ -612,32 +555,11 @@ void FdbSync::macRefreshStateDB(int vlan, string kmac, uint8_t protocol)
             return;
         }
 
-        if (m_fdb_mac[key].type == FDB_TYPE_DYNAMIC)
-        {
-            type = "dynamic extern_learn";
-        }
-        else
-        {
-            type = "static";
-        }
-
-        if (protocol == RTPROT_ZEBRA)
-            proto_string = m_isFdbProtoSupported ? " proto zebra" : "";
-        else if (protocol == RTPROT_HW)
-            proto_string = m_isFdbProtoSupported ? " proto hw" : "";
-
-        const std::string cmds = std::string("")
-            + " bridge fdb " + "replace" + " " + kmac + " dev "
-            + port_name + " master " + type  + " vlan " + to_string(vlan) + proto_string;
-
-        std::string res;
-        int ret = swss::exec(cmds, res);
-        if (ret != 0)
-        {
-            SWSS_LOG_INFO("Failed cmd:%s, res=%s, ret=%d", cmds.c_str(), res.c_str(), ret);
-        }
+        if (protocol != RTPROT_ZEBRA && protocol != RTPROT_HW)
+            protocol = RTPROT_UNSPEC;
 
-        SWSS_LOG_INFO("Refreshing cmd:%s, res=%s, ret=%d", cmds.c_str(), res.c_str(), ret);
+        queueBridgeFdb(true, kmac, port_name, static_cast<uint16_t>(vlan),
+                       m_fdb_mac[key].type, protocol);
     }
     return;
 }
@@ -10,6 +10,7 @@
 #include "subscriberstatetable.h"
 #include "netmsg.h"
 #include "warmRestartAssist.h"
+#include "fdbnlwriter.h"
 #include "lib/fdb_defs.h"
 
 /*
@@ -84,6 +85,9 @@ public:
 
     void processCfgEvpnNvo();
 
+    /* Sends the kernel FDB updates queued since the last call */
+    void flushKernelFdb();
+
     bool m_reconcileDone = false;
 
     bool m_isEvpnNvoExist = false;
@@ -92,6 +96,10 @@ private:
     bool m_isFdbProtoSupported = false;
     bool checkFdbProtoSupport();
 
+    FdbNlWriter m_fdbWriter;
+    void queueBridgeFdb(bool add, const std::string &mac, const std::string &port_name,
+                        uint16_t vlan, short fdb_type, uint8_t protocol);
+
     ProducerStateTable m_fdbTable;
     ProducerStateTable m_imetTable;
     ProducerStateTable m_l2NhgTable;
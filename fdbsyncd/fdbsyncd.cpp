@@ -158,6 +158,9 @@ int main(int argc, char **argv)
                         }
                     }
                 }
+
+                /* Program the kernel with everything this iteration queued in one go */
+                sync.flushKernelFdb();
             }
         }
         catch (const std::exception& e)
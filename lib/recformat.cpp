@@ -0,0 +1,700 @@
+#include "recformat.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <ctime>
+#include <zlib.h>
+
+using namespace swss;
+
+namespace {
+
+const char SEGMENT_MAGIC[] = "SWSSRECB";
+const char FOOTER_MAGIC[] = "SWSSRECI";
+const size_t MAGIC_LEN = 8;
+const uint8_t FORMAT_VERSION = 1;
+const char BLOCK_TAG = 'B';
+const char FOOTER_TAG = 'I';
+/* footer_offset and the footer magic */
+const size_t FOOTER_TRAILER_LEN = 8 + MAGIC_LEN;
+/* Largest block the reader accepts, far above the blocks the writer produces */
+const uint64_t MAX_BLOCK_LEN = 64 * 1024 * 1024;
+
+enum RecOp : uint8_t
+{
+    REC_OP_SET = 0,
+    REC_OP_DEL = 1,
+    REC_OP_OTHER = 2,
+};
+
+void putVarint(std::string& buf, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        buf.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    buf.push_back(static_cast<char>(value));
+}
+
+void putString(std::string& buf, const std::string& str)
+{
+    putVarint(buf, str.size());
+    buf.append(str);
+}
+
+bool getVarint(const std::string& buf, size_t& pos, uint64_t& value)
+{
+    value = 0;
+    for (unsigned shift = 0; shift < 64 && pos < buf.size(); shift += 7)
+    {
+        uint8_t byte = static_cast<uint8_t>(buf[pos++]);
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool getString(const std::string& buf, size_t& pos, std::string& str)
+{
+    uint64_t len;
+    if (!getVarint(buf, pos, len) || len > buf.size() - pos)
+    {
+        return false;
+    }
+    str.assign(buf, pos, len);
+    pos += len;
+    return true;
+}
+
+bool readVarint(std::istream& is, uint64_t& value)
+{
+    value = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7)
+    {
+        int byte = is.get();
+        if (byte == EOF)
+        {
+            return false;
+        }
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+struct BlockHeader
+{
+    uint64_t rawLen;
+    uint64_t compLen;
+    uint64_t firstUsec;
+    uint64_t lastUsec;
+    uint64_t count;
+};
+
+/* Reads the block header following the block tag */
+bool readBlockHeader(std::istream& is, BlockHeader& hdr)
+{
+    return readVarint(is, hdr.rawLen) && readVarint(is, hdr.compLen) &&
+           readVarint(is, hdr.firstUsec) && readVarint(is, hdr.lastUsec) &&
+           readVarint(is, hdr.count);
+}
+
+}
+
+RecBinaryWriter::RecBinaryWriter(size_t blockSize) :
+    m_blockSize(blockSize)
+{
+}
+
+RecBinaryWriter::~RecBinaryWriter()
+{
+    close();
+}
+
+bool RecBinaryWriter::open(const std::string& path, bool truncate)
+{
+    close();
+
+    auto mode = std::ofstream::out | std::ofstream::binary;
+    mode |= truncate ? std::ofstream::trunc : std::ofstream::app;
+    m_ofs.open(path, mode);
+    if (!m_ofs.is_open())
+    {
+        return false;
+    }
+
+    /* Appending to an existing recording starts a new segment */
+    m_ofs.write(SEGMENT_MAGIC, MAGIC_LEN);
+    m_ofs.put(static_cast<char>(FORMAT_VERSION));
+    m_ofs.flush();
+    return m_ofs.good();
+}
+
+void RecBinaryWriter::append(uint64_t usec, const std::string& prefix, const KeyOpFieldsValuesTuple& tuple)
+{
+    if (!isOpen())
+    {
+        return;
+    }
+
+    flushAged(usec);
+
+    if (m_count == 0)
+    {
+        m_firstUsec = usec;
+        m_lastUsec = usec;
+    }
+
+    putVarint(m_block, usec > m_firstUsec ? usec - m_firstUsec : 0);
+    m_lastUsec = std::max(m_lastUsec, usec);
+
+    auto it = m_prefixes.find(prefix);
+    if (it != m_prefixes.end())
+    {
+        putVarint(m_block, it->second);
+    }
+    else
+    {
+        uint64_t ref = m_prefixes.size();
+        putVarint(m_block, ref);
+        putString(m_block, prefix);
+        m_prefixes.emplace(prefix, ref);
+    }
+
+    const auto& op = kfvOp(tuple);
+    if (op == SET_COMMAND)
+    {
+        m_block.push_back(static_cast<char>(REC_OP_SET));
+    }
+    else if (op == DEL_COMMAND)
+    {
+        m_block.push_back(static_cast<char>(REC_OP_DEL));
+    }
+    else
+    {
+        m_block.push_back(static_cast<char>(REC_OP_OTHER));
+        putString(m_block, op);
+    }
+
+    putString(m_block, kfvKey(tuple));
+
+    const auto& fvs = kfvFieldsValues(tuple);
+    putVarint(m_block, fvs.size());
+    for (const auto& fv : fvs)
+    {
+        putString(m_block, fvField(fv));
+        putString(m_block, fvValue(fv));
+    }
+
+    m_count++;
+
+    if (m_block.size() >= m_blockSize)
+    {
+        flush();
+    }
+}
+
+uint64_t RecBinaryWriter::flushAged(uint64_t usec)
+{
+    if (m_count == 0)
+    {
+        return 0;
+    }
+
+    uint64_t due = m_firstUsec + MAX_BLOCK_AGE_USEC;
+    if (usec < due)
+    {
+        return due - usec;
+    }
+
+    flush();
+    return 0;
+}
+
+void RecBinaryWriter::flush()
+{
+    if (!isOpen() || m_count == 0)
+    {
+        return;
+    }
+
+    std::string payload;
+    uLongf compLen = compressBound(static_cast<uLong>(m_block.size()));
+    payload.resize(compLen);
+    if (compress2(reinterpret_cast<Bytef *>(&payload[0]), &compLen,
+                  reinterpret_cast<const Bytef *>(m_block.data()), static_cast<uLong>(m_block.size()),
+                  Z_BEST_SPEED) != Z_OK)
+    {
+        SWSS_LOG_ERROR("Failed to compress a recording block of %zu bytes", m_block.size());
+    }
+    else
+    {
+        payload.resize(compLen);
+
+        std::string hdr;
+        hdr.push_back(BLOCK_TAG);
+        putVarint(hdr, m_block.size());
+        putVarint(hdr, payload.size());
+        putVarint(hdr, m_firstUsec);
+        putVarint(hdr, m_lastUsec);
+        putVarint(hdr, m_count);
+
+        uint64_t offset = static_cast<uint64_t>(m_ofs.tellp());
+        m_ofs.write(hdr.data(), hdr.size());
+        m_ofs.write(payload.data(), payload.size());
+        m_ofs.flush();
+
+        m_index.push_back({ offset, m_firstUsec, m_lastUsec, m_count });
+    }
+
+    m_block.clear();
+    m_prefixes.clear();
+    m_count = 0;
+}
+
+void RecBinaryWriter::close()
+{
+    if (!isOpen())
+    {
+        return;
+    }
+
+    flush();
+
+    uint64_t footerOffset = static_cast<uint64_t>(m_ofs.tellp());
+    std::string footer;
+    footer.push_back(FOOTER_TAG);
+    putVarint(footer, m_index.size());
+    for (const auto& block : m_index)
+    {
+        putVarint(footer, block.offset);
+        putVarint(footer, block.firstUsec);
+        putVarint(footer, block.lastUsec);
+        putVarint(footer, block.count);
+    }
+    for (size_t i = 0; i < 8; i++)
+    {
+        footer.push_back(static_cast<char>((footerOffset >> (8 * i)) & 0xff));
+    }
+    footer.append(FOOTER_MAGIC, MAGIC_LEN);
+
+    m_ofs.write(footer.data(), footer.size());
+    m_ofs.close();
+    m_index.clear();
+}
+
+bool RecBinaryReader::isBinary(const std::string& path)
+{
+    std::ifstream ifs(path, std::ifstream::in | std::ifstream::binary);
+    char magic[MAGIC_LEN];
+    return ifs.read(magic, MAGIC_LEN) && memcmp(magic, SEGMENT_MAGIC, MAGIC_LEN) == 0;
+}
+
+bool RecBinaryReader::open(const std::string& path)
+{
+    close();
+
+    m_ifs.open(path, std::ifstream::in | std::ifstream::binary);
+    if (!m_ifs.is_open())
+    {
+        return false;
+    }
+
+    m_ifs.seekg(0, std::ifstream::end);
+    uint64_t size = static_cast<uint64_t>(m_ifs.tellg());
+    m_ifs.seekg(0);
+
+    char magic[MAGIC_LEN];
+    if (!m_ifs.read(magic, MAGIC_LEN) || memcmp(magic, SEGMENT_MAGIC, MAGIC_LEN) != 0 ||
+        m_ifs.get() != FORMAT_VERSION)
+    {
+        close();
+        return false;
+    }
+
+    return buildIndex(size);
+}
+
+void RecBinaryReader::close()
+{
+    if (m_ifs.is_open())
+    {
+        m_ifs.close();
+    }
+    m_index.clear();
+    m_nextBlock = 0;
+    m_payload.clear();
+    m_pos = 0;
+    m_remaining = 0;
+    m_seekUsec = 0;
+    m_prefixes.clear();
+}
+
+bool RecBinaryReader::buildIndex(uint64_t size)
+{
+    /*
+     * A single segment closed cleanly carries the full index in its footer.
+     * Recordings that were appended to or not closed (crash, kill) are
+     * indexed by walking the block headers instead.
+     */
+    if (size >= MAGIC_LEN + 1 + FOOTER_TRAILER_LEN)
+    {
+        char trailer[FOOTER_TRAILER_LEN];
+        m_ifs.seekg(size - FOOTER_TRAILER_LEN);
+        if (m_ifs.read(trailer, FOOTER_TRAILER_LEN) && memcmp(trailer + 8, FOOTER_MAGIC, MAGIC_LEN) == 0)
+        {
+            uint64_t footerOffset = 0;
+            for (size_t i = 0; i < 8; i++)
+            {
+                footerOffset |= static_cast<uint64_t>(static_cast<uint8_t>(trailer[i])) << (8 * i);
+            }
+
+            uint64_t count;
+            m_ifs.seekg(footerOffset);
+            if (footerOffset < size && m_ifs.get() == FOOTER_TAG && readVarint(m_ifs, count))
+            {
+                std::vector<RecBlockIndex> index;
+                RecBlockIndex block;
+                while (index.size() < count &&
+                       readVarint(m_ifs, block.offset) && readVarint(m_ifs, block.firstUsec) &&
+                       readVarint(m_ifs, block.lastUsec) && readVarint(m_ifs, block.count))
+                {
+                    index.push_back(block);
+                }
+
+                uint64_t first = index.empty() ? footerOffset : index.front().offset;
+                if (index.size() == count && first == MAGIC_LEN + 1)
+                {
+                    m_index = std::move(index);
+                    m_ifs.clear();
+                    return true;
+                }
+            }
+        }
+        m_ifs.clear();
+    }
+
+    m_ifs.seekg(MAGIC_LEN + 1);
+    while (true)
+    {
+        uint64_t offset = static_cast<uint64_t>(m_ifs.tellg());
+        int tag = m_ifs.get();
+        if (tag == BLOCK_TAG)
+        {
+            BlockHeader hdr;
+            if (!readBlockHeader(m_ifs, hdr))
+            {
+                break;
+            }
+            uint64_t payload = static_cast<uint64_t>(m_ifs.tellg());
+            if (hdr.compLen > size - payload)
+            {
+                /* Block cut short by an unclean shutdown */
+                break;
+            }
+            m_index.push_back({ offset, hdr.firstUsec, hdr.lastUsec, hdr.count });
+            m_ifs.seekg(payload + hdr.compLen);
+        }
+        else if (tag == FOOTER_TAG)
+        {
+            uint64_t count, value;
+            if (!readVarint(m_ifs, count))
+            {
+                break;
+            }
+            for (uint64_t i = 0; i < count * 4; i++)
+            {
+                if (!readVarint(m_ifs, value))
+                {
+                    break;
+                }
+            }
+            m_ifs.seekg(FOOTER_TRAILER_LEN, std::ifstream::cur);
+        }
+        else if (tag == SEGMENT_MAGIC[0])
+        {
+            char magic[MAGIC_LEN - 1];
+            if (!m_ifs.read(magic, MAGIC_LEN - 1) || memcmp(magic, SEGMENT_MAGIC + 1, MAGIC_LEN - 1) != 0 ||
+                m_ifs.get() != FORMAT_VERSION)
+            {
+                break;
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    m_ifs.clear();
+    return true;
+}
+
+void RecBinaryReader::seek(uint64_t usec)
+{
+    auto it = std::lower_bound(m_index.begin(), m_index.end(), usec,
+                               [](const RecBlockIndex& block, uint64_t value) {
+                                   return block.lastUsec < value;
+                               });
+    m_nextBlock = static_cast<size_t>(it - m_index.begin());
+    m_remaining = 0;
+    m_seekUsec = usec;
+}
+
+bool RecBinaryReader::loadBlock()
+{
+    const auto& block = m_index[m_nextBlock++];
+
+    m_ifs.clear();
+    m_ifs.seekg(block.offset);
+
+    BlockHeader hdr;
+    if (m_ifs.get() != BLOCK_TAG || !readBlockHeader(m_ifs, hdr) ||
+        hdr.rawLen > MAX_BLOCK_LEN || hdr.compLen > MAX_BLOCK_LEN)
+    {
+        return false;
+    }
+
+    std::string comp(hdr.compLen, '\0');
+    if (!m_ifs.read(&comp[0], comp.size()))
+    {
+        return false;
+    }
+
+    m_payload.resize(hdr.rawLen);
+    uLongf rawLen = static_cast<uLongf>(hdr.rawLen);
+    if (uncompress(reinterpret_cast<Bytef *>(&m_payload[0]), &rawLen,
+                   reinterpret_cast<const Bytef *>(comp.data()), static_cast<uLong>(comp.size())) != Z_OK ||
+        rawLen != hdr.rawLen)
+    {
+        return false;
+    }
+
+    m_pos = 0;
+    m_remaining = hdr.count;
+    m_firstUsec = hdr.firstUsec;
+    m_prefixes.clear();
+    return true;
+}
+
+bool RecBinaryReader::next(RecEntry& entry)
+{
+    while (true)
+    {
+        while (m_remaining == 0)
+        {
+            if (m_nextBlock >= m_index.size() || !loadBlock())
+            {
+                return false;
+            }
+        }
+
+        uint64_t delta, ref, fvCount;
+        if (!getVarint(m_payload, m_pos, delta) || !getVarint(m_payload, m_pos, ref))
+        {
+            return false;
+        }
+
+        if (ref == m_prefixes.size())
+        {
+            std::string prefix;
+            if (!getString(m_payload, m_pos, prefix))
+            {
+                return false;
+            }
+            m_prefixes.push_back(std::move(prefix));
+        }
+        else if (ref > m_prefixes.size())
+        {
+            return false;
+        }
+
+        if (m_pos >= m_payload.size())
+        {
+            return false;
+        }
+
+        std::string op;
+        switch (static_cast<uint8_t>(m_payload[m_pos++]))
+        {
+        case REC_OP_SET:
+            op = SET_COMMAND;
+            break;
+        case REC_OP_DEL:
+            op = DEL_COMMAND;
+            break;
+        default:
+            if (!getString(m_payload, m_pos, op))
+            {
+                return false;
+            }
+            break;
+        }
+
+        std::string key;
+        if (!getString(m_payload, m_pos, key) || !getVarint(m_payload, m_pos, fvCount))
+        {
+            return false;
+        }
+
+        std::vector<FieldValueTuple> fvs;
+        fvs.reserve(std::min<uint64_t>(fvCount, m_payload.size() - m_pos));
+        for (uint64_t i = 0; i < fvCount; i++)
+        {
+            std::string field, value;
+            if (!getString(m_payload, m_pos, field) || !getString(m_payload, m_pos, value))
+            {
+                return false;
+            }
+            fvs.emplace_back(std::move(field), std::move(value));
+        }
+
+        m_remaining--;
+
+        uint64_t usec = m_firstUsec + delta;
+        if (usec < m_seekUsec)
+        {
+            continue;
+        }
+
+        entry.usec = usec;
+        entry.prefix = m_prefixes[ref];
+        entry.tuple = KeyOpFieldsValuesTuple(std::move(key), std::move(op), std::move(fvs));
+        return true;
+    }
+}
+
+std::string swss::formatRecTimestamp(uint64_t usec)
+{
+    char buffer[64];
+    struct tm tm_info;
+    time_t sec = static_cast<time_t>(usec / 1000000);
+    localtime_r(&sec, &tm_info);
+
+    size_t size = strftime(buffer, 32, "%Y-%m-%d.%T.", &tm_info);
+    snprintf(&buffer[size], 32, "%06" PRIu64, usec % 1000000);
+
+    return std::string(buffer);
+}
+
+/* ts must be NUL terminated */
+static bool parseTimestamp(const char *ts, uint64_t& usec)
+{
+    struct tm tm_info;
+    memset(&tm_info, 0, sizeof(tm_info));
+    const char *rest = strptime(ts, "%Y-%m-%d.%H:%M:%S", &tm_info);
+    if (rest == nullptr || *rest != '.')
+    {
+        return false;
+    }
+
+    tm_info.tm_isdst = -1;
+    time_t sec = mktime(&tm_info);
+    if (sec < 0)
+    {
+        return false;
+    }
+
+    usec = static_cast<uint64_t>(sec) * 1000000 + strtoull(rest + 1, nullptr, 10);
+    return true;
+}
+
+bool swss::parseRecTimestamp(const std::string& ts, uint64_t& usec)
+{
+    return parseTimestamp(ts.c_str(), usec);
+}
+
+std::string swss::formatRecTextLine(const RecEntry& entry)
+{
+    std::string s = formatRecTimestamp(entry.usec) + "|" + entry.prefix + kfvKey(entry.tuple) + "|" + kfvOp(entry.tuple);
+    for (const auto& fv : kfvFieldsValues(entry.tuple))
+    {
+        s += "|" + fvField(fv) + ":" + fvValue(fv);
+    }
+    return s;
+}
+
+bool swss::parseRecTextLine(boost::string_view line, RecEntry& entry)
+{
+    const size_t npos = boost::string_view::npos;
+
+    size_t tsEnd = line.find('|');
+    char ts[64];
+    if (tsEnd == npos || tsEnd >= sizeof(ts))
+    {
+        return false;
+    }
+    memcpy(ts, line.data(), tsEnd);
+    ts[tsEnd] = '\0';
+    if (!parseTimestamp(ts, entry.usec))
+    {
+        return false;
+    }
+
+    /*
+     * Config DB tables use '|' as key separator as well, so the operation
+     * token is searched for instead of splitting at fixed positions. The key
+     * spans at least one token.
+     */
+    size_t keyStart = tsEnd + 1;
+    size_t tokStart = line.find('|', keyStart);
+    boost::string_view op;
+    while (tokStart != npos)
+    {
+        tokStart++;
+        size_t tokEnd = line.find('|', tokStart);
+        boost::string_view tok = line.substr(tokStart, tokEnd == npos ? npos : tokEnd - tokStart);
+        if (tok == SET_COMMAND || tok == DEL_COMMAND)
+        {
+            op = tok;
+            break;
+        }
+        tokStart = tokEnd;
+    }
+    if (op.empty())
+    {
+        return false;
+    }
+
+    boost::string_view key = line.substr(keyStart, tokStart - 1 - keyStart);
+    size_t sep = key.find_first_of(":|");
+    if (sep == npos)
+    {
+        return false;
+    }
+
+    /* field:value tokens, a trailing separator adds no field */
+    std::vector<FieldValueTuple> fvs;
+    size_t fvStart = tokStart + op.size() + 1;
+    while (fvStart < line.size())
+    {
+        size_t fvEnd = line.find('|', fvStart);
+        if (fvEnd == npos)
+        {
+            fvEnd = line.size();
+        }
+        boost::string_view fv = line.substr(fvStart, fvEnd - fvStart);
+        size_t colon = fv.find(':');
+        if (colon == npos)
+        {
+            fvs.emplace_back(fv.to_string(), "");
+        }
+        else
+        {
+            fvs.emplace_back(fv.substr(0, colon).to_string(), fv.substr(colon + 1).to_string());
+        }
+        fvStart = fvEnd + 1;
+    }
+
+    entry.prefix = key.substr(0, sep + 1).to_string();
+    entry.tuple = KeyOpFieldsValuesTuple(key.substr(sep + 1).to_string(), op.to_string(), std::move(fvs));
+    return true;
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/utility/string_view.hpp>
+
+#include "table.h"
+
+namespace swss {
+
+/*
+ * Binary swss.rec format
+ *
+ * The file is a sequence of segments. A segment starts with the 8 byte magic
+ * "SWSSRECB" and a version byte, followed by compressed blocks and, when the
+ * writer was closed cleanly, an index footer:
+ *
+ *   block:  'B' raw_len comp_len first_usec last_usec count payload[comp_len]
+ *   footer: 'I' count (offset first_usec last_usec count)* footer_offset(u64) "SWSSRECI"
+ *
+ * All integers but footer_offset are LEB128 varints. The payload is zlib
+ * compressed and holds count records:
+ *
+ *   usec_delta prefix_ref [prefix] op [op_str] key fv_count (field value)*
+ *
+ * usec_delta is relative to first_usec of the block. Table prefixes ("TABLE:")
+ * are interned per block, so every block can be decoded on its own:
+ * prefix_ref equal to the number of prefixes seen so far in the block
+ * introduces a new prefix. op is 0 for SET, 1 for DEL and 2 for any other
+ * operation, which is then stored as a string. Strings are a varint length
+ * followed by the bytes.
+ */
+
+struct RecEntry
+{
+    uint64_t usec = 0;
+    std::string prefix;
+    KeyOpFieldsValuesTuple tuple;
+};
+
+struct RecBlockIndex
+{
+    uint64_t offset;
+    uint64_t firstUsec;
+    uint64_t lastUsec;
+    uint64_t count;
+};
+
+class RecBinaryWriter {
+public:
+    static const size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+    /* Oldest entry a block may buffer before it is written out */
+    static const uint64_t MAX_BLOCK_AGE_USEC = 1000000;
+
+    explicit RecBinaryWriter(size_t blockSize = DEFAULT_BLOCK_SIZE);
+    ~RecBinaryWriter();
+
+    /* Appends a new segment to path, or overwrites it when truncate is set */
+    bool open(const std::string& path, bool truncate = false);
+    bool isOpen() const { return m_ofs.is_open(); }
+    void append(uint64_t usec, const std::string& prefix, const KeyOpFieldsValuesTuple& tuple);
+    void append(const RecEntry& entry) { append(entry.usec, entry.prefix, entry.tuple); }
+    bool hasPending() const { return m_count > 0; }
+    /*
+     * Writes out the pending block once its oldest entry is MAX_BLOCK_AGE_USEC
+     * older than usec. Returns the time left until the pending block is due,
+     * 0 when nothing is left pending.
+     */
+    uint64_t flushAged(uint64_t usec);
+    /* Writes out the pending block */
+    void flush();
+    /* Writes out the pending block and the index footer */
+    void close();
+
+private:
+    size_t m_blockSize;
+    std::ofstream m_ofs;
+    std::vector<RecBlockIndex> m_index;
+
+    std::string m_block;
+    std::unordered_map<std::string, uint64_t> m_prefixes;
+    uint64_t m_firstUsec = 0;
+    uint64_t m_lastUsec = 0;
+    uint64_t m_count = 0;
+};
+
+class RecBinaryReader {
+public:
+    bool open(const std::string& path);
+    void close();
+
+    const std::vector<RecBlockIndex>& index() const { return m_index; }
+
+    /* Positions the reader at the first entry recorded at or after usec */
+    void seek(uint64_t usec);
+    /* Returns false at the end of the recording or on a corrupted block */
+    bool next(RecEntry& entry);
+
+    /* Returns true when the file at path starts with the binary magic */
+    static bool isBinary(const std::string& path);
+
+private:
+    bool loadBlock();
+    bool buildIndex(uint64_t size);
+
+    std::ifstream m_ifs;
+    std::vector<RecBlockIndex> m_index;
+    size_t m_nextBlock = 0;
+
+    std::string m_payload;
+    size_t m_pos = 0;
+    uint64_t m_remaining = 0;
+    uint64_t m_firstUsec = 0;
+    /* Entries older than the last seek target are skipped */
+    uint64_t m_seekUsec = 0;
+    std::vector<std::string> m_prefixes;
+};
+
+/* Time stamps of the text format, as written by swss::getTimestamp() */
+std::string formatRecTimestamp(uint64_t usec);
+bool parseRecTimestamp(const std::string& ts, uint64_t& usec);
+
+/*
+ * Conversion between a text swss.rec line and an entry. The line is parsed in
+ * place, so a line of a memory mapped recording needs no copy.
+ */
+std::string formatRecTextLine(const RecEntry& entry);
+bool parseRecTextLine(boost::string_view line, RecEntry& entry);
+
+}
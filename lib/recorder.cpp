@@ -1,6 +1,7 @@
 #include "recorder.h"
 #include "timestamp.h"
 #include "logger.h"
+#include <chrono>
 #include <cstring>
 #include <inttypes.h>
 #include <unistd.h>
@@ -55,6 +56,43 @@ SwSSRec::SwSSRec()
 SwSSRec::~SwSSRec()
 {
     stopAsyncWorker();
+
+    std::lock_guard<std::mutex> lock(m_binaryMutex);
+    m_binaryWriter.close();
+}
+
+void SwSSRec::startRec(bool exit_if_failure)
+{
+    if (!m_binary)
+    {
+        RecWriter::startRec(exit_if_failure);
+        return;
+    }
+
+    if (!isRecord())
+    {
+        return;
+    }
+
+    std::string fname = getLoc() + "/" + getFile();
+    {
+        std::lock_guard<std::mutex> lock(m_binaryMutex);
+        if (!m_binaryWriter.open(fname))
+        {
+            SWSS_LOG_ERROR("%s Recorder: Failed to open recording file %s: error %s", getName().c_str(), fname.c_str(), strerror(errno));
+            if (exit_if_failure)
+            {
+                exit(EXIT_FAILURE);
+            }
+            setRecord(false);
+            return;
+        }
+    }
+    SWSS_LOG_NOTICE("%s Recorder: Binary recording started at %s", getName().c_str(), fname.c_str());
+
+    /* The worker also writes out binary blocks that don't fill up in time */
+    std::lock_guard<std::mutex> stateLock(m_stateMutex);
+    ensureAsyncWorkerLocked();
 }
 
 void SwSSRec::setAsync(bool enabled)
@@ -68,6 +106,13 @@ void SwSSRec::setAsync(bool enabled)
     if (!enabled)
     {
         stopAsyncWorker();
+
+        if (m_binary && isRecord())
+        {
+            /* Restart the worker for the age flush of binary blocks */
+            std::lock_guard<std::mutex> stateLock(m_stateMutex);
+            ensureAsyncWorkerLocked();
+        }
     }
 }
 
@@ -80,8 +125,7 @@ void SwSSRec::recordTupleAsync(const std::string& prefix, const KeyOpFieldsValue
 {
     if (!m_asyncEnabled.load(std::memory_order_relaxed))
     {
-        AsyncSwssRecordEntry entry = {{}, prefix, tuple};
-        record(serialize(entry));
+        writeEntry({{}, prefix, tuple});
         return;
     }
 
@@ -102,8 +146,7 @@ void SwSSRec::recordTupleAsync(const std::string& prefix, const KeyOpFieldsValue
         if (!m_asyncEnabled.load(std::memory_order_relaxed))
         {
             stateLock.unlock();
-            AsyncSwssRecordEntry entry = {{}, prefix, tuple};
-            record(serialize(entry));
+            writeEntry({{}, prefix, tuple});
             return;
         }
 
@@ -123,7 +166,7 @@ void SwSSRec::recordTuplesAsync(const std::string& prefix, const std::deque<KeyO
     {
         for (const auto& entry : entries)
         {
-            record(serialize({{}, prefix, entry}));
+            writeEntry({{}, prefix, entry});
         }
         return;
     }
@@ -144,7 +187,7 @@ void SwSSRec::recordTuplesAsync(const std::string& prefix, const std::deque<KeyO
             stateLock.unlock();
             for (const auto& entry : entries)
             {
-                record(serialize({{}, prefix, entry}));
+                writeEntry({{}, prefix, entry});
             }
             return;
         }
@@ -201,7 +244,7 @@ void SwSSRec::dumpAsyncSignalSafeStats(int fd, int signo) const
 
 void SwSSRec::ensureAsyncWorkerLocked()
 {
-    if (m_workerStarted || !m_asyncEnabled.load(std::memory_order_relaxed))
+    if (m_workerStarted || !(m_asyncEnabled.load(std::memory_order_relaxed) || m_binary))
     {
         return;
     }
@@ -288,16 +331,104 @@ std::string SwSSRec::serialize(const AsyncSwssRecordEntry& entry) const
     return s;
 }
 
+void SwSSRec::writeEntry(const AsyncSwssRecordEntry& entry)
+{
+    if (!m_binary)
+    {
+        if (entry.received_time.tv_sec == 0)
+        {
+            record(serialize(entry));
+        }
+        else
+        {
+            record(formatTimestamp(entry.received_time), serialize(entry));
+        }
+        return;
+    }
+
+    if (!isRecord())
+    {
+        return;
+    }
+
+    struct timeval tv = entry.received_time;
+    if (tv.tv_sec == 0)
+    {
+        gettimeofday(&tv, nullptr);
+    }
+
+    bool blockStarted;
+    {
+        std::lock_guard<std::mutex> lock(m_binaryMutex);
+        if (isRotate())
+        {
+            setRotate(false);
+            m_binaryWriter.close();
+            if (!m_binaryWriter.open(getLoc() + "/" + getFile()))
+            {
+                SWSS_LOG_ERROR("%s Recorder: Failed to reopen recording file: %s", getName().c_str(), strerror(errno));
+                return;
+            }
+            SWSS_LOG_INFO("%s Recorder: LogRotate request handled", getName().c_str());
+        }
+        blockStarted = !m_binaryWriter.hasPending();
+        m_binaryWriter.append(static_cast<uint64_t>(tv.tv_sec) * 1000000 + static_cast<uint64_t>(tv.tv_usec),
+                              entry.prefix, entry.tuple);
+        blockStarted = blockStarted && m_binaryWriter.hasPending();
+    }
+
+    if (blockStarted)
+    {
+        /* Let the worker time the age flush of the new block */
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_binaryBlockStarted = true;
+        }
+        m_signal.notify_one();
+    }
+}
+
+uint64_t SwSSRec::flushAgedBinaryBlock()
+{
+    if (!m_binary)
+    {
+        return 0;
+    }
+
+    struct timeval now;
+    gettimeofday(&now, nullptr);
+
+    std::lock_guard<std::mutex> lock(m_binaryMutex);
+    uint64_t due = m_binaryWriter.flushAged(static_cast<uint64_t>(now.tv_sec) * 1000000 + static_cast<uint64_t>(now.tv_usec));
+
+    /* Bounded, in case the wall clock was set back */
+    return due < RecBinaryWriter::MAX_BLOCK_AGE_USEC ? due : RecBinaryWriter::MAX_BLOCK_AGE_USEC;
+}
+
 void SwSSRec::drain()
 {
+    /* Time left until the pending binary block is due, 0 when there is none */
+    uint64_t flushDue = 0;
+
     while (true)
     {
         std::deque<AsyncSwssRecordEntry> pending;
         {
             std::unique_lock<std::mutex> lock(m_mutex);
-            m_signal.wait(lock, [this]() {
-                return m_shutdown || !m_queue.empty();
-            });
+            auto ready = [this]() {
+                return m_shutdown || !m_queue.empty() || m_binaryBlockStarted;
+            };
+
+            /* Only a pending binary block wakes the worker up on its own */
+            if (flushDue == 0)
+            {
+                m_signal.wait(lock, ready);
+            }
+            else
+            {
+                m_signal.wait_for(lock, std::chrono::microseconds(flushDue), ready);
+            }
+            m_binaryBlockStarted = false;
 
             if (m_shutdown && m_queue.empty())
             {
@@ -309,9 +440,11 @@ void SwSSRec::drain()
 
         for (const auto& entry : pending)
         {
-            record(formatTimestamp(entry.received_time), serialize(entry));
+            writeEntry(entry);
             onDrain();
         }
+
+        flushDue = flushAgedBinaryBlock();
     }
 }
 
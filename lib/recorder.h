@@ -14,6 +14,7 @@
 #include <sys/time.h>
 
 #include "table.h"
+#include "recformat.h"
 
 namespace swss {
 
@@ -46,7 +47,7 @@ class RecWriter : public RecBase {
 public:
     RecWriter() = default;
     virtual ~RecWriter();
-    void startRec(bool exit_if_failure);
+    virtual void startRec(bool exit_if_failure);
     void record(const std::string& val);
     void record(const std::string& timestamp, const std::string& val);
 
@@ -76,6 +77,12 @@ public:
     SwSSRec();
     ~SwSSRec() override;
 
+    void startRec(bool exit_if_failure) override;
+
+    /* Record in the compressed binary format of recformat.h instead of text */
+    void setBinary(bool enabled) { m_binary = enabled; }
+    bool isBinary() const { return m_binary; }
+
     void setAsync(bool enabled);
     bool isAsyncEnabled() const;
     void recordTupleAsync(const std::string& prefix, const KeyOpFieldsValuesTuple& tuple);
@@ -97,6 +104,8 @@ private:
     void onDrain();
     std::string formatTimestamp(const struct timeval& tv) const;
     std::string serialize(const AsyncSwssRecordEntry& entry) const;
+    void writeEntry(const AsyncSwssRecordEntry& entry);
+    uint64_t flushAgedBinaryBlock();
     void drain();
 
     static size_t appendLiteral(char *buffer, size_t pos, const char *text, size_t capacity);
@@ -113,7 +122,12 @@ private:
     std::mutex m_mutex;
     std::condition_variable m_signal;
     std::deque<AsyncSwssRecordEntry> m_queue;
+    bool m_binaryBlockStarted = false; // A binary block waits for its age flush, guarded by m_mutex.
     std::thread m_worker;
+
+    bool m_binary = false;
+    std::mutex m_binaryMutex; // Main and ring thread both record in sync mode.
+    RecBinaryWriter m_binaryWriter;
 };
 
 /* Record Handler for Response Publisher Class */
@@ -1,4 +1,5 @@
 #include <string>
+#include <inttypes.h>
 #include <netinet/in.h>
 #include <netlink/route/link.h>
 #include <netlink/route/neighbour.h>
@@ -18,6 +19,7 @@
 #include <linux/neighbour.h>
 
 using namespace std;
+using namespace std::chrono;
 using namespace swss;
 
 #define VRF_PREFIX              "Vrf"
@@ -25,8 +27,8 @@ using namespace swss;
 #define MAX_ROUTE_DEL_RETRY     100
 
 NeighSync::NeighSync(RedisPipeline *pipelineAppDB, DBConnector *stateDb, DBConnector *cfgDb, DBConnector *appDb) :
-    m_neighTable(pipelineAppDB, APP_NEIGH_TABLE_NAME),
-    m_routeTable(pipelineAppDB, APP_ROUTE_TABLE_NAME, false),
+    m_neighTable(pipelineAppDB, APP_NEIGH_TABLE_NAME, true),
+    m_routeTable(pipelineAppDB, APP_ROUTE_TABLE_NAME, true),
     m_routeCheckTable(appDb, APP_ROUTE_TABLE_NAME),
     m_stateNeighRestoreTable(stateDb, STATE_NEIGH_RESTORE_TABLE_NAME),
     m_cfgInterfaceTable(cfgDb, CFG_INTF_TABLE_NAME),
@@ -62,6 +64,14 @@ NeighSync::NeighSync(RedisPipeline *pipelineAppDB, DBConnector *stateDb, DBConne
         m_nl_sock = NULL;
         SWSS_LOG_THROW("Failed to allocate link cache");
     }
+
+    /* Fill the CONFIG_DB caches before the first neighbor event is handled */
+    processCfgPeerSwitch();
+    processCfgInterface(m_cfgInterfaceTable, "Ethernet");
+    processCfgInterface(m_cfgLagInterfaceTable, "PortChannel");
+    processCfgInterface(m_cfgVlanInterfaceTable, "Vlan");
+
+    m_statsStart = steady_clock::now();
 }
 
 NeighSync::~NeighSync()
@@ -133,6 +143,145 @@ void NeighSync::processCfgEvpnNvo()
     }
 }
 
+void NeighSync::addCfgSelectables(Select &s)
+{
+    s.addSelectable(&m_cfgPeerSwitchTable);
+    s.addSelectable(&m_cfgInterfaceTable);
+    s.addSelectable(&m_cfgLagInterfaceTable);
+    s.addSelectable(&m_cfgVlanInterfaceTable);
+}
+
+/*
+ * Update the CONFIG_DB caches
+ * @arg selectable        The selectable returned by Select
+ *
+ * Return true if the selectable is one of the cached CONFIG_DB tables.
+ */
+bool NeighSync::processCfgTable(Selectable *selectable)
+{
+    if (selectable == &m_cfgPeerSwitchTable)
+    {
+        processCfgPeerSwitch();
+    }
+    else if (selectable == &m_cfgInterfaceTable)
+    {
+        processCfgInterface(m_cfgInterfaceTable, "Ethernet");
+    }
+    else if (selectable == &m_cfgLagInterfaceTable)
+    {
+        processCfgInterface(m_cfgLagInterfaceTable, "PortChannel");
+    }
+    else if (selectable == &m_cfgVlanInterfaceTable)
+    {
+        processCfgInterface(m_cfgVlanInterfaceTable, "Vlan");
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void NeighSync::processCfgPeerSwitch()
+{
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    m_cfgPeerSwitchTable.pops(entries);
+
+    for (const auto &entry : entries)
+    {
+        const std::string &op = kfvOp(entry);
+        if (op == SET_COMMAND)
+        {
+            m_peerSwitches.insert(kfvKey(entry));
+        }
+        else if (op == DEL_COMMAND)
+        {
+            m_peerSwitches.erase(kfvKey(entry));
+        }
+    }
+}
+
+void NeighSync::processCfgInterface(SubscriberStateTable &table, const string &prefix)
+{
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    table.pops(entries);
+
+    for (const auto &entry : entries)
+    {
+        const std::string &key = kfvKey(entry);
+        const std::string &op = kfvOp(entry);
+
+        /* Only the interface entries carry the link local setting, skip the IP address ones */
+        if (key.compare(0, prefix.size(), prefix) || key.find('|') != string::npos)
+        {
+            continue;
+        }
+
+        if (op == SET_COMMAND)
+        {
+            const auto &values = kfvFieldsValues(entry);
+            auto it = std::find_if(values.begin(), values.end(), [](const FieldValueTuple& t){ return t.first == "ipv6_use_link_local_only";});
+            m_linkLocalEnabled[key] = (it != values.end() && it->second == "enable");
+        }
+        else if (op == DEL_COMMAND)
+        {
+            m_linkLocalEnabled.erase(key);
+        }
+    }
+}
+
+void NeighSync::flush()
+{
+    for (const auto &hostRoute : m_pendingHostRouteDels)
+    {
+        SWSS_LOG_INFO("Remove host route before adding neighbor %s", hostRoute.c_str());
+        m_routeTable.del(hostRoute);
+    }
+
+    for (const auto &it : m_pendingNeighs)
+    {
+        if (it.second.del)
+        {
+            m_neighTable.del(it.first);
+        }
+        else
+        {
+            m_neighTable.set(it.first, it.second.fvs);
+        }
+    }
+    m_writes += m_pendingNeighs.size();
+
+    m_pendingHostRouteDels.clear();
+    m_pendingNeighs.clear();
+
+    /* The neighbor and route tables share the pipeline */
+    m_neighTable.flush();
+
+    logStats();
+}
+
+void NeighSync::logStats()
+{
+    auto now = steady_clock::now();
+    auto elapsed = duration_cast<seconds>(now - m_statsStart).count();
+    if (elapsed < NEIGHSYNC_STATS_INTERVAL)
+    {
+        return;
+    }
+
+    if (m_events > 0)
+    {
+        SWSS_LOG_NOTICE("%.1f neighbor events/s, %" PRIu64 " updates coalesced into %" PRIu64 " writes, coalesce ratio %.2f",
+                        (double)m_events / (double)elapsed, m_updates, m_writes,
+                        m_writes ? (double)m_updates / (double)m_writes : 0.0);
+    }
+
+    m_events = 0;
+    m_updates = 0;
+    m_writes = 0;
+    m_statsStart = now;
+}
 
 // Check if neighbor table is restored in kernel
 bool NeighSync::isNeighRestoreDone()
@@ -156,14 +305,14 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
     string key;
     string family;
     string intfName;
-    std::vector<std::string> peerSwitchKeys;
-    m_cfgPeerSwitchTable.getKeys(peerSwitchKeys);
-    bool is_dualtor = peerSwitchKeys.size() > 0;
+    bool is_dualtor = !m_peerSwitches.empty();
 
     if ((nlmsg_type != RTM_NEWNEIGH) && (nlmsg_type != RTM_GETNEIGH) &&
         (nlmsg_type != RTM_DELNEIGH))
         return;
 
+    m_events++;
+
     if (rtnl_neigh_get_family(neigh) == AF_INET)
         family = IPV4_NAME;
     else if (rtnl_neigh_get_family(neigh) == AF_INET6)
@@ -322,9 +471,11 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
     }
     else
     {
+        /* Updates are coalesced per key until the next flush */
+        m_updates++;
         if (delete_key == true)
         {
-            m_neighTable.del(key);
+            m_pendingNeighs[key] = { true, {} };
             return;
         }
 
@@ -336,57 +487,29 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
             hostRoute += ":";
             hostRoute += ipStr;
 
-            SWSS_LOG_INFO("Remove host route before adding neighbor %s", hostRoute.c_str());
-            m_routeTable.del(hostRoute);
+            m_pendingHostRouteDels.insert(hostRoute);
         }
 
-        m_neighTable.set(key, fvVector);
+        m_pendingNeighs[key] = { false, fvVector };
     }
 }
 
 /* To check the ipv6 link local is enabled on a given port */
 bool NeighSync::isLinkLocalEnabled(const string &port)
 {
-    vector<FieldValueTuple> values;
-
-    if (!port.compare(0, strlen("Vlan"), "Vlan"))
-    {
-        if (!m_cfgVlanInterfaceTable.get(port, values))
-        {
-            SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
-            return false;
-        }
-    }
-    else if (!port.compare(0, strlen("PortChannel"), "PortChannel"))
-    {
-        if (!m_cfgLagInterfaceTable.get(port, values))
-        {
-            SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
-            return false;
-        }
-    }
-    else if (!port.compare(0, strlen("Ethernet"), "Ethernet"))
-    {
-        if (!m_cfgInterfaceTable.get(port, values))
-        {
-            SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
-            return false;
-        }
-    }
-    else
+    if (port.compare(0, strlen("Vlan"), "Vlan") &&
+        port.compare(0, strlen("PortChannel"), "PortChannel") &&
+        port.compare(0, strlen("Ethernet"), "Ethernet"))
     {
         SWSS_LOG_INFO("IPv6 Link local is not supported for %s ", port.c_str());
         return false;
     }
 
-    auto it = std::find_if(values.begin(), values.end(), [](const FieldValueTuple& t){ return t.first == "ipv6_use_link_local_only";});
-    if (it != values.end())
+    auto it = m_linkLocalEnabled.find(port);
+    if (it != m_linkLocalEnabled.end() && it->second)
     {
-        if (it->second == "enable")
-        {
-            SWSS_LOG_INFO("IPv6 Link local is enabled on %s", port.c_str());
-            return true;
-        }
+        SWSS_LOG_INFO("IPv6 Link local is enabled on %s", port.c_str());
+        return true;
     }
 
     SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
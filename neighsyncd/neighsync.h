@@ -1,9 +1,15 @@
 #ifndef __NEIGHSYNC__
 #define __NEIGHSYNC__
 
+#include <map>
+#include <set>
+#include <chrono>
+#include <unordered_map>
+
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "subscriberstatetable.h"
+#include "select.h"
 #include "netmsg.h"
 #include "warmRestartAssist.h"
 
@@ -17,6 +23,9 @@
  */
 #define RESTORE_NEIGH_WAIT_TIME_OUT 180
 
+/* The interval (in seconds) at which the neighbor event counters are logged */
+#define NEIGHSYNC_STATS_INTERVAL 60
+
 namespace swss {
 
 class NeighSync : public NetMsg
@@ -46,18 +55,48 @@ public:
 
     void processCfgEvpnNvo();
 
+    /* CONFIG_DB tables cached by neighsyncd, instead of being read on every event */
+    void addCfgSelectables(Select &s);
+    bool processCfgTable(Selectable *selectable);
+
+    /* Write the neighbor updates coalesced since the last flush in one pipeline flush */
+    void flush();
+
 private:
-    Table m_stateNeighRestoreTable, m_cfgPeerSwitchTable, m_routeCheckTable;
+    struct PendingNeigh
+    {
+        bool del;
+        std::vector<FieldValueTuple> fvs;
+    };
+
+    Table m_stateNeighRestoreTable, m_routeCheckTable;
     ProducerStateTable m_neighTable;
     ProducerStateTable m_routeTable;
     SubscriberStateTable m_cfgEvpnNvoTable;
+    SubscriberStateTable m_cfgPeerSwitchTable;
     struct nl_cache    *m_link_cache;
     struct nl_sock     *m_nl_sock;
     AppRestartAssist  *m_AppRestartAssist;
-    Table m_cfgVlanInterfaceTable, m_cfgLagInterfaceTable, m_cfgInterfaceTable;
+    SubscriberStateTable m_cfgVlanInterfaceTable, m_cfgLagInterfaceTable, m_cfgInterfaceTable;
     bool m_isEvpnNvoExist = false;
 
+    std::set<std::string> m_peerSwitches;
+    /* ipv6_use_link_local_only setting of the configured interfaces */
+    std::unordered_map<std::string, bool> m_linkLocalEnabled;
+
+    std::map<std::string, PendingNeigh> m_pendingNeighs;
+    std::set<std::string> m_pendingHostRouteDels;
+
+    /* Counters for the periodic stats log */
+    uint64_t m_events = 0;
+    uint64_t m_updates = 0;
+    uint64_t m_writes = 0;
+    std::chrono::steady_clock::time_point m_statsStart;
+
     bool isLinkLocalEnabled(const std::string &port);
+    void processCfgPeerSwitch();
+    void processCfgInterface(SubscriberStateTable &table, const std::string &prefix);
+    void logStats();
 };
 
 }
@@ -68,6 +68,7 @@ int main(int argc, char **argv)
 
             s.addSelectable(&netlink);
             s.addSelectable(sync.getCfgEvpnNvoTable());
+            sync.addCfgSelectables(s);
             while (true)
             {
                 Selectable *temps;
@@ -77,6 +78,10 @@ int main(int argc, char **argv)
                     sync.processCfgEvpnNvo();
                     continue;
                 }
+                if (sync.processCfgTable(temps))
+                {
+                    continue;
+                }
                 /*
                  * If warmstart is in progress, we check the reconcile timer,
                  * if timer expired, we stop the timer and start the reconcile process
@@ -89,6 +94,9 @@ int main(int argc, char **argv)
                         sync.getRestartAssist()->reconcile();
                     }
                 }
+
+                /* Write the neighbor updates coalesced while reading netlink */
+                sync.flush();
             }
         }
         catch (const std::exception& e)
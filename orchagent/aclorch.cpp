@@ -3,6 +3,7 @@
 #include <unordered_map>
 #include <algorithm>
 #include <sstream>
+#include <typeinfo>
 #include "aclorch.h"
 #include "logger.h"
 #include "schema.h"
@@ -14,6 +15,7 @@
 #include "sai_serialize.h"
 #include "directory.h"
 #include "saihelper.h"
+#include "bulker.h"
 
 using namespace std;
 using namespace swss;
@@ -29,6 +31,7 @@ extern sai_acl_api_t*    sai_acl_api;
 extern sai_port_api_t*   sai_port_api;
 extern sai_switch_api_t* sai_switch_api;
 extern sai_object_id_t   gSwitchId;
+extern size_t            gMaxBulkSize;
 extern PortsOrch*        gPortsOrch;
 extern CrmOrch *gCrmOrch;
 extern SwitchOrch *gSwitchOrch;
@@ -1271,16 +1274,54 @@ bool AclRule::create()
     return true;
 }
 
+bool AclRule::prepareCreate(vector<sai_attribute_t>& rule_attrs)
+{
+    if (m_createCounter && !createCounter())
+    {
+        return false;
+    }
+
+    if (!getRuleAttrs(rule_attrs))
+    {
+        removeCounter();
+        return false;
+    }
+
+    return true;
+}
+
+bool AclRule::completeCreate(sai_object_id_t rule_oid, sai_status_t status)
+{
+    if (!onRuleCreated(rule_oid, status))
+    {
+        removeCounter();
+        return false;
+    }
+
+    return true;
+}
+
 bool AclRule::createRule()
 {
     SWSS_LOG_ENTER();
 
     vector<sai_attribute_t> rule_attrs;
-    sai_object_id_t range_objects[2];
-    sai_object_list_t range_object_list = {0, range_objects};
+
+    if (!getRuleAttrs(rule_attrs))
+    {
+        return false;
+    }
+
+    sai_status_t status = sai_acl_api->create_acl_entry(&m_ruleOid, gSwitchId, (uint32_t)rule_attrs.size(), rule_attrs.data());
+
+    return onRuleCreated(m_ruleOid, status);
+}
+
+bool AclRule::getRuleAttrs(vector<sai_attribute_t>& rule_attrs)
+{
+    SWSS_LOG_ENTER();
 
     sai_attribute_t attr;
-    sai_status_t status;
 
     // store table oid this rule belongs to
     attr.id = SAI_ACL_ENTRY_ATTR_TABLE_ID;
@@ -1304,6 +1345,9 @@ bool AclRule::createRule()
         rule_attrs.push_back(attr);
     }
 
+    // range oids are kept in the rule, the attribute list may be used
+    // after this call returns when the entry is created in bulk
+    m_rangeOids.clear();
     if (!m_rangeConfig.empty())
     {
         for (const auto& rangeConfig: m_rangeConfig)
@@ -1314,17 +1358,19 @@ bool AclRule::createRule()
             if (!range)
             {
                 // release already created range if any
-                AclRange::remove(range_objects, range_object_list.count);
+                AclRange::remove(m_rangeOids.data(), (int)m_rangeOids.size());
+                m_rangeOids.clear();
                 return false;
             }
 
             m_ranges.push_back(range);
-            range_objects[range_object_list.count++] = range->getOid();
+            m_rangeOids.push_back(range->getOid());
         }
 
         attr.id = SAI_ACL_ENTRY_ATTR_FIELD_ACL_RANGE_TYPE;
         attr.value.aclfield.enable = true;
-        attr.value.aclfield.data.objlist = range_object_list;
+        attr.value.aclfield.data.objlist.count = (uint32_t)m_rangeOids.size();
+        attr.value.aclfield.data.objlist.list = m_rangeOids.data();
         rule_attrs.push_back(attr);
     }
 
@@ -1342,7 +1388,13 @@ bool AclRule::createRule()
         rule_attrs.push_back(attr);
     }
 
-    status = sai_acl_api->create_acl_entry(&m_ruleOid, gSwitchId, (uint32_t)rule_attrs.size(), rule_attrs.data());
+    return true;
+}
+
+bool AclRule::onRuleCreated(sai_object_id_t rule_oid, sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
     m_lastSaiStatus = status;
     if (status != SAI_STATUS_SUCCESS)
     {
@@ -1353,16 +1405,16 @@ bool AclRule::createRule()
         }
         SWSS_LOG_ERROR("Failed to create ACL rule %s, rv:%d",
                 m_id.c_str(), status);
-        AclRange::remove(range_objects, range_object_list.count);
+        AclRange::remove(m_rangeOids.data(), (int)m_rangeOids.size());
+        m_rangeOids.clear();
         decreaseNextHopRefCount();
+        return false;
     }
 
-    if (status == SAI_STATUS_SUCCESS)
-    {
-        gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, m_pTable->getOid());
-    }
+    m_ruleOid = rule_oid;
+    gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, m_pTable->getOid());
 
-    return (status == SAI_STATUS_SUCCESS);
+    return true;
 }
 
 void AclRule::decreaseNextHopRefCount()
@@ -1550,32 +1602,41 @@ bool AclRule::updatePriority(const AclRule& updatedRule)
     return true;
 }
 
-bool AclRule::updateMatches(const AclRule& updatedRule)
+// Diff of the match or action attributes of two rules. Changed holds the
+// new and updated attributes, disabled the ones the updated rule dropped.
+static void diffAclEntryAttrs(
+    const map<sai_acl_entry_attr_t, SaiAttrWrapper>& current,
+    const map<sai_acl_entry_attr_t, SaiAttrWrapper>& updated,
+    vector<pair<sai_acl_entry_attr_t, SaiAttrWrapper>>& changed,
+    vector<pair<sai_acl_entry_attr_t, SaiAttrWrapper>>& disabled)
 {
-    vector<pair<sai_acl_entry_attr_t, SaiAttrWrapper>> matchesUpdated;
-    vector<pair<sai_acl_entry_attr_t, SaiAttrWrapper>> matchesDisabled;
-
-    // Diff by value to get new matches and updated matches
+    // Diff by value to get new and updated attributes
     // in a single set_difference pass.
     set_difference(
-        updatedRule.m_matches.begin(),
-        updatedRule.m_matches.end(),
-        m_matches.begin(), m_matches.end(),
-        back_inserter(matchesUpdated)
+        updated.begin(), updated.end(),
+        current.begin(), current.end(),
+        back_inserter(changed)
     );
 
-    // Diff by key only to get delete matches. Assuming that
-    // deleted matches mean setting a match attribute to disabled state.
+    // Diff by key only to get deleted attributes. Assuming that
+    // deleted attributes mean setting an attribute to disabled state.
     set_difference(
-        m_matches.begin(), m_matches.end(),
-        updatedRule.m_matches.begin(),
-        updatedRule.m_matches.end(),
-        back_inserter(matchesDisabled),
-        [](auto& oldMatch, auto& newMatch)
+        current.begin(), current.end(),
+        updated.begin(), updated.end(),
+        back_inserter(disabled),
+        [](auto& oldAttr, auto& newAttr)
         {
-            return oldMatch.first < newMatch.first;
+            return oldAttr.first < newAttr.first;
         }
     );
+}
+
+bool AclRule::updateMatches(const AclRule& updatedRule)
+{
+    vector<pair<sai_acl_entry_attr_t, SaiAttrWrapper>> matchesUpdated;
+    vector<pair<sai_acl_entry_attr_t, SaiAttrWrapper>> matchesDisabled;
+
+    diffAclEntryAttrs(m_matches, updatedRule.m_matches, matchesUpdated, matchesDisabled);
 
     for (const auto& attrPair: matchesDisabled)
     {
@@ -1606,27 +1667,7 @@ bool AclRule::updateActions(const AclRule& updatedRule)
     vector<pair<sai_acl_entry_attr_t, SaiAttrWrapper>> actionsUpdated;
     vector<pair<sai_acl_entry_attr_t, SaiAttrWrapper>> actionsDisabled;
 
-    // Diff by value to get new action and updated actions
-    // in a single set_difference pass.
-    set_difference(
-        updatedRule.m_actions.begin(),
-        updatedRule.m_actions.end(),
-        m_actions.begin(), m_actions.end(),
-        back_inserter(actionsUpdated)
-    );
-
-    // Diff by key only to get delete actions. Assuming that
-    // action matches mean setting a action attribute to disabled state.
-    set_difference(
-        m_actions.begin(), m_actions.end(),
-        updatedRule.m_actions.begin(),
-        updatedRule.m_actions.end(),
-        back_inserter(actionsDisabled),
-        [](auto& oldAction, auto& newAction)
-        {
-            return oldAction.first < newAction.first;
-        }
-    );
+    diffAclEntryAttrs(m_actions, updatedRule.m_actions, actionsUpdated, actionsDisabled);
 
     for (const auto& attrPair: actionsDisabled)
     {
@@ -1652,6 +1693,99 @@ bool AclRule::updateActions(const AclRule& updatedRule)
     return true;
 }
 
+bool AclRule::hasRedirectTarget() const
+{
+    return !m_redirect_target_next_hop.empty() ||
+           !m_redirect_target_next_hop_group.empty() ||
+           m_redirect_target_tun_nh.oid != SAI_NULL_OBJECT_ID;
+}
+
+bool AclRule::canUpdateInPlace(const AclRule& updatedRule) const
+{
+    // Mirror and DTel entries depend on session state, not only on config
+    if (m_ruleOid == SAI_NULL_OBJECT_ID || !isBulkCreateSupported() || typeid(*this) != typeid(updatedRule))
+    {
+        return false;
+    }
+
+    // Ranges are shared objects referenced by the entry and redirect
+    // targets hold next hop references, a change of either is applied by
+    // creating the entry anew
+    if (m_rangeConfig.size() != updatedRule.m_rangeConfig.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < m_rangeConfig.size(); i++)
+    {
+        const auto& cur = m_rangeConfig[i];
+        const auto& upd = updatedRule.m_rangeConfig[i];
+        if (cur.rangeType != upd.rangeType || cur.min != upd.min || cur.max != upd.max)
+        {
+            return false;
+        }
+    }
+
+    return !hasRedirectTarget() && !updatedRule.hasRedirectTarget();
+}
+
+bool AclRule::prepareUpdate(const AclRule& updatedRule, vector<SaiAttrWrapper>& attrs)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_createCounter != updatedRule.m_createCounter && !updateCounter(updatedRule))
+    {
+        return false;
+    }
+
+    sai_attribute_t attr;
+
+    if (m_priority != updatedRule.m_priority)
+    {
+        attr.id = SAI_ACL_ENTRY_ATTR_PRIORITY;
+        attr.value.u32 = updatedRule.m_priority;
+        attrs.emplace_back(SAI_OBJECT_TYPE_ACL_ENTRY, attr);
+    }
+
+    vector<pair<sai_acl_entry_attr_t, SaiAttrWrapper>> changed;
+    vector<pair<sai_acl_entry_attr_t, SaiAttrWrapper>> disabled;
+
+    diffAclEntryAttrs(m_matches, updatedRule.m_matches, changed, disabled);
+    for (const auto& attrPair: disabled)
+    {
+        attr = attrPair.second.getSaiAttr();
+        attr.value.aclfield.enable = false;
+        attrs.emplace_back(SAI_OBJECT_TYPE_ACL_ENTRY, attr);
+    }
+    for (const auto& attrPair: changed)
+    {
+        attrs.push_back(attrPair.second);
+    }
+
+    changed.clear();
+    disabled.clear();
+
+    diffAclEntryAttrs(m_actions, updatedRule.m_actions, changed, disabled);
+    for (const auto& attrPair: disabled)
+    {
+        attr = attrPair.second.getSaiAttr();
+        attr.value.aclaction.enable = false;
+        attrs.emplace_back(SAI_OBJECT_TYPE_ACL_ENTRY, attr);
+    }
+    for (const auto& attrPair: changed)
+    {
+        attrs.push_back(attrPair.second);
+    }
+
+    return true;
+}
+
+void AclRule::completeUpdate(const AclRule& updatedRule)
+{
+    m_priority = updatedRule.m_priority;
+    m_matches = updatedRule.m_matches;
+    m_actions = updatedRule.m_actions;
+}
+
 bool AclRule::setPriority(const sai_uint32_t &value)
 {
     if (!(value >= m_minPriority && value <= m_maxPriority))
@@ -2075,11 +2209,34 @@ bool AclRulePacket::validateAddAction(string attr_name, string _attr_value)
     return setAction(aclL3ActionLookup[action_str], actionData);
 }
 
+bool AclRulePacket::restoreRedirectTarget()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_redirect_target.empty() || hasRedirectTarget())
+    {
+        return true;
+    }
+
+    sai_object_id_t param_id = getRedirectObjectId(m_redirect_target);
+    if (param_id == SAI_NULL_OBJECT_ID)
+    {
+        return false;
+    }
+
+    sai_acl_action_data_t actionData;
+    actionData.parameter.oid = param_id;
+    actionData.enable = true;
+
+    return setAction(SAI_ACL_ENTRY_ATTR_ACTION_REDIRECT, actionData);
+}
+
 // This method should return sai attribute id of the redirect destination
 sai_object_id_t AclRulePacket::getRedirectObjectId(const string& redirect_value)
 {
 
     string target = redirect_value;
+    m_redirect_target = redirect_value;
 
     // Try to parse physical port and LAG first
     Port port;
@@ -2994,7 +3151,28 @@ bool AclTable::add(shared_ptr<AclRule> newRule)
     auto ruleIter = rules.find(rule_id);
     if (ruleIter != rules.end())
     {
-        // If ACL rule already exists, delete it first
+        // If ACL rule already exists, create the new entry before deleting
+        // the old one so that traffic stays matched during the replacement.
+        bool created = newRule->create();
+        if (!created)
+        {
+            if (!isSaiStatusResourceFull(newRule->getLastSaiStatus()))
+            {
+                SWSS_LOG_ERROR("Failed to create ACL rule %s in table %s",
+                        rule_id.c_str(), id.c_str());
+                return false;
+            }
+
+            // The failed create released the redirect target references,
+            // take them again while the old entry still holds its own
+            if (!newRule->restoreRedirectTarget())
+            {
+                SWSS_LOG_ERROR("Failed to restore redirect target of ACL rule %s in table %s",
+                        rule_id.c_str(), id.c_str());
+                return false;
+            }
+        }
+
         if (ruleIter->second->hasCounter())
         {
             // Deregister the flex counter before deleting the rule
@@ -3007,6 +3185,19 @@ bool AclTable::add(shared_ptr<AclRule> newRule)
             SWSS_LOG_NOTICE("Successfully deleted ACL rule %s in table %s",
                     rule_id.c_str(), id.c_str());
         }
+
+        // No room for both entries, fall back to delete then create
+        if (!created && !newRule->create())
+        {
+            SWSS_LOG_ERROR("Failed to create ACL rule %s in table %s",
+                    rule_id.c_str(), id.c_str());
+            return false;
+        }
+
+        rules[rule_id] = newRule;
+        SWSS_LOG_NOTICE("Successfully replaced ACL rule %s in table %s",
+                rule_id.c_str(), id.c_str());
+        return true;
     }
 
     if (newRule->create())
@@ -4990,6 +5181,210 @@ bool AclOrch::addAclRule(shared_ptr<AclRule> newRule, string table_id)
     return status;
 }
 
+bool AclOrch::isBulkAddAclRule(const shared_ptr<AclRule>& rule, const string& table_id)
+{
+    // Rules that replace an existing one, need the egress set DSCP companion
+    // rule or create their entry on mirror/DTel session state keep the
+    // one by one path of addAclRule()
+    if (!sai_acl_api->create_acl_entries || !rule->isBulkCreateSupported() || isUsingEgrSetDscp(table_id))
+    {
+        return false;
+    }
+
+    sai_object_id_t table_oid = getTableById(table_id);
+    if (table_oid == SAI_NULL_OBJECT_ID)
+    {
+        return false;
+    }
+
+    const auto& rules = m_AclTables[table_oid].rules;
+    return rules.find(rule->getId()) == rules.end();
+}
+
+vector<bool> AclOrch::addAclRulesBulk(const vector<pair<string, shared_ptr<AclRule>>>& newRules)
+{
+    SWSS_LOG_ENTER();
+
+    size_t count = newRules.size();
+    vector<bool> results(count, false);
+    vector<bool> prepared(count, false);
+    vector<vector<sai_attribute_t>> rule_attrs(count);
+    vector<sai_object_id_t> rule_oids(count, SAI_NULL_OBJECT_ID);
+
+    ObjectBulker<sai_acl_api_t> bulker(sai_acl_api, gSwitchId, gMaxBulkSize,
+                                       (sai_object_type_extensions_t)SAI_OBJECT_TYPE_ACL_ENTRY);
+
+    // Counters and ranges come first, the entries reference them
+    for (size_t i = 0; i < count; i++)
+    {
+        const auto& table_id = newRules[i].first;
+        const auto& rule = newRules[i].second;
+
+        if (!rule->prepareCreate(rule_attrs[i]))
+        {
+            SWSS_LOG_ERROR("Failed to create ACL rule %s in table %s",
+                    rule->getId().c_str(), table_id.c_str());
+            continue;
+        }
+
+        prepared[i] = true;
+        bulker.create_entry(&rule_oids[i], (uint32_t)rule_attrs[i].size(), rule_attrs[i].data());
+    }
+
+    bulker.flush();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!prepared[i])
+        {
+            continue;
+        }
+
+        const auto& table_id = newRules[i].first;
+        const auto& rule = newRules[i].second;
+        sai_status_t status = SAI_STATUS_SUCCESS;
+
+        // The bulk call stops on the first error and does not report a
+        // per entry status for the ones it did not create, redo those one
+        // by one so that the rule gets the status of its own create
+        if (rule_oids[i] == SAI_NULL_OBJECT_ID)
+        {
+            status = sai_acl_api->create_acl_entry(&rule_oids[i], gSwitchId,
+                    (uint32_t)rule_attrs[i].size(), rule_attrs[i].data());
+        }
+
+        if (!rule->completeCreate(rule_oids[i], status))
+        {
+            SWSS_LOG_ERROR("Failed to create ACL rule %s in table %s",
+                    rule->getId().c_str(), table_id.c_str());
+            continue;
+        }
+
+        m_AclTables[getTableById(table_id)].rules[rule->getId()] = rule;
+        SWSS_LOG_NOTICE("Successfully created ACL rule %s in table %s",
+                rule->getId().c_str(), table_id.c_str());
+
+        if (rule->hasCounter())
+        {
+            registerFlexCounter(*rule);
+        }
+
+        results[i] = true;
+    }
+
+    return results;
+}
+
+bool AclOrch::isDeltaUpdateAclRule(const shared_ptr<AclRule>& rule, const string& table_id)
+{
+    // The egress set DSCP companion rule is replaced together with the rule
+    if (isUsingEgrSetDscp(table_id))
+    {
+        return false;
+    }
+
+    auto current = getAclRule(table_id, rule->getId());
+    return current && current->canUpdateInPlace(*rule);
+}
+
+vector<bool> AclOrch::updateAclRulesBulk(const vector<pair<string, shared_ptr<AclRule>>>& updatedRules)
+{
+    SWSS_LOG_ENTER();
+
+    size_t count = updatedRules.size();
+    vector<bool> results(count, true);
+    vector<AclRule*> currentRules(count);
+    vector<vector<SaiAttrWrapper>> rule_attrs(count);
+
+    // Set operations grouped by attribute id, so that a change of the same
+    // match or action across many rules goes to the SAI in one bulk call.
+    // A rule has at most one operation per group.
+    map<sai_attr_id_t, vector<pair<size_t, const sai_attribute_t*>>> attrGroups;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const auto& table_id = updatedRules[i].first;
+        const auto& rule = updatedRules[i].second;
+
+        currentRules[i] = getAclRule(table_id, rule->getId());
+        if (!currentRules[i]->prepareUpdate(*rule, rule_attrs[i]))
+        {
+            results[i] = false;
+            continue;
+        }
+
+        for (const auto& attr: rule_attrs[i])
+        {
+            attrGroups[attr.getAttrId()].emplace_back(i, &attr.getSaiAttr());
+        }
+    }
+
+    for (const auto& group: attrGroups)
+    {
+        const auto& ops = group.second;
+        for (size_t begin = 0; begin < ops.size(); begin += gMaxBulkSize)
+        {
+            size_t end = min(begin + gMaxBulkSize, ops.size());
+            vector<sai_object_id_t> oids;
+            vector<sai_attribute_t> attrs;
+            vector<sai_status_t> statuses(end - begin, SAI_STATUS_NOT_EXECUTED);
+
+            for (size_t j = begin; j < end; j++)
+            {
+                oids.push_back(currentRules[ops[j].first]->getOid());
+                attrs.push_back(*ops[j].second);
+            }
+
+            if (sai_acl_api->set_acl_entries_attribute)
+            {
+                sai_acl_api->set_acl_entries_attribute((uint32_t)oids.size(), oids.data(), attrs.data(),
+                        SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+            }
+            else
+            {
+                for (size_t j = 0; j < oids.size(); j++)
+                {
+                    statuses[j] = sai_acl_api->set_acl_entry_attribute(oids[j], &attrs[j]);
+                }
+            }
+
+            for (size_t j = begin; j < end; j++)
+            {
+                if (statuses[j - begin] != SAI_STATUS_SUCCESS)
+                {
+                    const auto& rule = updatedRules[ops[j].first].second;
+                    SWSS_LOG_ERROR("Failed to update attribute %s on ACL rule %s in ACL table %s: %s",
+                            getAttributeIdName(SAI_OBJECT_TYPE_ACL_ENTRY, group.first).c_str(),
+                            rule->getId().c_str(), updatedRules[ops[j].first].first.c_str(),
+                            sai_serialize_status(statuses[j - begin]).c_str());
+                    results[ops[j].first] = false;
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const auto& table_id = updatedRules[i].first;
+        const auto& rule = updatedRules[i].second;
+
+        if (results[i])
+        {
+            currentRules[i]->completeUpdate(*rule);
+            SWSS_LOG_NOTICE("Successfully updated ACL rule %s in table %s",
+                    rule->getId().c_str(), table_id.c_str());
+            continue;
+        }
+
+        // The entry may now be partly updated, replace it as a whole
+        SWSS_LOG_WARN("Replacing ACL rule %s in table %s as it could not be updated in place",
+                rule->getId().c_str(), table_id.c_str());
+        results[i] = addAclRule(rule, table_id);
+    }
+
+    return results;
+}
+
 bool AclOrch::removeAclRule(string table_id, string rule_id)
 {
     string key = table_id + ":" + rule_id;
@@ -5522,6 +5917,42 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    // Outcome of a rule add, returns the next task to process
+    auto onAclRuleAdded = [&](decltype(consumer.m_toSync.begin()) it, const shared_ptr<AclRule>& newRule,
+                              const string& table_id, const string& rule_id, bool added)
+    {
+        if (added)
+        {
+            setAclRuleStatus(table_id, rule_id, AclObjectStatus::ACTIVE);
+            return consumer.m_toSync.erase(it);
+        }
+        else if (isSaiStatusResourceFull(newRule->getLastSaiStatus()))
+        {
+            /* Park resource-exhaustion failures in the retry cache.
+             * They will be re-queued when resources are freed (i.e.,
+             * when an ACL rule is successfully removed from this table). */
+            SWSS_LOG_WARN("ACL rule %s in table %s failed due to resource exhaustion, parking for retry",
+                    rule_id.c_str(), table_id.c_str());
+            auto cst = make_constraint(RETRY_CST_SAI_RESOURCE, table_id);
+            if (consumer.addToRetry(it->second, cst))
+            {
+                setAclRuleStatus(table_id, rule_id, AclObjectStatus::PENDING_CREATION);
+                return consumer.m_toSync.erase(it);
+            }
+            SWSS_LOG_ERROR("Failed to park ACL rule %s in table %s in retry cache",
+                    rule_id.c_str(), table_id.c_str());
+        }
+        setAclRuleStatus(table_id, rule_id, AclObjectStatus::PENDING_CREATION);
+        return ++it;
+    };
+
+    // New rules of this drain cycle that are created together, see addAclRulesBulk(),
+    // and existing rules that are updated together, see updateAclRulesBulk()
+    vector<decltype(consumer.m_toSync.begin())> bulkTasks;
+    vector<pair<string, shared_ptr<AclRule>>> bulkRules;
+    vector<decltype(consumer.m_toSync.begin())> updateTasks;
+    vector<pair<string, shared_ptr<AclRule>>> updateRules;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -5582,7 +6013,7 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
             {
                 SWSS_LOG_ERROR("Error while creating ACL rule %s: %s", rule_id.c_str(), e.what());
                 it = consumer.m_toSync.erase(it);
-                return;
+                break;
             }
             bool bHasTCPFlag = false;
             bool bHasIPProtocol = false;
@@ -5666,36 +6097,21 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
             // validate and create ACL rule
             if (bAllAttributesOk && newRule->validate())
             {
-                if (addAclRule(newRule, table_id))
+                if (isBulkAddAclRule(newRule, table_id))
                 {
-                    setAclRuleStatus(table_id, rule_id, AclObjectStatus::ACTIVE);
-                    it = consumer.m_toSync.erase(it);
+                    bulkTasks.push_back(it);
+                    bulkRules.emplace_back(table_id, newRule);
+                    it++;
                 }
-                else if (isSaiStatusResourceFull(newRule->getLastSaiStatus()))
+                else if (isDeltaUpdateAclRule(newRule, table_id))
                 {
-                    /* Park resource-exhaustion failures in the retry cache.
-                     * They will be re-queued when resources are freed (i.e.,
-                     * when an ACL rule is successfully removed from this table). */
-                    SWSS_LOG_WARN("ACL rule %s in table %s failed due to resource exhaustion, parking for retry",
-                            rule_id.c_str(), table_id.c_str());
-                    auto cst = make_constraint(RETRY_CST_SAI_RESOURCE, table_id);
-                    if (consumer.addToRetry(it->second, cst))
-                    {
-                        setAclRuleStatus(table_id, rule_id, AclObjectStatus::PENDING_CREATION);
-                        it = consumer.m_toSync.erase(it);
-                    }
-                    else
-                    {
-                        SWSS_LOG_ERROR("Failed to park ACL rule %s in table %s in retry cache",
-                                rule_id.c_str(), table_id.c_str());
-                        setAclRuleStatus(table_id, rule_id, AclObjectStatus::PENDING_CREATION);
-                        it++;
-                    }
+                    updateTasks.push_back(it);
+                    updateRules.emplace_back(table_id, newRule);
+                    it++;
                 }
                 else
                 {
-                    setAclRuleStatus(table_id, rule_id, AclObjectStatus::PENDING_CREATION);
-                    it++;
+                    it = onAclRuleAdded(it, newRule, table_id, rule_id, addAclRule(newRule, table_id));
                 }
             }
             else
@@ -5734,6 +6150,26 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
             SWSS_LOG_ERROR("Unknown operation type %s", op.c_str());
         }
     }
+
+    if (!bulkRules.empty())
+    {
+        auto results = addAclRulesBulk(bulkRules);
+        for (size_t i = 0; i < bulkRules.size(); i++)
+        {
+            const auto& newRule = bulkRules[i].second;
+            onAclRuleAdded(bulkTasks[i], newRule, bulkRules[i].first, newRule->getId(), results[i]);
+        }
+    }
+
+    if (!updateRules.empty())
+    {
+        auto results = updateAclRulesBulk(updateRules);
+        for (size_t i = 0; i < updateRules.size(); i++)
+        {
+            const auto& newRule = updateRules[i].second;
+            onAclRuleAdded(updateTasks[i], newRule, updateRules[i].first, newRule->getId(), results[i]);
+        }
+    }
 }
 
 void AclOrch::doAclTableTypeTask(Consumer &consumer)
@@ -324,6 +324,22 @@ public:
     }
 
     virtual bool create();
+    // create() split in two for bulk creation: prepareCreate() makes the
+    // counter and ranges and fills the entry attributes, completeCreate()
+    // takes the result of the entry create issued by AclOrch
+    virtual bool isBulkCreateSupported() const { return true; }
+    bool prepareCreate(vector<sai_attribute_t>& rule_attrs);
+    bool completeCreate(sai_object_id_t rule_oid, sai_status_t status);
+    // Delta update of the existing entry: prepareUpdate() returns the entry
+    // attributes to set, completeUpdate() takes over the updated rule once
+    // AclOrch has set them
+    bool canUpdateInPlace(const AclRule& updatedRule) const;
+    bool hasRedirectTarget() const;
+    // Takes the redirect target references again after a failed create
+    // released them, so that the rule can be created once more
+    virtual bool restoreRedirectTarget() { return true; }
+    bool prepareUpdate(const AclRule& updatedRule, vector<SaiAttrWrapper>& attrs);
+    void completeUpdate(const AclRule& updatedRule);
     virtual bool update(const AclRule& updatedRule);
     virtual bool remove();
     virtual void onUpdate(SubjectType, void *) = 0;
@@ -355,6 +371,8 @@ public:
 protected:
     virtual bool createCounter();
     virtual bool createRule();
+    bool getRuleAttrs(vector<sai_attribute_t>& rule_attrs);
+    bool onRuleCreated(sai_object_id_t rule_oid, sai_status_t status);
     virtual bool removeCounter();
     virtual bool removeRanges();
     virtual bool removeRule();
@@ -390,6 +408,7 @@ protected:
 
     vector<AclRangeConfig> m_rangeConfig;
     vector<AclRange*> m_ranges;
+    vector<sai_object_id_t> m_rangeOids;
     sai_status_t m_lastSaiStatus = SAI_STATUS_SUCCESS;
 
 private:
@@ -404,9 +423,12 @@ public:
     bool validateAddAction(string attr_name, string attr_value);
     bool validate();
     void onUpdate(SubjectType, void *) override;
+    bool restoreRedirectTarget() override;
 
 protected:
     sai_object_id_t getRedirectObjectId(const string& redirect_param);
+
+    string m_redirect_target;
 };
 
 class AclRuleInnerSrcMacRewrite: public AclRule
@@ -428,6 +450,7 @@ public:
     bool createCounter();
     bool createRule();
     bool removeRule();
+    bool isBulkCreateSupported() const override { return false; }
     void onUpdate(SubjectType, void *) override;
 
     bool activate();
@@ -448,6 +471,7 @@ public:
     bool validate();
     bool createRule();
     bool removeRule();
+    bool isBulkCreateSupported() const override { return false; }
     void onUpdate(SubjectType, void *) override;
 
     bool activate();
@@ -651,6 +675,10 @@ private:
     void doTask(Consumer &consumer);
     void doAclTableTask(Consumer &consumer);
     void doAclRuleTask(Consumer &consumer);
+    bool isBulkAddAclRule(const shared_ptr<AclRule>& rule, const string& table_id);
+    vector<bool> addAclRulesBulk(const vector<pair<string, shared_ptr<AclRule>>>& newRules);
+    bool isDeltaUpdateAclRule(const shared_ptr<AclRule>& rule, const string& table_id);
+    vector<bool> updateAclRulesBulk(const vector<pair<string, shared_ptr<AclRule>>>& updatedRules);
     void doAclTableTypeTask(Consumer &consumer);
     void init(vector<TableConnector>& connectors, PortsOrch *portOrch, MirrorOrch *mirrorOrch, NeighOrch *neighOrch, RouteOrch *routeOrch);
     void initDefaultTableTypes(const string& platform, const string& sub_platform);
@@ -61,6 +61,9 @@ BfdOrch::BfdOrch(DBConnector *db, string tableName, TableConnector stateDbBfdSes
 {
     SWSS_LOG_ENTER();
 
+    m_stateDbPipeline = std::make_unique<swss::RedisPipeline>(stateDbBfdSessionTable.first);
+    m_stateBfdSessionPipeTable = std::make_unique<swss::Table>(m_stateDbPipeline.get(), stateDbBfdSessionTable.second, true);
+
     DBConnector *notificationsDb = new DBConnector("ASIC_DB", 0);
     m_bfdStateNotificationConsumer = new swss::NotificationConsumer(notificationsDb, "NOTIFICATIONS");
     m_bfdStateNotificationConsumer->setOpAllowList({"bfd_session_state_change"});
@@ -220,29 +223,41 @@ void BfdOrch::doTask(Consumer &consumer)
 
         it = consumer.m_toSync.erase(it);
     }
+
+    flush_state_updates();
 }
 
 void BfdOrch::doTask(NotificationConsumer &consumer)
 {
     SWSS_LOG_ENTER();
 
-    std::string op;
-    std::string data;
-    std::vector<swss::FieldValueTuple> values;
-
-    consumer.pop(op, data, values);
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    consumer.pops(entries);
 
     if (&consumer != m_bfdStateNotificationConsumer)
     {
         return;
     }
 
-    if (op == "bfd_session_state_change")
+    /*
+     * A link failure flips many sessions at once. Only the last state of
+     * every session in the burst is applied, in the order the sessions
+     * first changed.
+     */
+    vector<sai_object_id_t> changed;
+    map<sai_object_id_t, sai_bfd_session_state_t> last_state;
+
+    for (auto &entry : entries)
     {
+        if (kfvOp(entry) != "bfd_session_state_change")
+        {
+            continue;
+        }
+
         uint32_t count;
         sai_bfd_session_state_notification_t *bfdSessionState = nullptr;
 
-        sai_deserialize_bfd_session_state_ntf(data, count, &bfdSessionState);
+        sai_deserialize_bfd_session_state_ntf(kfvKey(entry), count, &bfdSessionState);
 
         for (uint32_t i = 0; i < count; i++)
         {
@@ -251,25 +266,41 @@ void BfdOrch::doTask(NotificationConsumer &consumer)
 
             SWSS_LOG_INFO("Get BFD session state change notification id:%" PRIx64 " state: %s", id, session_state_lookup.at(state).c_str());
 
-            if (state != bfd_session_lookup[id].state)
+            if (last_state.find(id) == last_state.end())
             {
-                auto key = bfd_session_lookup[id].peer;
-                m_stateBfdSessionTable.hset(key, "state", session_state_lookup.at(state));
-
-                SWSS_LOG_NOTICE("BFD session state for %s changed from %s to %s", key.c_str(),
-                            session_state_lookup.at(bfd_session_lookup[id].state).c_str(), session_state_lookup.at(state).c_str());
-
-                BfdUpdate update;
-                update.peer = key;
-                update.state = state;
-                notify(SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE, static_cast<void *>(&update));
-
-                bfd_session_lookup[id].state = state;
+                changed.push_back(id);
             }
+            last_state[id] = state;
         }
 
         sai_deserialize_free_bfd_session_state_ntf(count, bfdSessionState);
     }
+
+    for (auto id : changed)
+    {
+        auto session = bfd_session_lookup.find(id);
+        if (session == bfd_session_lookup.end())
+        {
+            SWSS_LOG_INFO("Ignoring BFD session state change for unknown session id:%" PRIx64, id);
+            continue;
+        }
+
+        sai_bfd_session_state_t state = last_state[id];
+        if (state != session->second.state)
+        {
+            auto key = session->second.peer;
+            m_stateBfdSessionPipeTable->hset(key, "state", session_state_lookup.at(state));
+
+            SWSS_LOG_NOTICE("BFD session state for %s changed from %s to %s", key.c_str(),
+                        session_state_lookup.at(session->second.state).c_str(), session_state_lookup.at(state).c_str());
+
+            queue_state_update(key, state);
+
+            session->second.state = state;
+        }
+    }
+
+    flush_state_updates();
 }
 
 bool BfdOrch::register_bfd_state_change_notification(void)
@@ -567,14 +598,11 @@ bool BfdOrch::create_bfd_session(const string& key, const vector<FieldValueTuple
     }
 
     const string state_db_key = get_state_db_key(vrf_name, alias, peer_address);
-    m_stateBfdSessionTable.set(state_db_key, fvVector);
+    m_stateBfdSessionPipeTable->set(state_db_key, fvVector);
     bfd_session_map[key] = bfd_session_id;
     bfd_session_lookup[bfd_session_id] = {state_db_key, SAI_BFD_SESSION_STATE_DOWN};
 
-    BfdUpdate update;
-    update.peer = state_db_key;
-    update.state = SAI_BFD_SESSION_STATE_DOWN;
-    notify(SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE, static_cast<void *>(&update));
+    queue_state_update(state_db_key, SAI_BFD_SESSION_STATE_DOWN);
 
     return true;
 }
@@ -631,7 +659,7 @@ bool BfdOrch::remove_bfd_session(const string& key)
         }
     }
 
-    m_stateBfdSessionTable.del(bfd_session_lookup[bfd_session_id].peer);
+    m_stateBfdSessionPipeTable->del(bfd_session_lookup[bfd_session_id].peer);
     bfd_session_map.erase(key);
     bfd_session_lookup.erase(bfd_session_id);
 
@@ -679,10 +707,28 @@ void BfdOrch::notify_session_state_down(const string& key)
     string vrf_name = key.substr(0, found_vrf);
     string alias = key.substr(found_vrf + 1, found_ifname - found_vrf - 1);
     IpAddress peer_address(key.substr(found_ifname + 1));
-    BfdUpdate update;
-    update.peer = get_state_db_key(vrf_name, alias, peer_address);
-    update.state = SAI_BFD_SESSION_STATE_DOWN;
-    notify(SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE, static_cast<void *>(&update));
+    queue_state_update(get_state_db_key(vrf_name, alias, peer_address), SAI_BFD_SESSION_STATE_DOWN);
+}
+
+void BfdOrch::queue_state_update(const string& peer, sai_bfd_session_state_t state)
+{
+    m_pendingUpdates.push_back({peer, state});
+}
+
+void BfdOrch::flush_state_updates()
+{
+    SWSS_LOG_ENTER();
+
+    m_stateBfdSessionPipeTable->flush();
+
+    if (m_pendingUpdates.empty())
+    {
+        return;
+    }
+
+    BfdUpdates updates;
+    updates.swap(m_pendingUpdates);
+    notify(SUBJECT_TYPE_BFD_SESSION_STATE_CHANGES, static_cast<void *>(&updates));
 }
 
 void BfdOrch::handleTsaStateChange(bool tsaState)
@@ -706,6 +752,8 @@ void BfdOrch::handleTsaStateChange(bool tsaState)
             }
         }
     }
+
+    flush_state_updates();
 }
 
 void BfdOrch::createSoftwareBfdSession(const string &key, const vector<swss::FieldValueTuple>& data)
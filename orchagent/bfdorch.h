@@ -10,6 +10,9 @@ struct BfdUpdate
     sai_bfd_session_state_t state;
 };
 
+/* Session state changes published together, in the order they happened */
+typedef std::vector<BfdUpdate> BfdUpdates;
+
 class BfdOrch: public Orch, public Subject
 {
 public:
@@ -36,6 +39,8 @@ private:
     uint32_t bfd_src_port(void);
 
     void notify_session_state_down(const std::string& key);
+    void queue_state_update(const std::string& peer, sai_bfd_session_state_t state);
+    void flush_state_updates();
     bool register_bfd_state_change_notification(void);
     void update_port_number(std::vector<sai_attribute_t> &attrs);
     sai_status_t retry_create_bfd_session(sai_object_id_t &bfd_session_id, vector<sai_attribute_t> attrs);
@@ -46,6 +51,15 @@ private:
 
     swss::Table m_stateBfdSessionTable;
 
+    /*
+     * STATE_DB writes and observer updates are buffered while a batch of
+     * sessions or a burst of notifications is processed, and published
+     * together by flush_state_updates().
+     */
+    std::unique_ptr<swss::RedisPipeline> m_stateDbPipeline;
+    std::unique_ptr<swss::Table> m_stateBfdSessionPipeTable;
+    BfdUpdates m_pendingUpdates;
+
     std::unique_ptr<swss::DBConnector> m_stateDbConnector;
     std::unique_ptr<swss::Table> m_stateSoftBfdSessionTable;
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <assert.h>
+#include <string.h>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -155,6 +156,18 @@ static inline bool operator==(const sai_outbound_port_map_port_range_entry_t& a,
         ;
 }
 
+static inline bool operator==(const sai_my_sid_entry_t& a, const sai_my_sid_entry_t& b)
+{
+    return a.switch_id == b.switch_id
+        && a.vr_id == b.vr_id
+        && a.locator_block_len == b.locator_block_len
+        && a.locator_node_len == b.locator_node_len
+        && a.function_len == b.function_len
+        && a.args_len == b.args_len
+        && memcmp(a.sid, b.sid, sizeof(a.sid)) == 0
+        ;
+}
+
 static inline std::size_t hash_value(const sai_ip_prefix_t& a)
 {
     size_t seed = 0;
@@ -293,6 +306,23 @@ namespace std
         }
     };
 
+    template <>
+    struct hash<sai_my_sid_entry_t>
+    {
+        size_t operator()(const sai_my_sid_entry_t& a) const noexcept
+        {
+            size_t seed = 0;
+            boost::hash_combine(seed, a.switch_id);
+            boost::hash_combine(seed, a.vr_id);
+            boost::hash_combine(seed, a.locator_block_len);
+            boost::hash_combine(seed, a.locator_node_len);
+            boost::hash_combine(seed, a.function_len);
+            boost::hash_combine(seed, a.args_len);
+            boost::hash_combine(seed, a.sid);
+            return seed;
+        }
+    };
+
     template <>
     struct hash<sai_outbound_port_map_port_range_entry_t>
     {
@@ -384,6 +414,19 @@ struct SaiBulkerTraits<sai_next_hop_api_t>
     using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
 };
 
+template<>
+struct SaiBulkerTraits<sai_vlan_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_vlan_api_t;
+    using create_entry_fn = sai_create_vlan_member_fn;
+    using remove_entry_fn = sai_remove_vlan_member_fn;
+    using set_entry_attribute_fn = sai_set_vlan_member_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
+};
+
 template<>
 struct SaiBulkerTraits<sai_mpls_api_t>
 {
@@ -397,6 +440,19 @@ struct SaiBulkerTraits<sai_mpls_api_t>
     using bulk_set_entry_attribute_fn = sai_bulk_set_inseg_entry_attribute_fn;
 };
 
+template<>
+struct SaiBulkerTraits<sai_srv6_api_t>
+{
+    // Both MySID entries and SID list objects are bulked from the SRv6 API.
+    // entry_t and bulk_create/remove_entry_fn are only used by EntityBulker
+    // for MySID entries, ObjectBulker covers the SID lists
+    using api_t = sai_srv6_api_t;
+    using entry_t = sai_my_sid_entry_t;
+    using bulk_create_entry_fn = sai_bulk_create_my_sid_entry_fn;
+    using bulk_remove_entry_fn = sai_bulk_remove_my_sid_entry_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_set_my_sid_entry_attribute_fn;
+};
+
 template<>
 struct SaiBulkerTraits<sai_neighbor_api_t>
 {
@@ -488,6 +544,33 @@ struct SaiBulkerTraits<sai_dash_outbound_routing_api_t>
     using bulk_set_entry_attribute_fn = sai_bulk_set_outbound_routing_entry_attribute_fn;
 };
 
+template<>
+struct SaiBulkerTraits<sai_dash_acl_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_dash_acl_api_t;
+    using create_entry_fn = sai_create_dash_acl_rule_fn;
+    using remove_entry_fn = sai_remove_dash_acl_rule_fn;
+    using set_entry_attribute_fn = sai_set_dash_acl_rule_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
+};
+
+template<>
+struct SaiBulkerTraits<sai_acl_api_t>
+{
+    // ACL entries only, SAI has no bulk calls for the other ACL objects
+    using entry_t = sai_object_id_t;
+    using api_t = sai_acl_api_t;
+    using create_entry_fn = sai_create_acl_entry_fn;
+    using remove_entry_fn = sai_remove_acl_entry_fn;
+    using set_entry_attribute_fn = sai_set_acl_entry_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
+};
+
 template<>
 struct SaiBulkerTraits<sai_dash_tunnel_api_t>
 {
@@ -983,6 +1066,14 @@ inline EntityBulker<sai_dash_inbound_routing_api_t>::EntityBulker(sai_dash_inbou
     set_entries_attribute = nullptr;
 }
 
+template <>
+inline EntityBulker<sai_srv6_api_t>::EntityBulker(sai_srv6_api_t *api, size_t max_bulk_size) : max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_my_sid_entries;
+    remove_entries = api->remove_my_sid_entries;
+    set_entries_attribute = api->set_my_sid_entries_attribute;
+}
+
 template <>
 inline EntityBulker<sai_dash_outbound_ca_to_pa_api_t>::EntityBulker(sai_dash_outbound_ca_to_pa_api_t *api, size_t max_bulk_size) : max_bulk_size(max_bulk_size)
 {
@@ -1052,6 +1143,22 @@ public:
         return SAI_STATUS_NOT_EXECUTED;
     }
 
+    // Same as above, object_status receives the status of the object on flush
+    sai_status_t create_entry(
+        _Out_ sai_status_t *object_status,
+        _Out_ sai_object_id_t *object_id,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+    {
+        assert(object_status);
+        if (!object_status) throw std::invalid_argument("object_status is null");
+
+        auto status = create_entry(object_id, attr_count, attr_list);
+        creating_statuses[object_id] = object_status;
+        *object_status = SAI_STATUS_NOT_EXECUTED;
+        return status;
+    }
+
     sai_status_t remove_entry(
         _Out_ sai_status_t *object_status,
         _In_ sai_object_id_t object_id)
@@ -1147,10 +1254,12 @@ public:
             flush_creating_entries(rs, tss, cs);
 
             creating_entries.clear();
+            creating_statuses.clear();
         }
 
         if (!setting_entries.empty())
         {
+            set_statuses.clear();
             std::vector<sai_object_id_t> rs;
             std::vector<sai_attribute_t> ts;
 
@@ -1179,6 +1288,7 @@ public:
     {
         removing_entries.clear();
         creating_entries.clear();
+        creating_statuses.clear();
         setting_entries.clear();
     }
 
@@ -1201,6 +1311,11 @@ public:
         return create_statuses[object];
     }
 
+    // Status of the attributes set on object by the last flush, the first failure wins
+    sai_status_t set_status(sai_object_id_t object) {
+        return set_statuses[object];
+    }
+
 private:
     struct object_entry
     {
@@ -1223,6 +1338,10 @@ private:
             std::vector<sai_attribute_t>                    // - attrs
     >>                                                      creating_entries;
 
+                                                            // A map of
+                                                            // object_id pointer -> object_status
+    std::unordered_map<sai_object_id_t *, sai_status_t *>   creating_statuses;
+
     std::unordered_map<                                     // A map of
             sai_object_id_t,                                // object_id -> attrs
             std::vector<sai_attribute_t>
@@ -1238,6 +1357,8 @@ private:
 
     std::unordered_map<sai_object_id_t, sai_status_t>       create_statuses;
 
+    std::unordered_map<sai_object_id_t, sai_status_t>       set_statuses;
+
     sai_status_t flush_removing_entries(
         _Inout_ std::vector<sai_object_id_t> &rs)
     {
@@ -1299,6 +1420,12 @@ private:
             create_statuses.emplace(object_ids[i], statuses[i]);
             sai_object_id_t *pid = rs[i];
             *pid = (statuses[i] == SAI_STATUS_SUCCESS) ? object_ids[i] : SAI_NULL_OBJECT_ID;
+
+            auto found_status = creating_statuses.find(pid);
+            if (found_status != creating_statuses.end())
+            {
+                *found_status->second = statuses[i];
+            }
         }
 
         rs.clear();
@@ -1317,7 +1444,7 @@ private:
             return SAI_STATUS_SUCCESS;
         }
         size_t count = rs.size();
-        std::vector<sai_status_t> statuses(count);
+        std::vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
         sai_status_t status = (*set_entries_attribute)((uint32_t)count, rs.data(), ts.data(),
                                SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
         if (status == SAI_STATUS_SUCCESS)
@@ -1330,6 +1457,15 @@ private:
                             count, sai_serialize_status(status).c_str());
         }
 
+        for (size_t i = 0; i < count; i++)
+        {
+            auto found = set_statuses.emplace(rs[i], statuses[i]).first;
+            if (found->second == SAI_STATUS_SUCCESS)
+            {
+                found->second = statuses[i];
+            }
+        }
+
         rs.clear();
         ts.clear();
 
@@ -1357,6 +1493,26 @@ inline ObjectBulker<sai_next_hop_api_t>::ObjectBulker(SaiBulkerTraits<sai_next_h
     set_entries_attribute = api->set_next_hops_attribute;
 }
 
+template <>
+inline ObjectBulker<sai_vlan_api_t>::ObjectBulker(SaiBulkerTraits<sai_vlan_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_vlan_members;
+    remove_entries = api->remove_vlan_members;
+    set_entries_attribute = nullptr;
+}
+
+template <>
+inline ObjectBulker<sai_srv6_api_t>::ObjectBulker(SaiBulkerTraits<sai_srv6_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_srv6_sidlists;
+    remove_entries = api->remove_srv6_sidlists;
+    set_entries_attribute = nullptr;
+}
+
 template <>
 inline ObjectBulker<sai_dash_vnet_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_vnet_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
     switch_id(switch_id),
@@ -1377,6 +1533,36 @@ inline ObjectBulker<sai_dash_meter_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash
     set_entries_attribute = nullptr;
 }
 
+template <>
+inline ObjectBulker<sai_dash_acl_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_acl_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_dash_acl_rules;
+    remove_entries = api->remove_dash_acl_rules;
+    set_entries_attribute = nullptr;
+}
+
+template <>
+inline ObjectBulker<sai_acl_api_t>::ObjectBulker(SaiBulkerTraits<sai_acl_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size, sai_object_type_extensions_t object_type) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    switch ((sai_object_type_t)object_type)
+    {
+        case SAI_OBJECT_TYPE_ACL_ENTRY:
+            create_entries = api->create_acl_entries;
+            remove_entries = api->remove_acl_entries;
+            set_entries_attribute = api->set_acl_entries_attribute;
+            break;
+        default:
+            std::string type_str = sai_serialize_object_type((sai_object_type_t) object_type);
+            std::stringstream ss;
+            ss << "Invalid object type for sai_acl_api_t: " << type_str;
+            throw std::invalid_argument(ss.str());
+    }
+}
+
 template <>
 inline ObjectBulker<sai_dash_tunnel_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_tunnel_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size, sai_object_type_extensions_t object_type) :
     switch_id(switch_id),
@@ -7,9 +7,11 @@
 #include "saihelper.h"
 
 #define CRM_POLLING_INTERVAL "polling_interval"
+#define CRM_AVAIL_POLL_BACKOFF "available_poll_backoff"
 #define CRM_COUNTERS_TABLE_KEY "STATS"
 
 #define CRM_POLLING_INTERVAL_DEFAULT (5 * 60)
+#define CRM_AVAIL_POLL_BACKOFF_DEFAULT 0
 #define CRM_THRESHOLD_TYPE_DEFAULT CrmThresholdType::CRM_PERCENTAGE
 #define CRM_THRESHOLD_LOW_DEFAULT 70
 #define CRM_THRESHOLD_HIGH_DEFAULT 85
@@ -404,6 +406,7 @@ CrmOrch::CrmOrch(DBConnector *db, string tableName):
     SWSS_LOG_ENTER();
 
     m_pollingInterval = chrono::seconds(CRM_POLLING_INTERVAL_DEFAULT);
+    m_availPollBackoff = CRM_AVAIL_POLL_BACKOFF_DEFAULT;
 
     for (const auto &res : crmResTypeNameMap)
     {
@@ -490,6 +493,21 @@ void CrmOrch::handleSetCommand(const string& key, const vector<FieldValueTuple>&
                 auto interv = timespec { .tv_sec = (time_t)m_pollingInterval.count(), .tv_nsec = 0 };
                 m_timer->setInterval(interv);
                 m_timer->reset();
+
+                // Refresh all availability counters on the next interval
+                for (auto &res : m_resourcesMap)
+                {
+                    res.second.availPollSkip = 0;
+                }
+            }
+            else if (field == CRM_AVAIL_POLL_BACKOFF)
+            {
+                m_availPollBackoff = to_uint<uint32_t>(value);
+
+                for (auto &res : m_resourcesMap)
+                {
+                    res.second.availPollSkip = 0;
+                }
             }
             else if (crmThreshTypeResMap.find(field) != crmThreshTypeResMap.end())
             {
@@ -505,6 +523,8 @@ void CrmOrch::handleSetCommand(const string& key, const vector<FieldValueTuple>&
                     {
                         cnt.second.exceededLogCounter = 0;
                     }
+
+                    resetCrmThresholdCheck(resource);
                 }
             }
             else if (crmThreshLowResMap.find(field) != crmThreshLowResMap.end())
@@ -513,6 +533,7 @@ void CrmOrch::handleSetCommand(const string& key, const vector<FieldValueTuple>&
                 auto thresholdValue = to_uint<uint32_t>(value);
 
                 m_resourcesMap.at(resourceType).lowThreshold = thresholdValue;
+                resetCrmThresholdCheck(m_resourcesMap.at(resourceType));
             }
             else if (crmThreshHighResMap.find(field) != crmThreshHighResMap.end())
             {
@@ -520,6 +541,7 @@ void CrmOrch::handleSetCommand(const string& key, const vector<FieldValueTuple>&
                 auto thresholdValue = to_uint<uint32_t>(value);
 
                 m_resourcesMap.at(resourceType).highThreshold = thresholdValue;
+                resetCrmThresholdCheck(m_resourcesMap.at(resourceType));
             }
             else
             {
@@ -875,6 +897,55 @@ bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEn
     return true;
 }
 
+bool CrmOrch::isResAvailabilityQueryDue(CrmResourceEntry &res)
+{
+    if ((m_availPollBackoff == 0) || (res.availPollSkip == 0))
+    {
+        return true;
+    }
+
+    // Any change of the "used" counter since the last query may have consumed
+    // or released hardware resources, so the availability has to be refreshed.
+    for (const auto &cnt : res.countersMap)
+    {
+        if (!cnt.second.availableQueried || (cnt.second.usedCounter != cnt.second.usedAtLastQuery))
+        {
+            return true;
+        }
+    }
+
+    res.availPollSkip--;
+
+    return false;
+}
+
+void CrmOrch::scheduleResAvailabilityQuery(CrmResourceEntry &res)
+{
+    uint32_t skip = m_availPollBackoff;
+
+    for (auto &cnt : res.countersMap)
+    {
+        cnt.second.usedAtLastQuery = cnt.second.usedCounter;
+        cnt.second.availableQueried = true;
+
+        uint32_t percentageUtil = 0;
+        uint64_t utilization = getCrmUtilization(res, cnt.second, percentageUtil);
+
+        if (utilization >= res.lowThreshold)
+        {
+            // Close to the thresholds, query on every polling interval
+            skip = 0;
+            continue;
+        }
+
+        // Back off proportionally to the distance from the low threshold
+        uint64_t backoff = m_availPollBackoff * (res.lowThreshold - utilization) / res.lowThreshold;
+        skip = min(skip, static_cast<uint32_t>(backoff));
+    }
+
+    res.availPollSkip = skip;
+}
+
 void CrmOrch::getResAvailableCounters()
 {
     SWSS_LOG_ENTER();
@@ -887,6 +958,11 @@ void CrmOrch::getResAvailableCounters()
             continue;
         }
 
+        if (!isResAvailabilityQueryDue(res.second))
+        {
+            continue;
+        }
+
         switch (res.first)
         {
             case CrmResourceType::CRM_IPV4_ROUTE:
@@ -1057,6 +1133,8 @@ void CrmOrch::getResAvailableCounters()
                 SWSS_LOG_ERROR("Failed to get CRM resource type %u. Unknown resource type.\n", static_cast<uint32_t>(res.first));
                 return;
         }
+
+        scheduleResAvailabilityQuery(res.second);
     }
 }
 
@@ -1064,22 +1142,31 @@ void CrmOrch::updateCrmCountersTable()
 {
     SWSS_LOG_ENTER();
 
+    // Only the counters changed since the last update are written to COUNTERS_DB,
+    // grouped per key so that every key is updated with a single request.
+    map<string, vector<FieldValueTuple>> updates;
+
     // Update CRM used counters in COUNTERS_DB
     for (const auto &i : crmUsedCntsTableMap)
     {
         try
         {
-            const auto &res = m_resourcesMap.at(i.second);
+            auto &res = m_resourcesMap.at(i.second);
             if (res.resStatus == CrmResourceStatus::CRM_RES_NOT_SUPPORTED)
             {
                 continue;
             }
 
-            for (const auto &cnt : res.countersMap)
+            for (auto &cnt : res.countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.usedCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
+                if (cnt.second.usedPublished && (cnt.second.publishedUsedCounter == cnt.second.usedCounter))
+                {
+                    continue;
+                }
+
+                updates[cnt.first].emplace_back(i.first, to_string(cnt.second.usedCounter));
+                cnt.second.publishedUsedCounter = cnt.second.usedCounter;
+                cnt.second.usedPublished = true;
             }
         }
         catch(const out_of_range &e)
@@ -1093,17 +1180,22 @@ void CrmOrch::updateCrmCountersTable()
     {
         try
         {
-            const auto &res = m_resourcesMap.at(i.second);
+            auto &res = m_resourcesMap.at(i.second);
             if (res.resStatus == CrmResourceStatus::CRM_RES_NOT_SUPPORTED)
             {
                 continue;
             }
 
-            for (const auto &cnt : res.countersMap)
+            for (auto &cnt : res.countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.availableCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
+                if (cnt.second.availablePublished && (cnt.second.publishedAvailableCounter == cnt.second.availableCounter))
+                {
+                    continue;
+                }
+
+                updates[cnt.first].emplace_back(i.first, to_string(cnt.second.availableCounter));
+                cnt.second.publishedAvailableCounter = cnt.second.availableCounter;
+                cnt.second.availablePublished = true;
             }
         }
         catch(const out_of_range &e)
@@ -1111,6 +1203,50 @@ void CrmOrch::updateCrmCountersTable()
             // expected when a resource is unavailable
         }
     }
+
+    for (const auto &update : updates)
+    {
+        m_countersCrmTable->set(update.first, update.second);
+    }
+}
+
+uint64_t CrmOrch::getCrmUtilization(const CrmResourceEntry &res, const CrmResourceCounter &cnt, uint32_t &percentageUtil)
+{
+    percentageUtil = 0;
+
+    if (cnt.usedCounter != 0)
+    {
+        uint32_t dvsr = cnt.usedCounter + cnt.availableCounter;
+        if (dvsr != 0)
+        {
+            percentageUtil = (cnt.usedCounter * 100) / dvsr;
+        }
+        else
+        {
+            SWSS_LOG_WARN("%s Exception occurred (div by Zero): Used count %u free count %u",
+                          res.name.c_str(), cnt.usedCounter, cnt.availableCounter);
+        }
+    }
+
+    switch (res.thresholdType)
+    {
+        case CrmThresholdType::CRM_PERCENTAGE:
+            return percentageUtil;
+        case CrmThresholdType::CRM_USED:
+            return cnt.usedCounter;
+        case CrmThresholdType::CRM_FREE:
+            return cnt.availableCounter;
+        default:
+            throw runtime_error("Unknown threshold type for CRM resource");
+    }
+}
+
+void CrmOrch::resetCrmThresholdCheck(CrmResourceEntry &res)
+{
+    for (auto &cnt : res.countersMap)
+    {
+        cnt.second.thresholdChecked = false;
+    }
 }
 
 void CrmOrch::checkCrmThresholds()
@@ -1129,36 +1265,32 @@ void CrmOrch::checkCrmThresholds()
         for (auto &j : i.second.countersMap)
         {
             auto &cnt = j.second;
-            uint64_t utilization = 0;
             uint32_t percentageUtil = 0;
             string threshType = "";
 
-            if (cnt.usedCounter != 0)
+            // Thresholds are only re-evaluated when the counters changed since the last check
+            if (cnt.thresholdChecked &&
+                (cnt.checkedUsedCounter == cnt.usedCounter) &&
+                (cnt.checkedAvailableCounter == cnt.availableCounter))
             {
-                uint32_t dvsr = cnt.usedCounter + cnt.availableCounter;
-                if (dvsr != 0)
-                {
-                    percentageUtil = (cnt.usedCounter * 100) / dvsr;
-                }
-                else
-                {
-                    SWSS_LOG_WARN("%s Exception occurred (div by Zero): Used count %u free count %u",
-                                  res.name.c_str(), cnt.usedCounter, cnt.availableCounter);
-                }
+                continue;
             }
 
+            cnt.checkedUsedCounter = cnt.usedCounter;
+            cnt.checkedAvailableCounter = cnt.availableCounter;
+            cnt.thresholdChecked = true;
+
+            uint64_t utilization = getCrmUtilization(res, cnt, percentageUtil);
+
             switch (res.thresholdType)
             {
                 case CrmThresholdType::CRM_PERCENTAGE:
-                    utilization = percentageUtil;
                     threshType = "TH_PERCENTAGE";
                     break;
                 case CrmThresholdType::CRM_USED:
-                    utilization = cnt.usedCounter;
                     threshType = "TH_USED";
                     break;
                 case CrmThresholdType::CRM_FREE:
-                    utilization = cnt.availableCounter;
                     threshType = "TH_FREE";
                     break;
                 default:
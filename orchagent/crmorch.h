@@ -104,6 +104,21 @@ private:
         uint32_t availableCounter = 0;
         uint32_t usedCounter = 0;
         uint32_t exceededLogCounter = 0;
+
+        // "used" value at the time availability was last queried from SAI
+        uint32_t usedAtLastQuery = 0;
+        bool availableQueried = false;
+
+        // Last values written to COUNTERS_DB, used to publish only deltas
+        uint32_t publishedUsedCounter = 0;
+        uint32_t publishedAvailableCounter = 0;
+        bool usedPublished = false;
+        bool availablePublished = false;
+
+        // Last values evaluated against the thresholds
+        uint32_t checkedUsedCounter = 0;
+        uint32_t checkedAvailableCounter = 0;
+        bool thresholdChecked = false;
     };
 
     struct CrmResourceEntry
@@ -119,9 +134,13 @@ private:
         std::map<std::string, CrmResourceCounter> countersMap;
 
         CrmResourceStatus resStatus = CrmResourceStatus::CRM_RES_SUPPORTED;
+
+        // Number of polling intervals to skip before availability is queried again
+        uint32_t availPollSkip = 0;
     };
 
     std::chrono::seconds m_pollingInterval;
+    uint32_t m_availPollBackoff;
 
     std::map<CrmResourceType, CrmResourceEntry> m_resourcesMap;
 
@@ -130,9 +149,13 @@ private:
     void doTask(swss::SelectableTimer &timer);
     bool getResAvailability(CrmResourceType type, CrmResourceEntry &res);
     bool getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEntry &res);
+    bool isResAvailabilityQueryDue(CrmResourceEntry &res);
+    void scheduleResAvailabilityQuery(CrmResourceEntry &res);
     void getResAvailableCounters();
     void updateCrmCountersTable();
     void checkCrmThresholds();
+    uint64_t getCrmUtilization(const CrmResourceEntry &res, const CrmResourceCounter &cnt, uint32_t &percentageUtil);
+    void resetCrmThresholdCheck(CrmResourceEntry &res);
     std::string getCrmAclKey(sai_acl_stage_t stage, sai_acl_bind_point_type_t bindPoint);
     std::string getCrmAclTableKey(sai_object_id_t id);
     std::string getCrmP4rtTableKey(std::string table_name);
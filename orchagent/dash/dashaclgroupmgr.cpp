@@ -1,6 +1,8 @@
 #include <boost/iterator/counting_iterator.hpp>
 
+#include <algorithm>
 #include <map>
+#include <tuple>
 
 #include "dashaclgroupmgr.h"
 
@@ -14,6 +16,7 @@
 extern sai_dash_acl_api_t* sai_dash_acl_api;
 extern sai_dash_eni_api_t* sai_dash_eni_api;
 extern sai_object_id_t gSwitchId;
+extern size_t gMaxBulkSize;
 extern CrmOrch *gCrmOrch;
 
 using namespace std;
@@ -129,7 +132,8 @@ sai_attr_id_t getSaiStage(DashAclDirection d, sai_ip_addr_family_t f, DashAclSta
 
 DashAclRuleInfo::DashAclRuleInfo(const DashAclRule &rule) :
     m_src_tags(rule.m_src_tags),
-    m_dst_tags(rule.m_dst_tags)
+    m_dst_tags(rule.m_dst_tags),
+    m_rule(rule)
 {
     SWSS_LOG_ENTER();
 }
@@ -142,7 +146,8 @@ bool DashAclRuleInfo::isTagUsed(const std::string &tag_id) const
 DashAclGroupMgr::DashAclGroupMgr(DBConnector *db, DashOrch *dashorch, DashAclOrch *aclorch) :
     m_dash_orch(dashorch),
     m_dash_acl_orch(aclorch),
-    m_dash_acl_rules_table(new Table(db, APP_DASH_ACL_RULE_TABLE_NAME))
+    m_dash_acl_rules_table(new Table(db, APP_DASH_ACL_RULE_TABLE_NAME)),
+    m_rule_bulker(sai_dash_acl_api, gSwitchId, gMaxBulkSize)
 {
     SWSS_LOG_ENTER();
 }
@@ -237,6 +242,13 @@ task_process_status DashAclGroupMgr::remove(const string& group_id)
         return task_failed;
     }
 
+    removeRules(group_id, group);
+    if (!group.m_dash_acl_rule_table.empty())
+    {
+        SWSS_LOG_ERROR("ACL group %s still has %zu rules", group_id.c_str(), group.m_dash_acl_rule_table.size());
+        return task_failed;
+    }
+
     remove(group);
 
     m_groups_table.erase(group_id);
@@ -253,15 +265,13 @@ bool DashAclGroupMgr::exists(const string& group_id) const
     return m_groups_table.find(group_id) != m_groups_table.end();
 }
 
-DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& rule)
+void DashAclGroupMgr::expandRulePrefixes(DashAclGroup& group, DashAclRuleBulkContext& ctxt)
 {
     SWSS_LOG_ENTER();
 
-    vector<sai_attribute_t> attrs;
-    vector<sai_ip_prefix_t> src_prefixes = {};
-    vector<sai_ip_prefix_t> dst_prefixes = {};
-
-    DashAclRuleInfo rule_info = rule;
+    const auto& rule = ctxt.rule;
+    auto& src_prefixes = ctxt.src_prefixes;
+    auto& dst_prefixes = ctxt.dst_prefixes;
 
     auto any_ip = [] (const auto& g)
     {
@@ -270,36 +280,8 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
         return ip_prefix;
     };
 
-    attrs.emplace_back();
-    attrs.back().id = SAI_DASH_ACL_RULE_ATTR_PRIORITY;
-    attrs.back().value.u32 = rule.m_priority;
-
-    attrs.emplace_back();
-    attrs.back().id = SAI_DASH_ACL_RULE_ATTR_ACTION;
-
-    if (rule.m_action == DashAclRule::Action::ALLOW)
-    {
-        attrs.back().value.s32 = rule.m_terminating ?
-            SAI_DASH_ACL_RULE_ACTION_PERMIT : SAI_DASH_ACL_RULE_ACTION_PERMIT_AND_CONTINUE;
-    }
-    else
-    {
-        attrs.back().value.s32 = rule.m_terminating ?
-            SAI_DASH_ACL_RULE_ACTION_DENY : SAI_DASH_ACL_RULE_ACTION_DENY_AND_CONTINUE;
-    }
-
-    attrs.emplace_back();
-    attrs.back().id = SAI_DASH_ACL_RULE_ATTR_PROTOCOL;
-
-    vector<uint8_t> protocols;
-    if (rule.m_protocols.size()) {
-        protocols = rule.m_protocols;
-    } else {
-        protocols = all_protocols;
-    }
-
-    attrs.back().value.u8list.count = static_cast<uint32_t>(protocols.size());
-    attrs.back().value.u8list.list = protocols.data();
+    src_prefixes.clear();
+    dst_prefixes.clear();
 
     if (!rule.m_src_prefixes.empty())
     {
@@ -339,16 +321,54 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
     {
         dst_prefixes.push_back(any_ip(group));
     }
+}
+
+void DashAclGroupMgr::createRule(sai_object_id_t group_oid, DashAclRuleBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    auto& rule = ctxt.rule;
+    vector<sai_attribute_t> attrs;
+
+    attrs.emplace_back();
+    attrs.back().id = SAI_DASH_ACL_RULE_ATTR_PRIORITY;
+    attrs.back().value.u32 = rule.m_priority;
+
+    attrs.emplace_back();
+    attrs.back().id = SAI_DASH_ACL_RULE_ATTR_ACTION;
+
+    if (rule.m_action == DashAclRule::Action::ALLOW)
+    {
+        attrs.back().value.s32 = rule.m_terminating ?
+            SAI_DASH_ACL_RULE_ACTION_PERMIT : SAI_DASH_ACL_RULE_ACTION_PERMIT_AND_CONTINUE;
+    }
+    else
+    {
+        attrs.back().value.s32 = rule.m_terminating ?
+            SAI_DASH_ACL_RULE_ACTION_DENY : SAI_DASH_ACL_RULE_ACTION_DENY_AND_CONTINUE;
+    }
+
+    attrs.emplace_back();
+    attrs.back().id = SAI_DASH_ACL_RULE_ATTR_PROTOCOL;
+
+    if (rule.m_protocols.size()) {
+        ctxt.protocols = rule.m_protocols;
+    } else {
+        ctxt.protocols = all_protocols;
+    }
+
+    attrs.back().value.u8list.count = static_cast<uint32_t>(ctxt.protocols.size());
+    attrs.back().value.u8list.list = ctxt.protocols.data();
 
     attrs.emplace_back();
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_SIP;
-    attrs.back().value.ipprefixlist.count = static_cast<uint32_t>(src_prefixes.size());
-    attrs.back().value.ipprefixlist.list = src_prefixes.data();
+    attrs.back().value.ipprefixlist.count = static_cast<uint32_t>(ctxt.src_prefixes.size());
+    attrs.back().value.ipprefixlist.list = ctxt.src_prefixes.data();
 
     attrs.emplace_back();
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_DIP;
-    attrs.back().value.ipprefixlist.count = static_cast<uint32_t>(dst_prefixes.size());
-    attrs.back().value.ipprefixlist.list = dst_prefixes.data();
+    attrs.back().value.ipprefixlist.count = static_cast<uint32_t>(ctxt.dst_prefixes.size());
+    attrs.back().value.ipprefixlist.list = ctxt.dst_prefixes.data();
 
     attrs.emplace_back();
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_SRC_PORT;
@@ -362,26 +382,75 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
 
     attrs.emplace_back();
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_DASH_ACL_GROUP_ID;
-    attrs.back().value.oid = group.m_dash_acl_group_id;
+    attrs.back().value.oid = group_oid;
 
-    auto status = sai_dash_acl_api->create_dash_acl_rule(&rule_info.m_dash_acl_rule_id, gSwitchId, static_cast<uint32_t>(attrs.size()), attrs.data());
-    if (status != SAI_STATUS_SUCCESS)
+    ctxt.object_ids.emplace_back();
+    m_rule_bulker.create_entry(&ctxt.object_ids.back(), static_cast<uint32_t>(attrs.size()), attrs.data());
+}
+
+void DashAclGroupMgr::addRuleInfo(DashAclGroup& group, const DashAclRuleBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    DashAclRuleInfo rule_info = ctxt.rule;
+    rule_info.m_dash_acl_rule_id = ctxt.object_ids.front();
+    rule_info.m_src_prefixes = ctxt.src_prefixes;
+    rule_info.m_dst_prefixes = ctxt.dst_prefixes;
+
+    for (const auto& tag_id : rule_info.m_src_tags)
     {
-        SWSS_LOG_ERROR("Failed to create ACL rule: %d, %s", status, sai_serialize_status(status).c_str());
-        handleSaiCreateStatus((sai_api_t)SAI_API_DASH_ACL, status);
+        group.m_tag_rules[tag_id].insert(ctxt.rule_id);
     }
 
-    CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
-            CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
-    gCrmOrch->incCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
+    for (const auto& tag_id : rule_info.m_dst_tags)
+    {
+        group.m_tag_rules[tag_id].insert(ctxt.rule_id);
+    }
 
-    return rule_info;
+    group.m_dash_acl_rule_table[ctxt.rule_id] = std::move(rule_info);
 }
 
-task_process_status DashAclGroupMgr::createRule(const string& group_id, const string& rule_id, DashAclRule& rule)
+void DashAclGroupMgr::removeRuleInfo(DashAclGroup& group, const string& rule_id)
 {
     SWSS_LOG_ENTER();
 
+    auto rule_it = group.m_dash_acl_rule_table.find(rule_id);
+    if (rule_it == group.m_dash_acl_rule_table.end())
+    {
+        return;
+    }
+
+    auto unindex = [&] (const unordered_set<string>& tags)
+    {
+        for (const auto& tag_id : tags)
+        {
+            auto tag_it = group.m_tag_rules.find(tag_id);
+            if (tag_it == group.m_tag_rules.end())
+            {
+                continue;
+            }
+
+            tag_it->second.erase(rule_id);
+            if (tag_it->second.empty())
+            {
+                group.m_tag_rules.erase(tag_it);
+            }
+        }
+    };
+
+    unindex(rule_it->second.m_src_tags);
+    unindex(rule_it->second.m_dst_tags);
+
+    group.m_dash_acl_rule_table.erase(rule_it);
+}
+
+task_process_status DashAclGroupMgr::createRule(DashAclRuleBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    const auto& group_id = ctxt.group_id;
+    const auto& rule_id = ctxt.rule_id;
+
     auto group_it = m_groups_table.find(group_id);
     if (group_it == m_groups_table.end())
     {
@@ -390,7 +459,7 @@ task_process_status DashAclGroupMgr::createRule(const string& group_id, const st
     }
     auto& group = group_it->second;
 
-    for (const auto& tag_id : rule.m_src_tags)
+    for (const auto& tag_id : ctxt.rule.m_src_tags)
     {
         if (!m_dash_acl_orch->getDashAclTagMgr().exists(tag_id))
         {
@@ -399,7 +468,7 @@ task_process_status DashAclGroupMgr::createRule(const string& group_id, const st
         }
     }
 
-    for (const auto& tag_id : rule.m_dst_tags)
+    for (const auto& tag_id : ctxt.rule.m_dst_tags)
     {
         if (!m_dash_acl_orch->getDashAclTagMgr().exists(tag_id))
         {
@@ -408,7 +477,73 @@ task_process_status DashAclGroupMgr::createRule(const string& group_id, const st
         }
     }
 
-    auto rule_info = createRule(group, rule);
+    // An existing rule is replaced, the bulker removes objects before creating new ones
+    auto rule_it = group.m_dash_acl_rule_table.find(rule_id);
+    if (rule_it != group.m_dash_acl_rule_table.end())
+    {
+        ctxt.object_statuses.emplace_back();
+        m_rule_bulker.remove_entry(&ctxt.object_statuses.back(), rule_it->second.m_dash_acl_rule_id);
+    }
+
+    expandRulePrefixes(group, ctxt);
+    createRule(group.m_dash_acl_group_id, ctxt);
+
+    return task_success;
+}
+
+task_process_status DashAclGroupMgr::createRulePost(const DashAclRuleBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    const auto& group_id = ctxt.group_id;
+    const auto& rule_id = ctxt.rule_id;
+
+    auto group_it = m_groups_table.find(group_id);
+    if (group_it == m_groups_table.end())
+    {
+        SWSS_LOG_ERROR("ACL group %s doesn't exist, cannot create rule %s", group_id.c_str(), rule_id.c_str());
+        return task_failed;
+    }
+    auto& group = group_it->second;
+
+    CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
+            CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
+
+    if (!ctxt.object_statuses.empty())
+    {
+        sai_status_t status = ctxt.object_statuses.front();
+        if (status != SAI_STATUS_SUCCESS && status != SAI_STATUS_ITEM_NOT_FOUND)
+        {
+            SWSS_LOG_ERROR("Failed to remove ACL rule %s:%s: %s", group_id.c_str(), rule_id.c_str(), sai_serialize_status(status).c_str());
+
+            // The old rule stays in place, drop the replacement the same bulk
+            // created so that a retry doesn't leak another one
+            if (!ctxt.object_ids.empty() && ctxt.object_ids.front() != SAI_NULL_OBJECT_ID)
+            {
+                sai_status_t rm_status = sai_dash_acl_api->remove_dash_acl_rule(ctxt.object_ids.front());
+                if (rm_status != SAI_STATUS_SUCCESS)
+                {
+                    SWSS_LOG_ERROR("Failed to remove replacement ACL rule %s:%s: %s", group_id.c_str(), rule_id.c_str(), sai_serialize_status(rm_status).c_str());
+                }
+            }
+
+            return handleSaiRemoveStatus((sai_api_t)SAI_API_DASH_ACL, status);
+        }
+
+        removeRuleInfo(group, rule_id);
+        group.m_rule_count--;
+        gCrmOrch->decCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
+    }
+
+    if (ctxt.object_ids.empty() || ctxt.object_ids.front() == SAI_NULL_OBJECT_ID)
+    {
+        SWSS_LOG_ERROR("Failed to create ACL rule %s:%s", group_id.c_str(), rule_id.c_str());
+        return task_failed;
+    }
+
+    addRuleInfo(group, ctxt);
+
+    gCrmOrch->incCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
 
     group.m_rule_count++;
     attachTags(group_id, group.m_tags);
@@ -418,7 +553,347 @@ task_process_status DashAclGroupMgr::createRule(const string& group_id, const st
     return task_success;
 }
 
-void DashAclGroupMgr::bind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage)
+task_process_status DashAclGroupMgr::removeRule(DashAclRuleBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    const auto& group_id = ctxt.group_id;
+    const auto& rule_id = ctxt.rule_id;
+
+    auto group_it = m_groups_table.find(group_id);
+    if (group_it == m_groups_table.end())
+    {
+        SWSS_LOG_INFO("ACL group %s doesn't exist, rule %s is already removed", group_id.c_str(), rule_id.c_str());
+        return task_ignore;
+    }
+    auto& group = group_it->second;
+
+    auto rule_it = group.m_dash_acl_rule_table.find(rule_id);
+    if (rule_it == group.m_dash_acl_rule_table.end())
+    {
+        SWSS_LOG_INFO("ACL rule %s:%s doesn't exist", group_id.c_str(), rule_id.c_str());
+        return task_ignore;
+    }
+
+    ctxt.object_statuses.emplace_back();
+    m_rule_bulker.remove_entry(&ctxt.object_statuses.back(), rule_it->second.m_dash_acl_rule_id);
+
+    return task_success;
+}
+
+task_process_status DashAclGroupMgr::removeRulePost(const DashAclRuleBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    const auto& group_id = ctxt.group_id;
+    const auto& rule_id = ctxt.rule_id;
+
+    auto group_it = m_groups_table.find(group_id);
+    if (group_it == m_groups_table.end() || ctxt.object_statuses.empty())
+    {
+        return task_failed;
+    }
+    auto& group = group_it->second;
+
+    sai_status_t status = ctxt.object_statuses.front();
+    if (status != SAI_STATUS_SUCCESS && status != SAI_STATUS_ITEM_NOT_FOUND)
+    {
+        SWSS_LOG_ERROR("Failed to remove ACL rule %s:%s: %s", group_id.c_str(), rule_id.c_str(), sai_serialize_status(status).c_str());
+        return handleSaiRemoveStatus((sai_api_t)SAI_API_DASH_ACL, status);
+    }
+
+    removeRuleInfo(group, rule_id);
+    group.m_rule_count--;
+
+    CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
+            CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
+    gCrmOrch->decCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
+
+    SWSS_LOG_INFO("Removed ACL rule %s:%s", group_id.c_str(), rule_id.c_str());
+
+    return task_success;
+}
+
+void DashAclGroupMgr::flushRules()
+{
+    SWSS_LOG_ENTER();
+
+    m_rule_bulker.flush();
+}
+
+void DashAclGroupMgr::removeRules(const string& group_id, DashAclGroup& group)
+{
+    SWSS_LOG_ENTER();
+
+    if (group.m_dash_acl_rule_table.empty())
+    {
+        return;
+    }
+
+    map<string, sai_status_t> statuses;
+    for (const auto& rule : group.m_dash_acl_rule_table)
+    {
+        auto& status = statuses[rule.first];
+        m_rule_bulker.remove_entry(&status, rule.second.m_dash_acl_rule_id);
+    }
+
+    m_rule_bulker.flush();
+
+    CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
+            CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
+
+    for (const auto& status : statuses)
+    {
+        if (status.second != SAI_STATUS_SUCCESS && status.second != SAI_STATUS_ITEM_NOT_FOUND)
+        {
+            SWSS_LOG_ERROR("Failed to remove ACL rule %s:%s: %s", group_id.c_str(), status.first.c_str(), sai_serialize_status(status.second).c_str());
+            continue;
+        }
+
+        removeRuleInfo(group, status.first);
+        group.m_rule_count--;
+        gCrmOrch->decCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
+    }
+}
+
+task_process_status DashAclGroupMgr::onTagUpdate(const string& group_id, const string& tag_id)
+{
+    SWSS_LOG_ENTER();
+
+    auto group_it = m_groups_table.find(group_id);
+    if (group_it == m_groups_table.end())
+    {
+        SWSS_LOG_INFO("ACL group %s doesn't exist", group_id.c_str());
+        return task_success;
+    }
+    auto& group = group_it->second;
+
+    auto tag_it = group.m_tag_rules.find(tag_id);
+    if (tag_it == group.m_tag_rules.end())
+    {
+        return task_success;
+    }
+
+    // Only the rules whose expanded prefix lists changed are reprogrammed
+    map<string, DashAclRuleBulkContext> rules;
+    for (const auto& rule_id : tag_it->second)
+    {
+        const auto& rule_info = group.m_dash_acl_rule_table.at(rule_id);
+
+        auto& ctxt = rules[rule_id];
+        ctxt.group_id = group_id;
+        ctxt.rule_id = rule_id;
+        ctxt.rule = rule_info.m_rule;
+        expandRulePrefixes(group, ctxt);
+
+        if (isPrefixListEqual(ctxt.src_prefixes, rule_info.m_src_prefixes) &&
+            isPrefixListEqual(ctxt.dst_prefixes, rule_info.m_dst_prefixes))
+        {
+            rules.erase(rule_id);
+        }
+    }
+
+    if (rules.empty())
+    {
+        SWSS_LOG_INFO("ACL group %s is not affected by prefix tag %s update", group_id.c_str(), tag_id.c_str());
+        return task_success;
+    }
+
+    SWSS_LOG_INFO("Updating %zu rules of ACL group %s on prefix tag %s update", rules.size(), group_id.c_str(), tag_id.c_str());
+
+    if (!isBound(group))
+    {
+        return updateRules(group_id, group, rules);
+    }
+
+    return rebuildGroup(group_id, group, rules);
+}
+
+task_process_status DashAclGroupMgr::updateRules(const string& group_id, DashAclGroup& group, map<string, DashAclRuleBulkContext>& rules)
+{
+    SWSS_LOG_ENTER();
+
+    // The group is not bound to any ENI, so the rules can be replaced in place
+    for (auto& it : rules)
+    {
+        auto& ctxt = it.second;
+        ctxt.object_statuses.emplace_back();
+        m_rule_bulker.remove_entry(&ctxt.object_statuses.back(), group.m_dash_acl_rule_table.at(it.first).m_dash_acl_rule_id);
+        createRule(group.m_dash_acl_group_id, ctxt);
+    }
+
+    m_rule_bulker.flush();
+
+    task_process_status status = task_success;
+    for (const auto& it : rules)
+    {
+        auto rv = createRulePost(it.second);
+        if (rv != task_success)
+        {
+            status = rv;
+        }
+    }
+
+    return status;
+}
+
+task_process_status DashAclGroupMgr::rebuildGroup(const string& group_id, DashAclGroup& group, map<string, DashAclRuleBulkContext>& rules)
+{
+    SWSS_LOG_ENTER();
+
+    // The group is in use, so a shadow group with all the rules is programmed and
+    // swapped in with a single ENI attribute update per bound stage. The old group
+    // keeps serving traffic until the new one is complete.
+    DashAclGroup shadow;
+    shadow.m_ip_version = group.m_ip_version;
+    create(shadow);
+    if (shadow.m_dash_acl_group_id == SAI_NULL_OBJECT_ID)
+    {
+        SWSS_LOG_ERROR("Failed to create shadow ACL group for %s", group_id.c_str());
+        return task_failed;
+    }
+
+    for (const auto& rule : group.m_dash_acl_rule_table)
+    {
+        if (rules.find(rule.first) != rules.end())
+        {
+            continue;
+        }
+
+        auto& ctxt = rules[rule.first];
+        ctxt.group_id = group_id;
+        ctxt.rule_id = rule.first;
+        ctxt.rule = rule.second.m_rule;
+        ctxt.src_prefixes = rule.second.m_src_prefixes;
+        ctxt.dst_prefixes = rule.second.m_dst_prefixes;
+    }
+
+    for (auto& it : rules)
+    {
+        createRule(shadow.m_dash_acl_group_id, it.second);
+    }
+
+    m_rule_bulker.flush();
+
+    bool created = all_of(rules.begin(), rules.end(), [] (const auto& it) {
+        return it.second.object_ids.front() != SAI_NULL_OBJECT_ID;
+    });
+
+    if (!created)
+    {
+        SWSS_LOG_ERROR("Failed to create rules of shadow ACL group for %s", group_id.c_str());
+
+        map<string, sai_status_t> statuses;
+        for (const auto& it : rules)
+        {
+            if (it.second.object_ids.front() != SAI_NULL_OBJECT_ID)
+            {
+                m_rule_bulker.remove_entry(&statuses[it.first], it.second.object_ids.front());
+            }
+        }
+        m_rule_bulker.flush();
+
+        remove(shadow);
+
+        return task_failed;
+    }
+
+    // Every ENI stage is moved to the shadow group. If any of them fails, the
+    // stages already moved are bound back and the shadow group is dropped, so
+    // the ENIs are never left split between the two groups.
+    vector<tuple<const EniEntry*, DashAclDirection, DashAclStage>> moved;
+    auto rebind = [&] (const DashAclGroup::EniTable& table, DashAclDirection direction)
+    {
+        for (const auto& eni_it : table)
+        {
+            auto eni = m_dash_orch->getEni(eni_it.first);
+            if (!eni)
+            {
+                SWSS_LOG_ERROR("ENI %s not found, cannot rebind ACL group %s", eni_it.first.c_str(), group_id.c_str());
+                return false;
+            }
+
+            for (const auto& stage : eni_it.second)
+            {
+                if (bind(shadow, *eni, direction, stage) != task_success)
+                {
+                    SWSS_LOG_ERROR("Failed to rebind ACL group %s to ENI %s", group_id.c_str(), eni_it.first.c_str());
+                    return false;
+                }
+                moved.emplace_back(eni, direction, stage);
+            }
+        }
+
+        return true;
+    };
+
+    if (!rebind(group.m_in_tables, DashAclDirection::IN) || !rebind(group.m_out_tables, DashAclDirection::OUT))
+    {
+        for (const auto& it : moved)
+        {
+            bind(group, *get<0>(it), get<1>(it), get<2>(it));
+        }
+
+        map<string, sai_status_t> statuses;
+        for (const auto& it : rules)
+        {
+            m_rule_bulker.remove_entry(&statuses[it.first], it.second.object_ids.front());
+        }
+        m_rule_bulker.flush();
+
+        for (const auto& status : statuses)
+        {
+            if (status.second != SAI_STATUS_SUCCESS && status.second != SAI_STATUS_ITEM_NOT_FOUND)
+            {
+                SWSS_LOG_ERROR("Failed to remove shadow ACL rule %s:%s: %s", group_id.c_str(), status.first.c_str(), sai_serialize_status(status.second).c_str());
+            }
+        }
+
+        remove(shadow);
+
+        return task_need_retry;
+    }
+
+    CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
+            CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
+    for (size_t i = 0; i < rules.size(); i++)
+    {
+        gCrmOrch->incCrmDashAclUsedCounter(crm_rtype, shadow.m_dash_acl_group_id);
+    }
+
+    // Old rules and group are no longer referenced
+    map<string, sai_status_t> statuses;
+    for (const auto& rule : group.m_dash_acl_rule_table)
+    {
+        m_rule_bulker.remove_entry(&statuses[rule.first], rule.second.m_dash_acl_rule_id);
+    }
+    m_rule_bulker.flush();
+
+    for (const auto& status : statuses)
+    {
+        if (status.second != SAI_STATUS_SUCCESS && status.second != SAI_STATUS_ITEM_NOT_FOUND)
+        {
+            SWSS_LOG_ERROR("Failed to remove ACL rule %s:%s: %s", group_id.c_str(), status.first.c_str(), sai_serialize_status(status.second).c_str());
+        }
+    }
+
+    remove(group);
+    group.m_dash_acl_group_id = shadow.m_dash_acl_group_id;
+
+    for (const auto& it : rules)
+    {
+        auto& rule_info = group.m_dash_acl_rule_table.at(it.first);
+        rule_info.m_dash_acl_rule_id = it.second.object_ids.front();
+        rule_info.m_src_prefixes = it.second.src_prefixes;
+        rule_info.m_dst_prefixes = it.second.dst_prefixes;
+    }
+
+    SWSS_LOG_INFO("Rebuilt ACL group %s with %zu rules", group_id.c_str(), rules.size());
+
+    return task_success;
+}
+
+task_process_status DashAclGroupMgr::bind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage)
 {
     SWSS_LOG_ENTER();
 
@@ -431,8 +906,10 @@ void DashAclGroupMgr::bind(const DashAclGroup& group, const EniEntry& eni, DashA
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to bind ACL group to ENI: %d", status);
-        handleSaiSetStatus((sai_api_t)SAI_API_DASH_ENI, status);
+        return handleSaiSetStatus((sai_api_t)SAI_API_DASH_ENI, status);
     }
+
+    return task_success;
 }
 
 task_process_status DashAclGroupMgr::bind(const string& group_id, const string& eni_id, DashAclDirection direction, DashAclStage stage)
@@ -461,7 +938,11 @@ task_process_status DashAclGroupMgr::bind(const string& group_id, const string&
         return task_failed;
     }
 
-    bind(group, *eni, direction, stage);
+    auto status = bind(group, *eni, direction, stage);
+    if (status != task_success)
+    {
+        return status;
+    }
 
     auto& table = (direction == DashAclDirection::IN) ? group.m_in_tables : group.m_out_tables;
     auto& eni_stages = table[eni_id];
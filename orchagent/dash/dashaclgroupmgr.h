@@ -1,12 +1,15 @@
 #pragma once
 
 #include <unordered_map>
+#include <map>
 #include <memory>
+#include <deque>
 
 #include <saitypes.h>
 #include <sai.h>
 #include <logger.h>
 
+#include "bulker.h"
 #include "dashorch.h"
 #include "dashtagmgr.h"
 #include "table.h"
@@ -58,19 +61,49 @@ struct DashAclRuleInfo
     std::unordered_set<std::string> m_src_tags;
     std::unordered_set<std::string> m_dst_tags;
 
+    // Rule and its tag-expanded prefix lists, used to regenerate it on tag updates
+    DashAclRule m_rule;
+    std::vector<sai_ip_prefix_t> m_src_prefixes;
+    std::vector<sai_ip_prefix_t> m_dst_prefixes;
+
     DashAclRuleInfo() = default;
     DashAclRuleInfo(const DashAclRule &rule);
 
     bool isTagUsed(const std::string &tag_id) const;
 };
 
+struct DashAclRuleBulkContext
+{
+    std::string group_id;
+    std::string rule_id;
+    DashAclRule rule;
+
+    // Attribute lists referenced by the bulker until it is flushed
+    std::vector<std::uint8_t> protocols;
+    std::vector<sai_ip_prefix_t> src_prefixes;
+    std::vector<sai_ip_prefix_t> dst_prefixes;
+
+    std::deque<sai_object_id_t> object_ids;
+    std::deque<sai_status_t> object_statuses;
+    DashAclRuleBulkContext() {}
+
+    DashAclRuleBulkContext(const DashAclRuleBulkContext&) = delete;
+    DashAclRuleBulkContext(DashAclRuleBulkContext&&) = delete;
+};
+
 struct DashAclGroup
 {
     using EniTable = std::unordered_map<std::string, std::unordered_set<DashAclStage>>;
+    using RuleTable = std::unordered_map<std::string, DashAclRuleInfo>;
     sai_object_id_t m_dash_acl_group_id = SAI_NULL_OBJECT_ID;
     std::unordered_set<std::string> m_tags;
     int m_rule_count = 0;
 
+    RuleTable m_dash_acl_rule_table;
+
+    // Reverse index of the rules using each prefix tag
+    std::unordered_map<std::string, std::unordered_set<std::string>> m_tag_rules;
+
     sai_ip_addr_family_t m_ip_version;
     
     EniTable m_in_tables;
@@ -98,6 +131,7 @@ class DashAclGroupMgr
     DashAclOrch *m_dash_acl_orch;
     std::unordered_map<std::string, DashAclGroup> m_groups_table;
     std::unique_ptr<swss::Table> m_dash_acl_rules_table;
+    ObjectBulker<sai_dash_acl_api_t> m_rule_bulker;
 
 public:
     DashAclGroupMgr(swss::DBConnector *db, DashOrch *dashorch, DashAclOrch *aclorch);
@@ -107,7 +141,17 @@ public:
     bool exists(const std::string& group_id) const;
     bool isBound(const std::string& group_id);
 
-    task_process_status createRule(const std::string& group_id, const std::string& rule_id, DashAclRule& rule);
+    // Rules are created and removed through the bulker. createRule/removeRule queue the SAI
+    // operations and return task_success if the context has to be completed by the matching
+    // *Post method after flushRules(), any other status finishes the task immediately.
+    task_process_status createRule(DashAclRuleBulkContext& ctxt);
+    task_process_status createRulePost(const DashAclRuleBulkContext& ctxt);
+    task_process_status removeRule(DashAclRuleBulkContext& ctxt);
+    task_process_status removeRulePost(const DashAclRuleBulkContext& ctxt);
+    void flushRules();
+
+    // Regenerates the rules of the group whose prefix lists changed with the tag
+    task_process_status onTagUpdate(const std::string& group_id, const std::string& tag_id);
 
     task_process_status bind(const std::string& group_id, const std::string& eni_id, DashAclDirection direction, DashAclStage stage);
     task_process_status unbind(const std::string& group_id, const std::string& eni_id, DashAclDirection direction, DashAclStage stage);
@@ -117,9 +161,15 @@ private:
     void create(DashAclGroup& group);
     void remove(DashAclGroup& group);
 
-    DashAclRuleInfo createRule(DashAclGroup& group, DashAclRule& rule);
+    void expandRulePrefixes(DashAclGroup& group, DashAclRuleBulkContext& ctxt);
+    void createRule(sai_object_id_t group_oid, DashAclRuleBulkContext& ctxt);
+    void addRuleInfo(DashAclGroup& group, const DashAclRuleBulkContext& ctxt);
+    void removeRuleInfo(DashAclGroup& group, const std::string& rule_id);
+    void removeRules(const std::string& group_id, DashAclGroup& group);
+    task_process_status updateRules(const std::string& group_id, DashAclGroup& group, std::map<std::string, DashAclRuleBulkContext>& rules);
+    task_process_status rebuildGroup(const std::string& group_id, DashAclGroup& group, std::map<std::string, DashAclRuleBulkContext>& rules);
 
-    void bind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage);
+    task_process_status bind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage);
     void unbind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage);
     bool isBound(const DashAclGroup& group);
     void attachTags(const std::string &group_id, const std::unordered_set<std::string>& tags);
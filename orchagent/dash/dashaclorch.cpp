@@ -23,6 +23,8 @@ using namespace dash::acl_group;
 using namespace dash::tag;
 using namespace dash::types;
 
+extern int gBatchSize;
+
 template <typename T, typename... Args>
 static bool extractVariables(const string &input, char delimiter, T &output, Args &... args)
 {
@@ -107,10 +109,68 @@ DashTagMgr& DashAclOrch::getDashAclTagMgr()
     return m_tag_mgr;
 }
 
+void DashAclOrch::doTask()
+{
+    SWSS_LOG_ENTER();
+
+    // Same retry quota as Orch::doTask()
+    auto threshold = gBatchSize == 0 ? 30000 : gBatchSize;
+    size_t count = 0;
+
+    // Drain the tables in dependency order, so that a group, its rules and
+    // its ENI bindings received together are programmed in a single pass:
+    // prefix tags -> groups -> rules (bulk) -> ENI bindings.
+    for (const string table : {APP_DASH_PREFIX_TAG_TABLE_NAME,
+                               APP_DASH_ACL_GROUP_TABLE_NAME,
+                               APP_DASH_ACL_RULE_TABLE_NAME,
+                               APP_DASH_ACL_IN_TABLE_NAME,
+                               APP_DASH_ACL_OUT_TABLE_NAME})
+    {
+        auto *executor = getExecutor(table);
+        if (!executor)
+        {
+            continue;
+        }
+
+        try
+        {
+            count += retryToSync(table, threshold - count);
+            executor->drain();
+        }
+        catch (const std::invalid_argument& e)
+        {
+            SWSS_LOG_ERROR("Exception caught: type=invalid_argument, table=%s, orch=%s, error=%s",
+                           table.c_str(), typeid(*this).name(), e.what());
+        }
+        catch (const std::logic_error& e)
+        {
+            SWSS_LOG_ERROR("Exception caught: type=logic_error, table=%s, orch=%s, error=%s",
+                           table.c_str(), typeid(*this).name(), e.what());
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_ERROR("Exception caught: type=exception, table=%s, orch=%s, error=%s",
+                           table.c_str(), typeid(*this).name(), e.what());
+        }
+        catch (...)
+        {
+            SWSS_LOG_ERROR("Exception caught: type=unknown, table=%s, orch=%s",
+                           table.c_str(), typeid(*this).name());
+        }
+    }
+}
+
 void DashAclOrch::doTask(ConsumerBase &consumer)
 {
     SWSS_LOG_ENTER();
 
+    const string &table_name = consumer.getTableName();
+    if (table_name == APP_DASH_ACL_RULE_TABLE_NAME)
+    {
+        doTaskAclRuleTable(consumer);
+        return;
+    }
+
     const static TaskMap TaskMap = {
         PbWorker<AclIn>::makeMemberTask(APP_DASH_ACL_IN_TABLE_NAME, SET_COMMAND, &DashAclOrch::taskUpdateDashAclIn, this),
         KeyOnlyWorker::makeMemberTask(APP_DASH_ACL_IN_TABLE_NAME, DEL_COMMAND, &DashAclOrch::taskRemoveDashAclIn, this),
@@ -118,12 +178,10 @@ void DashAclOrch::doTask(ConsumerBase &consumer)
         KeyOnlyWorker::makeMemberTask(APP_DASH_ACL_OUT_TABLE_NAME, DEL_COMMAND, &DashAclOrch::taskRemoveDashAclOut, this),
         PbWorker<AclGroup>::makeMemberTask(APP_DASH_ACL_GROUP_TABLE_NAME, SET_COMMAND, &DashAclOrch::taskUpdateDashAclGroup, this),
         KeyOnlyWorker::makeMemberTask(APP_DASH_ACL_GROUP_TABLE_NAME, DEL_COMMAND, &DashAclOrch::taskRemoveDashAclGroup, this),
-        PbWorker<AclRule>::makeMemberTask(APP_DASH_ACL_RULE_TABLE_NAME, SET_COMMAND, &DashAclOrch::taskUpdateDashAclRule, this),
         PbWorker<PrefixTag>::makeMemberTask(APP_DASH_PREFIX_TAG_TABLE_NAME, SET_COMMAND, &DashAclOrch::taskUpdateDashPrefixTag, this),
         KeyOnlyWorker::makeMemberTask(APP_DASH_PREFIX_TAG_TABLE_NAME, DEL_COMMAND, &DashAclOrch::taskRemoveDashPrefixTag, this),
      };
 
-    const string &table_name = consumer.getTableName();
     auto itr = consumer.m_toSync.begin();
     while (itr != consumer.m_toSync.end())
     {
@@ -260,33 +318,135 @@ task_process_status DashAclOrch::taskRemoveDashAclGroup(
     return m_group_mgr.remove(key);
 }
 
-task_process_status DashAclOrch::taskUpdateDashAclRule(
-    const string &key,
-    const AclRule &data)
+void DashAclOrch::doTaskAclRuleTable(ConsumerBase &consumer)
 {
     SWSS_LOG_ENTER();
 
-    string group_id, rule_id;
-    if (!extractVariables(key, ':', group_id, rule_id))
+    auto it = consumer.m_toSync.begin();
+    while (it != consumer.m_toSync.end())
     {
-        SWSS_LOG_ERROR("Failed to parse key %s", key.c_str());
-        return task_failed;
-    }
+        // Map to store ACL rule bulk op contexts
+        std::map<std::pair<std::string, std::string>,
+            DashAclRuleBulkContext> toBulk;
 
-    DashAclRule rule = {};
+        while (it != consumer.m_toSync.end())
+        {
+            KeyOpFieldsValuesTuple tuple = it->second;
+            const string& key = kfvKey(tuple);
+            auto op = kfvOp(tuple);
 
-    if (!from_pb(data, rule))
-    {
-        return task_failed;
-    }
+            // A rule can only be queued once per bulk, a following operation on it goes to the next bulk
+            if (toBulk.find(make_pair(key, SET_COMMAND)) != toBulk.end() ||
+                toBulk.find(make_pair(key, DEL_COMMAND)) != toBulk.end())
+            {
+                break;
+            }
 
-    if (m_group_mgr.isBound(group_id))
-    {
-        SWSS_LOG_INFO("Failed to set dash ACL rule %s:%s, ACL group is bound to the ENI", group_id.c_str(), rule_id.c_str());
-        return task_failed;
-    }
+            try
+            {
+                auto& ctxt = toBulk.emplace(std::piecewise_construct,
+                        std::forward_as_tuple(key, op),
+                        std::forward_as_tuple()).first->second;
+
+                if (!extractVariables(key, ':', ctxt.group_id, ctxt.rule_id))
+                {
+                    SWSS_LOG_ERROR("Failed to parse key %s", key.c_str());
+                    it = consumer.m_toSync.erase(it);
+                    continue;
+                }
+
+                if (m_group_mgr.isBound(ctxt.group_id))
+                {
+                    SWSS_LOG_INFO("Failed to %s dash ACL rule %s, ACL group is bound to the ENI", op.c_str(), key.c_str());
+                    it = consumer.m_toSync.erase(it);
+                    continue;
+                }
+
+                task_process_status task_status = task_failed;
+                if (op == SET_COMMAND)
+                {
+                    AclRule data;
+                    if (!parsePbMessage(kfvFieldsValues(tuple), data) || !from_pb(data, ctxt.rule))
+                    {
+                        SWSS_LOG_ERROR("Failed to parse dash ACL rule %s", key.c_str());
+                        it = consumer.m_toSync.erase(it);
+                        continue;
+                    }
+
+                    task_status = m_group_mgr.createRule(ctxt);
+                }
+                else if (op == DEL_COMMAND)
+                {
+                    task_status = m_group_mgr.removeRule(ctxt);
+                }
+                else
+                {
+                    SWSS_LOG_ERROR("Unknown operation %s", op.c_str());
+                }
+
+                if (task_status == task_success)
+                {
+                    // Completed after the bulk flush
+                    it++;
+                }
+                else
+                {
+                    if (task_status != task_ignore)
+                    {
+                        SWSS_LOG_ERROR("Task %s - %s failed", APP_DASH_ACL_RULE_TABLE_NAME, op.c_str());
+                    }
+                    it = consumer.m_toSync.erase(it);
+                }
+            }
+            catch (const std::exception& e)
+            {
+                SWSS_LOG_ERROR("Exception caught processing %s entry %s: %s", consumer.getTableName().c_str(), key.c_str(), e.what());
+                it = consumer.m_toSync.erase(it);
+            }
+        }
+
+        m_group_mgr.flushRules();
+
+        auto it_prev = consumer.m_toSync.begin();
+        while (it_prev != it)
+        {
+            KeyOpFieldsValuesTuple t = it_prev->second;
+            string key = kfvKey(t);
+            string op = kfvOp(t);
 
-    return m_group_mgr.createRule(group_id, rule_id, rule);
+            try
+            {
+                auto found = toBulk.find(make_pair(key, op));
+                if (found == toBulk.end())
+                {
+                    it_prev++;
+                    continue;
+                }
+
+                const auto& ctxt = found->second;
+                task_process_status task_status = (op == SET_COMMAND) ?
+                    m_group_mgr.createRulePost(ctxt) : m_group_mgr.removeRulePost(ctxt);
+
+                if (task_status == task_need_retry)
+                {
+                    it_prev++;
+                    continue;
+                }
+
+                if (task_status != task_success)
+                {
+                    SWSS_LOG_ERROR("Task %s - %s failed", APP_DASH_ACL_RULE_TABLE_NAME, op.c_str());
+                }
+
+                it_prev = consumer.m_toSync.erase(it_prev);
+            }
+            catch (const std::exception& e)
+            {
+                SWSS_LOG_ERROR("Exception caught in post-processing %s entry %s: %s", consumer.getTableName().c_str(), key.c_str(), e.what());
+                it_prev = consumer.m_toSync.erase(it_prev);
+            }
+        }
+    }
 }
 
 task_process_status DashAclOrch::taskUpdateDashPrefixTag(
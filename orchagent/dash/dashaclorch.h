@@ -40,7 +40,9 @@ public:
     DashTagMgr& getDashAclTagMgr();
 
 private:
+    void doTask() override;
     void doTask(ConsumerBase &consumer);
+    void doTaskAclRuleTable(ConsumerBase &consumer);
 
     task_process_status taskUpdateDashAclIn(
         const std::string &key,
@@ -60,10 +62,6 @@ private:
     task_process_status taskRemoveDashAclGroup(
         const std::string &key);
 
-    task_process_status taskUpdateDashAclRule(
-        const std::string &key,
-        const dash::acl_rule::AclRule &data);
-
     task_process_status taskUpdateDashPrefixTag(
         const std::string &key,
         const dash::tag::PrefixTag &data);
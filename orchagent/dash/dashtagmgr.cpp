@@ -1,3 +1,5 @@
+#include <cstring>
+
 #include "dashtagmgr.h"
 
 #include "dashaclorch.h"
@@ -21,6 +23,37 @@ bool from_pb(const dash::tag::PrefixTag& data, DashTag& tag)
     return true;
 }
 
+bool isPrefixListEqual(const vector<sai_ip_prefix_t>& lhs, const vector<sai_ip_prefix_t>& rhs)
+{
+    if (lhs.size() != rhs.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < lhs.size(); i++)
+    {
+        if (lhs[i].addr_family != rhs[i].addr_family)
+        {
+            return false;
+        }
+
+        if (lhs[i].addr_family == SAI_IP_ADDR_FAMILY_IPV4)
+        {
+            if ((lhs[i].addr.ip4 != rhs[i].addr.ip4) || (lhs[i].mask.ip4 != rhs[i].mask.ip4))
+            {
+                return false;
+            }
+        }
+        else if (memcmp(lhs[i].addr.ip6, rhs[i].addr.ip6, sizeof(lhs[i].addr.ip6)) ||
+                 memcmp(lhs[i].mask.ip6, rhs[i].mask.ip6, sizeof(lhs[i].mask.ip6)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 DashTagMgr::DashTagMgr(DashAclOrch *aclorch) :
     m_dash_acl_orch(aclorch)
 {
@@ -67,7 +100,20 @@ task_process_status DashTagMgr::update(const string& tag_id, const DashTag& new_
     // Update tag prefixes
     tag.m_prefixes = new_tag.m_prefixes;
 
-    return task_success;
+    // Groups only reprogram the rules whose expanded prefix lists changed, so
+    // an unchanged tag or a retry after a partial failure is cheap
+    task_process_status status = task_success;
+    for (const auto& group_id : tag.m_groups)
+    {
+        auto rv = m_dash_acl_orch->getDashAclGroupMgr().onTagUpdate(group_id, tag_id);
+        if (rv != task_success)
+        {
+            SWSS_LOG_ERROR("Failed to update ACL group %s with prefix tag %s", group_id.c_str(), tag_id.c_str());
+            status = rv;
+        }
+    }
+
+    return status;
 }
 
 task_process_status DashTagMgr::remove(const string& tag_id)
@@ -19,6 +19,7 @@ struct DashTag {
 };
 
 bool from_pb(const dash::tag::PrefixTag& data, DashTag& tag);
+bool isPrefixListEqual(const std::vector<sai_ip_prefix_t>& lhs, const std::vector<sai_ip_prefix_t>& rhs);
 
 class DashAclOrch;
 
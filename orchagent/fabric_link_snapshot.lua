@@ -0,0 +1,17 @@
+-- KEYS - fabric link keys
+-- return "index|field|value|..." per existing key, index is the position of the key in KEYS
+
+local rets = {}
+
+for i = 1, #KEYS do
+    local values = redis.call('HGETALL', KEYS[i])
+    if #values > 0 then
+        local row = { tostring(i) }
+        for j = 1, #values do
+            row[#row + 1] = values[j]
+        end
+        rets[#rets + 1] = table.concat(row, '|')
+    end
+end
+
+return rets
@@ -4,6 +4,7 @@
 #include <fstream>
 #include <sstream>
 #include <tuple>
+#include <algorithm>
 
 #include "logger.h"
 #include "schema.h"
@@ -12,6 +13,8 @@
 #include "saihelper.h"
 #include "converter.h"
 #include "stringutility.h"
+#include "redisapi.h"
+#include "tokenize.h"
 #include <chrono>
 #include <math.h>
 
@@ -77,6 +80,20 @@ const vector<sai_switch_stat_t> switch_drop_counter_ids =
     SAI_SWITCH_STAT_PACKET_INTEGRITY_DROP
 };
 
+class FabricMonitorExecutor : public Executor
+{
+public:
+    FabricMonitorExecutor(swss::SelectableEvent *event, FabricPortsOrch *orch, const string &name)
+        : Executor(event, orch, name)
+    {
+    }
+
+    void execute() override
+    {
+        static_cast<FabricPortsOrch *>(m_orch)->doMonitorResults();
+    }
+};
+
 FabricPortsOrch::FabricPortsOrch(DBConnector *appl_db, vector<table_name_with_pri_t> &tableNames,
                                  bool fabricPortStatEnabled, bool fabricQueueStatEnabled) :
         Orch(appl_db, tableNames),
@@ -92,13 +109,12 @@ FabricPortsOrch::FabricPortsOrch(DBConnector *appl_db, vector<table_name_with_pr
     SWSS_LOG_NOTICE( "FabricPortsOrch constructor" );
 
     m_state_db = shared_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
-    m_stateTable = unique_ptr<Table>(new Table(m_state_db.get(), APP_FABRIC_PORT_TABLE_NAME));
-    m_fabricCapacityTable = unique_ptr<Table>(new Table(m_state_db.get(), STATE_FABRIC_CAPACITY_TABLE_NAME));
+    m_stateDbPipeline = make_shared<RedisPipeline>(m_state_db.get());
+    m_statePipeTable = unique_ptr<Table>(new Table(m_stateDbPipeline.get(), APP_FABRIC_PORT_TABLE_NAME, true));
 
     m_counter_db = shared_ptr<DBConnector>(new DBConnector("COUNTERS_DB", 0));
     m_portNameQueueCounterTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_FABRIC_QUEUE_NAME_MAP));
     m_portNamePortCounterTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_FABRIC_PORT_NAME_MAP));
-    m_fabricCounterTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_TABLE));
 
     // Create Switch level drop counters for voq & fabric switch.
     if ((gMySwitchType == "voq") || (gMySwitchType == "fabric"))
@@ -113,6 +129,31 @@ FabricPortsOrch::FabricPortsOrch(DBConnector *appl_db, vector<table_name_with_pr
     m_applTable = unique_ptr<Table>(new Table(m_appl_db.get(), APP_FABRIC_MONITOR_PORT_TABLE_NAME));
     m_applMonitorConstTable = unique_ptr<Table>(new Table(m_appl_db.get(), APP_FABRIC_MONITOR_DATA_TABLE_NAME));
 
+    // The monitor thread gets its own connections, a DBConnector is not thread safe
+    m_monitorStateDb = shared_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
+    m_monitorCounterDb = shared_ptr<DBConnector>(new DBConnector("COUNTERS_DB", 0));
+    m_monitorApplDb = shared_ptr<DBConnector>(new DBConnector("APPL_DB", 0));
+    m_monitorPipeline = make_shared<RedisPipeline>(m_monitorStateDb.get());
+    m_monitorStateTable = unique_ptr<Table>(new Table(m_monitorPipeline.get(), APP_FABRIC_PORT_TABLE_NAME, true));
+    m_monitorCapacityTable = unique_ptr<Table>(new Table(m_monitorPipeline.get(), STATE_FABRIC_CAPACITY_TABLE_NAME, true));
+    m_monitorCounterTable = unique_ptr<Table>(new Table(m_monitorCounterDb.get(), COUNTERS_TABLE));
+    m_monitorApplTable = unique_ptr<Table>(new Table(m_monitorApplDb.get(), APP_FABRIC_MONITOR_PORT_TABLE_NAME));
+    m_monitorApplConstTable = unique_ptr<Table>(new Table(m_monitorApplDb.get(), APP_FABRIC_MONITOR_DATA_TABLE_NAME));
+
+    try
+    {
+        string snapshotLuaScript = swss::loadLuaScript("fabric_link_snapshot.lua");
+        for (auto db : { m_monitorStateDb.get(), m_monitorCounterDb.get(), m_monitorApplDb.get() })
+        {
+            m_monitorSnapshotSha = swss::loadRedisScript(db, snapshotLuaScript);
+        }
+    }
+    catch (...)
+    {
+        m_monitorSnapshotSha.clear();
+        SWSS_LOG_WARN("Fabric link snapshot script was not loaded, fabric links are read one by one");
+    }
+
     m_fabricPortStatEnabled = fabricPortStatEnabled;
     m_fabricQueueStatEnabled = fabricQueueStatEnabled;
 
@@ -130,6 +171,24 @@ FabricPortsOrch::FabricPortsOrch(DBConnector *appl_db, vector<table_name_with_pr
         m_debugTimer->start();
         SWSS_LOG_INFO("Fabric monitor starts at init time");
     }
+
+    m_monitorEvent = new SelectableEvent();
+    Orch::addExecutor(new FabricMonitorExecutor(m_monitorEvent, this, "FABRIC_MONITOR_RESULT"));
+    m_monitorThread = std::thread(&FabricPortsOrch::monitorThread, this);
+}
+
+FabricPortsOrch::~FabricPortsOrch()
+{
+    SWSS_LOG_ENTER();
+
+    FabricMonitorJob job;
+    job.type = FabricMonitorJob::SHUTDOWN;
+    postMonitorJob(std::move(job));
+
+    if (m_monitorThread.joinable())
+    {
+        m_monitorThread.join();
+    }
 }
 
 bool FabricPortsOrch::checkFabricPortMonState()
@@ -324,6 +383,8 @@ void FabricPortsOrch::generateQueueStats()
     m_isQueueStatsGenerated = true;
 }
 
+// Runs on the main loop: SAI calls stay on the main thread, and SAI has no
+// bulk get for these port attributes. The STATE_DB writes are pipelined.
 void FabricPortsOrch::updateFabricPortState()
 {
     if (!m_getFabricPortListDone) return;
@@ -411,14 +472,12 @@ void FabricPortsOrch::updateFabricPortState()
             values.emplace_back("PORT_DOWN_SEEN_LAST_TIME",
                                 to_string(m_portDownSeenLastTime[lane]));
         }
-        m_stateTable->set(key, values);
+        m_statePipeTable->set(key, values);
     }
 }
 
-void FabricPortsOrch::updateFabricDebugCounters()
+void FabricPortsOrch::updateFabricDebugCounters(FabricMonitorResult &result)
 {
-    if (!m_getFabricPortListDone) return;
-
     SWSS_LOG_ENTER();
 
     // Get time
@@ -441,7 +500,7 @@ void FabricPortsOrch::updateFabricDebugCounters()
     std::vector<FieldValueTuple> constValues;
     SWSS_LOG_INFO("updateFabricDebugCounters");
 
-    bool setCfgVal = m_applMonitorConstTable->get("FABRIC_MONITOR_DATA", constValues);
+    bool setCfgVal = m_monitorApplConstTable->get("FABRIC_MONITOR_DATA", constValues);
     if (!setCfgVal)
     {
         SWSS_LOG_INFO("applConstKey %s default values not set", applConstKey.c_str());
@@ -483,10 +542,10 @@ void FabricPortsOrch::updateFabricDebugCounters()
     }
 
     // Get debug countesrs (e.g. # of cells with crc errors, # of cells)
-    for (auto p : m_fabricLanePortMap)
+    for (auto &p : m_monitorLinks)
     {
         int lane = p.first;
-        sai_object_id_t port = p.second;
+        sai_object_id_t port = p.second.port;
 
         string key = FABRIC_PORT_PREFIX + to_string(lane);
         // so basically port is the oid
@@ -497,7 +556,8 @@ void FabricPortsOrch::updateFabricDebugCounters()
             "SAI_PORT_STAT_IF_IN_FABRIC_DATA_UNITS", // rx data cells
             "SAI_PORT_STAT_IF_IN_FEC_NOT_CORRECTABLE_FRAMES"  // cell with uncorrectable errors
         };
-        if (!m_fabricCounterTable->get(sai_serialize_object_id(port), fieldValues))
+        fieldValues = p.second.counters;
+        if (fieldValues.empty())
         {
            SWSS_LOG_INFO("no port %s", sai_serialize_object_id(port).c_str());
         }
@@ -587,7 +647,8 @@ void FabricPortsOrch::updateFabricDebugCounters()
         string applKey = APPL_FABRIC_PORT_PREFIX + to_string(lane);
         std::vector<FieldValueTuple> applValues;
         string applResult = "False";
-        bool exist = m_applTable->get(applKey, applValues);
+        applValues = p.second.appl;
+        bool exist = !applValues.empty();
         if (!exist)
         {
             SWSS_LOG_INFO("No app infor for port %s", applKey.c_str());
@@ -616,7 +677,8 @@ void FabricPortsOrch::updateFabricDebugCounters()
         // Get the consecutive polls from the state db
         std::vector<FieldValueTuple> values;
         string valuePt;
-        exist = m_stateTable->get(key, values);
+        values = p.second.state;
+        exist = p.second.hasState;
         if (!exist)
         {
             SWSS_LOG_INFO("No state infor for port %s", key.c_str());
@@ -747,13 +809,13 @@ void FabricPortsOrch::updateFabricDebugCounters()
 
             SWSS_LOG_INFO("port %s about to clear counters.", key.c_str());
             SWSS_LOG_INFO("origIsolated %d isolated %d cfgIsolated %d clearCnt %s", origIsolated, isolated, cfgIsolated, clearCnt ? "true":"flase");
-            clearFabricCnt(lane, clearCnt);
+            clearFabricCnt(lane, clearCnt, result);
 
             if (linkFlap > 0 )
             {
                 SWSS_LOG_NOTICE("port %s possibly flapping %d", key.c_str(), linkFlap);
             }
-            updateStateDbTable(m_stateTable, key, "PORT_DOWN_COUNT_handled", lnkDownCnt);
+            updateStateDbTable(lane, "PORT_DOWN_COUNT_handled", lnkDownCnt);
             continue;
         }
         // clear lane done
@@ -771,7 +833,7 @@ void FabricPortsOrch::updateFabricDebugCounters()
         {
             skipCrcErrorsOnLinkupCount += 1;
             valuePt = to_string(skipCrcErrorsOnLinkupCount);
-            updateStateDbTable(m_stateTable, key, "SKIP_CRC_ERR_ON_LNKUP_CNT", skipCrcErrorsOnLinkupCount);
+            updateStateDbTable(lane, "SKIP_CRC_ERR_ON_LNKUP_CNT", skipCrcErrorsOnLinkupCount);
             // update error counters.
             prevCrcErrors = crcErrors;
         }
@@ -822,7 +884,7 @@ void FabricPortsOrch::updateFabricDebugCounters()
         {
             skipFecErrorsOnLinkupCount += 1;
             valuePt = to_string(skipFecErrorsOnLinkupCount);
-            updateStateDbTable(m_stateTable, key, "SKIP_FEC_ERR_ON_LNKUP_CNT", skipFecErrorsOnLinkupCount);
+            updateStateDbTable(lane, "SKIP_FEC_ERR_ON_LNKUP_CNT", skipFecErrorsOnLinkupCount);
             // update error counters
             prevCodeErrors = codeErrors;
         }
@@ -881,7 +943,7 @@ void FabricPortsOrch::updateFabricDebugCounters()
                 permIsolate = 1;
             }
             SWSS_LOG_NOTICE("port %s get permIsolated", key.c_str() );
-            updateStateDbTable(m_stateTable, key, "AUTO_ISOLATED", autoIsolated);
+            updateStateDbTable(lane, "AUTO_ISOLATED", autoIsolated);
             SWSS_LOG_NOTICE("port %s set AUTO_ISOLATED %d", key.c_str(), autoIsolated);
         }
         else if (autoIsolated == 1 && consecutivePollsWithNoErrors >= recoveryPollsCfg
@@ -890,7 +952,7 @@ void FabricPortsOrch::updateFabricDebugCounters()
             // Link is isolated, but no longer needs to be.
             SWSS_LOG_INFO("port %s healthy again", key.c_str());
             autoIsolated = 0;
-            updateStateDbTable(m_stateTable, key, "AUTO_ISOLATED", autoIsolated);
+            updateStateDbTable(lane, "AUTO_ISOLATED", autoIsolated);
             SWSS_LOG_NOTICE("port %s set AUTO_ISOLATED %d", key.c_str(), autoIsolated);
         }
         if (cfgIsolated == 1)
@@ -928,7 +990,7 @@ void FabricPortsOrch::updateFabricDebugCounters()
             {
                 setVal = true;
             }
-            isolateFabricLink(lane, setVal);
+            result.isolations.emplace_back(lane, setVal);
         }
         else
         {
@@ -936,27 +998,27 @@ void FabricPortsOrch::updateFabricDebugCounters()
         }
 
         // Update state_db with link isolation data
-        updateStateDbTable(m_stateTable, key, "POLL_WITH_ERRORS", consecutivePollsWithErrors);
-        updateStateDbTable(m_stateTable, key, "POLL_WITH_NO_ERRORS", consecutivePollsWithNoErrors);
-        updateStateDbTable(m_stateTable, key, "POLL_WITH_FEC_ERRORS", consecutivePollsWithFecErrs);
-        updateStateDbTable(m_stateTable, key, "POLL_WITH_NOFEC_ERRORS", consecutivePollsWithNoFecErrs);
-        updateStateDbTable(m_stateTable, key, "CONFIG_ISOLATED", cfgIsolated);
-        updateStateDbTable(m_stateTable, key, "ISOLATED", isolated);
-        updateStateDbTable(m_stateTable, key, "PRM_ISOLATED", permIsolate);
+        updateStateDbTable(lane, "POLL_WITH_ERRORS", consecutivePollsWithErrors);
+        updateStateDbTable(lane, "POLL_WITH_NO_ERRORS", consecutivePollsWithNoErrors);
+        updateStateDbTable(lane, "POLL_WITH_FEC_ERRORS", consecutivePollsWithFecErrs);
+        updateStateDbTable(lane, "POLL_WITH_NOFEC_ERRORS", consecutivePollsWithNoFecErrs);
+        updateStateDbTable(lane, "CONFIG_ISOLATED", cfgIsolated);
+        updateStateDbTable(lane, "ISOLATED", isolated);
+        updateStateDbTable(lane, "PRM_ISOLATED", permIsolate);
 
         // Update state_db with error rate
         valuePt = to_string(rxCells);
-        m_stateTable->hset(key, "RX_CELLS", valuePt.c_str());
+        updateStateDbTable(lane, "RX_CELLS", valuePt);
         SWSS_LOG_INFO("port %s set RX_CELLS %s",
                       key.c_str(), valuePt.c_str());
 
         valuePt = to_string(prevCrcErrors);
-        m_stateTable->hset(key, "CRC_ERRORS", valuePt.c_str());
+        updateStateDbTable(lane, "CRC_ERRORS", valuePt);
         SWSS_LOG_INFO("port %s set CRC_ERRORS %s",
                       key.c_str(), valuePt.c_str());
 
         valuePt = to_string(prevCodeErrors);
-        m_stateTable->hset(key, "CODE_ERRORS", valuePt.c_str());
+        updateStateDbTable(lane, "CODE_ERRORS", valuePt);
         SWSS_LOG_INFO("port %s set CODE_ERRORS %s",
                       key.c_str(), valuePt.c_str());
     }
@@ -964,8 +1026,35 @@ void FabricPortsOrch::updateFabricDebugCounters()
 
 // Update state_db tables
 void FabricPortsOrch::updateStateDbTable(
-    const std::unique_ptr<Table>& stateTable,
-    const std::string& key,
+    int lane,
+    const std::string& field,
+    const std::string& value)
+{
+    string key = FABRIC_PORT_PREFIX + to_string(lane);
+
+    // Queue the update on the monitor pipeline, it is flushed once per poll
+    m_monitorStateTable->hset(key, field, value);
+
+    // Keep the snapshot of the ongoing poll in sync, later stages read it
+    auto link = m_monitorLinks.find(lane);
+    if (link != m_monitorLinks.end())
+    {
+        auto &state = link->second.state;
+        auto fv = find_if(state.begin(), state.end(),
+                          [&field](const FieldValueTuple &f) { return fvField(f) == field; });
+        if (fv != state.end())
+        {
+            fvValue(*fv) = value;
+        }
+        else
+        {
+            state.emplace_back(field, value);
+        }
+    }
+}
+
+void FabricPortsOrch::updateStateDbTable(
+    int lane,
     const std::string& field,
     uint64_t value)
 {
@@ -973,11 +1062,11 @@ void FabricPortsOrch::updateStateDbTable(
     std::string valueStr = std::to_string(value);
 
     // Update the state table
-    stateTable->hset(key, field, valueStr.c_str());
+    updateStateDbTable(lane, field, valueStr);
 
     // Log the update
-    SWSS_LOG_INFO("%s updates %s to %s %lld",
-                  key.c_str(), field.c_str(), valueStr.c_str(), (long long)value);
+    SWSS_LOG_INFO("%s%d updates %s to %s %lld", FABRIC_PORT_PREFIX,
+                  lane, field.c_str(), valueStr.c_str(), (long long)value);
 }
 
 // Isolate/Unisolate a fabric link
@@ -1003,7 +1092,7 @@ void FabricPortsOrch::isolateFabricLink(int lane, bool isolate)
 }
 
 // Clear fabric link counters
-void FabricPortsOrch::clearFabricCnt(int lane, bool clearIsolation)
+void FabricPortsOrch::clearFabricCnt(int lane, bool clearIsolation, FabricMonitorResult &result)
 {
     // Key to get/set state_db valuse.
     string key = FABRIC_PORT_PREFIX + to_string(lane);
@@ -1026,19 +1115,19 @@ void FabricPortsOrch::clearFabricCnt(int lane, bool clearIsolation)
     if (clearIsolation)
     {
         isolated = 0;
-        // sai call to unisolate the link
-        isolateFabricLink(lane, !clearIsolation);
-        updateStateDbTable(m_stateTable, key, "ISOLATED", isolated);
+        // sai call to unisolate the link, made by the main loop
+        result.isolations.emplace_back(lane, !clearIsolation);
+        updateStateDbTable(lane, "ISOLATED", isolated);
     }
 
     // update state_db
-    updateStateDbTable(m_stateTable, key, "SKIP_CRC_ERR_ON_LNKUP_CNT", skipCrcErrorsOnLinkupCount);
-    updateStateDbTable(m_stateTable, key, "SKIP_FEC_ERR_ON_LNKUP_CNT", skipFecErrorsOnLinkupCount);
-    updateStateDbTable(m_stateTable, key, "POLL_WITH_ERRORS", consecutivePollsWithErrors);
-    updateStateDbTable(m_stateTable, key, "POLL_WITH_NO_ERRORS", consecutivePollsWithNoErrors);
-    updateStateDbTable(m_stateTable, key, "POLL_WITH_FEC_ERRORS", consecutivePollsWithFecErrs);
-    updateStateDbTable(m_stateTable, key, "POLL_WITH_NOFEC_ERRORS", consecutivePollsWithNoFecErrs);
-    updateStateDbTable(m_stateTable, key, "AUTO_ISOLATED", autoIsolated);
+    updateStateDbTable(lane, "SKIP_CRC_ERR_ON_LNKUP_CNT", skipCrcErrorsOnLinkupCount);
+    updateStateDbTable(lane, "SKIP_FEC_ERR_ON_LNKUP_CNT", skipFecErrorsOnLinkupCount);
+    updateStateDbTable(lane, "POLL_WITH_ERRORS", consecutivePollsWithErrors);
+    updateStateDbTable(lane, "POLL_WITH_NO_ERRORS", consecutivePollsWithNoErrors);
+    updateStateDbTable(lane, "POLL_WITH_FEC_ERRORS", consecutivePollsWithFecErrs);
+    updateStateDbTable(lane, "POLL_WITH_NOFEC_ERRORS", consecutivePollsWithNoFecErrs);
+    updateStateDbTable(lane, "AUTO_ISOLATED", autoIsolated);
 }
 
 // Update fabric capacity
@@ -1055,7 +1144,7 @@ void FabricPortsOrch::updateFabricCapacity()
 
     // Get capacity warning threshold from APPL_DB table FABRIC_MONITOR_DATA
     // By default, this threshold is 100 (percentage).
-    bool cfgVal = m_applMonitorConstTable->get("FABRIC_MONITOR_DATA", constValues);
+    bool cfgVal = m_monitorApplConstTable->get("FABRIC_MONITOR_DATA", constValues);
     if(!cfgVal)
     {
         SWSS_LOG_INFO("%s default values not set", applKey.c_str());
@@ -1078,7 +1167,7 @@ void FabricPortsOrch::updateFabricCapacity()
 
     // Check fabric capacity.
     SWSS_LOG_INFO("FabricPortsOrch::updateFabricCapacity start");
-    for (auto p : m_fabricLanePortMap)
+    for (auto &p : m_monitorLinks)
     {
         int lane = p.first;
         string key = FABRIC_PORT_PREFIX + to_string(lane);
@@ -1090,7 +1179,8 @@ void FabricPortsOrch::updateFabricCapacity()
         string autoIsolated = "0";
 
         // Get fabric serdes link status from STATE_DB
-        bool exist = m_stateTable->get(key, values);
+        values = p.second.state;
+        bool exist = p.second.hasState;
         if (!exist)
         {
             SWSS_LOG_INFO("No state infor for port %s", key.c_str());
@@ -1165,7 +1255,7 @@ void FabricPortsOrch::updateFabricCapacity()
     SWSS_LOG_INFO("Capacity: %d Missing %d", capacity, downCapacity);
 
     // Get the last event and time that event happend from STATE_DB
-    bool capacity_data = m_fabricCapacityTable->get("FABRIC_CAPACITY_DATA", constValues);
+    bool capacity_data = m_monitorCapacityTable->get("FABRIC_CAPACITY_DATA", constValues);
     if (capacity_data)
     {
         for (auto cv : constValues)
@@ -1222,20 +1312,20 @@ void FabricPortsOrch::updateFabricCapacity()
 
     // Update STATE_DB
     SWSS_LOG_INFO("FabricPortsOrch::updateFabricCapacity now update STATE_DB");
-    m_fabricCapacityTable->hset("FABRIC_CAPACITY_DATA", "fabric_capacity", to_string(capacity));
-    m_fabricCapacityTable->hset("FABRIC_CAPACITY_DATA", "missing_capacity", to_string(downCapacity));
-    m_fabricCapacityTable->hset("FABRIC_CAPACITY_DATA", "operating_links", to_string(operating_links));
-    m_fabricCapacityTable->hset("FABRIC_CAPACITY_DATA", "number_of_links", to_string(total_links));
-    m_fabricCapacityTable->hset("FABRIC_CAPACITY_DATA", "warning_threshold", to_string(threshold));
-    m_fabricCapacityTable->hset("FABRIC_CAPACITY_DATA", "last_event", event);
-    m_fabricCapacityTable->hset("FABRIC_CAPACITY_DATA", "last_event_time", lastTime);
+    m_monitorCapacityTable->hset("FABRIC_CAPACITY_DATA", "fabric_capacity", to_string(capacity));
+    m_monitorCapacityTable->hset("FABRIC_CAPACITY_DATA", "missing_capacity", to_string(downCapacity));
+    m_monitorCapacityTable->hset("FABRIC_CAPACITY_DATA", "operating_links", to_string(operating_links));
+    m_monitorCapacityTable->hset("FABRIC_CAPACITY_DATA", "number_of_links", to_string(total_links));
+    m_monitorCapacityTable->hset("FABRIC_CAPACITY_DATA", "warning_threshold", to_string(threshold));
+    m_monitorCapacityTable->hset("FABRIC_CAPACITY_DATA", "last_event", event);
+    m_monitorCapacityTable->hset("FABRIC_CAPACITY_DATA", "last_event_time", lastTime);
 }
 
 
 // Update rate on fabric links
 void FabricPortsOrch::updateFabricRate()
 {
-    for (auto p : m_fabricLanePortMap)
+    for (auto &p : m_monitorLinks)
     {
         int lane = p.first;
         string key = FABRIC_PORT_PREFIX + to_string(lane);
@@ -1243,7 +1333,8 @@ void FabricPortsOrch::updateFabricRate()
         // get oldRateAverage, oldData, oldTime(time.time) from state db
         std::vector<FieldValueTuple> values;
         string valuePt;
-        bool exist = m_stateTable->get(key, values);
+        values = p.second.state;
+        bool exist = p.second.hasState;
         double oldRxRate = 0;
         uint64_t oldRxData = 0;
         double oldTxRate = 0;
@@ -1296,13 +1387,14 @@ void FabricPortsOrch::updateFabricRate()
 
         // get the newData and newTime for this poll
         vector<FieldValueTuple> fieldValues;
-        sai_object_id_t port = p.second;
+        sai_object_id_t port = p.second.port;
         static const array<string, 2> cntNames =
         {
             "SAI_PORT_STAT_IF_OUT_OCTETS", // snmpBcmTxDataBytes
             "SAI_PORT_STAT_IF_IN_OCTETS", // snmpBcmRxDataBytes
         };
-        if (!m_fabricCounterTable->get(sai_serialize_object_id(port), fieldValues))
+        fieldValues = p.second.counters;
+        if (fieldValues.empty())
         {
             SWSS_LOG_INFO("no port %s", sai_serialize_object_id(port).c_str());
         }
@@ -1371,19 +1463,19 @@ void FabricPortsOrch::updateFabricRate()
                          (long long)newTxRate, (long long)txBytes, newTime );
 
         valuePt = to_string(newRxRate);
-        m_stateTable->hset(key, "OLD_RX_RATE_AVG", valuePt.c_str());
+        updateStateDbTable(lane, "OLD_RX_RATE_AVG", valuePt);
 
         valuePt = to_string(rxBytes);
-        m_stateTable->hset(key, "OLD_RX_DATA", valuePt.c_str());
+        updateStateDbTable(lane, "OLD_RX_DATA", valuePt);
 
         valuePt = to_string(newTxRate);
-        m_stateTable->hset(key, "OLD_TX_RATE_AVG", valuePt.c_str());
+        updateStateDbTable(lane, "OLD_TX_RATE_AVG", valuePt);
 
         valuePt = to_string(txBytes);
-        m_stateTable->hset(key, "OLD_TX_DATA", valuePt.c_str());
+        updateStateDbTable(lane, "OLD_TX_DATA", valuePt);
 
         valuePt = to_string(newTime);
-        m_stateTable->hset(key, "LAST_TIME", valuePt.c_str());
+        updateStateDbTable(lane, "LAST_TIME", valuePt);
     }
 }
 
@@ -1488,58 +1580,12 @@ void FabricPortsOrch::doFabricPortTask(Consumer &consumer)
 
             if (isolateStatus == "False")
             {
-                // get state db value of forceIolatedCntInStateDb,
-                // if forceIolatedCnt != forceIolatedCntInStateDb
-                //    1) clear all isolate related flags in stateDb
-                //    2) replace the cnt in stateb
-                //
-
-                std::vector<FieldValueTuple> values;
-                string state_key = FABRIC_PORT_PREFIX + lanes;
-                bool exist = m_stateTable->get(state_key, values);
-                if (!exist)
-                {
-                    SWSS_LOG_INFO("React to unshut No state infor for port %s", state_key.c_str());
-                }
-                else
-                {
-                    SWSS_LOG_INFO("React to unshut port %s", state_key.c_str());
-                }
-                int curVal = 0;
-                for (auto val : values)
-                {
-                    if(fvField(val) == "FORCE_UN_ISOLATE")
-                    {
-                        curVal = stoi(fvValue(val));
-                    }
-                }
-                SWSS_LOG_INFO("Current %d Config %d", curVal, forceIsolateCnt);
-                if (curVal != forceIsolateCnt)
-                {
-                    // update all related fields in state_db:
-                    //     POLL_WITH_ERRORS 0
-                    //     POLL_WITH_NO_ERRORS 8
-                    //     POLL_WITH_FEC_ERRORS 0
-                    //     POLL_WITH_NOFEC_ERRORS 8
-                    //     CONFIG_ISOLATED 0
-                    //     ISOLATED 0
-                    //     AUTO_ISOLATED 0
-                    //     PRM_ISOLATED 0
-                    updateStateDbTable(m_stateTable, state_key, "FORCE_UN_ISOLATE", forceIsolateCnt);
-                    updateStateDbTable(m_stateTable, state_key, "POLL_WITH_ERRORS", m_defaultPollWithErrors);
-                    updateStateDbTable(m_stateTable, state_key, "POLL_WITH_NO_ERRORS", m_defaultPollWithNoErrors);
-                    updateStateDbTable(m_stateTable, state_key, "POLL_WITH_FEC_ERRORS", m_defaultPollWithFecErrors);
-                    updateStateDbTable(m_stateTable, state_key, "POLL_WITH_NOFEC_ERRORS", m_defaultPollWithNoFecErrors);
-                    updateStateDbTable(m_stateTable, state_key, "CONFIG_ISOLATED", m_defaultConfigIsolated);
-                    updateStateDbTable(m_stateTable, state_key, "ISOLATED", m_defaultIsolated);
-                    updateStateDbTable(m_stateTable, state_key, "AUTO_ISOLATED", m_defaultAutoIsolated);
-                    updateStateDbTable(m_stateTable, state_key, "PRM_ISOLATED", m_defaultIsolated);
-                    linkQueues.clear();
-
-                    // unisolate the link
-                    bool setVal = false;
-                    isolateFabricLink(to_uint<uint8_t>(lanes), setVal);
-                }
+                // The monitor thread owns the isolation state of the links
+                FabricMonitorJob job;
+                job.type = FabricMonitorJob::FORCE_UNISOLATE;
+                job.lane = lanes;
+                job.forceUnisolateCnt = forceIsolateCnt;
+                postMonitorJob(std::move(job));
             }
         }
         it = consumer.m_toSync.erase(it);
@@ -1573,6 +1619,7 @@ void FabricPortsOrch::doTask(swss::SelectableTimer &timer)
         if (m_getFabricPortListDone)
         {
             updateFabricPortState();
+            m_stateDbPipeline->flush();
         }
         if (((gMySwitchType == "voq") || (gMySwitchType == "fabric")) && (!m_isSwitchStatsGenerated))
         {
@@ -1607,13 +1654,275 @@ void FabricPortsOrch::doTask(swss::SelectableTimer &timer)
         if (m_getFabricPortListDone)
         {
             SWSS_LOG_INFO("Fabric monitor enabled");
-            updateFabricDebugCounters();
-            updateFabricCapacity();
-            updateFabricRate();
+            if (m_monitorPollPending)
+            {
+                // Do not queue polls behind one that is still running
+                m_monitorSkippedPolls++;
+                SWSS_LOG_INFO("Fabric monitor poll still in progress, skipping");
+                return;
+            }
+
+            FabricMonitorJob job;
+            job.type = FabricMonitorJob::POLL;
+            job.lanes = m_fabricLanePortMap;
+            job.skippedPolls = m_monitorSkippedPolls;
+            m_monitorPollPending = true;
+            postMonitorJob(std::move(job));
+        }
+    }
+}
+
+void FabricPortsOrch::postMonitorJob(FabricMonitorJob &&job)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_monitorLock);
+        m_monitorJobs.push(std::move(job));
+    }
+    m_monitorSignal.notify_one();
+}
+
+void FabricPortsOrch::doMonitorResults()
+{
+    SWSS_LOG_ENTER();
+
+    vector<FabricMonitorResult> results;
+    {
+        std::lock_guard<std::mutex> lock(m_monitorLock);
+        results.swap(m_monitorResults);
+    }
+
+    for (const auto &result : results)
+    {
+        for (const auto &isolation : result.isolations)
+        {
+            isolateFabricLink(isolation.first, isolation.second);
+        }
+        if (result.poll)
+        {
+            m_monitorPollPending = false;
         }
     }
 }
 
+// Runs on m_monitorThread
+void FabricPortsOrch::monitorThread()
+{
+    SWSS_LOG_ENTER();
+
+    while (true)
+    {
+        FabricMonitorJob job;
+        {
+            std::unique_lock<std::mutex> lock(m_monitorLock);
+            m_monitorSignal.wait(lock, [this]() { return !m_monitorJobs.empty(); });
+            job = std::move(m_monitorJobs.front());
+            m_monitorJobs.pop();
+        }
+
+        if (job.type == FabricMonitorJob::SHUTDOWN)
+        {
+            break;
+        }
+
+        FabricMonitorResult result;
+        result.poll = (job.type == FabricMonitorJob::POLL);
+        try
+        {
+            if (result.poll)
+            {
+                doMonitorPoll(job, result);
+            }
+            else
+            {
+                doForceUnisolate(job, result);
+            }
+            m_monitorPipeline->flush();
+        }
+        catch (const std::exception &e)
+        {
+            SWSS_LOG_ERROR("Fabric monitor failed to process %s: %s",
+                           result.poll ? "poll" : "force unisolate", e.what());
+        }
+        m_monitorLinks.clear();
+
+        {
+            std::lock_guard<std::mutex> lock(m_monitorLock);
+            m_monitorResults.push_back(std::move(result));
+        }
+        m_monitorEvent->notify();
+    }
+}
+
+// Reads the state, counters and configuration of every fabric link once per
+// poll. The debug counter, capacity and rate stages all work on this snapshot.
+void FabricPortsOrch::loadMonitorSnapshot(const map<int, sai_object_id_t> &lanes)
+{
+    m_monitorLinks.clear();
+
+    vector<string> stateKeys, counterKeys, applKeys;
+    for (const auto &p : lanes)
+    {
+        m_monitorLinks[p.first].port = p.second;
+        stateKeys.push_back(FABRIC_PORT_PREFIX + to_string(p.first));
+        counterKeys.push_back(sai_serialize_object_id(p.second));
+        applKeys.push_back(APPL_FABRIC_PORT_PREFIX + to_string(p.first));
+    }
+
+    if (!m_monitorSnapshotSha.empty())
+    {
+        try
+        {
+            // One script call per DB instead of three reads per link
+            auto state = readMonitorHashes(*m_monitorStateDb, *m_monitorStateTable, stateKeys);
+            auto counters = readMonitorHashes(*m_monitorCounterDb, *m_monitorCounterTable, counterKeys);
+            auto appl = readMonitorHashes(*m_monitorApplDb, *m_monitorApplTable, applKeys);
+
+            size_t i = 0;
+            for (auto &p : m_monitorLinks)
+            {
+                auto &link = p.second;
+                link.hasState = !state[i].empty();
+                link.state = std::move(state[i]);
+                link.counters = std::move(counters[i]);
+                link.appl = std::move(appl[i]);
+                i++;
+            }
+            return;
+        }
+        catch (const std::exception &e)
+        {
+            SWSS_LOG_ERROR("Failed to read the snapshot of %zu fabric links: %s", lanes.size(), e.what());
+        }
+    }
+
+    size_t i = 0;
+    for (auto &p : m_monitorLinks)
+    {
+        auto &link = p.second;
+        link.hasState = m_monitorStateTable->get(stateKeys[i], link.state);
+        m_monitorCounterTable->get(counterKeys[i], link.counters);
+        m_monitorApplTable->get(applKeys[i], link.appl);
+        i++;
+    }
+}
+
+// Reads the hashes of keys in table with a single fabric_link_snapshot.lua
+// call. The hash of a key that does not exist is left empty.
+vector<vector<FieldValueTuple>> FabricPortsOrch::readMonitorHashes(DBConnector &db, Table &table, const vector<string> &keys)
+{
+    vector<string> redisKeys;
+    redisKeys.reserve(keys.size());
+    for (const auto &key : keys)
+    {
+        redisKeys.push_back(table.getKeyName(key));
+    }
+
+    vector<vector<FieldValueTuple>> hashes(keys.size());
+    for (const auto &row : swss::runRedisScript(db, m_monitorSnapshotSha, redisKeys, {}))
+    {
+        auto values = tokenize(row, '|');
+        size_t index = to_uint<uint32_t>(values[0]);
+        if (index == 0 || index > keys.size())
+        {
+            continue;
+        }
+
+        auto &hash = hashes[index - 1];
+        for (size_t j = 1; j + 1 < values.size(); j += 2)
+        {
+            hash.emplace_back(values[j], values[j + 1]);
+        }
+    }
+    return hashes;
+}
+
+void FabricPortsOrch::doMonitorPoll(const FabricMonitorJob &job, FabricMonitorResult &result)
+{
+    SWSS_LOG_ENTER();
+
+    auto start = std::chrono::steady_clock::now();
+
+    loadMonitorSnapshot(job.lanes);
+    updateFabricDebugCounters(result);
+    updateFabricCapacity();
+    updateFabricRate();
+    m_monitorPipeline->flush();
+
+    auto pollUsec = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count());
+    m_monitorPolls++;
+    m_monitorMaxPollUsec = max(m_monitorMaxPollUsec, pollUsec);
+
+    vector<FieldValueTuple> stats;
+    stats.emplace_back("links", to_string(job.lanes.size()));
+    stats.emplace_back("polls", to_string(m_monitorPolls));
+    stats.emplace_back("skipped_polls", to_string(job.skippedPolls));
+    stats.emplace_back("last_poll_usec", to_string(pollUsec));
+    stats.emplace_back("max_poll_usec", to_string(m_monitorMaxPollUsec));
+    m_monitorCapacityTable->set(STATE_FABRIC_MONITOR_STATS_KEY, stats);
+
+    SWSS_LOG_INFO("Fabric monitor poll of %zu links took %" PRIu64 " usec, %zu isolation updates",
+                  job.lanes.size(), pollUsec, result.isolations.size());
+}
+
+void FabricPortsOrch::doForceUnisolate(const FabricMonitorJob &job, FabricMonitorResult &result)
+{
+    SWSS_LOG_ENTER();
+
+    // get state db value of forceIolatedCntInStateDb,
+    // if forceIolatedCnt != forceIolatedCntInStateDb
+    //    1) clear all isolate related flags in stateDb
+    //    2) replace the cnt in stateb
+    //
+
+    std::vector<FieldValueTuple> values;
+    int lane = to_uint<uint8_t>(job.lane);
+    string state_key = FABRIC_PORT_PREFIX + job.lane;
+    bool exist = m_monitorStateTable->get(state_key, values);
+    if (!exist)
+    {
+        SWSS_LOG_INFO("React to unshut No state infor for port %s", state_key.c_str());
+    }
+    else
+    {
+        SWSS_LOG_INFO("React to unshut port %s", state_key.c_str());
+    }
+    int curVal = 0;
+    for (auto val : values)
+    {
+        if(fvField(val) == "FORCE_UN_ISOLATE")
+        {
+            curVal = stoi(fvValue(val));
+        }
+    }
+    SWSS_LOG_INFO("Current %d Config %d", curVal, job.forceUnisolateCnt);
+    if (curVal != job.forceUnisolateCnt)
+    {
+        // update all related fields in state_db:
+        //     POLL_WITH_ERRORS 0
+        //     POLL_WITH_NO_ERRORS 8
+        //     POLL_WITH_FEC_ERRORS 0
+        //     POLL_WITH_NOFEC_ERRORS 8
+        //     CONFIG_ISOLATED 0
+        //     ISOLATED 0
+        //     AUTO_ISOLATED 0
+        //     PRM_ISOLATED 0
+        updateStateDbTable(lane, "FORCE_UN_ISOLATE", job.forceUnisolateCnt);
+        updateStateDbTable(lane, "POLL_WITH_ERRORS", m_defaultPollWithErrors);
+        updateStateDbTable(lane, "POLL_WITH_NO_ERRORS", m_defaultPollWithNoErrors);
+        updateStateDbTable(lane, "POLL_WITH_FEC_ERRORS", m_defaultPollWithFecErrors);
+        updateStateDbTable(lane, "POLL_WITH_NOFEC_ERRORS", m_defaultPollWithNoFecErrors);
+        updateStateDbTable(lane, "CONFIG_ISOLATED", m_defaultConfigIsolated);
+        updateStateDbTable(lane, "ISOLATED", m_defaultIsolated);
+        updateStateDbTable(lane, "AUTO_ISOLATED", m_defaultAutoIsolated);
+        updateStateDbTable(lane, "PRM_ISOLATED", m_defaultIsolated);
+        linkQueues.clear();
+
+        // unisolate the link
+        result.isolations.emplace_back(lane, false);
+    }
+}
+
 void FabricPortsOrch::createSwitchDropCounters(void)
 {
     std::unordered_set<std::string> counter_stats;
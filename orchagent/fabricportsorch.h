@@ -2,11 +2,17 @@
 #define SWSS_FABRICPORTSORCH_H
 
 #include <map>
+#include <queue>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 
 #include "orch.h"
 #include "observer.h"
 #include "observer.h"
 #include "producertable.h"
+#include "redispipeline.h"
+#include "selectableevent.h"
 #include "flex_counter_manager.h"
 
 using Clock = std::chrono::system_clock;
@@ -14,16 +20,53 @@ using TimePoint = std::chrono::time_point<Clock>;
 
 #define STATE_FABRIC_CAPACITY_TABLE_NAME "FABRIC_CAPACITY_TABLE"
 #define STATE_PORT_CAPACITY_TABLE_NAME "PORT_CAPACITY_TABLE"
+#define STATE_FABRIC_MONITOR_STATS_KEY "FABRIC_MONITOR_STATS"
 
 class FabricPortsOrch : public Orch, public Subject
 {
 public:
     FabricPortsOrch(DBConnector *appl_db, vector<table_name_with_pri_t> &tableNames,
                     bool fabricPortStatEnabled=true, bool fabricQueueStatEnabled=true);
+    ~FabricPortsOrch();
     bool allPortsReady();
     void generateQueueStats();
 
+    // Applies the link isolation decisions posted by the monitor thread
+    void doMonitorResults();
+
 private:
+    /*
+     * Fabric link monitoring (debug counters, capacity and rate) runs on
+     * m_monitorThread. The main loop hands it a snapshot of the fabric lanes
+     * on every debug poll and applies the isolation decisions it posts back,
+     * so SAI calls stay on the main thread.
+     */
+    struct FabricMonitorJob
+    {
+        enum Type { POLL, FORCE_UNISOLATE, SHUTDOWN };
+
+        Type type = POLL;
+        map<int, sai_object_id_t> lanes;
+        string lane;
+        int forceUnisolateCnt = 0;
+        uint64_t skippedPolls = 0;
+    };
+
+    struct FabricMonitorResult
+    {
+        bool poll = false;
+        vector<pair<int, bool>> isolations;
+    };
+
+    struct FabricLinkSnapshot
+    {
+        sai_object_id_t port = SAI_NULL_OBJECT_ID;
+        bool hasState = false;
+        vector<FieldValueTuple> state;
+        vector<FieldValueTuple> counters;
+        vector<FieldValueTuple> appl;
+    };
+
     bool m_fabricPortStatEnabled;
     bool m_fabricQueueStatEnabled;
 
@@ -31,19 +74,46 @@ private:
     shared_ptr<DBConnector> m_counter_db;
     shared_ptr<DBConnector> m_appl_db;
 
-    unique_ptr<Table> m_stateTable;
     unique_ptr<Table> m_portNameQueueCounterTable;
     unique_ptr<Table> m_portNamePortCounterTable;
-    unique_ptr<Table> m_fabricCounterTable;
     unique_ptr<Table> m_applTable;
-    unique_ptr<Table> m_fabricCapacityTable;
     unique_ptr<Table> m_applMonitorConstTable;
     unique_ptr<ProducerTable> m_flexCounterTable;
     shared_ptr<Table> m_counterNameToSwitchStatMap;
 
+    shared_ptr<RedisPipeline> m_stateDbPipeline;
+    unique_ptr<Table> m_statePipeTable;
+
     swss::SelectableTimer *m_timer = nullptr;
     swss::SelectableTimer *m_debugTimer = nullptr;
 
+    // Owned by the monitor thread
+    shared_ptr<DBConnector> m_monitorStateDb;
+    shared_ptr<DBConnector> m_monitorCounterDb;
+    shared_ptr<DBConnector> m_monitorApplDb;
+    shared_ptr<RedisPipeline> m_monitorPipeline;
+    unique_ptr<Table> m_monitorStateTable;
+    unique_ptr<Table> m_monitorCapacityTable;
+    unique_ptr<Table> m_monitorCounterTable;
+    unique_ptr<Table> m_monitorApplTable;
+    unique_ptr<Table> m_monitorApplConstTable;
+    map<int, FabricLinkSnapshot> m_monitorLinks;
+    string m_monitorSnapshotSha;
+    uint64_t m_monitorPolls = 0;
+    uint64_t m_monitorMaxPollUsec = 0;
+
+    // Shared between the main loop and the monitor thread
+    std::thread m_monitorThread;
+    std::mutex m_monitorLock;
+    std::condition_variable m_monitorSignal;
+    std::queue<FabricMonitorJob> m_monitorJobs;
+    vector<FabricMonitorResult> m_monitorResults;
+    swss::SelectableEvent *m_monitorEvent = nullptr;
+
+    // Main loop side of the monitor
+    bool m_monitorPollPending = false;
+    uint64_t m_monitorSkippedPolls = 0;
+
     FlexCounterManager port_stat_manager;
     FlexCounterManager queue_stat_manager;
     FlexCounterManager *switch_drop_counter_manager = nullptr;
@@ -72,19 +142,29 @@ private:
     int getFabricPortList();
     void generatePortStats();
     void updateFabricPortState();
-    void updateFabricDebugCounters();
+    void updateFabricDebugCounters(FabricMonitorResult &result);
     void updateFabricCapacity();
     bool checkFabricPortMonState();
     void updateFabricRate();
     void createSwitchDropCounters();
-    void clearFabricCnt(int lane, bool clearIsolation);
+    void clearFabricCnt(int lane, bool clearIsolation, FabricMonitorResult &result);
     void updateStateDbTable(
-        const unique_ptr<Table>& stateTable,
-        const string& key,
+        int lane,
+        const string& field,
+        const string& value);
+    void updateStateDbTable(
+        int lane,
         const string& field,
         uint64_t value);
     void isolateFabricLink(int lane, bool isolate);
 
+    void postMonitorJob(FabricMonitorJob &&job);
+    void monitorThread();
+    void loadMonitorSnapshot(const map<int, sai_object_id_t> &lanes);
+    vector<vector<FieldValueTuple>> readMonitorHashes(DBConnector &db, Table &table, const vector<string> &keys);
+    void doMonitorPoll(const FabricMonitorJob &job, FabricMonitorResult &result);
+    void doForceUnisolate(const FabricMonitorJob &job, FabricMonitorResult &result);
+
     void doTask() override;
     void doTask(Consumer &consumer);
     void doFabricPortTask(Consumer &consumer);
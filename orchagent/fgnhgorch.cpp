@@ -3,6 +3,7 @@
 #include "fgnhgorch.h"
 #include "orch_zmq_config.h"
 #include "routeorch.h"
+#include "bulker.h"
 #include "logger.h"
 #include "swssnet.h"
 #include "crmorch.h"
@@ -14,6 +15,7 @@
 
 extern sai_object_id_t gVirtualRouterId;
 extern sai_object_id_t gSwitchId;
+extern size_t gMaxBulkSize;
 
 extern sai_next_hop_group_api_t*    sai_next_hop_group_api;
 extern sai_route_api_t*             sai_route_api;
@@ -213,44 +215,156 @@ void FgNhgOrch::calculateBankHashBucketStartIndices(FgNhgEntry *fgNhgEntry)
 }
 
 
-void FgNhgOrch::setStateDbRouteEntry(const IpPrefix &ipPrefix, uint32_t index, NextHopKey nextHop)
+void FgNhgOrch::setStateDbRouteEntry(const IpPrefix &ipPrefix, const vector<FieldValueTuple> &bucketNextHops)
 {
     SWSS_LOG_ENTER();
 
+    if (bucketNextHops.empty())
+    {
+        return;
+    }
+
+    /* All the buckets of the prefix go to STATE_DB in a single hmset */
     string key = ipPrefix.to_string();
-    string field = std::to_string(index);
-    string value = nextHop.to_string();
+    m_stateWarmRestartRouteTable.set(key, bucketNextHops);
+
+    SWSS_LOG_INFO("Set state db entry for ip prefix %s with %zu hash buckets",
+                  key.c_str(), bucketNextHops.size());
+}
 
-    m_stateWarmRestartRouteTable.hset(key, field, value);
+void FgNhgOrch::writeHashBucketChange(FGNextHopGroupEntry *syncd_fg_route_entry, HashBucketIdx index, sai_object_id_t nh_oid,
+        NextHopKey nextHop)
+{
+    SWSS_LOG_ENTER();
 
-    SWSS_LOG_INFO("Set state db entry for ip prefix %s next hop %s with index %d",
-                  key.c_str(), value.c_str(), index);
+    /* A bucket can move more than once while the banks are rebalanced, only its final next hop is written */
+    m_pendingBucketChanges[index] = { syncd_fg_route_entry->nhopgroup_members[index], nh_oid, nextHop };
 }
 
-bool FgNhgOrch::writeHashBucketChange(FGNextHopGroupEntry *syncd_fg_route_entry, HashBucketIdx index, sai_object_id_t nh_oid,
-        const IpPrefix &ipPrefix, NextHopKey nextHop)
+bool FgNhgOrch::flushHashBucketChanges(FGNextHopGroupEntry *syncd_fg_route_entry,
+        const BankFGNextHopGroupMap &prev_fgnhg_map, const IpPrefix &ipPrefix)
 {
     SWSS_LOG_ENTER();
 
-    sai_attribute_t nhgm_attr;
-    nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
-    nhgm_attr.value.oid = nh_oid;
-    sai_status_t status = sai_next_hop_group_api->set_next_hop_group_member_attribute(
-                                                              syncd_fg_route_entry->nhopgroup_members[index],
-                                                              &nhgm_attr);
-    if (status != SAI_STATUS_SUCCESS)
+    if (m_pendingBucketChanges.empty())
+    {
+        return true;
+    }
+
+    ObjectBulker<sai_next_hop_group_api_t> nextHopGroupMemberBulker(sai_next_hop_group_api, gSwitchId, gMaxBulkSize);
+    for (const auto &change : m_pendingBucketChanges)
+    {
+        sai_attribute_t nhgm_attr;
+        nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
+        nhgm_attr.value.oid = change.second.next_hop_id;
+        nextHopGroupMemberBulker.set_entry_attribute(change.second.nhopgroup_member_id, &nhgm_attr);
+    }
+    nextHopGroupMemberBulker.flush();
+
+    bool success = true;
+    vector<FieldValueTuple> bucketNextHops;
+    FGHashBucketChanges failedChanges;
+    for (const auto &change : m_pendingBucketChanges)
     {
-        SWSS_LOG_ERROR("Failed to set next hop oid %" PRIx64 " member %" PRIx64 ": %d",
-            syncd_fg_route_entry->nhopgroup_members[index], nh_oid, status);
-        task_process_status handle_status = handleSaiSetStatus(SAI_API_NEXT_HOP_GROUP, status);
-        if (handle_status != task_success)
+        sai_status_t status = nextHopGroupMemberBulker.set_status(change.second.nhopgroup_member_id);
+        if (status == SAI_STATUS_NOT_EXECUTED)
+        {
+            /* The bulk set stopped at an earlier failure, this bucket was not tried */
+            SWSS_LOG_INFO("Next hop oid %" PRIx64 " not set on member %" PRIx64 " after an earlier failure",
+                change.second.next_hop_id, change.second.nhopgroup_member_id);
+            failedChanges.insert(change);
+            success = false;
+            continue;
+        }
+        if (status != SAI_STATUS_SUCCESS)
         {
-            return parseHandleSaiStatusFailure(handle_status);
+            SWSS_LOG_ERROR("Failed to set next hop oid %" PRIx64 " member %" PRIx64 ": %d",
+                change.second.next_hop_id, change.second.nhopgroup_member_id, status);
+            task_process_status handle_status = handleSaiSetStatus(SAI_API_NEXT_HOP_GROUP, status);
+            if (handle_status != task_success)
+            {
+                failedChanges.insert(change);
+                success = success && parseHandleSaiStatusFailure(handle_status);
+                continue;
+            }
         }
+
+        bucketNextHops.emplace_back(std::to_string(change.first), change.second.next_hop.to_string());
     }
+    m_pendingBucketChanges.clear();
 
-    setStateDbRouteEntry(ipPrefix, index, nextHop);
-    return true;
+    if (!failedChanges.empty())
+    {
+        undoHashBucketChanges(syncd_fg_route_entry, prev_fgnhg_map, failedChanges);
+    }
+
+    setStateDbRouteEntry(ipPrefix, bucketNextHops);
+    return success;
+}
+
+void FgNhgOrch::undoHashBucketChanges(FGNextHopGroupEntry *syncd_fg_route_entry,
+        const BankFGNextHopGroupMap &prev_fgnhg_map, const FGHashBucketChanges &failed_changes)
+{
+    SWSS_LOG_ENTER();
+
+    /* The members of the failed buckets still point to their previous next hops,
+     * hand the buckets back to them so that the route entry matches the ASIC */
+    BankFGNextHopGroupMap &fgnhg_map = syncd_fg_route_entry->syncd_fgnhg_map;
+    for (auto &bank_map : fgnhg_map)
+    {
+        for (auto nh_it = bank_map.begin(); nh_it != bank_map.end();)
+        {
+            HashBuckets &buckets = nh_it->second;
+            size_t size = buckets.size();
+            buckets.erase(std::remove_if(buckets.begin(), buckets.end(),
+                    [&](HashBucketIdx idx) { return failed_changes.find(idx) != failed_changes.end(); }),
+                    buckets.end());
+            if (size != 0 && buckets.empty())
+            {
+                nh_it = bank_map.erase(nh_it);
+            }
+            else
+            {
+                nh_it++;
+            }
+        }
+    }
+
+    for (uint32_t bank = 0; bank < prev_fgnhg_map.size() && bank < fgnhg_map.size(); bank++)
+    {
+        for (const auto &nh_buckets : prev_fgnhg_map[bank])
+        {
+            for (auto idx : nh_buckets.second)
+            {
+                if (failed_changes.find(idx) != failed_changes.end())
+                {
+                    fgnhg_map[bank][nh_buckets.first].push_back(idx);
+                    syncd_fg_route_entry->active_nexthops.insert(nh_buckets.first);
+                }
+            }
+        }
+    }
+
+    /* A next hop left without buckets is no longer active */
+    for (const auto &change : failed_changes)
+    {
+        const NextHopKey &nh = change.second.next_hop;
+        bool has_buckets = false;
+        for (const auto &bank_map : fgnhg_map)
+        {
+            if (bank_map.find(nh) != bank_map.end())
+            {
+                has_buckets = true;
+                break;
+            }
+        }
+        if (!has_buckets)
+        {
+            syncd_fg_route_entry->active_nexthops.erase(nh);
+        }
+    }
+
+    SWSS_LOG_WARN("Restored %zu hash buckets to their previous next hops", failed_changes.size());
 }
 
 
@@ -593,12 +707,9 @@ bool FgNhgOrch::setActiveBankHashBucketChanges(FGNextHopGroupEntry *syncd_fg_rou
         // fill the hash bucket indices with the added NHs
         for (uint32_t i = 0; i < hash_buckets->size(); i++)
         {
-            if (!writeHashBucketChange(syncd_fg_route_entry, hash_buckets->at(i),
+            writeHashBucketChange(syncd_fg_route_entry, hash_buckets->at(i),
                         nhopgroup_members_set[bank_member_change.nhs_to_add[add_idx]],
-                        ipPrefix, bank_member_change.nhs_to_add[add_idx]))
-            {
-                return false;
-            }
+                        bank_member_change.nhs_to_add[add_idx]);
         }
 
         (*bank_fgnhg_map)[bank_member_change.nhs_to_add[add_idx]] =*hash_buckets;
@@ -681,11 +792,8 @@ bool FgNhgOrch::setActiveBankHashBucketChanges(FGNextHopGroupEntry *syncd_fg_rou
 
                 if (move_bkt)
                 {
-                    if (!writeHashBucketChange(syncd_fg_route_entry, hash_buckets->at(bkt_idx),
-                                               nhopgroup_members_set[*it], ipPrefix, *it))
-                    {
-                        return false;
-                    }
+                    writeHashBucketChange(syncd_fg_route_entry, hash_buckets->at(bkt_idx),
+                                          nhopgroup_members_set[*it], *it);
                     bank_fgnhg_map->at(*it).push_back(hash_buckets->at(bkt_idx));
                     bkt_idx++;
                 }
@@ -792,12 +900,9 @@ bool FgNhgOrch::setActiveBankHashBucketChanges(FGNextHopGroupEntry *syncd_fg_rou
                 if (move_bkt)
                 {
                     HashBucketIdx last_elem = map_entry->at((*map_entry).size() - 1);
-                    if (!writeHashBucketChange(syncd_fg_route_entry, last_elem,
-                                               nhopgroup_members_set[bank_member_change.nhs_to_add[add_idx]],
-                                               ipPrefix, bank_member_change.nhs_to_add[add_idx]))
-                    {
-                        return false;
-                    }
+                    writeHashBucketChange(syncd_fg_route_entry, last_elem,
+                                          nhopgroup_members_set[bank_member_change.nhs_to_add[add_idx]],
+                                          bank_member_change.nhs_to_add[add_idx]);
 
                     (*bank_fgnhg_map)[bank_member_change.nhs_to_add[add_idx]].push_back(last_elem);
                     (*map_entry).erase((*map_entry).end() - 1);
@@ -847,11 +952,8 @@ bool FgNhgOrch::setInactiveBankToNextAvailableActiveBank(FGNextHopGroupEntry *sy
                 NextHopKey bank_nh_memb = bank_member_changes[new_bank_idx].
                          active_nhs[i % bank_member_changes[new_bank_idx].active_nhs.size()];
 
-                if (!writeHashBucketChange(syncd_fg_route_entry, i,
-                    nhopgroup_members_set[bank_nh_memb],ipPrefix, bank_nh_memb ))
-                {
-                    return false;
-                }
+                writeHashBucketChange(syncd_fg_route_entry, i,
+                    nhopgroup_members_set[bank_nh_memb], bank_nh_memb);
 
                 syncd_fg_route_entry->syncd_fgnhg_map[bank][bank_nh_memb].push_back(i);
             }
@@ -884,6 +986,8 @@ bool FgNhgOrch::setInactiveBankToNextAvailableActiveBank(FGNextHopGroupEntry *sy
                 return false;
             }
 
+            // The members are going away, drop the bucket changes queued for them
+            m_pendingBucketChanges.clear();
             if (!removeFineGrainedNextHopGroup(syncd_fg_route_entry))
             {
                 SWSS_LOG_ERROR("Failed to delete Fine Grained next hop group");
@@ -935,11 +1039,8 @@ bool FgNhgOrch::setInactiveBankHashBucketChanges(FGNextHopGroupEntry *syncd_fg_r
             NextHopKey bank_nh_memb = bank_member_changes[bank].
                 nhs_to_add[i % bank_member_changes[bank].nhs_to_add.size()];
 
-            if (!writeHashBucketChange(syncd_fg_route_entry, i,
-                  nhopgroup_members_set[bank_nh_memb], ipPrefix, bank_nh_memb))
-            {
-                return false;
-            }
+            writeHashBucketChange(syncd_fg_route_entry, i,
+                  nhopgroup_members_set[bank_nh_memb], bank_nh_memb);
 
             syncd_fg_route_entry->syncd_fgnhg_map[bank][bank_nh_memb].push_back(i);
             syncd_fg_route_entry->active_nexthops.insert(bank_nh_memb);
@@ -1001,6 +1102,12 @@ bool FgNhgOrch::computeAndSetHashBucketChanges(FGNextHopGroupEntry *syncd_fg_rou
 {
     SWSS_LOG_ENTER();
 
+    /* Bucket changes of all the banks are queued and then applied with one bulk set
+     * and one STATE_DB update. On failure the changes queued so far are still applied,
+     * as they are already reflected in syncd_fg_route_entry. Buckets whose set fails
+     * are handed back to their previous next hops. */
+    m_pendingBucketChanges.clear();
+    BankFGNextHopGroupMap prev_fgnhg_map = syncd_fg_route_entry->syncd_fgnhg_map;
     for (uint32_t bank_idx = 0; bank_idx < bank_member_changes.size(); bank_idx++)
     {
         if (bank_member_changes[bank_idx].active_nhs.size() != 0 ||
@@ -1016,6 +1123,7 @@ bool FgNhgOrch::computeAndSetHashBucketChanges(FGNextHopGroupEntry *syncd_fg_rou
             if (!setActiveBankHashBucketChanges(syncd_fg_route_entry, fgNhgEntry,
                         bank_idx, bank_member_changes[bank_idx], nhopgroup_members_set, ipPrefix))
             {
+                flushHashBucketChanges(syncd_fg_route_entry, prev_fgnhg_map, ipPrefix);
                 return false;
             }
         }
@@ -1024,12 +1132,13 @@ bool FgNhgOrch::computeAndSetHashBucketChanges(FGNextHopGroupEntry *syncd_fg_rou
             if (!setInactiveBankHashBucketChanges(syncd_fg_route_entry, fgNhgEntry,
                         bank_idx, bank_member_changes, nhopgroup_members_set, ipPrefix))
             {
+                flushHashBucketChanges(syncd_fg_route_entry, prev_fgnhg_map, ipPrefix);
                 return false;
             }
         }
     }
 
-    return true;
+    return flushHashBucketChanges(syncd_fg_route_entry, prev_fgnhg_map, ipPrefix);
 }
 
 
@@ -1129,6 +1238,7 @@ bool FgNhgOrch::sprayBankNhgMembers(FGNextHopGroupEntry &syncd_fg_route_entry, c
 
     SWSS_LOG_INFO("Warm reboot is set to %d, bank %d", isWarmReboot, bank);
 
+    vector<FieldValueTuple> bucketNextHops;
     // fill the hash idx range with the nhs
     for (uint32_t bucket_idx = hash_idx_range.start_index;
             bucket_idx <= hash_idx_range.end_index; bucket_idx++)
@@ -1187,13 +1297,14 @@ bool FgNhgOrch::sprayBankNhgMembers(FGNextHopGroupEntry &syncd_fg_route_entry, c
             }
         }
 
-        setStateDbRouteEntry(ipPrefix, bucket_idx, nh_memb_key);
+        bucketNextHops.emplace_back(std::to_string(bucket_idx), nh_memb_key.to_string());
         syncd_fg_route_entry.syncd_fgnhg_map[bank][nh_memb_key].push_back(bucket_idx);
         syncd_fg_route_entry.active_nexthops.insert(nh_memb_key);
         syncd_fg_route_entry.nhopgroup_members[bucket_idx] = next_hop_group_member_id;
         gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
     }
 
+    setStateDbRouteEntry(ipPrefix, bucketNextHops);
     return true;
 }
 
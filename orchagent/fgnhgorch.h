@@ -36,6 +36,15 @@ struct FGNextHopGroupEntry
     bool                    points_to_rif;          // Flag to identify that route is currently pointing to a rif
 };
 
+struct FGHashBucketChange
+{
+    sai_object_id_t         nhopgroup_member_id;    // nexthopgroup member of the hash bucket
+    sai_object_id_t         next_hop_id;            // next hop the bucket moves to
+    NextHopKey              next_hop;               // The nexthop(ip+alias) the bucket moves to
+};
+/* Pending hash bucket changes of a route: hash bucket -> change */
+typedef std::map<HashBucketIdx, FGHashBucketChange> FGHashBucketChanges;
+
 struct FGNextHopInfo
 {
     Bank bank;                                      // Bank associated with nh IP
@@ -140,6 +149,9 @@ private:
     // < ip_prefix, < HashBuckets, nh_ip>>
     WarmBootRecoveryMap m_recoveryMap;
 
+    // Hash bucket changes of the route being updated, applied together by flushHashBucketChanges
+    FGHashBucketChanges m_pendingBucketChanges;
+
     bool setNewNhgMembers(FGNextHopGroupEntry &syncd_fg_route_entry, FgNhgEntry *fgNhgEntry,
                     std::vector<BankMemberChanges> &bank_member_changes,
                     std::map<NextHopKey,sai_object_id_t> &nhopgroup_members_set, const IpPrefix&);
@@ -161,9 +173,13 @@ private:
                     uint32_t bank, std::vector<BankMemberChanges> bank_member_changes,
                     std::map<NextHopKey,sai_object_id_t> &nhopgroup_members_set, const IpPrefix&);
     void calculateBankHashBucketStartIndices(FgNhgEntry *fgNhgEntry);
-    void setStateDbRouteEntry(const IpPrefix&, uint32_t index, NextHopKey nextHop);
-    bool writeHashBucketChange(FGNextHopGroupEntry *syncd_fg_route_entry, uint32_t index, sai_object_id_t nh_oid,
-                    const IpPrefix &ipPrefix, NextHopKey nextHop);
+    void setStateDbRouteEntry(const IpPrefix&, const vector<FieldValueTuple> &bucketNextHops);
+    void writeHashBucketChange(FGNextHopGroupEntry *syncd_fg_route_entry, uint32_t index, sai_object_id_t nh_oid,
+                    NextHopKey nextHop);
+    bool flushHashBucketChanges(FGNextHopGroupEntry *syncd_fg_route_entry,
+                    const BankFGNextHopGroupMap &prev_fgnhg_map, const IpPrefix &ipPrefix);
+    void undoHashBucketChanges(FGNextHopGroupEntry *syncd_fg_route_entry,
+                    const BankFGNextHopGroupMap &prev_fgnhg_map, const FGHashBucketChanges &failed_changes);
     bool modifyRoutesNextHopId(sai_object_id_t vrf_id, const IpPrefix &ipPrefix, sai_object_id_t next_hop_id);
     bool createFineGrainedNextHopGroup(FGNextHopGroupEntry &syncd_fg_route_entry, FgNhgEntry *fgNhgEntry,
                     const NextHopGroupKey &nextHops);
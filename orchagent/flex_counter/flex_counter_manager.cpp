@@ -235,6 +235,58 @@ void FlexCounterManager::setCounterIdList(
             group_name.c_str());
 }
 
+// setCounterIdList configures flex counters to poll the same set of stats on
+// all of the provided objects. The objects are installed with a single
+// FLEX_COUNTER operation, except in traditional mode where FLEX_COUNTER_TABLE
+// keys name one object each.
+void FlexCounterManager::setCounterIdList(
+        const vector<sai_object_id_t>& object_ids,
+        const CounterType counter_type,
+        const unordered_set<string>& counter_stats,
+        const sai_object_id_t switch_id)
+{
+    SWSS_LOG_ENTER();
+
+    if (object_ids.empty())
+    {
+        return;
+    }
+
+    auto counter_type_it = counter_id_field_lookup.find(counter_type);
+    if (counter_type_it == counter_id_field_lookup.end())
+    {
+        SWSS_LOG_ERROR("Could not update flex counter id list for group '%s': counter type not found.",
+                group_name.c_str());
+        return;
+    }
+
+    auto counter_ids = serializeCounterStats(counter_stats);
+    auto effective_switch_id = switch_id == SAI_NULL_OBJECT_ID ? gSwitchId : switch_id;
+
+    if (gTraditionalFlexCounter)
+    {
+        for (const auto& object_id : object_ids)
+        {
+            startFlexCounterPolling(effective_switch_id, getFlexCounterTableKey(group_name, object_id),
+                                    counter_ids, counter_type_it->second);
+        }
+    }
+    else
+    {
+        startFlexCounterPolling(effective_switch_id, getFlexCounterTableKeys(group_name, object_ids),
+                                counter_ids, counter_type_it->second);
+    }
+
+    for (const auto& object_id : object_ids)
+    {
+        installed_counters[object_id] = effective_switch_id;
+    }
+
+    SWSS_LOG_DEBUG("Updated flex counter id list for %zu objects in group '%s'.",
+            object_ids.size(),
+            group_name.c_str());
+}
+
 // clearCounterIdList clears all stats that are currently being polled from
 // the given object.
 void FlexCounterManager::clearCounterIdList(const sai_object_id_t object_id)
@@ -5,6 +5,7 @@
 #include <unordered_set>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 #include "dbconnector.h"
 #include "producertable.h"
 #include "table.h"
@@ -96,6 +97,11 @@ class FlexCounterManager
                 const CounterType counter_type,
                 const std::unordered_set<std::string>& counter_stats,
                 const sai_object_id_t switch_id=SAI_NULL_OBJECT_ID);
+        virtual void setCounterIdList(
+                const std::vector<sai_object_id_t>& object_ids,
+                const CounterType counter_type,
+                const std::unordered_set<std::string>& counter_stats,
+                const sai_object_id_t switch_id=SAI_NULL_OBJECT_ID);
         virtual void clearCounterIdList(const sai_object_id_t object_id);
 
         const std::string& getGroupName() const
@@ -125,6 +131,22 @@ class FlexCounterManager
                 const std::string& group_name,
                 const sai_object_id_t object_id) const;
 
+        // getFlexCounterTableKeys joins the objects into one key, which
+        // FLEX_COUNTER handles as a single operation on all of them.
+        template <typename ObjectIds>
+        static std::string getFlexCounterTableKeys(
+                const std::string& group_name,
+                const ObjectIds& object_ids)
+        {
+            auto keys = group_name + ":";
+            for (const auto& oid : object_ids)
+            {
+                keys += sai_serialize_object_id(oid) + ",";
+            }
+            keys.pop_back();
+            return keys;
+        }
+
         std::string group_name;
         StatsMode stats_mode;
         uint polling_interval;
@@ -179,6 +201,15 @@ struct CachedObjects
         pending_objects_map[key].emplace(object_id);
     }
 
+    void cache(const std::vector<sai_object_id_t>& object_ids,
+                   const CounterType counter_type,
+                   const std::unordered_set<std::string>& counter_stats,
+                   sai_object_id_t switch_id)
+    {
+        PendingMapKey key{counter_stats, counter_type, switch_id};
+        pending_objects_map[key].insert(object_ids.begin(), object_ids.end());
+    }
+
     void flush(const std::string &group_name)
     {
         if (pending_objects_map.empty())
@@ -201,12 +232,7 @@ struct CachedObjects
             auto counter_ids = FlexCounterManager::serializeCounterStats(counter_stats);
             auto counter_type_it = FlexCounterManager::counter_id_field_lookup.find(counter_type);
 
-            auto counter_keys = group_name + ":";
-            for (const auto& oid: pending_sai_objects)
-            {
-                counter_keys += sai_serialize_object_id(oid) + ",";
-            }
-            counter_keys.pop_back();
+            auto counter_keys = FlexCounterManager::getFlexCounterTableKeys(group_name, pending_sai_objects);
 
             startFlexCounterPolling(switch_id, counter_keys, counter_ids, counter_type_it->second);
         }
@@ -258,6 +284,32 @@ class FlexCounterCachedManager : public FlexCounterManager
             cached_objects.cache(object_id, counter_type, counter_stats, effective_switch_id);
         }
 
+        void setCounterIdList(
+            struct CachedObjects &cached_objects,
+            const std::vector<sai_object_id_t>& object_ids,
+            const CounterType counter_type,
+            const std::unordered_set<std::string>& counter_stats,
+            const sai_object_id_t switch_id=SAI_NULL_OBJECT_ID)
+        {
+            if (gTraditionalFlexCounter)
+            {
+                FlexCounterManager::setCounterIdList(object_ids, counter_type, counter_stats, switch_id);
+                return;
+            }
+
+            if (object_ids.empty())
+            {
+                return;
+            }
+
+            auto effective_switch_id = switch_id == SAI_NULL_OBJECT_ID ? gSwitchId : switch_id;
+            for (const auto& oid : object_ids)
+            {
+                installed_counters[oid] = effective_switch_id;
+            }
+            cached_objects.cache(object_ids, counter_type, counter_stats, effective_switch_id);
+        }
+
         void clearCounterIdList(
             struct CachedObjects &cached_objects,
             const sai_object_id_t object_id)
@@ -322,6 +374,19 @@ class FlexCounterTaggedCachedManager : public FlexCounterCachedManager
                                                        counter_stats);
         }
 
+        virtual void setCounterIdList(
+            const std::vector<sai_object_id_t>& object_ids,
+            const CounterType counter_type,
+            const std::unordered_set<std::string>& counter_stats,
+            const sai_object_id_t switch_id=SAI_NULL_OBJECT_ID)
+        {
+            FlexCounterCachedManager::setCounterIdList(cached_objects,
+                                                       object_ids,
+                                                       counter_type,
+                                                       counter_stats,
+                                                       switch_id);
+        }
+
         virtual void clearCounterIdList(
             const sai_object_id_t object_id)
         {
@@ -367,6 +432,20 @@ class FlexCounterTaggedCachedManager<TagType, typename std::enable_if_t<std::is_
                                                        counter_stats);
         }
 
+        void setCounterIdList(
+            const std::vector<sai_object_id_t>& object_ids,
+            const CounterType counter_type,
+            const std::unordered_set<std::string>& counter_stats,
+            const TagType tag,
+            const sai_object_id_t switch_id=SAI_NULL_OBJECT_ID)
+        {
+            FlexCounterCachedManager::setCounterIdList(cached_objects[tag],
+                                                       object_ids,
+                                                       counter_type,
+                                                       counter_stats,
+                                                       switch_id);
+        }
+
         void clearCounterIdList(
             const sai_object_id_t object_id,
             const TagType tag)
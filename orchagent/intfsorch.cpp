@@ -119,18 +119,20 @@ sai_object_id_t IntfsOrch::getRouterIntfsId(const string &alias)
 
 bool IntfsOrch::isPrefixSubnet(const IpPrefix &ip_prefix, const string &alias)
 {
-    if (m_syncdIntfses.find(alias) == m_syncdIntfses.end())
+    auto intfs = m_syncdIntfses.find(alias);
+    if (intfs == m_syncdIntfses.end())
     {
         return false;
     }
-    for (auto &prefixIt: m_syncdIntfses[alias].ip_addresses)
+
+    auto subnets = m_syncdIntfSubnets.find(intfs->second.vrf_id);
+    if (subnets == m_syncdIntfSubnets.end())
     {
-        if (prefixIt.getSubnet() == ip_prefix)
-        {
-            return true;
-        }
+        return false;
     }
-    return false;
+
+    auto aliases = subnets->second.find(ip_prefix);
+    return aliases && aliases->count(alias);
 }
 
 string IntfsOrch::getRouterIntfsAlias(const IpAddress &ip, const string &vrf_name)
@@ -142,21 +144,18 @@ string IntfsOrch::getRouterIntfsAlias(const IpAddress &ip, const string &vrf_nam
         vrf_id = m_vrfOrch->getVRFid(vrf_name);
     }
 
-    for (const auto &it_intfs: m_syncdIntfses)
+    auto subnets = m_syncdIntfSubnets.find(vrf_id);
+    if (subnets == m_syncdIntfSubnets.end())
     {
-        if (it_intfs.second.vrf_id != vrf_id)
-        {
-            continue;
-        }
-        for (const auto &prefixIt: it_intfs.second.ip_addresses)
-        {
-            if (prefixIt.isAddressInSubnet(ip))
-            {
-                return it_intfs.first;
-            }
-        }
+        return string();
     }
-    return string();
+
+    auto aliases = subnets->second.longestMatch(ip);
+    if (!aliases)
+    {
+        return string();
+    }
+    return *aliases->begin();
 }
 
 bool IntfsOrch::isInbandIntfInMgmtVrf(const string& alias)
@@ -609,7 +608,7 @@ bool IntfsOrch::setIntf(const string& alias, sai_object_id_t vrf_id, const IpPre
         addDirectedBroadcast(port, *ip_prefix);
     }
 
-    m_syncdIntfses[alias].ip_addresses.insert(*ip_prefix);
+    updateSyncdIntfPfx(alias, *ip_prefix, true);
     return true;
 }
 
@@ -640,7 +639,7 @@ bool IntfsOrch::removeIntf(const string& alias, sai_object_id_t vrf_id, const Ip
             removeDirectedBroadcast(port, *ip_prefix);
         }
 
-        m_syncdIntfses[alias].ip_addresses.erase(*ip_prefix);
+        updateSyncdIntfPfx(alias, *ip_prefix, false);
     }
 
     if (!ip_prefix)
@@ -916,7 +915,7 @@ void IntfsOrch::doTask(Consumer &consumer)
                     }
                     if (m_syncdIntfses[alias].ip_addresses.count(ip_prefix) == 0)
                     {
-                        m_syncdIntfses[alias].ip_addresses.insert(ip_prefix);
+                        updateSyncdIntfPfx(alias, ip_prefix, true);
                         addIp2MeRoute(m_syncdIntfses[alias].vrf_id, ip_prefix);
                     }
                 }
@@ -1145,7 +1144,7 @@ void IntfsOrch::doTask(Consumer &consumer)
                     {
                         if (m_syncdIntfses[alias].ip_addresses.count(ip_prefix))
                         {
-                            m_syncdIntfses[alias].ip_addresses.erase(ip_prefix);
+                            updateSyncdIntfPfx(alias, ip_prefix, false);
                             removeIp2MeRoute(m_syncdIntfses[alias].vrf_id, ip_prefix);
                         }
                     }
@@ -1773,15 +1772,40 @@ void IntfsOrch::generateInterfaceMap()
 
 bool IntfsOrch::updateSyncdIntfPfx(const string &alias, const IpPrefix &ip_prefix, bool add)
 {
-    if (add && m_syncdIntfses[alias].ip_addresses.count(ip_prefix) == 0)
+    auto &intfs = m_syncdIntfses[alias];
+    auto &subnets = m_syncdIntfSubnets[intfs.vrf_id];
+    auto subnet = ip_prefix.getSubnet();
+
+    if (add && intfs.ip_addresses.count(ip_prefix) == 0)
     {
-        m_syncdIntfses[alias].ip_addresses.insert(ip_prefix);
+        intfs.ip_addresses.insert(ip_prefix);
+
+        auto aliases = subnets.find(subnet);
+        if (aliases)
+        {
+            aliases->insert(alias);
+        }
+        else
+        {
+            subnets.insert(subnet, { alias });
+        }
         return true;
     }
 
-    if (!add && m_syncdIntfses[alias].ip_addresses.count(ip_prefix) > 0)
+    if (!add && intfs.ip_addresses.count(ip_prefix) > 0)
     {
-        m_syncdIntfses[alias].ip_addresses.erase(ip_prefix);
+        intfs.ip_addresses.erase(ip_prefix);
+
+        /* Several addresses of an interface can share a subnet */
+        auto aliases = subnets.find(subnet);
+        if (aliases && aliases->count(alias))
+        {
+            aliases->erase(aliases->find(alias));
+            if (aliases->empty())
+            {
+                subnets.erase(subnet);
+            }
+        }
         return true;
     }
 
@@ -9,6 +9,7 @@
 #include "ipaddresses.h"
 #include "ipprefix.h"
 #include "macaddress.h"
+#include "prefixtrie.h"
 
 #include <map>
 #include <set>
@@ -84,6 +85,8 @@ private:
 
     VRFOrch *m_vrfOrch;
     IntfsTable m_syncdIntfses;
+    /* Interface subnets per VRF, each with the interfaces it is configured on */
+    VrfPrefixTrie<std::multiset<string>> m_syncdIntfSubnets;
     map<string, string> m_vnetInfses;
     MacAddress m_sagMac;
     std::map<sai_object_id_t, uint32_t> m_sagVrfRefTable;
@@ -68,6 +68,7 @@ extern bool gIsNatSupported;
 #define SWSS_RECORD_ENABLE (0x1 << 1)
 #define RESPONSE_PUBLISHER_RECORD_ENABLE (0x1 << 2)
 #define RETRY_RECORD_ENABLE (0x1 << 3)
+#define SWSS_RECORD_BINARY (0x1 << 4)
 
 /* orchagent heart beat message interval */
 #define HEART_BEAT_INTERVAL_MSECS_DEFAULT 10 * 1000
@@ -100,6 +101,7 @@ void usage()
     cout << "                    2: record SwSS task sequence as swss.rec" << endl;
     cout << "                    3: enable both above two records" << endl;
     cout << "                    7: enable sairedis.rec, swss.rec and responsepublisher.rec" << endl;
+    cout << "                    Bit 4: write swss.rec in the compressed binary format, see swssrecconv" << endl;
     cout << "    -d record_location: set record logs folder location (default .)" << endl;
     cout << "    -b batch_size: set consumer table pop operation batch size (default 128)" << endl;
     cout << "    -m MAC: set switch MAC address" << endl;
@@ -495,7 +497,7 @@ int main(int argc, char **argv)
             // Disable all recordings if atoi() fails i.e. returns 0 due to
             // invalid command line argument.
             record_type = atoi(optarg);
-            if (record_type < 0 || record_type > 15) 
+            if (record_type < 0 || record_type > 31)
             {
                 usage();
                 exit(EXIT_FAILURE);
@@ -624,6 +626,9 @@ int main(int argc, char **argv)
     );
     Recorder::Instance().swss.setLocation(record_location);
     Recorder::Instance().swss.setFileName(swss_rec_filename);
+    Recorder::Instance().swss.setBinary(
+        (record_type & SWSS_RECORD_BINARY) == SWSS_RECORD_BINARY
+    );
     Recorder::Instance().swss.startRec(true);
 
     Recorder::Instance().respub.setRecord(
@@ -599,6 +599,139 @@ void MuxCable::setState(string new_state)
     return;
 }
 
+bool MuxCable::canSwitchInBatch(const string& new_state) const
+{
+    if (nbr_handler_type_ != MuxNbrHandlerType::NBR_HANDLER_HOST_ROUTE)
+    {
+        return false;
+    }
+
+    auto ns = muxStateStringToVal.find(new_state);
+    if (ns == muxStateStringToVal.end())
+    {
+        return false;
+    }
+
+    auto change = mux_state_change(state_, ns->second);
+    return (change == MuxStateChange::MUX_STATE_ACTIVE_STANDBY ||
+            change == MuxStateChange::MUX_STATE_STANDBY_ACTIVE);
+}
+
+void MuxCable::beginStateChange(const string& new_state)
+{
+    MuxState ns = muxStateStringToVal.at(new_state);
+
+    SWSS_LOG_NOTICE("[%s] Set MUX state from %s to %s in batch", mux_name_.c_str(),
+                     muxStateValToString.at(state_).c_str(), muxStateValToString.at(ns).c_str());
+
+    mux_cb_orch_->updateMuxMetricState(mux_name_, muxStateValToString.at(ns), true);
+
+    prev_state_ = state_;
+    state_ = ns;
+
+    st_chg_in_progress_ = true;
+}
+
+void MuxCable::endStateChange(bool success)
+{
+    st_chg_in_progress_ = false;
+
+    if (!success)
+    {
+        //Reset back to original state
+        state_ = prev_state_;
+        st_chg_failed_ = true;
+        return;
+    }
+
+    string new_state = muxStateValToString.at(state_);
+
+    mux_cb_orch_->updateMuxMetricState(mux_name_, new_state, false);
+
+    st_chg_failed_ = false;
+    SWSS_LOG_INFO("Changed state to %s", new_state.c_str());
+
+    mux_cb_orch_->updateMuxState(mux_name_, new_state);
+}
+
+/*
+ * First stage of a batched switchover, the steps of stateActive() and
+ * stateStandby() that come before the neighbor changes
+ */
+bool MuxCable::switchoverPrepare(bool active, std::list<NeighborContext>& neigh_ctx_list)
+{
+    Port port;
+    if (!gPortsOrch->getPort(mux_name_, port))
+    {
+        SWSS_LOG_NOTICE("Port %s not found in port table", mux_name_.c_str());
+        return false;
+    }
+
+    if (active)
+    {
+        if (!aclHandler(port.m_port_id, mux_name_, false))
+        {
+            SWSS_LOG_INFO("Remove ACL drop rule failed for %s", mux_name_.c_str());
+            return false;
+        }
+    }
+    else
+    {
+        switchover_tnh_ = mux_orch_->createNextHopTunnel(MUX_TUNNEL, peer_ip4_);
+        if (switchover_tnh_ == SAI_NULL_OBJECT_ID)
+        {
+            SWSS_LOG_INFO("Null NH object id, retry for %s", peer_ip4_.to_string().c_str());
+            return false;
+        }
+        // Loop through all routes with nexthops through this mux cable when changing state
+        updateRoutes();
+    }
+
+    SWSS_LOG_NOTICE("Processing neighbors for mux %s, enable %d, state %d",
+                     mux_name_.c_str(), active, state_);
+    nbr_handler_->getNeighborContexts(neigh_ctx_list);
+
+    return true;
+}
+
+bool MuxCable::switchoverNexthops(bool active, std::list<MuxRouteBulkContext>& route_ctx_list)
+{
+    if (active)
+    {
+        return nbr_handler_->enableNexthops(true, route_ctx_list);
+    }
+
+    return nbr_handler_->disableNexthops(switchover_tnh_, route_ctx_list);
+}
+
+bool MuxCable::switchoverFinish(bool active)
+{
+    if (active)
+    {
+        // Loop through all routes with nexthops through this mux cable when changing state
+        updateRoutes();
+        refreshSliceRoute();
+        return true;
+    }
+
+    refreshSliceRoute();
+
+    Port port;
+    if (!gPortsOrch->getPort(mux_name_, port))
+    {
+        SWSS_LOG_NOTICE("Port %s not found in port table", mux_name_.c_str());
+        return false;
+    }
+
+    if (!aclHandler(port.m_port_id, mux_name_))
+    {
+        SWSS_LOG_INFO("Add ACL drop rule failed for %s", mux_name_.c_str());
+        return false;
+    }
+
+    return true;
+}
+
 void MuxCable::rollbackStateChange()
 {
     if (prev_state_ == MuxState::MUX_STATE_FAILED || prev_state_ == MuxState::MUX_STATE_PENDING)
@@ -834,6 +967,8 @@ void MuxNbrHandler::update(NextHopKey nh, sai_object_id_t tunnelId, bool add, Mu
     SWSS_LOG_INFO("Neigh %s on %s, add %d, state %d",
                    nh.ip_address.to_string().c_str(), nh.alias.c_str(), add, state);
 
+    invalidateSwitchoverPlan();
+
     IpPrefix pfx = nh.ip_address.to_string();
 
     if (add)
@@ -885,37 +1020,70 @@ void MuxNbrHandler::update(NextHopKey nh, sai_object_id_t tunnelId, bool add, Mu
     }
 }
 
+const MuxSwitchoverPlan& MuxNbrHandler::getSwitchoverPlan()
+{
+    if (plan_valid_)
+    {
+        return plan_;
+    }
+
+    plan_.clear();
+    plan_.reserve(neighbors_.size());
+    for (const auto& neighbor : neighbors_)
+    {
+        plan_.emplace_back(NextHopKey(neighbor.first, alias_));
+    }
+    plan_valid_ = true;
+
+    return plan_;
+}
+
+void MuxNbrHandler::getNeighborContexts(std::list<NeighborContext>& neigh_ctx_list)
+{
+    for (const auto& entry : getSwitchoverPlan())
+    {
+        // Create neighbor context with bulk_op enabled
+        neigh_ctx_list.push_back(NeighborContext(entry.nh, true));
+    }
+}
+
 bool MuxNbrHandler::enable(bool update_rt)
 {
-    NeighborEntry neigh;
     std::list<NeighborContext> neigh_ctx_list;
     std::list<MuxRouteBulkContext> route_ctx_list;
 
-    auto it = neighbors_.begin();
-    while (it != neighbors_.end())
+    getNeighborContexts(neigh_ctx_list);
+
+    if (!gNeighOrch->enableNeighbors(neigh_ctx_list))
     {
-        SWSS_LOG_INFO("Enabling neigh %s on %s", it->first.to_string().c_str(), alias_.c_str());
+        return false;
+    }
 
-        neigh = NeighborEntry(it->first, alias_);
-        // Create neighbor context with bulk_op enabled
-        neigh_ctx_list.push_back(NeighborContext(neigh, true));
-        it++;
+    if (!enableNexthops(update_rt, route_ctx_list))
+    {
+        return false;
     }
 
-    if (!gNeighOrch->enableNeighbors(neigh_ctx_list))
+    if (update_rt && !removeRoutes(route_ctx_list))
     {
         return false;
     }
 
-    it = neighbors_.begin();
-    while (it != neighbors_.end())
+    return true;
+}
+
+bool MuxNbrHandler::enableNexthops(bool update_rt, std::list<MuxRouteBulkContext>& route_ctx_list)
+{
+    for (const auto& entry : getSwitchoverPlan())
     {
+        const NextHopKey& nh_key = entry.nh;
+
+        SWSS_LOG_INFO("Enabling neigh %s on %s", nh_key.ip_address.to_string().c_str(), alias_.c_str());
+
         /* Update NH to point to learned neighbor */
-        neigh = NeighborEntry(it->first, alias_);
-        it->second = gNeighOrch->getLocalNextHopId(neigh);
+        neighbors_[nh_key.ip_address] = gNeighOrch->getLocalNextHopId(nh_key);
 
         /* Reprogram route */
-        NextHopKey nh_key = NextHopKey(it->first, alias_);
         uint32_t num_routes = 0;
         if (!gRouteOrch->updateNextHopRoutes(nh_key, num_routes))
         {
@@ -946,17 +1114,34 @@ bool MuxNbrHandler::enable(bool update_rt)
         /* Increment ref count for ECMP NH members */
         gNeighOrch->increaseNextHopRefCount(nh_key, nh_added);
 
-        IpPrefix pfx = it->first.to_string();
         if (update_rt)
         {
-            route_ctx_list.push_back(MuxRouteBulkContext(pfx));
+            route_ctx_list.push_back(MuxRouteBulkContext(entry.pfx));
             updateTunnelRoute(nh_key, false);
         }
+    }
 
-        it++;
+    return true;
+}
+
+bool MuxNbrHandler::disable(sai_object_id_t tnh)
+{
+    std::list<NeighborContext> neigh_ctx_list;
+    std::list<MuxRouteBulkContext> route_ctx_list;
+
+    if (!disableNexthops(tnh, route_ctx_list))
+    {
+        return false;
     }
 
-    if (update_rt && !removeRoutes(route_ctx_list))
+    if (!addRoutes(route_ctx_list))
+    {
+        return false;
+    }
+
+    getNeighborContexts(neigh_ctx_list);
+
+    if (!gNeighOrch->disableNeighbors(neigh_ctx_list))
     {
         return false;
     }
@@ -964,22 +1149,18 @@ bool MuxNbrHandler::enable(bool update_rt)
     return true;
 }
 
-bool MuxNbrHandler::disable(sai_object_id_t tnh)
+bool MuxNbrHandler::disableNexthops(sai_object_id_t tnh, std::list<MuxRouteBulkContext>& route_ctx_list)
 {
-    NeighborEntry neigh;
-    std::list<NeighborContext> neigh_ctx_list;
-    std::list<MuxRouteBulkContext> route_ctx_list;
-
-    auto it = neighbors_.begin();
-    while (it != neighbors_.end())
+    for (const auto& entry : getSwitchoverPlan())
     {
-        SWSS_LOG_INFO("Disabling neigh %s on %s", it->first.to_string().c_str(), alias_.c_str());
+        const NextHopKey& nh_key = entry.nh;
+
+        SWSS_LOG_INFO("Disabling neigh %s on %s", nh_key.ip_address.to_string().c_str(), alias_.c_str());
 
         /* Update NH to point to Tunnel nexhtop */
-        it->second = tnh;
+        neighbors_[nh_key.ip_address] = tnh;
 
         /* Reprogram route */
-        NextHopKey nh_key = NextHopKey(it->first, alias_);
         uint32_t num_routes = 0;
         if (!gRouteOrch->updateNextHopRoutes(nh_key, num_routes))
         {
@@ -1009,24 +1190,7 @@ bool MuxNbrHandler::disable(sai_object_id_t tnh)
 
         updateTunnelRoute(nh_key, true);
 
-        IpPrefix pfx = it->first.to_string();
-        route_ctx_list.push_back(MuxRouteBulkContext(pfx, it->second));
-
-        neigh = NeighborEntry(it->first, alias_);
-        // Create neighbor context with bulk_op enabled
-        neigh_ctx_list.push_back(NeighborContext(neigh, true));
-
-        it++;
-    }
-
-    if (!addRoutes(route_ctx_list))
-    {
-        return false;
-    }
-
-    if (!gNeighOrch->disableNeighbors(neigh_ctx_list))
-    {
-        return false;
+        route_ctx_list.push_back(MuxRouteBulkContext(entry.pfx, tnh));
     }
 
     return true;
@@ -1043,7 +1207,7 @@ sai_object_id_t MuxNbrHandler::getNextHopId(const NextHopKey nhKey)
     return SAI_NULL_OBJECT_ID;
 }
 
-bool MuxNbrHandler::addRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list)
+bool MuxNbrHandler::addRoutes(EntityBulker<sai_route_api_t>& bulker, std::list<MuxRouteBulkContext>& bulk_ctx_list)
 {
     sai_status_t status;
     bool ret = true;
@@ -1071,10 +1235,10 @@ bool MuxNbrHandler::addRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list)
         attr.value.oid = ctx->nh;
         attrs.push_back(attr);
 
-        status = gRouteBulker.create_entry(&object_statuses.back(), &route_entry, (uint32_t)attrs.size(), attrs.data());
+        status = bulker.create_entry(&object_statuses.back(), &route_entry, (uint32_t)attrs.size(), attrs.data());
     }
 
-    gRouteBulker.flush();
+    bulker.flush();
 
     for (auto ctx = bulk_ctx_list.begin(); ctx != bulk_ctx_list.end(); ctx++)
     {
@@ -1112,11 +1276,11 @@ bool MuxNbrHandler::addRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list)
         SWSS_LOG_NOTICE("Created tunnel route to %s ", ctx->pfx.to_string().c_str());
     }
 
-    gRouteBulker.clear();
+    bulker.clear();
     return ret;
 }
 
-bool MuxNbrHandler::removeRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list)
+bool MuxNbrHandler::removeRoutes(EntityBulker<sai_route_api_t>& bulker, std::list<MuxRouteBulkContext>& bulk_ctx_list)
 {
     sai_status_t status;
     bool ret = true;
@@ -1133,10 +1297,10 @@ bool MuxNbrHandler::removeRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list)
         SWSS_LOG_INFO("Removing route entry %s, nh %" PRIx64 "", ctx->pfx.getIp().to_string().c_str(), ctx->nh);
 
         object_statuses.emplace_back();
-        status = gRouteBulker.remove_entry(&object_statuses.back(), &route_entry);
+        status = bulker.remove_entry(&object_statuses.back(), &route_entry);
     }
 
-    gRouteBulker.flush();
+    bulker.flush();
 
     for (auto ctx = bulk_ctx_list.begin(); ctx != bulk_ctx_list.end(); ctx++)
     {
@@ -1174,7 +1338,7 @@ bool MuxNbrHandler::removeRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list)
         SWSS_LOG_NOTICE("Removed tunnel route to %s ", ctx->pfx.to_string().c_str());
     }
 
-    gRouteBulker.clear();
+    bulker.clear();
     return ret;
 }
 
@@ -1273,6 +1437,8 @@ void MuxPrefixBasedNbrHandler::update(NextHopKey nh, sai_object_id_t tunnelId, b
     SWSS_LOG_INFO("PrefixBased Neigh %s on %s, add %d, state %d",
                    nh.ip_address.to_string().c_str(), nh.alias.c_str(), add, state);
 
+    invalidateSwitchoverPlan();
+
     IpPrefix pfx = nh.ip_address.to_string();
 
     if (add)
@@ -2489,7 +2655,8 @@ MuxOrch::MuxOrch(DBConnector *db, const std::vector<std::string> &tables,
          Orch2(db, tables, request_),
          decap_orch_(decapOrch),
          neigh_orch_(neighOrch),
-         fdb_orch_(fdbOrch)
+         fdb_orch_(fdbOrch),
+         switchover_route_bulker_(sai_route_api, gMaxBulkSize)
 {
     handler_map_.insert(handler_pair(CFG_MUX_CABLE_TABLE_NAME, &MuxOrch::handleMuxCfg));
     handler_map_.insert(handler_pair(CFG_PEER_SWITCH_TABLE_NAME, &MuxOrch::handlePeerSwitch));
@@ -2806,6 +2973,81 @@ bool MuxOrch::delOperation(const Request& request)
     return true;
 }
 
+/**
+ * @brief Switches mux cables to the same state together. Each stage runs for
+ *        all cables before the next one starts, so the neighbors and tunnel
+ *        routes of all cables go out in one bulk call per stage.
+ * @param cables Cables in a batched state change, see MuxCable::beginStateChange()
+ * @param active true to switch to active, false to switch to standby
+ * @return true on success, false if a stage failed
+ */
+bool MuxOrch::switchMuxCables(const std::vector<MuxCable*>& cables, bool active)
+{
+    std::list<NeighborContext> neigh_ctx_list;
+    std::list<MuxRouteBulkContext> route_ctx_list;
+
+    switchover_route_bulker_.clear();
+
+    for (auto cable : cables)
+    {
+        if (!cable->switchoverPrepare(active, neigh_ctx_list))
+        {
+            return false;
+        }
+    }
+
+    if (active)
+    {
+        if (!gNeighOrch->enableNeighbors(neigh_ctx_list))
+        {
+            return false;
+        }
+
+        for (auto cable : cables)
+        {
+            if (!cable->switchoverNexthops(active, route_ctx_list))
+            {
+                return false;
+            }
+        }
+
+        if (!MuxNbrHandler::removeRoutes(switchover_route_bulker_, route_ctx_list))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        for (auto cable : cables)
+        {
+            if (!cable->switchoverNexthops(active, route_ctx_list))
+            {
+                return false;
+            }
+        }
+
+        if (!MuxNbrHandler::addRoutes(switchover_route_bulker_, route_ctx_list))
+        {
+            return false;
+        }
+
+        if (!gNeighOrch->disableNeighbors(neigh_ctx_list))
+        {
+            return false;
+        }
+    }
+
+    for (auto cable : cables)
+    {
+        if (!cable->switchoverFinish(active))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void MuxOrch::createStandaloneTunnelRoute(IpAddress neighborIp)
 {
     SWSS_LOG_INFO("Creating standalone tunnel route for neighbor %s", neighborIp.to_string().c_str());
@@ -2911,6 +3153,16 @@ void MuxCableOrch::updateMuxMetricState(string portName, string muxState, bool s
     mux_metric_table_.hset(portName, msg, time);
 }
 
+void MuxCableOrch::updateMuxSwitchoverMetric(string portName, size_t cables, uint64_t usec)
+{
+    vector<FieldValueTuple> fvs;
+
+    fvs.emplace_back("orch_switchover_cables", to_string(cables));
+    fvs.emplace_back("orch_switchover_usec", to_string(usec));
+
+    mux_metric_table_.set(portName, fvs);
+}
+
 void MuxCableOrch::addTunnelRoute(const NextHopKey &nhKey)
 {
     vector<FieldValueTuple> data;
@@ -2937,6 +3189,118 @@ void MuxCableOrch::removeTunnelRoute(const NextHopKey &nhKey)
     app_tunnel_route_table_.del(key);
 }
 
+void MuxCableOrch::doTask(Consumer &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    MuxOrch* mux_orch = gDirectory.get<MuxOrch*>();
+
+    /*
+     * A failover switches many cables between active and standby at once.
+     * Those switch together, one bulk call per stage for all of them. A
+     * cable with more than one pending request keeps the per request path
+     * so that its requests apply in order. The requests of a batch stay in
+     * m_toSync until the batch succeeds; if it fails, its cables roll back
+     * and the requests fall back to the per request path below, so only the
+     * cables that fail on their own end up rolled back.
+     */
+    map<string, size_t> port_requests;
+    for (const auto& entry : consumer.m_toSync)
+    {
+        port_requests[kfvKey(entry.second)]++;
+    }
+
+    map<bool, vector<SyncMap::iterator>> batches;
+    for (auto it = consumer.m_toSync.begin(); it != consumer.m_toSync.end(); it++)
+    {
+        const auto& port_name = kfvKey(it->second);
+        if (kfvOp(it->second) != SET_COMMAND || port_requests[port_name] != 1 ||
+            !mux_orch->isMuxExists(port_name))
+        {
+            continue;
+        }
+
+        for (const auto& fv : kfvFieldsValues(it->second))
+        {
+            if (fvField(fv) == "state" && mux_orch->getMuxCable(port_name)->canSwitchInBatch(fvValue(fv)))
+            {
+                bool active = (muxStateStringToVal.at(fvValue(fv)) == MuxState::MUX_STATE_ACTIVE);
+                batches[active].push_back(it);
+            }
+        }
+    }
+
+    for (auto& batch : batches)
+    {
+        bool active = batch.first;
+        if (batch.second.size() < 2)
+        {
+            continue;
+        }
+
+        vector<MuxCable*> cables;
+        for (auto it : batch.second)
+        {
+            auto mux_obj = mux_orch->getMuxCable(kfvKey(it->second));
+            for (const auto& fv : kfvFieldsValues(it->second))
+            {
+                if (fvField(fv) == "state")
+                {
+                    mux_obj->beginStateChange(fvValue(fv));
+                }
+            }
+            cables.push_back(mux_obj);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+
+        bool success = false;
+        try
+        {
+            success = mux_orch->switchMuxCables(cables, active);
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_ERROR("Exception caught while switching %zu mux cables to %s. Error: %s",
+                            cables.size(), active ? "active" : "standby", e.what());
+        }
+
+        auto usec = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start).count());
+
+        for (auto mux_obj : cables)
+        {
+            mux_obj->endStateChange(success);
+        }
+
+        if (!success)
+        {
+            SWSS_LOG_ERROR("Failed to switch %zu mux cables to %s, retrying each cable on its own",
+                            cables.size(), active ? "active" : "standby");
+            for (auto mux_obj : cables)
+            {
+                mux_obj->rollbackStateChange();
+            }
+            continue;
+        }
+
+        for (auto it : batch.second)
+        {
+            consumer.m_toSync.erase(it);
+        }
+
+        for (auto mux_obj : cables)
+        {
+            updateMuxSwitchoverMetric(mux_obj->getMuxName(), cables.size(), usec);
+        }
+
+        SWSS_LOG_NOTICE("Switched %zu mux cables to %s in %" PRIu64 " usec",
+                         cables.size(), active ? "active" : "standby", usec);
+    }
+
+    Orch2::doTask(consumer);
+}
+
 bool MuxCableOrch::addOperation(const Request& request)
 {
     SWSS_LOG_ENTER();
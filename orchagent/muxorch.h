@@ -59,6 +59,24 @@ struct MuxRouteBulkContext
     }
 };
 
+/*
+ * A neighbor of a mux cable and the prefix of its tunnel route. The ACL drop
+ * rule and the APP_DB tunnel route depend on the state of the cable at the
+ * time of the switchover, so they are not part of the plan.
+ */
+struct MuxSwitchoverPlanEntry
+{
+    NextHopKey                          nh;                         // neighbor nexthop on the cable
+    IpPrefix                            pfx;                        // host route prefix
+
+    MuxSwitchoverPlanEntry(const NextHopKey& nh)
+        : nh(nh), pfx(nh.ip_address.to_string())
+    {
+    }
+};
+
+typedef std::vector<MuxSwitchoverPlanEntry> MuxSwitchoverPlan;
+
 extern size_t gMaxBulkSize;
 extern sai_route_api_t* sai_route_api;
 
@@ -103,17 +121,35 @@ public:
     string getAlias() const { return alias_; };
     void clearBulkers() { gRouteBulker.clear(); };
 
+    /*
+     * Stages of enable() and disable(). MuxOrch::switchMuxCables() runs each
+     * stage for many cables and merges their bulk calls.
+     */
+    void getNeighborContexts(std::list<NeighborContext>& neigh_ctx_list);
+    bool enableNexthops(bool update_rt, std::list<MuxRouteBulkContext>& route_ctx_list);
+    bool disableNexthops(sai_object_id_t tnh, std::list<MuxRouteBulkContext>& route_ctx_list);
+
+    static bool removeRoutes(EntityBulker<sai_route_api_t>& bulker, std::list<MuxRouteBulkContext>& bulk_ctx_list);
+    static bool addRoutes(EntityBulker<sai_route_api_t>& bulker, std::list<MuxRouteBulkContext>& bulk_ctx_list);
+
 protected:
-    bool removeRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list);
-    bool addRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list);
+    bool removeRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list) { return removeRoutes(gRouteBulker, bulk_ctx_list); }
+    bool addRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list) { return addRoutes(gRouteBulker, bulk_ctx_list); }
     bool setBulkRouteNH(std::list<MuxRouteBulkContext>& bulk_ctx_list);
 
+    const MuxSwitchoverPlan& getSwitchoverPlan();
+    void invalidateSwitchoverPlan() { plan_valid_ = false; };
+
     inline void updateTunnelRoute(NextHopKey, bool = true);
 
 protected:
     MuxNeighbor neighbors_;
     string alias_;
     EntityBulker<sai_route_api_t> gRouteBulker;
+
+    // Neighbors walked on a state change, rebuilt after neighbor updates
+    MuxSwitchoverPlan plan_;
+    bool plan_valid_ = false;
 };
 
 // Mux Prefix-Based Neighbor Handler for adding/removing neighbors with prefix-based routing
@@ -175,6 +211,17 @@ public:
         return nbr_handler_type_;
     }
 
+    /*
+     * Batched state change, see MuxOrch::switchMuxCables(). A cable joins a
+     * batch only for an active/standby switchover of a host route cable.
+     */
+    bool canSwitchInBatch(const string& new_state) const;
+    void beginStateChange(const string& new_state);
+    void endStateChange(bool success);
+    bool switchoverPrepare(bool active, std::list<NeighborContext>& neigh_ctx_list);
+    bool switchoverNexthops(bool active, std::list<MuxRouteBulkContext>& route_ctx_list);
+    bool switchoverFinish(bool active);
+
 private:
     bool stateActive();
     bool stateInitActive();
@@ -201,6 +248,9 @@ private:
     // Nexthop OID the slice route points at; NULL when not installed.
     sai_object_id_t slice_route_nh_oid_ = SAI_NULL_OBJECT_ID;
 
+    // Tunnel nexthop of a batched switchover to standby
+    sai_object_id_t switchover_tnh_ = SAI_NULL_OBJECT_ID;
+
     MuxOrch *mux_orch_;
     MuxCableOrch *mux_cb_orch_;
     MuxStateOrch *mux_state_orch_;
@@ -325,6 +375,8 @@ public:
     void updateCachedNeighbors();
     bool getMuxPort(const MacAddress&, const string&, string&);
 
+    bool switchMuxCables(const std::vector<MuxCable*>& cables, bool active);
+
 private:
     virtual bool addOperation(const Request& request);
     virtual bool delOperation(const Request& request);
@@ -387,6 +439,9 @@ private:
     bool prefix_nbrs_supported_ = true;
 
     std::unique_ptr<Table> state_mux_cable_table_;
+
+    // Tunnel routes of a batched switchover
+    EntityBulker<sai_route_api_t> switchover_route_bulker_;
 };
 
 const request_description_t mux_cable_request_description = {
@@ -410,10 +465,12 @@ public:
 
     void updateMuxState(string portName, string muxState);
     void updateMuxMetricState(string portName, string muxState, bool start);
+    void updateMuxSwitchoverMetric(string portName, size_t cables, uint64_t usec);
     void addTunnelRoute(const NextHopKey &nhKey);
     void removeTunnelRoute(const NextHopKey &nhKey);
 
 private:
+    void doTask(Consumer &consumer) override;
     virtual bool addOperation(const Request& request);
     virtual bool delOperation(const Request& request);
 
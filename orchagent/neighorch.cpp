@@ -309,10 +309,10 @@ void NeighOrch::update(SubjectType type, void *cntx)
             processFDBFlushUpdate(*update);
             break;
         }
-        case SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE:
+        case SUBJECT_TYPE_BFD_SESSION_STATE_CHANGES:
         {
-            BfdUpdate *update = static_cast<BfdUpdate *>(cntx);
-            updateNextHop (*update);
+            BfdUpdates *updates = static_cast<BfdUpdates *>(cntx);
+            updateNextHops(*updates);
             break;
         }
         default:
@@ -701,52 +701,66 @@ bool NeighOrch::ifChangeInformNextHop(const string &alias, bool if_up)
     return rc;
 }
 
-void NeighOrch::updateNextHop(const BfdUpdate& update)
+void NeighOrch::updateNextHops(const BfdUpdates& updates)
 {
     SWSS_LOG_ENTER();
     bool rc = true;
 
-    auto key = update.peer;
-    sai_bfd_session_state_t state = update.state;
+    /* Last state of every default VRF peer, so the next hops are walked once per burst */
+    map<IpAddress, const BfdUpdate *> peers;
 
-    size_t found_vrf = key.find(state_db_key_delimiter);
-    if (found_vrf == string::npos)
+    for (const auto &update : updates)
     {
-        SWSS_LOG_INFO("Failed to parse key %s, no vrf is given", key.c_str());
-        return;
-    }
+        const auto &key = update.peer;
 
-    size_t found_ifname = key.find(state_db_key_delimiter, found_vrf + 1);
-    if (found_ifname == string::npos)
-    {
-        SWSS_LOG_INFO("Failed to parse key %s, no ifname is given", key.c_str());
-        return;
-    }
+        size_t found_vrf = key.find(state_db_key_delimiter);
+        if (found_vrf == string::npos)
+        {
+            SWSS_LOG_INFO("Failed to parse key %s, no vrf is given", key.c_str());
+            continue;
+        }
+
+        size_t found_ifname = key.find(state_db_key_delimiter, found_vrf + 1);
+        if (found_ifname == string::npos)
+        {
+            SWSS_LOG_INFO("Failed to parse key %s, no ifname is given", key.c_str());
+            continue;
+        }
 
-    string vrf_name = key.substr(0, found_vrf);
-    string alias = key.substr(found_vrf + 1, found_ifname - found_vrf - 1);
-    IpAddress peer_address(key.substr(found_ifname + 1));
+        string vrf_name = key.substr(0, found_vrf);
+        string alias = key.substr(found_vrf + 1, found_ifname - found_vrf - 1);
+        IpAddress peer_address(key.substr(found_ifname + 1));
+
+        if (alias != "default" || vrf_name != "default")
+        {
+            continue;
+        }
+
+        peers[peer_address] = &update;
+    }
 
-    if (alias != "default" || vrf_name != "default")
+    if (peers.empty())
     {
         return;
     }
 
     for (auto nhop = m_syncdNextHops.begin(); nhop != m_syncdNextHops.end(); ++nhop)
     {
-        if (nhop->first.ip_address != peer_address)
+        auto peer = peers.find(nhop->first.ip_address);
+        if (peer == peers.end())
         {
             continue;
         }
 
-        if (state == SAI_BFD_SESSION_STATE_UP)
+        const auto &key = peer->second->peer;
+        if (peer->second->state == SAI_BFD_SESSION_STATE_UP)
         {
-            SWSS_LOG_INFO("updateNextHop get BFD session UP event, key %s", key.c_str());
+            SWSS_LOG_INFO("updateNextHops get BFD session UP event, key %s", key.c_str());
             rc = clearNextHopFlag(nhop->first, NHFLAGS_IFDOWN);
         }
         else
         {
-            SWSS_LOG_INFO("updateNextHop get BFD session DOWN event, key %s", key.c_str());
+            SWSS_LOG_INFO("updateNextHops get BFD session DOWN event, key %s", key.c_str());
             rc = setNextHopFlag(nhop->first, NHFLAGS_IFDOWN);
         }
 
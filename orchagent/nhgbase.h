@@ -222,6 +222,59 @@ public:
     inline size_t getSize() const
                                 { SWSS_LOG_ENTER(); return m_members.size(); }
 
+    /*
+     * Queue the removal of the given members into a bulker which may be
+     * shared with other groups.  Once the bulker is flushed, the outcome is
+     * applied by finishRemoveMembers().
+     */
+    void queueRemoveMembers(ObjectBulker<sai_next_hop_group_api_t> &bulker,
+                            const set<MbrKey> &member_keys,
+                            map<MbrKey, sai_status_t> &statuses)
+    {
+        SWSS_LOG_ENTER();
+
+        for (const auto &key : member_keys)
+        {
+            const auto &nhgm = m_members.at(key);
+
+            if (nhgm.isSynced())
+            {
+                bulker.remove_entry(&statuses[key], nhgm.getId());
+            }
+        }
+    }
+
+    /*
+     * Iterate over the returned statuses and check if the removal was
+     * successful.  If it was, remove the member, otherwise log an error
+     * message.
+     */
+    bool finishRemoveMembers(const map<MbrKey, sai_status_t> &statuses)
+    {
+        SWSS_LOG_ENTER();
+
+        bool success = true;
+
+        for (const auto &status : statuses)
+        {
+            auto &member = m_members.at(status.first);
+
+            if (status.second == SAI_STATUS_SUCCESS)
+            {
+                member.remove();
+            }
+            else
+            {
+                SWSS_LOG_ERROR("Failed to remove next hop group member %s, rv: %d",
+                                member.to_string().c_str(),
+                                status.second);
+                success = false;
+            }
+        }
+
+        return success;
+    }
+
     /*
      * Sync the group, generating a SAI ID.
      */
@@ -321,46 +374,14 @@ protected:
                                                       gMaxBulkSize);
         map<MbrKey, sai_status_t> statuses;
 
-        for (const auto &key : member_keys)
-        {
-            const auto &nhgm = m_members.at(key);
-
-            if (nhgm.isSynced())
-            {
-                bulker.remove_entry(&statuses[key], nhgm.getId());
-            }
-        }
+        queueRemoveMembers(bulker, member_keys, statuses);
 
         /*
          * Flush the bulker to remove the members.
          */
         bulker.flush();
 
-        /*
-         * Iterate over the returned statuses and check if the removal was
-         * successful.  If it was, remove the member, otherwise log an error
-         * message.
-         */
-        bool success = true;
-
-        for (const auto &status : statuses)
-        {
-            auto &member = m_members.at(status.first);
-
-            if (status.second == SAI_STATUS_SUCCESS)
-            {
-                member.remove();
-            }
-            else
-            {
-                SWSS_LOG_ERROR("Failed to remove next hop group member %s, rv: %d",
-                                member.to_string().c_str(),
-                                status.second);
-                success = false;
-            }
-        }
-
-        return success;
+        return finishRemoveMembers(statuses);
     }
 
     /*
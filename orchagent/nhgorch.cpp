@@ -238,6 +238,9 @@ void NhgOrch::doTask(Consumer& consumer)
                 }
             }
 
+            /* The members may change below, reindex the group afterwards. */
+            unindexNhg(index);
+
             /* If the group does not exist, create one. */
             if (nhg_it == m_syncdNextHopGroups.end())
             {
@@ -389,6 +392,8 @@ void NhgOrch::doTask(Consumer& consumer)
                     }
                 }
             }
+
+            indexNhg(index);
         }
         else if (op == DEL_COMMAND)
         {
@@ -425,6 +430,7 @@ void NhgOrch::doTask(Consumer& consumer)
 
                 if (success)
                 {
+                    unindexNhg(index);
                     m_syncdNextHopGroups.erase(nhg_it);
                 }
             }
@@ -450,8 +456,9 @@ void NhgOrch::doTask(Consumer& consumer)
 
 /*
  * Purpose:     Validate a next hop for any groups that contains it.
- * Description: Iterate over all next hop groups and validate the next hop in
- *              those who contain it.
+ * Description: Look up the groups containing the next hop in the next hop
+ *              index and sync the next hop's member in all of them with a
+ *              single bulk create.
  * Params:      IN  nh_key - The next hop to validate.
  * Returns:     true, if the next hop was successfully validated in all
  *              containing groups;
@@ -461,37 +468,56 @@ bool NhgOrch::validateNextHop(const NextHopKey& nh_key)
 {
     SWSS_LOG_ENTER();
 
-    /*
-     * Iterate through all groups and validate the next hop in those who
-     * contain it.
-     */
-    for (auto& it : m_syncdNextHopGroups)
+    const auto& nhgs_it = m_nhgsByNextHop.find(nh_key);
+    if (nhgs_it == m_nhgsByNextHop.end())
+    {
+        return true;
+    }
+
+    ObjectBulker<sai_next_hop_group_api_t> nextHopGroupMemberBulker(sai_next_hop_group_api, gSwitchId, gMaxBulkSize);
+    map<string, map<NextHopKey, sai_object_id_t>> syncing;
+    bool success = true;
+
+    for (const auto& index : nhgs_it->second)
     {
-        auto& nhg = it.second.nhg;
+        auto& nhg = m_syncdNextHopGroups.at(index).nhg;
 
-        if (nhg->hasMember(nh_key))
+        /*
+         * If sync fails, stop queueing right away, as we expect it to be due
+         * to a reason for which any other future validations will fail too.
+         */
+        if (!nhg->validateNextHop(nh_key, nextHopGroupMemberBulker, syncing[index]))
         {
-            /*
-             * If sync fails, exit right away, as we expect it to be due to a
-             * raeson for which any other future validations will fail too.
-             */
-            if (!nhg->validateNextHop(nh_key))
-            {
-                SWSS_LOG_ERROR("Failed to validate next hop %s in group %s",
-                                nh_key.to_string().c_str(),
-                                it.first.c_str());
-                return false;
-            }
+            SWSS_LOG_ERROR("Failed to validate next hop %s in group %s",
+                            nh_key.to_string().c_str(),
+                            index.c_str());
+            success = false;
+            break;
         }
     }
 
-    return true;
+    /* Flush the bulker to sync the members of all the groups at once. */
+    nextHopGroupMemberBulker.flush();
+
+    for (const auto& it : syncing)
+    {
+        if (!m_syncdNextHopGroups.at(it.first).nhg->finishSyncMembers(it.second))
+        {
+            SWSS_LOG_ERROR("Failed to validate next hop %s in group %s",
+                            nh_key.to_string().c_str(),
+                            it.first.c_str());
+            success = false;
+        }
+    }
+
+    return success;
 }
 
 /*
  * Purpose:     Invalidate a next hop for any groups containing it.
- * Description: Iterate through the next hop groups and remove the next hop
- *              from those that contain it.
+ * Description: Look up the groups containing the next hop in the next hop
+ *              index and remove the next hop's member from all of them with
+ *              a single bulk remove.
  * Params:      IN  nh_key - The next hop to invalidate.
  * Returns:     true, if the next hop was successfully invalidatedd from all
  *              containing groups;
@@ -501,28 +527,91 @@ bool NhgOrch::invalidateNextHop(const NextHopKey& nh_key)
 {
     SWSS_LOG_ENTER();
 
-    /*
-     * Iterate through all groups and invalidate the next hop from those who
-     * contain it.
-     */
-    for (auto& it : m_syncdNextHopGroups)
+    const auto& nhgs_it = m_nhgsByNextHop.find(nh_key);
+    if (nhgs_it == m_nhgsByNextHop.end())
     {
-        auto& nhg = it.second.nhg;
+        return true;
+    }
+
+    ObjectBulker<sai_next_hop_group_api_t> nextHopGroupMemberBulker(sai_next_hop_group_api, gSwitchId, gMaxBulkSize);
+    map<string, map<NextHopKey, sai_status_t>> statuses;
+
+    for (const auto& index : nhgs_it->second)
+    {
+        m_syncdNextHopGroups.at(index).nhg->invalidateNextHop(nh_key, nextHopGroupMemberBulker, statuses[index]);
+    }
 
-        if (nhg->hasMember(nh_key))
+    /* Flush the bulker to remove the members of all the groups at once. */
+    nextHopGroupMemberBulker.flush();
+
+    bool success = true;
+    for (const auto& it : statuses)
+    {
+        if (!m_syncdNextHopGroups.at(it.first).nhg->finishRemoveMembers(it.second))
         {
-            /* If the remove fails, exit right away. */
-            if (!nhg->invalidateNextHop(nh_key))
-            {
-                SWSS_LOG_WARN("Failed to invalidate next hop %s from group %s",
-                                nh_key.to_string().c_str(),
-                                it.first.c_str());
-                return false;
-            }
+            SWSS_LOG_WARN("Failed to invalidate next hop %s from group %s",
+                            nh_key.to_string().c_str(),
+                            it.first.c_str());
+            success = false;
         }
     }
 
-    return true;
+    return success;
+}
+
+/*
+ * Purpose:     Add a group to the next hop index.
+ * Description: Record the group under each of its next hops.
+ * Params:      IN  index - The CP index of the next hop group.
+ * Returns:     Nothing.
+ */
+void NhgOrch::indexNhg(const string& index)
+{
+    SWSS_LOG_ENTER();
+
+    const auto& nhg_it = m_syncdNextHopGroups.find(index);
+    if (nhg_it == m_syncdNextHopGroups.end())
+    {
+        return;
+    }
+
+    for (const auto& nh_key : nhg_it->second.nhg->getKey().getNextHops())
+    {
+        m_nhgsByNextHop[nh_key].insert(index);
+    }
+}
+
+/*
+ * Purpose:     Remove a group from the next hop index.
+ * Description: Drop the group from under each of its next hops.  This must
+ *              be called before the group's key changes.
+ * Params:      IN  index - The CP index of the next hop group.
+ * Returns:     Nothing.
+ */
+void NhgOrch::unindexNhg(const string& index)
+{
+    SWSS_LOG_ENTER();
+
+    const auto& nhg_it = m_syncdNextHopGroups.find(index);
+    if (nhg_it == m_syncdNextHopGroups.end())
+    {
+        return;
+    }
+
+    for (const auto& nh_key : nhg_it->second.nhg->getKey().getNextHops())
+    {
+        auto nhgs_it = m_nhgsByNextHop.find(nh_key);
+        if (nhgs_it == m_nhgsByNextHop.end())
+        {
+            continue;
+        }
+
+        nhgs_it->second.erase(index);
+        if (nhgs_it->second.empty())
+        {
+            m_nhgsByNextHop.erase(nhgs_it);
+        }
+    }
 }
 
 /*
@@ -592,18 +681,16 @@ sai_object_id_t NextHopGroupMember::getNhId() const
 
 /*
  * Purpose:     Update the weight of a member.
- * Description: Set the new member's weight and if the member is synced, update
- *              the SAI attribute as well.
+ * Description: Set the new member's weight and if the member is synced, queue
+ *              the SAI attribute update into the bulker as well.
  * Params:      IN  weight - The weight of the next hop group member.
- * Returns:     true, if the operation was successful;
- *              false, otherwise.
+ *              IN  bulker - The bulker the attribute update is queued into.
+ * Returns:     Nothing.
  */
-bool NextHopGroupMember::updateWeight(uint32_t weight)
+void NextHopGroupMember::updateWeight(uint32_t weight, ObjectBulker<sai_next_hop_group_api_t>& bulker)
 {
     SWSS_LOG_ENTER();
 
-    bool success = true;
-
     m_key.weight = weight;
 
     if (isSynced())
@@ -612,11 +699,8 @@ bool NextHopGroupMember::updateWeight(uint32_t weight)
         nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_WEIGHT;
         nhgm_attr.value.s32 = m_key.weight;
 
-        sai_status_t status = sai_next_hop_group_api->set_next_hop_group_member_attribute(m_gm_id, &nhgm_attr);
-        success = status == SAI_STATUS_SUCCESS;
+        bulker.set_entry_attribute(m_gm_id, &nhgm_attr);
     }
-
-    return success;
 }
 
 /*
@@ -898,10 +982,8 @@ bool NextHopGroup::remove()
 
 /*
  * Purpose:     Sync the given next hop group's members over the SAI API.
- * Description: Iterate over the given members and sync them.  If the member
- *              is already synced, we skip it.  If any of the next hops isn't
- *              already synced by the neighOrch, this will fail.  Any next hop
- *              which has the neighbor interface down will be skipped.
+ * Description: Queue the given members into a bulker, flush it and apply the
+ *              outcome.
  * Params:      IN  nh_keys - The next hop keys of the members to sync.
  * Returns:     true, if the members were added succesfully;
  *              false, otherwise.
@@ -910,11 +992,39 @@ bool NextHopGroup::syncMembers(const std::set<NextHopKey>& nh_keys)
 {
     SWSS_LOG_ENTER();
 
+    ObjectBulker<sai_next_hop_group_api_t> nextHopGroupMemberBulker(sai_next_hop_group_api, gSwitchId, gMaxBulkSize);
+    std::map<NextHopKey, sai_object_id_t> syncingMembers;
+
+    bool success = queueSyncMembers(nextHopGroupMemberBulker, nh_keys, syncingMembers);
+
+    /* Flush the bulker to perform the sync. */
+    nextHopGroupMemberBulker.flush();
+
+    return finishSyncMembers(syncingMembers) && success;
+}
+
+/*
+ * Purpose:     Queue the sync of the given next hop group's members.
+ * Description: Iterate over the given members and queue their creation into
+ *              the bulker.  If the member is already synced, we skip it.  If
+ *              any of the next hops isn't already synced by the neighOrch,
+ *              this will fail.  Any next hop which has the neighbor interface
+ *              down will be skipped.
+ * Params:      IN  bulker  - The bulker the members are created with.
+ *              IN  nh_keys - The next hop keys of the members to sync.
+ *              OUT syncing - The members queued, filled in by the flush.
+ * Returns:     true, if all the members could be queued;
+ *              false, otherwise.
+ */
+bool NextHopGroup::queueSyncMembers(ObjectBulker<sai_next_hop_group_api_t>& bulker,
+                                    const std::set<NextHopKey>& nh_keys,
+                                    std::map<NextHopKey, sai_object_id_t>& syncing)
+{
+    SWSS_LOG_ENTER();
+
     /* This method should not be called for single-membered non-recursive nexthop groups */
     assert(isRecursive() || (m_members.size() > 1));
 
-    ObjectBulker<sai_next_hop_group_api_t> nextHopGroupMemberBulker(sai_next_hop_group_api, gSwitchId, gMaxBulkSize);
-
     /*
      * Iterate over the given next hops.
      * If the group member is already synced, skip it.
@@ -922,8 +1032,6 @@ bool NextHopGroup::syncMembers(const std::set<NextHopKey>& nh_keys)
      * immediately.
      * If a next hop's interface is down, skip it from being synced.
      */
-    std::map<NextHopKey, sai_object_id_t> syncingMembers;
-
     bool success = true;
     for (const auto& nh_key : nh_keys)
     {
@@ -958,19 +1066,28 @@ bool NextHopGroup::syncMembers(const std::set<NextHopKey>& nh_keys)
         vector<sai_attribute_t> nhgm_attrs = createNhgmAttrs(nhgm);
 
         /* Add a bulker entry for this member. */
-        nextHopGroupMemberBulker.create_entry(&syncingMembers[nh_key],
-                                               (uint32_t)nhgm_attrs.size(),
-                                               nhgm_attrs.data());
+        bulker.create_entry(&syncing[nh_key],
+                            (uint32_t)nhgm_attrs.size(),
+                            nhgm_attrs.data());
     }
 
-    /* Flush the bulker to perform the sync. */
-    nextHopGroupMemberBulker.flush();
+    return success;
+}
 
-    /*
-     * Go through the synced members and increment the Crm ref count for the
-     * successful ones.
-     */
-    for (const auto& mbr : syncingMembers)
+/*
+ * Purpose:     Apply the outcome of the members sync.
+ * Description: Go through the synced members and sync the successful ones,
+ *              incrementing the Crm ref count.
+ * Params:      IN  syncing - The members queued by queueSyncMembers().
+ * Returns:     true, if all the members were created;
+ *              false, otherwise.
+ */
+bool NextHopGroup::finishSyncMembers(const std::map<NextHopKey, sai_object_id_t>& syncing)
+{
+    SWSS_LOG_ENTER();
+
+    bool success = true;
+    for (const auto& mbr : syncing)
     {
         /* Check that the returned member ID is valid. */
         if (mbr.second == SAI_NULL_OBJECT_ID)
@@ -1025,8 +1142,12 @@ bool NextHopGroup::update(const NextHopGroupKey& nhg_key)
 
     std::set<NextHopKey> new_nh_keys = nhg_key.getNextHops();
     std::set<NextHopKey> removed_nh_keys;
+    std::set<NextHopKey> reweighted_nh_keys;
 
-    /* Mark the members that need to be removed. */
+    /*
+     * Compute the diff against the new key: the members to remove, the ones
+     * to update the weight of and the ones to add.
+     */
     for (auto& mbr_it : m_members)
     {
         const NextHopKey& nh_key = mbr_it.first;
@@ -1042,10 +1163,9 @@ bool NextHopGroup::update(const NextHopGroupKey& nhg_key)
         /* If the member is updated, update it's weight. */
         else
         {
-            if (new_nh_key_it->weight && mbr_it.second.getWeight() != new_nh_key_it->weight && !mbr_it.second.updateWeight(new_nh_key_it->weight))
+            if (new_nh_key_it->weight && mbr_it.second.getWeight() != new_nh_key_it->weight)
             {
-                SWSS_LOG_WARN("Failed to update member %s weight", nh_key.to_string().c_str());
-                return false;
+                reweighted_nh_keys.insert(*new_nh_key_it);
             }
 
             /*
@@ -1056,17 +1176,19 @@ bool NextHopGroup::update(const NextHopGroupKey& nhg_key)
         }
     }
 
-    /* Remove the removed members. */
-    if (!removeMembers(removed_nh_keys))
-    {
-        SWSS_LOG_WARN("Failed to remove members from group %s", to_string().c_str());
-        return false;
-    }
+    /*
+     * Apply the whole diff with a single bulker.  The bulker removes the
+     * members before creating the new ones, so we don't hit the ASIC group
+     * members limit.
+     */
+    ObjectBulker<sai_next_hop_group_api_t> nextHopGroupMemberBulker(sai_next_hop_group_api, gSwitchId, gMaxBulkSize);
 
-    /* Remove the removed members. */
-    for (const auto& nh_key : removed_nh_keys)
+    map<NextHopKey, sai_status_t> removing;
+    queueRemoveMembers(nextHopGroupMemberBulker, removed_nh_keys, removing);
+
+    for (const auto& nh_key : reweighted_nh_keys)
     {
-        m_members.erase(nh_key);
+        m_members.at(nh_key).updateWeight(nh_key.weight, nextHopGroupMemberBulker);
     }
 
     /* Add any new members to the group. */
@@ -1080,13 +1202,45 @@ bool NextHopGroup::update(const NextHopGroupKey& nhg_key)
      * there may be previous members that were not successfully synced
      * before the update, so we must make sure we sync those as well.
      */
-    if (!syncMembers(m_key.getNextHops()))
+    map<NextHopKey, sai_object_id_t> syncing;
+    bool success = queueSyncMembers(nextHopGroupMemberBulker, m_key.getNextHops(), syncing);
+
+    nextHopGroupMemberBulker.flush();
+
+    if (!finishRemoveMembers(removing))
+    {
+        SWSS_LOG_WARN("Failed to remove members from group %s", to_string().c_str());
+        success = false;
+    }
+
+    /* Remove the removed members, keeping the ones still synced. */
+    for (const auto& nh_key : removed_nh_keys)
+    {
+        if (!m_members.at(nh_key).isSynced())
+        {
+            m_members.erase(nh_key);
+        }
+    }
+
+    for (const auto& nh_key : reweighted_nh_keys)
+    {
+        const auto& nhgm = m_members.at(nh_key);
+
+        if (nhgm.isSynced() &&
+            nextHopGroupMemberBulker.set_status(nhgm.getId()) != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_WARN("Failed to update member %s weight", nh_key.to_string().c_str());
+            success = false;
+        }
+    }
+
+    if (!finishSyncMembers(syncing))
     {
         SWSS_LOG_WARN("Failed to sync new members for group %s", to_string().c_str());
-        return false;
+        success = false;
     }
 
-    return true;
+    return success;
 }
 
 /*
@@ -1126,18 +1280,22 @@ vector<sai_attribute_t> NextHopGroup::createNhgmAttrs(const NextHopGroupMember&
 
 /*
  * Purpose:     Validate a next hop in the group.
- * Description: Sync the validated next hop group member.
- * Params:      IN  nh_key - The next hop to validate.
+ * Description: Queue the sync of the validated next hop group member.
+ * Params:      IN  nh_key  - The next hop to validate.
+ *              IN  bulker  - The bulker shared by the groups of the next hop.
+ *              OUT syncing - The members queued, see finishSyncMembers().
  * Returns:     true, if the operation was successful;
  *              false, otherwise.
  */
-bool NextHopGroup::validateNextHop(const NextHopKey& nh_key)
+bool NextHopGroup::validateNextHop(const NextHopKey& nh_key,
+                                   ObjectBulker<sai_next_hop_group_api_t>& bulker,
+                                   map<NextHopKey, sai_object_id_t>& syncing)
 {
     SWSS_LOG_ENTER();
 
     if (isRecursive() || (m_members.size() > 1))
     {
-        return syncMembers({nh_key});
+        return queueSyncMembers(bulker, {nh_key}, syncing);
     }
 
     return true;
@@ -1145,19 +1303,20 @@ bool NextHopGroup::validateNextHop(const NextHopKey& nh_key)
 
 /*
  * Purpose:     Invalidate a next hop in the group.
- * Description: Sync the invalidated next hop group member.
- * Params:      IN  nh_key - The next hop to invalidate.
- * Returns:     true, if the operation was successful;
- *              false, otherwise.
+ * Description: Queue the removal of the invalidated next hop group member.
+ * Params:      IN  nh_key   - The next hop to invalidate.
+ *              IN  bulker   - The bulker shared by the groups of the next hop.
+ *              OUT statuses - The members queued, see finishRemoveMembers().
+ * Returns:     Nothing.
  */
-bool NextHopGroup::invalidateNextHop(const NextHopKey& nh_key)
+void NextHopGroup::invalidateNextHop(const NextHopKey& nh_key,
+                                     ObjectBulker<sai_next_hop_group_api_t>& bulker,
+                                     map<NextHopKey, sai_status_t>& statuses)
 {
     SWSS_LOG_ENTER();
 
     if (isRecursive() || (m_members.size() > 1))
     {
-        return removeMembers({nh_key});
+        queueRemoveMembers(bulker, {nh_key}, statuses);
     }
-
-    return true;
 }
@@ -23,8 +23,11 @@ public:
     /* Destructor. */
     ~NextHopGroupMember();
 
-    /* Update member's weight and update the SAI attribute as well. */
-    bool updateWeight(uint32_t weight);
+    /*
+     * Update member's weight, queueing the SAI attribute update into the
+     * bulker if the member is synced.
+     */
+    void updateWeight(uint32_t weight, ObjectBulker<sai_next_hop_group_api_t>& bulker);
 
     /* Sync / Remove. */
     void sync(sai_object_id_t gm_id) override;
@@ -74,11 +77,24 @@ public:
      */
     bool update(const NextHopGroupKey& nhg_key);
 
-    /* Validate a next hop in the group, syncing it. */
-    bool validateNextHop(const NextHopKey& nh_key);
+    /*
+     * Validate a next hop in the group, queueing its sync into a bulker
+     * shared with the other groups containing it.
+     */
+    bool validateNextHop(const NextHopKey& nh_key,
+                         ObjectBulker<sai_next_hop_group_api_t>& bulker,
+                         map<NextHopKey, sai_object_id_t>& syncing);
 
-    /* Invalidate a next hop in the group, removing it. */
-    bool invalidateNextHop(const NextHopKey& nh_key);
+    /*
+     * Invalidate a next hop in the group, queueing its removal into a bulker
+     * shared with the other groups containing it.
+     */
+    void invalidateNextHop(const NextHopKey& nh_key,
+                           ObjectBulker<sai_next_hop_group_api_t>& bulker,
+                           map<NextHopKey, sai_status_t>& statuses);
+
+    /* Apply the outcome of the members creation once the bulker is flushed. */
+    bool finishSyncMembers(const map<NextHopKey, sai_object_id_t>& syncing);
 
     /* Getters / Setters. */
     inline bool isTemp() const override { return m_is_temp; }
@@ -105,6 +121,11 @@ private:
     /* Add group's members over the SAI API for the given keys. */
     bool syncMembers(const set<NextHopKey>& nh_keys) override;
 
+    /* Queue the creation of the given members into the bulker. */
+    bool queueSyncMembers(ObjectBulker<sai_next_hop_group_api_t>& bulker,
+                          const set<NextHopKey>& nh_keys,
+                          map<NextHopKey, sai_object_id_t>& syncing);
+
     /* Create the attributes vector for a next hop group member. */
     vector<sai_attribute_t> createNhgmAttrs(
                                 const NextHopGroupMember& nhgm) const override;
@@ -130,5 +151,15 @@ public:
     bool invalidateNextHop(const NextHopKey& nh_key);
 
 private:
+    /*
+     * Index of the groups containing each next hop, so a next hop change
+     * only visits the groups it affects.
+     */
+    map<NextHopKey, set<string>> m_nhgsByNextHop;
+
+    /* Add / Remove a group to / from the next hop index. */
+    void indexNhg(const string& index);
+    void unindexNhg(const string& index);
+
     void doTask(Consumer& consumer) override;
 };
@@ -498,7 +498,7 @@ void ConsumerBase::recordTuple(const KeyOpFieldsValuesTuple &tuple)
 
     auto& swssRecorder = Recorder::Instance().swss;
 
-    if (!swssRecorder.isAsyncEnabled())
+    if (!swssRecorder.isAsyncEnabled() && !swssRecorder.isBinary())
     {
         swssRecorder.record(dumpTuple(tuple));
         return;
@@ -518,7 +518,7 @@ void ConsumerBase::recordTuples(const std::deque<KeyOpFieldsValuesTuple> &entrie
 
     auto& swssRecorder = Recorder::Instance().swss;
 
-    if (!swssRecorder.isAsyncEnabled())
+    if (!swssRecorder.isAsyncEnabled() && !swssRecorder.isBinary())
     {
         for (const auto& entry : entries)
         {
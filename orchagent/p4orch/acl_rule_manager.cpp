@@ -3,6 +3,7 @@
 #include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "SaiAttributeList.h"
@@ -196,9 +197,39 @@ void AclRuleManager::drainWithNotExecuted() {
   drainMgmtWithNotExecuted(m_entries, m_publisher);
 }
 
+ReturnCode AclRuleManager::processRuleEntries(
+    const std::vector<std::string>& acl_rule_keys,
+    const std::vector<P4AclRuleAppDbEntry>& entries,
+    const std::vector<swss::KeyOpFieldsValuesTuple>& tuple_list,
+    const std::string& op) {
+  SWSS_LOG_ENTER();
+
+  ReturnCode status;
+  std::vector<ReturnCode> statuses;
+  if (op == SET_COMMAND) {
+    statuses = processAddRuleRequests(acl_rule_keys, entries);
+  } else {
+    statuses = processDeleteRuleRequests(acl_rule_keys, entries);
+  }
+  for (size_t i = 0; i < entries.size(); ++i) {
+    m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(tuple_list[i]),
+                         kfvFieldsValues(tuple_list[i]), statuses[i],
+                         /*replace=*/true);
+    if (status.ok() && !statuses[i].ok()) {
+      status = statuses[i];
+    }
+  }
+  return status;
+}
+
 ReturnCode AclRuleManager::drain() {
   SWSS_LOG_ENTER();
 
+  std::vector<std::string> rule_key_list;
+  std::vector<P4AclRuleAppDbEntry> entry_list;
+  std::vector<swss::KeyOpFieldsValuesTuple> tuple_list;
+  std::unordered_set<std::string> batched_rules;
+  std::string prev_op;
   ReturnCode status;
   while (!m_entries.empty()) {
     auto key_op_fvs_tuple = m_entries.front();
@@ -242,21 +273,51 @@ ReturnCode AclRuleManager::drain() {
     const auto& acl_table_name = app_db_entry.acl_table_name;
     const auto& acl_rule_key = KeyGenerator::generateAclRuleKey(
         app_db_entry.match_fvs, std::to_string(app_db_entry.priority));
+    const auto& table_name_and_rule_key =
+        concatTableNameAndRuleKey(acl_table_name, acl_rule_key);
 
     const auto& operation = kfvOp(key_op_fvs_tuple);
-    if (operation == SET_COMMAND) {
-      auto* acl_rule = getAclRule(acl_table_name, acl_rule_key);
-      if (acl_rule == nullptr) {
-        status = processAddRuleRequest(acl_rule_key, app_db_entry);
-      } else {
-        status = processUpdateRuleRequest(app_db_entry, *acl_rule);
-      }
-    } else if (operation == DEL_COMMAND) {
-      status = processDeleteRuleRequest(acl_table_name, acl_rule_key);
-    } else {
+    auto* acl_rule = getAclRule(acl_table_name, acl_rule_key);
+    bool update = (operation == SET_COMMAND && acl_rule != nullptr);
+
+    // New rules and deletions are batched into bulk SAI calls. Process the
+    // batch when the operation changes, on updates, and when a rule repeats
+    // since it depends on the outcome of the pending request.
+    if (!entry_list.empty() &&
+        (operation != prev_op || update ||
+         batched_rules.count(table_name_and_rule_key))) {
+      status = processRuleEntries(rule_key_list, entry_list, tuple_list,
+                                  prev_op);
+      rule_key_list.clear();
+      entry_list.clear();
+      tuple_list.clear();
+      batched_rules.clear();
+      acl_rule = getAclRule(acl_table_name, acl_rule_key);
+      update = (operation == SET_COMMAND && acl_rule != nullptr);
+    }
+
+    if (!status.ok()) {
+      // Return SWSS_RC_NOT_EXECUTED if failure has occured.
+      m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple),
+                           kfvFieldsValues(key_op_fvs_tuple),
+                           ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED),
+                           /*replace=*/true);
+      break;
+    }
+
+    if (update) {
+      status = processUpdateRuleRequest(app_db_entry, *acl_rule);
+    } else if (operation != SET_COMMAND && operation != DEL_COMMAND) {
       status = ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
                << "Unknown operation type " << operation;
       SWSS_LOG_ERROR("%s", status.message().c_str());
+    } else {
+      prev_op = operation;
+      rule_key_list.push_back(acl_rule_key);
+      entry_list.push_back(app_db_entry);
+      tuple_list.push_back(key_op_fvs_tuple);
+      batched_rules.insert(table_name_and_rule_key);
+      continue;
     }
     m_publisher->publish(APP_P4RT_TABLE_NAME, kfvKey(key_op_fvs_tuple),
                          kfvFieldsValues(key_op_fvs_tuple), status,
@@ -265,6 +326,14 @@ ReturnCode AclRuleManager::drain() {
       break;
     }
   }
+
+  if (!entry_list.empty()) {
+    auto rc =
+        processRuleEntries(rule_key_list, entry_list, tuple_list, prev_op);
+    if (!rc.ok()) {
+      status = rc;
+    }
+  }
   drainWithNotExecuted();
   return status;
 }
@@ -1649,13 +1718,13 @@ ReturnCode AclRuleManager::setMeterValue(const P4AclTableDefinition *acl_table,
     return ReturnCode();
 }
 
-ReturnCode AclRuleManager::createAclRule(P4AclRule &acl_rule)
+ReturnCode AclRuleManager::createAclRuleMeterAndCounter(P4AclRule &acl_rule, bool *created_meter,
+                                                        bool *created_counter)
 {
     SWSS_LOG_ENTER();
 
-    // Track if the entry creates a new counter or meter
-    bool created_meter = false;
-    bool created_counter = false;
+    *created_meter = false;
+    *created_counter = false;
     const auto &table_name_and_rule_key = concatTableNameAndRuleKey(acl_rule.acl_table_name, acl_rule.acl_rule_key);
 
     // Add meter
@@ -1669,7 +1738,7 @@ ReturnCode AclRuleManager::createAclRule(P4AclRule &acl_rule)
                 SWSS_LOG_ERROR("Failed to create ACL meter for rule %s", QuotedVar(acl_rule.acl_rule_key).c_str());
                 return status;
             }
-            created_meter = true;
+            *created_meter = true;
         }
     }
 
@@ -1683,19 +1752,54 @@ ReturnCode AclRuleManager::createAclRule(P4AclRule &acl_rule)
             if (!status.ok())
             {
                 SWSS_LOG_ERROR("Failed to create ACL counter for rule %s", QuotedVar(acl_rule.acl_rule_key).c_str());
-                if (created_meter)
+                if (*created_meter)
                 {
                     auto rc = removeAclMeter(table_name_and_rule_key);
                     if (!rc.ok())
                     {
                         SWSS_RAISE_CRITICAL_STATE("Failed to remove ACL meter in recovery.");
                     }
+                    *created_meter = false;
                 }
                 return status;
             }
-            created_counter = true;
+            *created_counter = true;
         }
     }
+    return ReturnCode();
+}
+
+void AclRuleManager::removeAclRuleMeterAndCounter(const P4AclRule &acl_rule, bool created_meter, bool created_counter)
+{
+    SWSS_LOG_ENTER();
+
+    const auto &table_name_and_rule_key = concatTableNameAndRuleKey(acl_rule.acl_table_name, acl_rule.acl_rule_key);
+    if (created_meter)
+    {
+        auto rc = removeAclMeter(table_name_and_rule_key);
+        if (!rc.ok())
+        {
+            SWSS_RAISE_CRITICAL_STATE("Failed to remove ACL meter in recovery.");
+        }
+    }
+    if (created_counter)
+    {
+        auto rc = removeAclCounter(acl_rule.acl_table_name, table_name_and_rule_key);
+        if (!rc.ok())
+        {
+            SWSS_RAISE_CRITICAL_STATE("Failed to remove ACL counter in recovery.");
+        }
+    }
+}
+
+ReturnCode AclRuleManager::createAclRule(P4AclRule &acl_rule)
+{
+    SWSS_LOG_ENTER();
+
+    // Track if the entry creates a new counter or meter
+    bool created_meter = false;
+    bool created_counter = false;
+    RETURN_IF_ERROR(createAclRuleMeterAndCounter(acl_rule, &created_meter, &created_counter));
 
     auto attrs = getRuleSaiAttrs(acl_rule);
 
@@ -1706,22 +1810,7 @@ ReturnCode AclRuleManager::createAclRule(P4AclRule &acl_rule)
         ReturnCode status = ReturnCode(sai_status)
                             << "Failed to create ACL entry in table " << QuotedVar(acl_rule.acl_table_name);
         SWSS_LOG_ERROR("%s SAI_STATUS: %s", status.message().c_str(), sai_serialize_status(sai_status).c_str());
-        if (created_meter)
-        {
-            auto rc = removeAclMeter(table_name_and_rule_key);
-            if (!rc.ok())
-            {
-                SWSS_RAISE_CRITICAL_STATE("Failed to remove ACL meter in recovery.");
-            }
-        }
-        if (created_counter)
-        {
-            auto rc = removeAclCounter(acl_rule.acl_table_name, table_name_and_rule_key);
-            if (!rc.ok())
-            {
-                SWSS_RAISE_CRITICAL_STATE("Failed to remove ACL counter in recovery.");
-            }
-        }
+        removeAclRuleMeterAndCounter(acl_rule, created_meter, created_counter);
         return status;
     }
     return ReturnCode();
@@ -1865,7 +1954,7 @@ ReturnCode AclRuleManager::updateAclRule(const P4AclRule &acl_rule, const P4AclR
     return ReturnCode();
 }
 
-ReturnCode AclRuleManager::removeAclRule(const std::string &acl_table_name, const std::string &acl_rule_key)
+ReturnCode AclRuleManager::validateAclRuleRemoval(const std::string &acl_table_name, const std::string &acl_rule_key)
 {
     auto *acl_rule = getAclRule(acl_table_name, acl_rule_key);
     if (acl_rule == nullptr)
@@ -1888,13 +1977,30 @@ ReturnCode AclRuleManager::removeAclRule(const std::string &acl_table_name, cons
                              << "ACL rule " << QuotedVar(acl_rule_key)
                              << " referenced by other objects (ref_count = " << ref_count << ")");
     }
+    return ReturnCode();
+}
+
+ReturnCode AclRuleManager::removeAclRule(const std::string &acl_table_name, const std::string &acl_rule_key)
+{
+    RETURN_IF_ERROR(validateAclRuleRemoval(acl_table_name, acl_rule_key));
+    auto *acl_rule = getAclRule(acl_table_name, acl_rule_key);
 
     CHECK_ERROR_AND_LOG_AND_RETURN(sai_acl_api->remove_acl_entry(acl_rule->acl_entry_oid),
                                    "Failed to remove ACL rule with key "
                                        << sai_serialize_object_id(acl_rule->acl_entry_oid) << " in table "
                                        << QuotedVar(acl_table_name));
+    return completeAclRuleRemoval(*acl_rule);
+}
+
+ReturnCode AclRuleManager::completeAclRuleRemoval(P4AclRule &acl_rule)
+{
+    // Copy the keys, the rule is erased at the end.
+    const std::string acl_table_name = acl_rule.acl_table_name;
+    const std::string acl_rule_key = acl_rule.acl_rule_key;
+    const auto &table_name_and_rule_key = concatTableNameAndRuleKey(acl_table_name, acl_rule_key);
+
     bool deleted_meter = false;
-    if (acl_rule->meter.enabled)
+    if (acl_rule.meter.enabled)
     {
         m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_POLICER, table_name_and_rule_key);
         auto status = removeAclMeter(table_name_and_rule_key);
@@ -1902,7 +2008,7 @@ ReturnCode AclRuleManager::removeAclRule(const std::string &acl_table_name, cons
         {
             SWSS_LOG_ERROR("Failed to remove ACL meter for rule with key %s in table %s.",
                            QuotedVar(acl_rule_key).c_str(), QuotedVar(acl_table_name).c_str());
-            auto rc = createAclRule(*acl_rule);
+            auto rc = createAclRule(acl_rule);
             if (!rc.ok())
             {
                 SWSS_RAISE_CRITICAL_STATE("Failed to create ACL rule in recovery.");
@@ -1910,10 +2016,10 @@ ReturnCode AclRuleManager::removeAclRule(const std::string &acl_table_name, cons
             m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_POLICER, table_name_and_rule_key);
             return status;
         }
-        acl_rule->meter.meter_oid = SAI_NULL_OBJECT_ID;
+        acl_rule.meter.meter_oid = SAI_NULL_OBJECT_ID;
         deleted_meter = true;
     }
-    if (acl_rule->counter.packets_enabled || acl_rule->counter.bytes_enabled)
+    if (acl_rule.counter.packets_enabled || acl_rule.counter.bytes_enabled)
     {
         m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_ACL_COUNTER, table_name_and_rule_key);
         auto status = removeAclCounter(acl_table_name, table_name_and_rule_key);
@@ -1924,7 +2030,7 @@ ReturnCode AclRuleManager::removeAclRule(const std::string &acl_table_name, cons
             m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_ACL_COUNTER, table_name_and_rule_key);
             if (deleted_meter)
             {
-                auto rc = createAclMeter(acl_rule->meter, table_name_and_rule_key, &acl_rule->meter.meter_oid);
+                auto rc = createAclMeter(acl_rule.meter, table_name_and_rule_key, &acl_rule.meter.meter_oid);
                 m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_POLICER, table_name_and_rule_key);
                 if (!rc.ok())
                 {
@@ -1932,7 +2038,7 @@ ReturnCode AclRuleManager::removeAclRule(const std::string &acl_table_name, cons
                     return status;
                 }
             }
-            auto rc = createAclRule(*acl_rule);
+            auto rc = createAclRule(acl_rule);
             if (!rc.ok())
             {
                 SWSS_RAISE_CRITICAL_STATE("Failed to create ACL rule in recovery.");
@@ -1940,43 +2046,43 @@ ReturnCode AclRuleManager::removeAclRule(const std::string &acl_table_name, cons
             return status;
         }
         // Remove counter stats
-        m_countersTable->del(acl_rule->db_key);
+        m_countersTable->del(acl_rule.db_key);
     }
-    gCrmOrch->decCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, acl_rule->acl_table_oid);
-    if (!acl_rule->action_redirect_nexthop_key.empty())
+    gCrmOrch->decCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, acl_rule.acl_table_oid);
+    if (!acl_rule.action_redirect_nexthop_key.empty())
     {
-        m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_NEXT_HOP, acl_rule->action_redirect_nexthop_key);
+        m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_NEXT_HOP, acl_rule.action_redirect_nexthop_key);
     }
-    if (!acl_rule->action_redirect_l3_multicast_group_key.empty()) {
+    if (!acl_rule.action_redirect_l3_multicast_group_key.empty()) {
         m_p4OidMapper->decreaseRefCount(
           SAI_OBJECT_TYPE_IPMC_GROUP,
-          acl_rule->action_redirect_l3_multicast_group_key);
+          acl_rule.action_redirect_l3_multicast_group_key);
     }
-    if (!acl_rule->action_redirect_l2_multicast_group_key.empty()) {
+    if (!acl_rule.action_redirect_l2_multicast_group_key.empty()) {
         m_p4OidMapper->decreaseRefCount(
           SAI_OBJECT_TYPE_L2MC_GROUP,
-          acl_rule->action_redirect_l2_multicast_group_key);
+          acl_rule.action_redirect_l2_multicast_group_key);
     }
-    for (const auto &mirror_session : acl_rule->action_mirror_sessions)
+    for (const auto &mirror_session : acl_rule.action_mirror_sessions)
     {
         m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_MIRROR_SESSION, fvValue(mirror_session).key);
     }
-    auto set_vrf_action_it = acl_rule->action_fvs.find(SAI_ACL_ENTRY_ATTR_ACTION_SET_VRF);
-    if (set_vrf_action_it != acl_rule->action_fvs.end())
+    auto set_vrf_action_it = acl_rule.action_fvs.find(SAI_ACL_ENTRY_ATTR_ACTION_SET_VRF);
+    if (set_vrf_action_it != acl_rule.action_fvs.end())
     {
         m_vrfOrch->decreaseVrfRefCount(set_vrf_action_it->second.aclaction.parameter.oid);
     }
-    auto set_user_trap_it = acl_rule->action_fvs.find(SAI_ACL_ENTRY_ATTR_ACTION_SET_USER_TRAP_ID);
-    if (set_user_trap_it != acl_rule->action_fvs.end())
+    auto set_user_trap_it = acl_rule.action_fvs.find(SAI_ACL_ENTRY_ATTR_ACTION_SET_USER_TRAP_ID);
+    if (set_user_trap_it != acl_rule.action_fvs.end())
     {
         m_p4OidMapper->decreaseRefCount(SAI_OBJECT_TYPE_HOSTIF_USER_DEFINED_TRAP,
-                                        std::to_string(acl_rule->action_qos_queue_num));
+                                        std::to_string(acl_rule.action_qos_queue_num));
     }
-    for (const auto &port_alias : acl_rule->in_ports)
+    for (const auto &port_alias : acl_rule.in_ports)
     {
         gPortsOrch->decreasePortRefCount(port_alias);
     }
-    for (const auto &port_alias : acl_rule->out_ports)
+    for (const auto &port_alias : acl_rule.out_ports)
     {
         gPortsOrch->decreasePortRefCount(port_alias);
     }
@@ -1986,10 +2092,9 @@ ReturnCode AclRuleManager::removeAclRule(const std::string &acl_table_name, cons
     return ReturnCode();
 }
 
-ReturnCode AclRuleManager::processAddRuleRequest(const std::string &acl_rule_key,
-                                                 const P4AclRuleAppDbEntry &app_db_entry)
+ReturnCode AclRuleManager::buildAclRule(const std::string &acl_rule_key, const P4AclRuleAppDbEntry &app_db_entry,
+                                        P4AclRule &acl_rule)
 {
-    P4AclRule acl_rule{};
     acl_rule.priority = app_db_entry.priority;
     acl_rule.acl_rule_key = acl_rule_key;
     acl_rule.p4_action = app_db_entry.action;
@@ -2035,13 +2140,11 @@ ReturnCode AclRuleManager::processAddRuleRequest(const std::string &acl_rule_key
                                  << "Invalid ACL counter type " << QuotedVar(acl_table->counter_unit));
         }
     }
-    status = createAclRule(acl_rule);
-    if (!status.ok())
-    {
-        SWSS_LOG_ERROR("Failed to create ACL rule with key %s in table %s", QuotedVar(acl_rule.acl_rule_key).c_str(),
-                       QuotedVar(app_db_entry.acl_table_name).c_str());
-        return status;
-    }
+    return ReturnCode();
+}
+
+void AclRuleManager::completeAclRuleCreation(P4AclRule &acl_rule)
+{
     // ACL entry created in HW, update refcount
     if (!acl_rule.action_redirect_nexthop_key.empty())
     {
@@ -2094,10 +2197,31 @@ ReturnCode AclRuleManager::processAddRuleRequest(const std::string &acl_rule_key
         // Meter was created, increase ACL rule ref count
         m_p4OidMapper->increaseRefCount(SAI_OBJECT_TYPE_POLICER, table_name_and_rule_key);
     }
-    m_aclRuleTables[acl_table->acl_table_name][acl_rule_key] = std::move(acl_rule);
-    SWSS_LOG_NOTICE(
-        "Suceeded to create ACL rule %s : %s", QuotedVar(acl_rule_key).c_str(),
-        sai_serialize_object_id(m_aclRuleTables[acl_table->acl_table_name][acl_rule_key].acl_entry_oid).c_str());
+    SWSS_LOG_NOTICE("Suceeded to create ACL rule %s : %s", QuotedVar(acl_rule.acl_rule_key).c_str(),
+                    sai_serialize_object_id(acl_rule.acl_entry_oid).c_str());
+    auto &acl_rules = m_aclRuleTables[acl_rule.acl_table_name];
+    const auto acl_rule_key = acl_rule.acl_rule_key;
+    acl_rules[acl_rule_key] = std::move(acl_rule);
+}
+
+ReturnCode AclRuleManager::processAddRuleRequest(const std::string &acl_rule_key,
+                                                 const P4AclRuleAppDbEntry &app_db_entry)
+{
+    P4AclRule acl_rule{};
+    auto status = buildAclRule(acl_rule_key, app_db_entry, acl_rule);
+    if (!status.ok())
+    {
+        return status;
+    }
+
+    status = createAclRule(acl_rule);
+    if (!status.ok())
+    {
+        SWSS_LOG_ERROR("Failed to create ACL rule with key %s in table %s", QuotedVar(acl_rule.acl_rule_key).c_str(),
+                       QuotedVar(app_db_entry.acl_table_name).c_str());
+        return status;
+    }
+    completeAclRuleCreation(acl_rule);
     return status;
 }
 
@@ -2113,6 +2237,143 @@ ReturnCode AclRuleManager::processDeleteRuleRequest(const std::string &acl_table
     return status;
 }
 
+std::vector<ReturnCode> AclRuleManager::processAddRuleRequests(
+    const std::vector<std::string> &acl_rule_keys, const std::vector<P4AclRuleAppDbEntry> &app_db_entries)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<ReturnCode> statuses(app_db_entries.size(), ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED));
+    if (app_db_entries.size() == 1)
+    {
+        statuses[0] = processAddRuleRequest(acl_rule_keys[0], app_db_entries[0]);
+        return statuses;
+    }
+
+    // Meters and counters are created per rule, the ACL entries in one bulk call.
+    std::vector<P4AclRule> acl_rules(app_db_entries.size());
+    std::vector<bool> created_meters(app_db_entries.size(), false);
+    std::vector<bool> created_counters(app_db_entries.size(), false);
+    size_t rule_count = 0;
+    while (rule_count < app_db_entries.size())
+    {
+        auto &acl_rule = acl_rules[rule_count];
+        auto status = buildAclRule(acl_rule_keys[rule_count], app_db_entries[rule_count], acl_rule);
+        if (status.ok())
+        {
+            bool created_meter = false;
+            bool created_counter = false;
+            status = createAclRuleMeterAndCounter(acl_rule, &created_meter, &created_counter);
+            created_meters[rule_count] = created_meter;
+            created_counters[rule_count] = created_counter;
+        }
+        if (!status.ok())
+        {
+            SWSS_LOG_ERROR("Failed to create ACL rule with key %s in table %s",
+                           QuotedVar(acl_rule_keys[rule_count]).c_str(),
+                           QuotedVar(app_db_entries[rule_count].acl_table_name).c_str());
+            statuses[rule_count] = status;
+            break;
+        }
+        ++rule_count;
+    }
+    if (rule_count == 0)
+    {
+        return statuses;
+    }
+
+    std::vector<std::vector<sai_attribute_t>> sai_attrs(rule_count);
+    std::vector<uint32_t> attrs_cnt(rule_count);
+    std::vector<const sai_attribute_t *> attrs_ptr(rule_count);
+    std::vector<sai_object_id_t> object_ids(rule_count, SAI_NULL_OBJECT_ID);
+    std::vector<sai_status_t> object_statuses(rule_count, SAI_STATUS_NOT_EXECUTED);
+    for (size_t i = 0; i < rule_count; ++i)
+    {
+        sai_attrs[i] = getRuleSaiAttrs(acl_rules[i]);
+        attrs_cnt[i] = static_cast<uint32_t>(sai_attrs[i].size());
+        attrs_ptr[i] = sai_attrs[i].data();
+    }
+    // In syncd, bulk SAI calls use mode SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR.
+    sai_acl_api->create_acl_entries(gSwitchId, static_cast<uint32_t>(rule_count), attrs_cnt.data(), attrs_ptr.data(),
+                                    SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, object_ids.data(), object_statuses.data());
+
+    for (size_t i = 0; i < rule_count; ++i)
+    {
+        if (object_statuses[i] == SAI_STATUS_SUCCESS)
+        {
+            acl_rules[i].acl_entry_oid = object_ids[i];
+            completeAclRuleCreation(acl_rules[i]);
+            statuses[i] = ReturnCode();
+            continue;
+        }
+        statuses[i] = ReturnCode(object_statuses[i])
+                      << "Failed to create ACL entry in table " << QuotedVar(acl_rules[i].acl_table_name);
+        if (object_statuses[i] != SAI_STATUS_NOT_EXECUTED)
+        {
+            SWSS_LOG_ERROR("%s SAI_STATUS: %s", statuses[i].message().c_str(),
+                           sai_serialize_status(object_statuses[i]).c_str());
+        }
+        removeAclRuleMeterAndCounter(acl_rules[i], created_meters[i], created_counters[i]);
+    }
+    return statuses;
+}
+
+std::vector<ReturnCode> AclRuleManager::processDeleteRuleRequests(
+    const std::vector<std::string> &acl_rule_keys, const std::vector<P4AclRuleAppDbEntry> &app_db_entries)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<ReturnCode> statuses(app_db_entries.size(), ReturnCode(StatusCode::SWSS_RC_NOT_EXECUTED));
+    if (app_db_entries.size() == 1)
+    {
+        statuses[0] = processDeleteRuleRequest(app_db_entries[0].acl_table_name, acl_rule_keys[0]);
+        return statuses;
+    }
+
+    std::vector<P4AclRule *> acl_rules;
+    std::vector<sai_object_id_t> object_ids;
+    for (size_t i = 0; i < app_db_entries.size(); ++i)
+    {
+        auto status = validateAclRuleRemoval(app_db_entries[i].acl_table_name, acl_rule_keys[i]);
+        if (!status.ok())
+        {
+            statuses[i] = status;
+            break;
+        }
+        acl_rules.push_back(getAclRule(app_db_entries[i].acl_table_name, acl_rule_keys[i]));
+        object_ids.push_back(acl_rules.back()->acl_entry_oid);
+    }
+    if (acl_rules.empty())
+    {
+        return statuses;
+    }
+
+    std::vector<sai_status_t> object_statuses(acl_rules.size(), SAI_STATUS_NOT_EXECUTED);
+    // In syncd, bulk SAI calls use mode SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR.
+    sai_acl_api->remove_acl_entries(static_cast<uint32_t>(acl_rules.size()), object_ids.data(),
+                                    SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, object_statuses.data());
+
+    for (size_t i = 0; i < acl_rules.size(); ++i)
+    {
+        if (object_statuses[i] == SAI_STATUS_SUCCESS)
+        {
+            statuses[i] = completeAclRuleRemoval(*acl_rules[i]);
+        }
+        else
+        {
+            statuses[i] = ReturnCode(object_statuses[i])
+                          << "Failed to remove ACL rule with key " << sai_serialize_object_id(object_ids[i])
+                          << " in table " << QuotedVar(app_db_entries[i].acl_table_name);
+        }
+        if (!statuses[i].ok() && statuses[i].code() != StatusCode::SWSS_RC_NOT_EXECUTED)
+        {
+            SWSS_LOG_ERROR("Failed to remove ACL rule with key %s in table %s: %s",
+                           QuotedVar(acl_rule_keys[i]).c_str(),
+                           QuotedVar(app_db_entries[i].acl_table_name).c_str(), statuses[i].message().c_str());
+        }
+    }
+    return statuses;
+}
+
 ReturnCode AclRuleManager::processUpdateRuleRequest(
     const P4AclRuleAppDbEntry& app_db_entry, P4AclRule &old_acl_rule)
 {
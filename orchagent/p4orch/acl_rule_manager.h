@@ -72,6 +72,29 @@ class AclRuleManager : public ObjectManagerInterface
     // Processes delete operation for an ACL rule.
     ReturnCode processDeleteRuleRequest(const std::string &acl_table_name, const std::string &acl_rule_key);
 
+    // Processes add operations for new ACL rules, creating the ACL entries with
+    // a single bulk SAI call. Returns a status per request, requests after the
+    // first failure are not executed.
+    std::vector<ReturnCode> processAddRuleRequests(const std::vector<std::string> &acl_rule_keys,
+                                                   const std::vector<P4AclRuleAppDbEntry> &app_db_entries);
+
+    // Processes delete operations for ACL rules, removing the ACL entries with
+    // a single bulk SAI call. Returns a status per request.
+    std::vector<ReturnCode> processDeleteRuleRequests(const std::vector<std::string> &acl_rule_keys,
+                                                      const std::vector<P4AclRuleAppDbEntry> &app_db_entries);
+
+    // Processes a batch of add or delete requests and publishes the responses.
+    ReturnCode processRuleEntries(const std::vector<std::string> &acl_rule_keys,
+                                  const std::vector<P4AclRuleAppDbEntry> &entries,
+                                  const std::vector<swss::KeyOpFieldsValuesTuple> &tuple_list, const std::string &op);
+
+    // Builds an ACL rule from the APP_DB entry without programming it.
+    ReturnCode buildAclRule(const std::string &acl_rule_key, const P4AclRuleAppDbEntry &app_db_entry,
+                            P4AclRule &acl_rule);
+
+    // Updates references and internal state after the ACL entry is created.
+    void completeAclRuleCreation(P4AclRule &acl_rule);
+
     // Processes update operation for an ACL rule.
     ReturnCode processUpdateRuleRequest(const P4AclRuleAppDbEntry &app_db_entry, P4AclRule &old_acl_rule);
 
@@ -81,6 +104,12 @@ class AclRuleManager : public ObjectManagerInterface
     // Create an ACL rule.
     ReturnCode createAclRule(P4AclRule &acl_rule);
 
+    // Create the meter and counter used by an ACL rule, if not created yet.
+    ReturnCode createAclRuleMeterAndCounter(P4AclRule &acl_rule, bool *created_meter, bool *created_counter);
+
+    // Remove the meter and counter created for an ACL rule that failed to be created.
+    void removeAclRuleMeterAndCounter(const P4AclRule &acl_rule, bool created_meter, bool created_counter);
+
     // Create an ACL counter.
     ReturnCode createAclCounter(const std::string &acl_table_name, const std::string &counter_key,
                                 const P4AclRule &acl_rule, sai_object_id_t *counter_oid);
@@ -105,6 +134,13 @@ class AclRuleManager : public ObjectManagerInterface
     // Remove the ACL rule by key in the given ACL table.
     ReturnCode removeAclRule(const std::string &acl_table_name, const std::string &acl_rule_key);
 
+    // Check that the ACL rule exists and is not referenced.
+    ReturnCode validateAclRuleRemoval(const std::string &acl_table_name, const std::string &acl_rule_key);
+
+    // Remove the meter, counter, references and internal state of an ACL rule
+    // whose ACL entry was removed.
+    ReturnCode completeAclRuleRemoval(P4AclRule &acl_rule);
+
     // Set Meter value in ACL rule.
     ReturnCode setMeterValue(const P4AclTableDefinition *acl_table, const P4AclRuleAppDbEntry &app_db_entry,
                              P4AclMeter &acl_meter);
@@ -265,46 +265,36 @@ ReturnCode ExtTablesManager::prepareP4SaiExtAPIParams(const P4ExtTableAppDbEntry
                    << "extension entry for invalid table " << app_db_entry.table_name.c_str();
         }
 
-        nlohmann::json j = nlohmann::json::parse(app_db_entry.table_key);
-        for (auto it = j.begin(); it != j.end(); ++it)
+        P4DecodedKey decoded_key;
+        if (!table->key_decoder.decode(app_db_entry.table_key, &decoded_key).ok())
         {
-            std::string match, value, prefix;
-            std::size_t pos;
-
-            match = it.key();
-            value = it.value();
-
-            prefix = p4orch::kMatchPrefix;
-            pos = match.rfind(prefix);
-            if (pos != std::string::npos)
-            {
-                match.erase(0, prefix.length());
-            }
-            else
+            SWSS_LOG_ERROR("Failed to encode match fields for sai call");
+            return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to encode match fields for sai call";
+        }
+        const std::string match_prefix = std::string(p4orch::kMatchPrefix) + p4orch::kFieldDelimiter;
+        for (const auto &unknown_field : decoded_key.unknown_fields)
+        {
+            if (unknown_field.compare(0, match_prefix.size(), match_prefix) != 0)
             {
                 SWSS_LOG_ERROR("Failed to encode match fields for sai call");
                 return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to encode match fields for sai call";
             }
+            const std::string match = unknown_field.substr(match_prefix.size());
+            SWSS_LOG_ERROR("extension entry for invalid match field %s", match.c_str());
+            return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
+                   << "extension entry for invalid match field " << match.c_str();
+        }
 
-            prefix = p4orch::kFieldDelimiter;
-            pos = match.rfind(prefix);
-            if (pos != std::string::npos)
-            {
-                match.erase(0, prefix.length());
-            }
-            else
+        const auto &key_fields = table->key_decoder.fields();
+        for (size_t i = 0; i < key_fields.size(); ++i)
+        {
+            if (!decoded_key.found[i])
             {
-                SWSS_LOG_ERROR("Failed to encode match fields for sai call");
-                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to encode match fields for sai call";
+                continue;
             }
-
+            const std::string match = key_fields[i].substr(match_prefix.size());
+            const std::string &value = decoded_key.values[i];
             auto match_defn_it = table->match_fields.find(match);
-            if (match_defn_it == table->match_fields.end())
-            {
-                SWSS_LOG_ERROR("extension entry for invalid match field %s", match.c_str());
-                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
-                       << "extension entry for invalid match field " << match.c_str();
-            }
 
             sai_metadata_j = nlohmann::json::object({});
             sai_metadata_j["sai_attr_value_type"] = match_defn_it->second.datatype;
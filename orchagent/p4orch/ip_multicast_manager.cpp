@@ -1,7 +1,6 @@
 #include "p4orch/ip_multicast_manager.h"
 
 #include <memory>
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -412,30 +411,27 @@ IpMulticastManager::deserializeIpMulticastEntry(
     const std::vector<swss::FieldValueTuple>& attributes,
     const std::string& table_name) {
   SWSS_LOG_ENTER();
+  static const P4KeyDecoder ipv4_key_decoder(
+      {prependMatchField(p4orch::kVrfId), prependMatchField(p4orch::kIpv4Dst)});
+  static const P4KeyDecoder ipv6_key_decoder(
+      {prependMatchField(p4orch::kVrfId), prependMatchField(p4orch::kIpv6Dst)});
+
   P4IpMulticastEntry ip_multicast_entry = {};
+  const auto& key_decoder = (table_name == APP_P4RT_IPV4_MULTICAST_TABLE_NAME)
+                                ? ipv4_key_decoder
+                                : ipv6_key_decoder;
+  P4DecodedKey decoded_key;
+  if (!key_decoder.decode(key, &decoded_key).ok() || !decoded_key.found[0]) {
+    return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
+           << "Failed to deserialize IP multicast table key";
+  }
+  ip_multicast_entry.vrf_id = decoded_key.values[0];
+  const std::string& ip_dst = decoded_key.values[1];
   try {
-    nlohmann::json j = nlohmann::json::parse(key);
-    ip_multicast_entry.vrf_id = j[prependMatchField(p4orch::kVrfId)];
-
-    std::string ip_dst;
-    if (table_name == APP_P4RT_IPV4_MULTICAST_TABLE_NAME) {
-      if (j.find(prependMatchField(p4orch::kIpv4Dst)) != j.end()) {
-        ip_dst = j[prependMatchField(p4orch::kIpv4Dst)];
-      }
-    } else {
-      if (j.find(prependMatchField(p4orch::kIpv6Dst)) != j.end()) {
-        ip_dst = j[prependMatchField(p4orch::kIpv6Dst)];
-      }
-    }
-    try {
-      ip_multicast_entry.ip_dst = swss::IpAddress(ip_dst);
-    } catch (std::exception& ex) {
-      return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
-             << "Invalid IP address " << QuotedVar(ip_dst);
-    }
+    ip_multicast_entry.ip_dst = swss::IpAddress(ip_dst);
   } catch (std::exception& ex) {
     return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
-           << "Failed to deserialize IP multicast table key";
+           << "Invalid IP address " << QuotedVar(ip_dst);
   }
 
   ip_multicast_entry.ip_multicast_entry_key =
@@ -305,6 +305,11 @@ ReturnCodeOr<std::vector<P4Replica>> deserializeReplicas(
   return replicas;
 }
 
+bool isL2MulticastRouterInterfaceAction(const std::string& action) {
+  return action == p4orch::kL2MulticastPassthrough ||
+         action == p4orch::kMulticastL2Passthrough;
+}
+
 }  // namespace
 
 L3MulticastManager::L3MulticastManager(P4OidMapper* mapper, VRFOrch* vrfOrch,
@@ -621,17 +626,19 @@ L3MulticastManager::deserializeMulticastRouterInterfaceEntry(
     const std::vector<swss::FieldValueTuple>& attributes) {
   SWSS_LOG_ENTER();
 
+  static const P4KeyDecoder key_decoder(
+      {prependMatchField(p4orch::kMulticastReplicaPort),
+       prependMatchField(p4orch::kMulticastReplicaInstance)});
+
   P4MulticastRouterInterfaceEntry router_interface_entry = {};
-  try {
-    nlohmann::json j = nlohmann::json::parse(key);
-    router_interface_entry.multicast_replica_port =
-        j[prependMatchField(p4orch::kMulticastReplicaPort)];
-    router_interface_entry.multicast_replica_instance =
-        j[prependMatchField(p4orch::kMulticastReplicaInstance)];
-  } catch (std::exception& ex) {
+  P4DecodedKey decoded_key;
+  if (!key_decoder.decode(key, &decoded_key).ok() || !decoded_key.found[0] ||
+      !decoded_key.found[1]) {
     return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
            << "Failed to deserialize multicast router interface table key";
   }
+  router_interface_entry.multicast_replica_port = decoded_key.values[0];
+  router_interface_entry.multicast_replica_instance = decoded_key.values[1];
 
   router_interface_entry.multicast_router_interface_entry_key =
       KeyGenerator::generateMulticastRouterInterfaceKey(
@@ -1431,8 +1438,9 @@ ReturnCode L3MulticastManager::createDefaultMyMac() {
   return ReturnCode();
 }
 
-ReturnCode L3MulticastManager::createRouterInterface(
-    P4MulticastRouterInterfaceEntry& entry, sai_object_id_t* rif_oid) {
+ReturnCodeOr<std::vector<sai_attribute_t>>
+L3MulticastManager::prepareRouterInterfaceCreation(
+    P4MulticastRouterInterfaceEntry& entry) {
   SWSS_LOG_ENTER();
 
   // For NSF purposes, we cannot add the new SAI_ROUTER_INTERFACE_ATTR_MY_MAC,
@@ -1451,9 +1459,16 @@ ReturnCode L3MulticastManager::createRouterInterface(
         << " already exists in the centralized map");
   }
 
+  return prepareRifSaiAttrs(entry, m_my_mac_oid);
+}
+
+ReturnCode L3MulticastManager::createRouterInterface(
+    P4MulticastRouterInterfaceEntry& entry, sai_object_id_t* rif_oid) {
+  SWSS_LOG_ENTER();
+
   // Create RIF SAI object.
   ASSIGN_OR_RETURN(std::vector<sai_attribute_t> attrs,
-                   prepareRifSaiAttrs(entry, m_my_mac_oid));
+                   prepareRouterInterfaceCreation(entry));
   auto sai_status = sai_router_intfs_api->create_router_interface(
       rif_oid, gSwitchId, (uint32_t)attrs.size(), attrs.data());
   if (sai_status != SAI_STATUS_SUCCESS) {
@@ -1487,9 +1502,8 @@ ReturnCode L3MulticastManager::createNeighborEntry(
   return ReturnCode();
 }
 
-ReturnCode L3MulticastManager::createNextHop(
-    P4MulticastRouterInterfaceEntry& entry, const sai_object_id_t rif_oid,
-    sai_object_id_t* next_hop_oid) {
+ReturnCode L3MulticastManager::validateNextHopCreation(
+    const P4MulticastRouterInterfaceEntry& entry) {
   SWSS_LOG_ENTER();
 
   // Confirm we haven't already created a next hop for this.
@@ -1500,7 +1514,15 @@ ReturnCode L3MulticastManager::createNextHop(
         << QuotedVar(entry.multicast_router_interface_entry_key)
         << " already exists in the centralized map");
   }
+  return ReturnCode();
+}
 
+ReturnCode L3MulticastManager::createNextHop(
+    P4MulticastRouterInterfaceEntry& entry, const sai_object_id_t rif_oid,
+    sai_object_id_t* next_hop_oid) {
+  SWSS_LOG_ENTER();
+
+  RETURN_IF_ERROR(validateNextHopCreation(entry));
   RETURN_IF_ERROR(createNeighborEntry(entry, rif_oid));
 
   // Create next hop SAI object.
@@ -1783,22 +1805,231 @@ std::vector<ReturnCode> L3MulticastManager::addMulticastRouterInterfaceEntries(
   std::vector<ReturnCode> statuses(entries.size());
   fillStatusArrayWithNotExecuted(statuses, 0);
 
-  for (size_t i = 0; i < entries.size(); ++i) {
-    auto& entry = entries[i];
-    // TODO(b/353398275): Remove condition for kL2MulticastPassthrough
-    if (entry.action == p4orch::kL2MulticastPassthrough ||
-        entry.action == p4orch::kMulticastL2Passthrough) {
-      statuses[i] = addL2MulticastRouterInterfaceEntry(entry);
+  size_t i = 0;
+  while (i < entries.size()) {
+    if (isL2MulticastRouterInterfaceAction(entries[i].action)) {
+      statuses[i] = addL2MulticastRouterInterfaceEntry(entries[i]);
+      if (!statuses[i].ok()) {
+        break;
+      }
+      ++i;
+      continue;
+    }
+
+    // Consecutive L3 entries are created with bulk SAI calls.  A repeated key
+    // ends the batch, so that it fails the same way as it would on its own.
+    size_t end = i;
+    std::unordered_set<std::string> keys;
+    while (end < entries.size() &&
+           !isL2MulticastRouterInterfaceAction(entries[end].action) &&
+           keys.insert(entries[end].multicast_router_interface_entry_key)
+               .second) {
+      ++end;
+    }
+    if (end - i == 1) {
+      statuses[i] = addL3MulticastRouterInterfaceEntry(entries[i]);
     } else {
-      statuses[i] = addL3MulticastRouterInterfaceEntry(entry);
+      addL3MulticastRouterInterfaceEntries(entries, i, end, statuses);
     }
-    if (!statuses[i].ok()) {
+    bool failed = false;
+    for (; i < end; ++i) {
+      if (!statuses[i].ok()) {
+        failed = true;
+        break;
+      }
+    }
+    if (failed) {
       break;
     }
   }
   return statuses;
 }
 
+void L3MulticastManager::addL3MulticastRouterInterfaceEntries(
+    std::vector<P4MulticastRouterInterfaceEntry>& entries, size_t begin,
+    size_t end, std::vector<ReturnCode>& statuses) {
+  SWSS_LOG_ENTER();
+
+  // Create the RIFs.
+  std::vector<std::vector<sai_attribute_t>> rif_attrs;
+  for (size_t i = begin; i < end; ++i) {
+    auto attrs_or = prepareRouterInterfaceCreation(entries[i]);
+    if (!attrs_or.ok()) {
+      statuses[i] = attrs_or.status();
+      break;
+    }
+    rif_attrs.push_back(*attrs_or);
+  }
+  size_t count = rif_attrs.size();
+  if (count == 0) {
+    return;
+  }
+  std::vector<uint32_t> attr_counts(count);
+  std::vector<const sai_attribute_t*> attr_lists(count);
+  for (size_t j = 0; j < count; ++j) {
+    attr_counts[j] = (uint32_t)rif_attrs[j].size();
+    attr_lists[j] = rif_attrs[j].data();
+  }
+  std::vector<sai_object_id_t> rif_oids(count, SAI_NULL_OBJECT_ID);
+  std::vector<sai_status_t> object_statuses(count, SAI_STATUS_NOT_EXECUTED);
+  // In syncd, bulk SAI calls use mode SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR.
+  sai_router_intfs_api->create_router_interfaces(
+      gSwitchId, (uint32_t)count, attr_counts.data(), attr_lists.data(),
+      SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, rif_oids.data(),
+      object_statuses.data());
+  for (size_t j = 0; j < count; ++j) {
+    auto& entry = entries[begin + j];
+    if (object_statuses[j] != SAI_STATUS_SUCCESS) {
+      statuses[begin + j] =
+          ReturnCode(object_statuses[j])
+          << "Failed to create router interface for multicast router "
+          << "interface table: "
+          << QuotedVar(entry.multicast_router_interface_entry_key);
+      SWSS_LOG_ERROR("%s", statuses[begin + j].message().c_str());
+      count = j;
+      break;
+    }
+    // Need to set RIF in mapper in case have to back out.
+    m_p4OidMapper->setOID(SAI_OBJECT_TYPE_ROUTER_INTERFACE,
+                          entry.multicast_router_interface_entry_key,
+                          rif_oids[j]);
+  }
+
+  // Position of the first entry that failed past RIF creation.
+  size_t fail_pos = count;
+
+  // Create the neighbor entries and next hops of the new actions.
+  std::vector<size_t> nh_indices;
+  std::vector<sai_neighbor_entry_t> neighbor_entries;
+  std::vector<std::vector<sai_attribute_t>> neighbor_attrs;
+  for (size_t j = 0; j < count; ++j) {
+    auto& entry = entries[begin + j];
+    if (entry.action == p4orch::kSetMulticastSrcMac) {
+      continue;
+    }
+    statuses[begin + j] = validateNextHopCreation(entry);
+    if (!statuses[begin + j].ok()) {
+      fail_pos = j;
+      break;
+    }
+    entry.sai_neighbor_entry = prepareSaiNeighborEntry(rif_oids[j]);
+    nh_indices.push_back(j);
+    neighbor_entries.push_back(entry.sai_neighbor_entry);
+    neighbor_attrs.push_back(prepareNeighborEntrySaiAttrs(entry.dst_mac));
+  }
+
+  size_t neighbor_count = nh_indices.size();
+  size_t next_hop_count = 0;
+  std::vector<sai_object_id_t> next_hop_oids(nh_indices.size(),
+                                             SAI_NULL_OBJECT_ID);
+  if (!nh_indices.empty()) {
+    attr_counts.resize(nh_indices.size());
+    attr_lists.resize(nh_indices.size());
+    for (size_t k = 0; k < nh_indices.size(); ++k) {
+      attr_counts[k] = (uint32_t)neighbor_attrs[k].size();
+      attr_lists[k] = neighbor_attrs[k].data();
+    }
+    object_statuses.assign(nh_indices.size(), SAI_STATUS_NOT_EXECUTED);
+    sai_neighbor_api->create_neighbor_entries(
+        (uint32_t)nh_indices.size(), neighbor_entries.data(),
+        attr_counts.data(), attr_lists.data(),
+        SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, object_statuses.data());
+    for (size_t k = 0; k < nh_indices.size(); ++k) {
+      if (object_statuses[k] != SAI_STATUS_SUCCESS) {
+        auto& entry = entries[begin + nh_indices[k]];
+        statuses[begin + nh_indices[k]] =
+            ReturnCode(object_statuses[k])
+            << "Failed to create neighbor entry multicast router interface "
+            << "table: "
+            << QuotedVar(entry.multicast_router_interface_entry_key);
+        SWSS_LOG_ERROR("%s", statuses[begin + nh_indices[k]].message().c_str());
+        neighbor_count = k;
+        fail_pos = nh_indices[k];
+        break;
+      }
+    }
+
+    std::vector<std::vector<sai_attribute_t>> next_hop_attrs;
+    for (size_t k = 0; k < neighbor_count; ++k) {
+      next_hop_attrs.push_back(prepareNextHopSaiAttrs(
+          entries[begin + nh_indices[k]], rif_oids[nh_indices[k]]));
+      attr_counts[k] = (uint32_t)next_hop_attrs[k].size();
+      attr_lists[k] = next_hop_attrs[k].data();
+    }
+    next_hop_count = neighbor_count;
+    if (neighbor_count > 0) {
+      object_statuses.assign(neighbor_count, SAI_STATUS_NOT_EXECUTED);
+      sai_next_hop_api->create_next_hops(
+          gSwitchId, (uint32_t)neighbor_count, attr_counts.data(),
+          attr_lists.data(), SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR,
+          next_hop_oids.data(), object_statuses.data());
+      for (size_t k = 0; k < neighbor_count; ++k) {
+        if (object_statuses[k] != SAI_STATUS_SUCCESS) {
+          auto& entry = entries[begin + nh_indices[k]];
+          statuses[begin + nh_indices[k]] =
+              ReturnCode(object_statuses[k])
+              << "Failed to create next hop for multicast router interface "
+              << "table: "
+              << QuotedVar(entry.multicast_router_interface_entry_key);
+          SWSS_LOG_ERROR("%s",
+                         statuses[begin + nh_indices[k]].message().c_str());
+          next_hop_count = k;
+          fail_pos = nh_indices[k];
+          break;
+        }
+      }
+    }
+  }
+
+  // Back-out the entries at and after the failure.
+  for (size_t k = next_hop_count; k < neighbor_count; ++k) {
+    auto& entry = entries[begin + nh_indices[k]];
+    if (sai_neighbor_api->remove_neighbor_entry(&entry.sai_neighbor_entry) !=
+        SAI_STATUS_SUCCESS) {
+      // All kinds of bad.  The delete failed, and we have to leave a
+      // dangling neighbor entry.
+      std::stringstream err_msg;
+      err_msg << "Next hop creation failed, and we were "
+              << "unable to backout creation of the neighbor entry."
+              << QuotedVar(entry.multicast_router_interface_entry_key);
+      SWSS_LOG_ERROR("%s", err_msg.str().c_str());
+      SWSS_RAISE_CRITICAL_STATE(err_msg.str());
+    }
+  }
+  for (size_t j = fail_pos; j < count; ++j) {
+    auto& entry = entries[begin + j];
+    ReturnCode del_status = deleteRouterInterface(
+        entry.multicast_router_interface_entry_key, rif_oids[j]);
+    m_p4OidMapper->eraseOID(SAI_OBJECT_TYPE_ROUTER_INTERFACE,
+                            entry.multicast_router_interface_entry_key);
+    if (!del_status.ok()) {
+      // All kinds of bad.  The delete failed, and we have to leave a
+      // dangling allocated RIF
+      std::stringstream err_msg;
+      err_msg << "Next hop creation failed, and we were "
+              << "unable to backout creation of the RIF for "
+              << QuotedVar(entry.multicast_router_interface_entry_key);
+      SWSS_LOG_ERROR("%s", err_msg.str().c_str());
+      SWSS_RAISE_CRITICAL_STATE(err_msg.str());
+    }
+  }
+
+  // Update internal state of the created entries.
+  for (size_t k = 0; k < next_hop_count; ++k) {
+    m_p4OidMapper->setOID(
+        SAI_OBJECT_TYPE_NEXT_HOP,
+        entries[begin + nh_indices[k]].multicast_router_interface_entry_key,
+        next_hop_oids[k]);
+  }
+  for (size_t j = 0; j < fail_pos; ++j) {
+    auto& entry = entries[begin + j];
+    gPortsOrch->increasePortRefCount(entry.multicast_replica_port);
+    m_multicastRouterInterfaceTable[entry.multicast_router_interface_entry_key] =
+        entry;
+    statuses[begin + j] = ReturnCode();
+  }
+}
+
 ReturnCode L3MulticastManager::addL3MulticastRouterInterfaceEntry(
     P4MulticastRouterInterfaceEntry& entry) {
   // We no longer share RIFs, so adding a new entry requires allocating a RIF.
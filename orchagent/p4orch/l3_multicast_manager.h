@@ -198,9 +198,17 @@ class L3MulticastManager : public ObjectManagerInterface {
       const std::deque<swss::KeyOpFieldsValuesTuple>& tuple_list,
       const std::string& op, bool update);
 
+  // Checks that a RIF can be created for the entry and returns its SAI
+  // attributes.
+  ReturnCodeOr<std::vector<sai_attribute_t>> prepareRouterInterfaceCreation(
+      P4MulticastRouterInterfaceEntry& entry);
+
   // Wrapper around SAI setup and call, for easy mocking.
   ReturnCode createRouterInterface(P4MulticastRouterInterfaceEntry& entry,
                                    sai_object_id_t* rif_oid);
+  // Checks that no next hop was created for the entry yet.
+  ReturnCode validateNextHopCreation(
+      const P4MulticastRouterInterfaceEntry& entry);
   ReturnCode createNextHop(P4MulticastRouterInterfaceEntry& entry,
                            const sai_object_id_t rif_oid,
                            sai_object_id_t* next_hop_oid);
@@ -244,6 +252,12 @@ class L3MulticastManager : public ObjectManagerInterface {
       std::vector<P4MulticastRouterInterfaceEntry>& entries);
   ReturnCode addL3MulticastRouterInterfaceEntry(
       P4MulticastRouterInterfaceEntry& entry);      
+  // Adds entries [begin, end) of L3 multicast router interface entries with
+  // bulk SAI calls, setting their statuses.  Entries with the same key must
+  // not be in the same batch.
+  void addL3MulticastRouterInterfaceEntries(
+      std::vector<P4MulticastRouterInterfaceEntry>& entries, size_t begin,
+      size_t end, std::vector<ReturnCode>& statuses);
   ReturnCode addL2MulticastRouterInterfaceEntry(
       P4MulticastRouterInterfaceEntry& entry);
   // Update existing multicast router interface table entries.
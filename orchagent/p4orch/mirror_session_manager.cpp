@@ -194,15 +194,13 @@ ReturnCodeOr<P4MirrorSessionAppDbEntry> MirrorSessionManager::deserializeP4Mirro
 
     P4MirrorSessionAppDbEntry app_db_entry = {};
 
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.mirror_session_id = j[prependMatchField(p4orch::kMirrorSessionId)];
-    }
-    catch (std::exception &ex)
+    static const P4KeyDecoder key_decoder({prependMatchField(p4orch::kMirrorSessionId)});
+    P4DecodedKey decoded_key;
+    if (!key_decoder.decode(key, &decoded_key).ok() || !decoded_key.found[0])
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize mirror session id";
     }
+    app_db_entry.mirror_session_id = decoded_key.values[0];
 
     for (const auto &it : attributes)
     {
@@ -82,18 +82,17 @@ ReturnCodeOr<P4NeighborAppDbEntry> NeighborManager::deserializeNeighborEntry(
 {
     SWSS_LOG_ENTER();
 
+    static const P4KeyDecoder key_decoder(
+        {prependMatchField(p4orch::kRouterInterfaceId), prependMatchField(p4orch::kNeighborId)});
+
     P4NeighborAppDbEntry app_db_entry = {};
-    std::string ip_address;
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.router_intf_id = j[prependMatchField(p4orch::kRouterInterfaceId)];
-        ip_address = j[prependMatchField(p4orch::kNeighborId)];
-    }
-    catch (std::exception &ex)
+    P4DecodedKey decoded_key;
+    if (!key_decoder.decode(key, &decoded_key).ok() || !decoded_key.found[0] || !decoded_key.found[1])
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize key";
     }
+    app_db_entry.router_intf_id = decoded_key.values[0];
+    const std::string &ip_address = decoded_key.values[1];
     try
     {
         app_db_entry.neighbor_id = swss::IpAddress(ip_address);
@@ -419,15 +419,13 @@ ReturnCodeOr<P4NextHopAppDbEntry> NextHopManager::deserializeP4NextHopAppDbEntry
     P4NextHopAppDbEntry app_db_entry = {};
     app_db_entry.neighbor_id = swss::IpAddress("0.0.0.0");
 
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.next_hop_id = j[prependMatchField(p4orch::kNexthopId)];
-    }
-    catch (std::exception &ex)
+    static const P4KeyDecoder key_decoder({prependMatchField(p4orch::kNexthopId)});
+    P4DecodedKey decoded_key;
+    if (!key_decoder.decode(key, &decoded_key).ok() || !decoded_key.found[0])
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize next hop id";
     }
+    app_db_entry.next_hop_id = decoded_key.values[0];
 
     for (const auto &it : attributes)
     {
@@ -1,6 +1,7 @@
 #include "p4orch/p4orch_util.h"
 
 #include <iomanip>
+#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
 
@@ -35,6 +36,179 @@ void parseP4RTKey(const std::string &key, std::string *table_name, std::string *
     *key_content = key.substr(pos + 1);
 }
 
+namespace
+{
+
+bool isJsonWhitespace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+void skipJsonWhitespace(const std::string &s, size_t &pos)
+{
+    while (pos < s.size() && isJsonWhitespace(s[pos]))
+    {
+        ++pos;
+    }
+}
+
+// Scans a JSON string without escapes starting at pos, which must point at
+// the opening quote. On success, sets [*begin, *begin + *len) to the content
+// and moves pos past the closing quote. Returns false on escapes, control or
+// non-ASCII characters, which are left to the JSON parser.
+bool scanPlainJsonString(const std::string &s, size_t &pos, size_t *begin, size_t *len)
+{
+    if (pos >= s.size() || s[pos] != '"')
+    {
+        return false;
+    }
+    *begin = ++pos;
+    while (pos < s.size())
+    {
+        unsigned char c = static_cast<unsigned char>(s[pos]);
+        if (c == '"')
+        {
+            *len = pos - *begin;
+            ++pos;
+            return true;
+        }
+        if (c == '\\' || c < 0x20 || c >= 0x80)
+        {
+            return false;
+        }
+        ++pos;
+    }
+    return false;
+}
+
+} // namespace
+
+P4KeyDecoder::P4KeyDecoder(std::vector<std::string> fields) : m_fields(std::move(fields))
+{
+}
+
+size_t P4KeyDecoder::fieldIndex(const char *name, size_t len) const
+{
+    for (size_t i = 0; i < m_fields.size(); ++i)
+    {
+        if (m_fields[i].size() == len && m_fields[i].compare(0, len, name, len) == 0)
+        {
+            return i;
+        }
+    }
+    return m_fields.size();
+}
+
+bool P4KeyDecoder::decodeFlat(const std::string &key, P4DecodedKey *decoded) const
+{
+    size_t pos = 0;
+    skipJsonWhitespace(key, pos);
+    if (pos >= key.size() || key[pos] != '{')
+    {
+        return false;
+    }
+    ++pos;
+    skipJsonWhitespace(key, pos);
+    bool first = true;
+    while (pos < key.size() && key[pos] != '}')
+    {
+        if (!first)
+        {
+            if (key[pos] != ',')
+            {
+                return false;
+            }
+            ++pos;
+            skipJsonWhitespace(key, pos);
+        }
+        first = false;
+
+        size_t name_begin, name_len, value_begin, value_len;
+        if (!scanPlainJsonString(key, pos, &name_begin, &name_len))
+        {
+            return false;
+        }
+        skipJsonWhitespace(key, pos);
+        if (pos >= key.size() || key[pos] != ':')
+        {
+            return false;
+        }
+        ++pos;
+        skipJsonWhitespace(key, pos);
+        if (!scanPlainJsonString(key, pos, &value_begin, &value_len))
+        {
+            return false;
+        }
+        skipJsonWhitespace(key, pos);
+
+        size_t index = fieldIndex(key.data() + name_begin, name_len);
+        if (index < m_fields.size())
+        {
+            decoded->values[index].assign(key, value_begin, value_len);
+            decoded->found[index] = true;
+        }
+        else
+        {
+            decoded->unknown_fields.emplace_back(key, name_begin, name_len);
+        }
+    }
+    if (pos >= key.size())
+    {
+        return false;
+    }
+    ++pos;
+    skipJsonWhitespace(key, pos);
+    return pos == key.size();
+}
+
+ReturnCode P4KeyDecoder::decodeJson(const std::string &key, P4DecodedKey *decoded) const
+{
+    decoded->values.assign(m_fields.size(), std::string());
+    decoded->found.assign(m_fields.size(), false);
+    decoded->unknown_fields.clear();
+    try
+    {
+        const auto j = nlohmann::json::parse(key);
+        if (!j.is_object())
+        {
+            return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Key " << QuotedVar(key) << " is not an object";
+        }
+        for (auto it = j.begin(); it != j.end(); ++it)
+        {
+            size_t index = fieldIndex(it.key().data(), it.key().size());
+            if (index == m_fields.size())
+            {
+                decoded->unknown_fields.push_back(it.key());
+                continue;
+            }
+            if (!it.value().is_string())
+            {
+                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
+                       << "Field " << QuotedVar(it.key()) << " of key is not a string";
+            }
+            decoded->values[index] = it.value().get<std::string>();
+            decoded->found[index] = true;
+        }
+    }
+    catch (std::exception &ex)
+    {
+        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to parse key " << QuotedVar(key);
+    }
+    return ReturnCode();
+}
+
+ReturnCode P4KeyDecoder::decode(const std::string &key, P4DecodedKey *decoded) const
+{
+    decoded->values.assign(m_fields.size(), std::string());
+    decoded->found.assign(m_fields.size(), false);
+    decoded->unknown_fields.clear();
+    if (decodeFlat(key, decoded))
+    {
+        return ReturnCode();
+    }
+    return decodeJson(key, decoded);
+}
+
 std::string verifyAttrs(const std::vector<swss::FieldValueTuple> &targets,
                         const std::vector<swss::FieldValueTuple> &exp, const std::vector<swss::FieldValueTuple> &opt,
                         bool allow_unknown)
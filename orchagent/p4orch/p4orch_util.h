@@ -156,6 +156,49 @@ struct ActionInfo
     bool refers_to;
 };
 
+// P4DecodedKey holds the match fields of a P4RT key decoded by a
+// P4KeyDecoder.
+struct P4DecodedKey
+{
+    // Values of the decoder fields, in the order of the decoder fields.
+    std::vector<std::string> values;
+    // Whether each decoder field is present in the key.
+    std::vector<bool> found;
+    // Key fields that are not decoder fields.
+    std::vector<std::string> unknown_fields;
+};
+
+// P4KeyDecoder decodes the JSON key of a P4RT table entry into the values of a
+// fixed set of fields, compiled from the table definition. Keys that are flat
+// JSON objects of plain string values are decoded by a single pass tokenizer
+// without building a JSON document. Other keys fall back to the JSON parser.
+class P4KeyDecoder
+{
+  public:
+    P4KeyDecoder() = default;
+    // fields are the full JSON names of the key fields, e.g. "match/vrf_id".
+    explicit P4KeyDecoder(std::vector<std::string> fields);
+
+    const std::vector<std::string> &fields() const
+    {
+        return m_fields;
+    }
+
+    // Decodes the key. Returns SWSS_RC_INVALID_PARAM if the key is not a JSON
+    // object or a decoder field does not have a string value.
+    ReturnCode decode(const std::string &key, P4DecodedKey *decoded) const;
+
+  private:
+    // Returns the index of the field, or m_fields.size() if unknown.
+    size_t fieldIndex(const char *name, size_t len) const;
+    // Single pass decoding of flat keys. Returns false if the key needs the
+    // full JSON grammar.
+    bool decodeFlat(const std::string &key, P4DecodedKey *decoded) const;
+    ReturnCode decodeJson(const std::string &key, P4DecodedKey *decoded) const;
+
+    std::vector<std::string> m_fields;
+};
+
 struct TableMatchInfo
 {
     std::string name;
@@ -177,6 +220,8 @@ struct TableInfo
     std::unordered_map<std::string, ActionInfo> action_fields;
     bool counter_bytes_enabled;
     bool counter_packets_enabled;
+    // decoder of the entry keys, compiled from match_fields
+    P4KeyDecoder key_decoder;
     std::vector<std::string> action_ref_tables;
     // list of tables across all actions, of current table, refer to
 };
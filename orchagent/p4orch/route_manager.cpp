@@ -1,7 +1,6 @@
 #include "p4orch/route_manager.h"
 
 #include <memory>
-#include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
 #include <unordered_set>
@@ -338,38 +337,27 @@ ReturnCodeOr<P4RouteEntry> RouteManager::deserializeRouteEntry(const std::string
 {
     SWSS_LOG_ENTER();
 
+    static const P4KeyDecoder ipv4_key_decoder(
+        {prependMatchField(p4orch::kVrfId), prependMatchField(p4orch::kIpv4Dst)});
+    static const P4KeyDecoder ipv6_key_decoder(
+        {prependMatchField(p4orch::kVrfId), prependMatchField(p4orch::kIpv6Dst)});
+
     P4RouteEntry route_entry = {};
+    const bool is_ipv4 = (table_name == APP_P4RT_IPV4_TABLE_NAME);
+    P4DecodedKey decoded_key;
+    if (!(is_ipv4 ? ipv4_key_decoder : ipv6_key_decoder).decode(key, &decoded_key).ok() || !decoded_key.found[0])
+    {
+        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize route key";
+    }
+    route_entry.vrf_id = decoded_key.values[0];
     std::string route_prefix;
-    try
+    if (decoded_key.found[1])
     {
-        nlohmann::json j = nlohmann::json::parse(key);
-        route_entry.vrf_id = j[prependMatchField(p4orch::kVrfId)];
-        if (table_name == APP_P4RT_IPV4_TABLE_NAME)
-        {
-            if (j.find(prependMatchField(p4orch::kIpv4Dst)) != j.end())
-            {
-                route_prefix = j[prependMatchField(p4orch::kIpv4Dst)];
-            }
-            else
-            {
-                route_prefix = "0.0.0.0/0";
-            }
-        }
-        else
-        {
-            if (j.find(prependMatchField(p4orch::kIpv6Dst)) != j.end())
-            {
-                route_prefix = j[prependMatchField(p4orch::kIpv6Dst)];
-            }
-            else
-            {
-                route_prefix = "::/0";
-            }
-        }
+        route_prefix = decoded_key.values[1];
     }
-    catch (std::exception &ex)
+    else
     {
-        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize route key";
+        route_prefix = is_ipv4 ? "0.0.0.0/0" : "::/0";
     }
     try
     {
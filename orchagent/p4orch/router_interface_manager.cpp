@@ -132,16 +132,15 @@ ReturnCodeOr<P4RouterInterfaceAppDbEntry> RouterInterfaceManager::deserializeRou
 {
     SWSS_LOG_ENTER();
 
+    static const P4KeyDecoder key_decoder({prependMatchField(p4orch::kRouterInterfaceId)});
+
     P4RouterInterfaceAppDbEntry app_db_entry = {};
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.router_interface_id = j[prependMatchField(p4orch::kRouterInterfaceId)];
-    }
-    catch (std::exception &ex)
+    P4DecodedKey decoded_key;
+    if (!key_decoder.decode(key, &decoded_key).ok() || !decoded_key.found[0])
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize router interface id";
     }
+    app_db_entry.router_interface_id = decoded_key.values[0];
 
     for (const auto &it : attributes)
     {
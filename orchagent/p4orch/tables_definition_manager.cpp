@@ -1,5 +1,6 @@
 #include "p4orch/tables_definition_manager.h"
 
+#include <algorithm>
 #include <memory>
 #include <nlohmann/json.hpp>
 #include <sstream>
@@ -271,6 +272,16 @@ ReturnCode parseTablesInfo(const nlohmann::json &info_json, TablesInfo &info_ent
             }
 
             parseTableCounter(table_json, table);
+
+            // Compile the decoder of the entry keys. Fields are sorted so that
+            // decoded fields keep the order of a parsed JSON object.
+            std::vector<std::string> key_fields;
+            for (const auto &match : table.match_fields)
+            {
+                key_fields.push_back(prependMatchField(match.first));
+            }
+            std::sort(key_fields.begin(), key_fields.end());
+            table.key_decoder = P4KeyDecoder(std::move(key_fields));
         }
         catch (std::exception &ex)
         {
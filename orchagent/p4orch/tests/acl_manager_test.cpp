@@ -68,6 +68,7 @@ using ::testing::Invoke;
 using ::testing::NotNull;
 using ::testing::Return;
 using ::testing::SetArgPointee;
+using ::testing::SetArrayArgument;
 using ::testing::StrictMock;
 using ::testing::Truly;
 
@@ -915,6 +916,8 @@ class AclManagerTest : public ::testing::Test
         sai_acl_api->get_acl_counter_attribute = get_acl_counter_attribute;
         sai_acl_api->create_acl_entry = create_acl_entry;
         sai_acl_api->remove_acl_entry = remove_acl_entry;
+        sai_acl_api->create_acl_entries = create_acl_entries;
+        sai_acl_api->remove_acl_entries = remove_acl_entries;
         sai_acl_api->set_acl_entry_attribute = set_acl_entry_attribute;
         sai_acl_api->create_acl_counter = create_acl_counter;
         sai_acl_api->remove_acl_counter = remove_acl_counter;
@@ -5578,24 +5581,32 @@ TEST_F(AclManagerTest, DrainRuleStopOnFirstFailure) {
                    swss::KeyOpFieldsValuesTuple(
                        {rule_tuple_key_3, SET_COMMAND, attributes}));
 
-  EXPECT_CALL(mock_sai_acl_, create_acl_entry(_, _, _, _))
-      .WillOnce(DoAll(SetArgPointee<0>(kAclIngressRuleOid1),
-                      Return(SAI_STATUS_SUCCESS)))
-      .WillOnce(Return(SAI_STATUS_FAILURE));
+  std::vector<sai_object_id_t> exp_oids{kAclIngressRuleOid1,
+                                         SAI_NULL_OBJECT_ID,
+                                         SAI_NULL_OBJECT_ID};
+  std::vector<sai_status_t> exp_status{SAI_STATUS_SUCCESS, SAI_STATUS_FAILURE,
+                                       SAI_STATUS_NOT_EXECUTED};
+  EXPECT_CALL(mock_sai_acl_,
+              create_acl_entries(Eq(gSwitchId), Eq(3), NotNull(), NotNull(),
+                                 Eq(SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR),
+                                 NotNull(), NotNull()))
+      .WillOnce(DoAll(SetArrayArgument<5>(exp_oids.begin(), exp_oids.end()),
+                      SetArrayArgument<6>(exp_status.begin(), exp_status.end()),
+                      Return(SAI_STATUS_FAILURE)));
   EXPECT_CALL(mock_sai_acl_, create_acl_counter(_, _, _, _))
-      .WillOnce(
-          DoAll(SetArgPointee<0>(kAclCounterOid1), Return(SAI_STATUS_SUCCESS)))
-      .WillOnce(
+      .Times(3)
+      .WillRepeatedly(
           DoAll(SetArgPointee<0>(kAclCounterOid1), Return(SAI_STATUS_SUCCESS)));
   EXPECT_CALL(mock_sai_policer_, create_policer(_, _, _, _))
-      .WillOnce(
-          DoAll(SetArgPointee<0>(kAclMeterOid1), Return(SAI_STATUS_SUCCESS)))
-      .WillOnce(
+      .Times(3)
+      .WillRepeatedly(
           DoAll(SetArgPointee<0>(kAclMeterOid1), Return(SAI_STATUS_SUCCESS)));
   EXPECT_CALL(mock_sai_acl_, remove_acl_counter(_))
-      .WillOnce(Return(SAI_STATUS_SUCCESS));
+      .Times(2)
+      .WillRepeatedly(Return(SAI_STATUS_SUCCESS));
   EXPECT_CALL(mock_sai_policer_, remove_policer(_))
-      .WillOnce(Return(SAI_STATUS_SUCCESS));
+      .Times(2)
+      .WillRepeatedly(Return(SAI_STATUS_SUCCESS));
   EXPECT_CALL(
       *gMockResponsePublisher,
       publish(Eq(APP_P4RT_TABLE_NAME), Eq(rule_tuple_key_1), Eq(attributes),
@@ -5627,6 +5638,191 @@ TEST_F(AclManagerTest, DrainRuleStopOnFirstFailure) {
                  "fdf8:f53b:82e4::55:priority=15"));
 }
 
+TEST_F(AclManagerTest, DrainRuleTuplesToProcessBulkSetDelRequestsSucceeds) {
+  ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
+  auto attributes = getDefaultRuleFieldValueTuples();
+  const auto& acl_rule_json_key_1 =
+      "{\"match/ether_type\":\"0x0800\",\"match/"
+      "ipv6_dst\":\"fdf8:f53b:82e4::53 & "
+      "fdf8:f53b:82e4::53\",\"priority\":15}";
+  const auto& rule_tuple_key_1 = std::string(kAclIngressTableName) +
+                                 kTableKeyDelimiter + acl_rule_json_key_1;
+  const auto& acl_rule_json_key_2 =
+      "{\"match/ether_type\":\"0x0800\",\"match/"
+      "ipv6_dst\":\"fdf8:f53b:82e4::54 & "
+      "fdf8:f53b:82e4::54\",\"priority\":15}";
+  const auto& rule_tuple_key_2 = std::string(kAclIngressTableName) +
+                                 kTableKeyDelimiter + acl_rule_json_key_2;
+  const auto& acl_rule_key_1 =
+      "match/ether_type=0x0800:match/ipv6_dst=fdf8:f53b:82e4::53 & "
+      "fdf8:f53b:82e4::53:priority=15";
+  const auto& acl_rule_key_2 =
+      "match/ether_type=0x0800:match/ipv6_dst=fdf8:f53b:82e4::54 & "
+      "fdf8:f53b:82e4::54:priority=15";
+
+  // Both SET requests are created by a single bulk call.
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_1, SET_COMMAND, attributes}));
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_2, SET_COMMAND, attributes}));
+  std::vector<sai_object_id_t> exp_oids{kAclIngressRuleOid1,
+                                         kAclIngressRuleOid2};
+  std::vector<sai_status_t> exp_status{SAI_STATUS_SUCCESS, SAI_STATUS_SUCCESS};
+  EXPECT_CALL(mock_sai_acl_,
+              create_acl_entries(Eq(gSwitchId), Eq(2), NotNull(), NotNull(),
+                                 Eq(SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR),
+                                 NotNull(), NotNull()))
+      .WillOnce(DoAll(SetArrayArgument<5>(exp_oids.begin(), exp_oids.end()),
+                      SetArrayArgument<6>(exp_status.begin(), exp_status.end()),
+                      Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(mock_sai_acl_, create_acl_counter(_, _, _, _))
+      .Times(2)
+      .WillRepeatedly(
+          DoAll(SetArgPointee<0>(kAclCounterOid1), Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(mock_sai_policer_, create_policer(_, _, _, _))
+      .WillOnce(
+          DoAll(SetArgPointee<0>(kAclMeterOid1), Return(SAI_STATUS_SUCCESS)))
+      .WillOnce(
+          DoAll(SetArgPointee<0>(kAclMeterOid2), Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(
+      *gMockResponsePublisher,
+      publish(Eq(APP_P4RT_TABLE_NAME), Eq(rule_tuple_key_1), Eq(attributes),
+              Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
+  EXPECT_CALL(
+      *gMockResponsePublisher,
+      publish(Eq(APP_P4RT_TABLE_NAME), Eq(rule_tuple_key_2), Eq(attributes),
+              Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
+  EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS,
+            DrainRuleTuples(/*failure_before=*/false));
+  auto* acl_rule_1 = GetAclRule(kAclIngressTableName, acl_rule_key_1);
+  ASSERT_NE(nullptr, acl_rule_1);
+  EXPECT_EQ(kAclIngressRuleOid1, acl_rule_1->acl_entry_oid);
+  EXPECT_EQ(kAclMeterOid1, acl_rule_1->meter.meter_oid);
+  auto* acl_rule_2 = GetAclRule(kAclIngressTableName, acl_rule_key_2);
+  ASSERT_NE(nullptr, acl_rule_2);
+  EXPECT_EQ(kAclIngressRuleOid2, acl_rule_2->acl_entry_oid);
+  EXPECT_EQ(kAclMeterOid2, acl_rule_2->meter.meter_oid);
+
+  // Both DEL requests are removed by a single bulk call.
+  attributes.clear();
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_1, DEL_COMMAND, attributes}));
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_2, DEL_COMMAND, attributes}));
+  EXPECT_CALL(mock_sai_acl_,
+              remove_acl_entries(Eq(2), NotNull(),
+                                 Eq(SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR),
+                                 NotNull()))
+      .WillOnce(DoAll(SetArrayArgument<3>(exp_status.begin(), exp_status.end()),
+                      Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(mock_sai_acl_, remove_acl_counter(_))
+      .Times(2)
+      .WillRepeatedly(Return(SAI_STATUS_SUCCESS));
+  EXPECT_CALL(mock_sai_policer_, remove_policer(Eq(kAclMeterOid1)))
+      .WillOnce(Return(SAI_STATUS_SUCCESS));
+  EXPECT_CALL(mock_sai_policer_, remove_policer(Eq(kAclMeterOid2)))
+      .WillOnce(Return(SAI_STATUS_SUCCESS));
+  EXPECT_CALL(
+      *gMockResponsePublisher,
+      publish(Eq(APP_P4RT_TABLE_NAME), Eq(rule_tuple_key_1), Eq(attributes),
+              Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
+  EXPECT_CALL(
+      *gMockResponsePublisher,
+      publish(Eq(APP_P4RT_TABLE_NAME), Eq(rule_tuple_key_2), Eq(attributes),
+              Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
+  EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS,
+            DrainRuleTuples(/*failure_before=*/false));
+  EXPECT_EQ(nullptr, GetAclRule(kAclIngressTableName, acl_rule_key_1));
+  EXPECT_EQ(nullptr, GetAclRule(kAclIngressTableName, acl_rule_key_2));
+}
+
+TEST_F(AclManagerTest, DrainRuleTuplesBulkDelRequestStopsOnFirstFailure) {
+  ASSERT_NO_FATAL_FAILURE(AddDefaultIngressTable());
+  auto attributes = getDefaultRuleFieldValueTuples();
+  const auto& acl_rule_json_key_1 =
+      "{\"match/ether_type\":\"0x0800\",\"match/"
+      "ipv6_dst\":\"fdf8:f53b:82e4::53 & "
+      "fdf8:f53b:82e4::53\",\"priority\":15}";
+  const auto& rule_tuple_key_1 = std::string(kAclIngressTableName) +
+                                 kTableKeyDelimiter + acl_rule_json_key_1;
+  const auto& acl_rule_json_key_2 =
+      "{\"match/ether_type\":\"0x0800\",\"match/"
+      "ipv6_dst\":\"fdf8:f53b:82e4::54 & "
+      "fdf8:f53b:82e4::54\",\"priority\":15}";
+  const auto& rule_tuple_key_2 = std::string(kAclIngressTableName) +
+                                 kTableKeyDelimiter + acl_rule_json_key_2;
+  const auto& acl_rule_key_1 =
+      "match/ether_type=0x0800:match/ipv6_dst=fdf8:f53b:82e4::53 & "
+      "fdf8:f53b:82e4::53:priority=15";
+  const auto& acl_rule_key_2 =
+      "match/ether_type=0x0800:match/ipv6_dst=fdf8:f53b:82e4::54 & "
+      "fdf8:f53b:82e4::54:priority=15";
+
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_1, SET_COMMAND, attributes}));
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_2, SET_COMMAND, attributes}));
+  std::vector<sai_object_id_t> exp_oids{kAclIngressRuleOid1,
+                                         kAclIngressRuleOid2};
+  std::vector<sai_status_t> exp_status{SAI_STATUS_SUCCESS, SAI_STATUS_SUCCESS};
+  EXPECT_CALL(mock_sai_acl_, create_acl_entries(_, Eq(2), _, _, _, _, _))
+      .WillOnce(DoAll(SetArrayArgument<5>(exp_oids.begin(), exp_oids.end()),
+                      SetArrayArgument<6>(exp_status.begin(), exp_status.end()),
+                      Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(mock_sai_acl_, create_acl_counter(_, _, _, _))
+      .Times(2)
+      .WillRepeatedly(
+          DoAll(SetArgPointee<0>(kAclCounterOid1), Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(mock_sai_policer_, create_policer(_, _, _, _))
+      .Times(2)
+      .WillRepeatedly(
+          DoAll(SetArgPointee<0>(kAclMeterOid1), Return(SAI_STATUS_SUCCESS)));
+  EXPECT_CALL(*gMockResponsePublisher,
+              publish(Eq(APP_P4RT_TABLE_NAME), _, Eq(attributes),
+                      Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)))
+      .Times(2);
+  EXPECT_EQ(StatusCode::SWSS_RC_SUCCESS,
+            DrainRuleTuples(/*failure_before=*/false));
+
+  attributes.clear();
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_1, DEL_COMMAND, attributes}));
+  EnqueueRuleTuple(std::string(kAclIngressTableName),
+                   swss::KeyOpFieldsValuesTuple(
+                       {rule_tuple_key_2, DEL_COMMAND, attributes}));
+  std::vector<sai_status_t> exp_remove_status{SAI_STATUS_SUCCESS,
+                                              SAI_STATUS_FAILURE};
+  EXPECT_CALL(mock_sai_acl_, remove_acl_entries(Eq(2), NotNull(), _, NotNull()))
+      .WillOnce(DoAll(SetArrayArgument<3>(exp_remove_status.begin(),
+                                          exp_remove_status.end()),
+                      Return(SAI_STATUS_FAILURE)));
+  EXPECT_CALL(mock_sai_acl_, remove_acl_counter(_))
+      .WillOnce(Return(SAI_STATUS_SUCCESS));
+  EXPECT_CALL(mock_sai_policer_, remove_policer(_))
+      .WillOnce(Return(SAI_STATUS_SUCCESS));
+  EXPECT_CALL(
+      *gMockResponsePublisher,
+      publish(Eq(APP_P4RT_TABLE_NAME), Eq(rule_tuple_key_1), Eq(attributes),
+              Eq(StatusCode::SWSS_RC_SUCCESS), Eq(true)));
+  EXPECT_CALL(
+      *gMockResponsePublisher,
+      publish(Eq(APP_P4RT_TABLE_NAME), Eq(rule_tuple_key_2), Eq(attributes),
+              Eq(StatusCode::SWSS_RC_UNKNOWN), Eq(true)));
+  EXPECT_EQ(StatusCode::SWSS_RC_UNKNOWN,
+            DrainRuleTuples(/*failure_before=*/false));
+  EXPECT_EQ(nullptr, GetAclRule(kAclIngressTableName, acl_rule_key_1));
+  auto* acl_rule_2 = GetAclRule(kAclIngressTableName, acl_rule_key_2);
+  ASSERT_NE(nullptr, acl_rule_2);
+  EXPECT_EQ(kAclIngressRuleOid2, acl_rule_2->acl_entry_oid);
+}
+
 TEST_F(AclManagerTest, AclTableVerifyStateTest)
 {
     const auto &p4rtAclTableName =
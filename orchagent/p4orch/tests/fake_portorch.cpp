@@ -297,6 +297,11 @@ bool PortsOrch::addVlanMember(Port &vlan, Port &port, string &tagging_mode, stri
     return true;
 }
 
+bool PortsOrch::addVlanMembers(const vector<pair<string, string>> &members, string &tagging_mode)
+{
+    return true;
+}
+
 bool PortsOrch::removeVlanMember(Port &vlan, Port &port, string end_point_ip)
 {
     return true;
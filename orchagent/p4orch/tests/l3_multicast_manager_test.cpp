@@ -788,10 +788,25 @@ class L3MulticastManagerTest : public ::testing::Test {
     EXPECT_EQ(x.controller_metadata, y.controller_metadata);
   }
 
+  // Expects a successful bulk creation of RIFs with the given OIDs.
+  void ExpectCreateRouterInterfaces(std::vector<sai_object_id_t> rif_oids) {
+    std::vector<sai_status_t> exp_status(rif_oids.size(), SAI_STATUS_SUCCESS);
+    EXPECT_CALL(mock_sai_router_intf_,
+                create_router_interfaces(
+                    Eq(gSwitchId), Eq(rif_oids.size()), _, _,
+                    Eq(SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR), _, _))
+        .WillOnce(DoAll(SetArrayArgument<5>(rif_oids.begin(), rif_oids.end()),
+                        SetArrayArgument<6>(exp_status.begin(),
+                                            exp_status.end()),
+                        Return(SAI_STATUS_SUCCESS)));
+  }
+
   void SetUp() override {
     mock_sai_router_intf = &mock_sai_router_intf_;
     sai_router_intfs_api->create_router_interface =
         mock_create_router_interface;
+    sai_router_intfs_api->create_router_interfaces =
+        mock_create_router_interfaces;
 
     mock_sai_ipmc_group = &mock_sai_ipmc_group_;
     sai_ipmc_group_api->create_ipmc_group = mock_create_ipmc_group;
@@ -819,11 +834,13 @@ class L3MulticastManagerTest : public ::testing::Test {
 
     mock_sai_next_hop = &mock_sai_next_hop_;
     sai_next_hop_api->create_next_hop = mock_create_next_hop;
+    sai_next_hop_api->create_next_hops = mock_create_next_hops;
     sai_next_hop_api->remove_next_hop = mock_remove_next_hop;
     sai_next_hop_api->set_next_hop_attribute = mock_set_next_hop_attribute;
 
     mock_sai_neighbor = &mock_sai_neighbor_;
     sai_neighbor_api->create_neighbor_entry = mock_create_neighbor_entry;
+    sai_neighbor_api->create_neighbor_entries = mock_create_neighbor_entries;
     sai_neighbor_api->remove_neighbor_entry = mock_remove_neighbor_entry;
     sai_neighbor_api->set_neighbor_entry_attribute =
         mock_set_neighbor_entry_attribute;
@@ -1806,9 +1823,8 @@ TEST_F(L3MulticastManagerTest,
   entries.push_back(GenerateP4MulticastRouterInterfaceEntry(
       "Ethernet5", "0x5", swss::MacAddress(kSrcMac5)));
 
-  EXPECT_CALL(mock_sai_router_intf_, create_router_interface(_, _, _, _))
-      .WillOnce(DoAll(SetArgPointee<0>(kRifOid4), Return(SAI_STATUS_SUCCESS)))
-      .WillOnce(DoAll(SetArgPointee<0>(kRifOid5), Return(SAI_STATUS_SUCCESS)));
+  ExpectCreateRouterInterfaces({kRifOid4, kRifOid5});
+;
 
   std::vector<ReturnCode> statuses =
       AddMulticastRouterInterfaceEntries(entries);
@@ -1831,8 +1847,12 @@ TEST_F(L3MulticastManagerTest,
   entries.push_back(GenerateP4MulticastRouterInterfaceEntry(
       "Ethernet5", "0x6", swss::MacAddress(kSrcMac5)));
 
-  EXPECT_CALL(mock_sai_router_intf_, create_router_interface(_, _, _, _))
-      .WillOnce(Return(SAI_STATUS_FAILURE));
+  std::vector<sai_status_t> exp_status{SAI_STATUS_FAILURE,
+                                       SAI_STATUS_NOT_EXECUTED};
+  EXPECT_CALL(mock_sai_router_intf_,
+              create_router_interfaces(Eq(gSwitchId), Eq(2), _, _, _, _, _))
+      .WillOnce(DoAll(SetArrayArgument<6>(exp_status.begin(), exp_status.end()),
+                      Return(SAI_STATUS_FAILURE)));
 
   std::vector<ReturnCode> statuses =
       AddMulticastRouterInterfaceEntries(entries);
@@ -2379,6 +2399,178 @@ TEST_F(L3MulticastManagerTest,
             nullptr);
 }
 
+TEST_F(L3MulticastManagerTest,
+       AddMulticastRouterInterfaceEntriesWithNextHopsBulkSuccess) {
+  std::vector<P4MulticastRouterInterfaceEntry> entries;
+  entries.push_back(GenerateP4MulticastRouterInterfaceEntryByAction(
+      "Ethernet1", "0x0001", swss::MacAddress(kSrcMac1),
+      swss::MacAddress(kDstMac1), /*vlan_id=*/0, "metadata",
+      p4orch::kMulticastSetSrcMac));
+  entries.push_back(GenerateP4MulticastRouterInterfaceEntryByAction(
+      "Ethernet2", "0x0002", swss::MacAddress(kSrcMac2),
+      swss::MacAddress(kDstMac2), /*vlan_id=*/0, "metadata",
+      p4orch::kMulticastSetSrcMac));
+
+  EXPECT_CALL(mock_sai_my_mac_, create_my_mac(_, gSwitchId, Eq(2), _))
+      .WillOnce(DoAll(SetArgPointee<0>(kDefaultMyMacOid),
+                      Return(SAI_STATUS_SUCCESS)));
+  ExpectCreateRouterInterfaces({kRifOid1, kRifOid2});
+  std::vector<sai_status_t> exp_status{SAI_STATUS_SUCCESS, SAI_STATUS_SUCCESS};
+  EXPECT_CALL(mock_sai_neighbor_,
+              create_neighbor_entries(
+                  Eq(2), _, _, _, Eq(SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR), _))
+      .WillOnce(DoAll(SetArrayArgument<5>(exp_status.begin(), exp_status.end()),
+                      Return(SAI_STATUS_SUCCESS)));
+  std::vector<sai_object_id_t> exp_nh_oids{kNextHopOid1, kNextHopOid2};
+  EXPECT_CALL(mock_sai_next_hop_,
+              create_next_hops(Eq(gSwitchId), Eq(2), _, _,
+                               Eq(SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR), _, _))
+      .WillOnce(
+          DoAll(SetArrayArgument<5>(exp_nh_oids.begin(), exp_nh_oids.end()),
+                SetArrayArgument<6>(exp_status.begin(), exp_status.end()),
+                Return(SAI_STATUS_SUCCESS)));
+
+  std::vector<ReturnCode> statuses =
+      AddMulticastRouterInterfaceEntries(entries);
+  EXPECT_EQ(statuses.size(), 2);
+  EXPECT_TRUE(statuses[0].ok());
+  EXPECT_TRUE(statuses[1].ok());
+  EXPECT_NE(GetMulticastRouterInterfaceEntry(
+                entries[0].multicast_router_interface_entry_key),
+            nullptr);
+  EXPECT_NE(GetMulticastRouterInterfaceEntry(
+                entries[1].multicast_router_interface_entry_key),
+            nullptr);
+  EXPECT_EQ(GetRifOid(&entries[0]), kRifOid1);
+  EXPECT_EQ(GetRifOid(&entries[1]), kRifOid2);
+  EXPECT_EQ(GetNextHopOid(&entries[0]), kNextHopOid1);
+  EXPECT_EQ(GetNextHopOid(&entries[1]), kNextHopOid2);
+}
+
+TEST_F(L3MulticastManagerTest,
+       AddMulticastRouterInterfaceEntriesBulkNextHopFailsBacksOut) {
+  std::vector<P4MulticastRouterInterfaceEntry> entries;
+  entries.push_back(GenerateP4MulticastRouterInterfaceEntryByAction(
+      "Ethernet1", "0x0001", swss::MacAddress(kSrcMac1),
+      swss::MacAddress(kDstMac1), /*vlan_id=*/0, "metadata",
+      p4orch::kMulticastSetSrcMac));
+  entries.push_back(GenerateP4MulticastRouterInterfaceEntryByAction(
+      "Ethernet2", "0x0002", swss::MacAddress(kSrcMac2),
+      swss::MacAddress(kDstMac2), /*vlan_id=*/0, "metadata",
+      p4orch::kMulticastSetSrcMac));
+  entries.push_back(GenerateP4MulticastRouterInterfaceEntryByAction(
+      "Ethernet3", "0x0003", swss::MacAddress(kSrcMac3),
+      swss::MacAddress(kDstMac0), /*vlan_id=*/0, "metadata",
+      p4orch::kMulticastSetSrcMac));
+
+  EXPECT_CALL(mock_sai_my_mac_, create_my_mac(_, gSwitchId, Eq(2), _))
+      .WillOnce(DoAll(SetArgPointee<0>(kDefaultMyMacOid),
+                      Return(SAI_STATUS_SUCCESS)));
+  ExpectCreateRouterInterfaces({kRifOid1, kRifOid2, kRifOid3});
+  std::vector<sai_status_t> exp_neigh_status{
+      SAI_STATUS_SUCCESS, SAI_STATUS_SUCCESS, SAI_STATUS_SUCCESS};
+  EXPECT_CALL(mock_sai_neighbor_, create_neighbor_entries(Eq(3), _, _, _, _, _))
+      .WillOnce(DoAll(SetArrayArgument<5>(exp_neigh_status.begin(),
+                                          exp_neigh_status.end()),
+                      Return(SAI_STATUS_SUCCESS)));
+  // Second next hop fails, third is not executed.
+  std::vector<sai_object_id_t> exp_nh_oids{kNextHopOid1, SAI_NULL_OBJECT_ID,
+                                           SAI_NULL_OBJECT_ID};
+  std::vector<sai_status_t> exp_nh_status{
+      SAI_STATUS_SUCCESS, SAI_STATUS_FAILURE, SAI_STATUS_NOT_EXECUTED};
+  EXPECT_CALL(mock_sai_next_hop_, create_next_hops(_, Eq(3), _, _, _, _, _))
+      .WillOnce(
+          DoAll(SetArrayArgument<5>(exp_nh_oids.begin(), exp_nh_oids.end()),
+                SetArrayArgument<6>(exp_nh_status.begin(), exp_nh_status.end()),
+                Return(SAI_STATUS_FAILURE)));
+  // Neighbor entries and RIFs of the second and third entries are removed.
+  EXPECT_CALL(mock_sai_neighbor_, remove_neighbor_entry(_))
+      .Times(2)
+      .WillRepeatedly(Return(SAI_STATUS_SUCCESS));
+  EXPECT_CALL(mock_sai_router_intf_, remove_router_interface(kRifOid2))
+      .WillOnce(Return(SAI_STATUS_SUCCESS));
+  EXPECT_CALL(mock_sai_router_intf_, remove_router_interface(kRifOid3))
+      .WillOnce(Return(SAI_STATUS_SUCCESS));
+
+  std::vector<ReturnCode> statuses =
+      AddMulticastRouterInterfaceEntries(entries);
+  EXPECT_EQ(statuses.size(), 3);
+  EXPECT_TRUE(statuses[0].ok());
+  EXPECT_EQ(statuses[1].code(), StatusCode::SWSS_RC_UNKNOWN);
+  EXPECT_EQ(statuses[2].code(), StatusCode::SWSS_RC_NOT_EXECUTED);
+  EXPECT_NE(GetMulticastRouterInterfaceEntry(
+                entries[0].multicast_router_interface_entry_key),
+            nullptr);
+  EXPECT_EQ(GetNextHopOid(&entries[0]), kNextHopOid1);
+  EXPECT_EQ(GetMulticastRouterInterfaceEntry(
+                entries[1].multicast_router_interface_entry_key),
+            nullptr);
+  EXPECT_EQ(GetMulticastRouterInterfaceEntry(
+                entries[2].multicast_router_interface_entry_key),
+            nullptr);
+  EXPECT_EQ(GetRifOid(&entries[1]), SAI_NULL_OBJECT_ID);
+  EXPECT_EQ(GetRifOid(&entries[2]), SAI_NULL_OBJECT_ID);
+}
+
+TEST_F(L3MulticastManagerTest,
+       AddMulticastRouterInterfaceEntriesBulkNextHopExistsBacksOut) {
+  std::vector<P4MulticastRouterInterfaceEntry> entries;
+  entries.push_back(GenerateP4MulticastRouterInterfaceEntryByAction(
+      "Ethernet1", "0x0001", swss::MacAddress(kSrcMac1),
+      swss::MacAddress(kDstMac1), /*vlan_id=*/0, "metadata",
+      p4orch::kMulticastSetSrcMac));
+  entries.push_back(GenerateP4MulticastRouterInterfaceEntryByAction(
+      "Ethernet2", "0x0002", swss::MacAddress(kSrcMac2),
+      swss::MacAddress(kDstMac2), /*vlan_id=*/0, "metadata",
+      p4orch::kMulticastSetSrcMac));
+  entries.push_back(GenerateP4MulticastRouterInterfaceEntryByAction(
+      "Ethernet3", "0x0003", swss::MacAddress(kSrcMac3),
+      swss::MacAddress(kDstMac0), /*vlan_id=*/0, "metadata",
+      p4orch::kMulticastSetSrcMac));
+
+  // Pre-populate Next Hop OID of the second entry to force an error.
+  p4_oid_mapper_.setOID(SAI_OBJECT_TYPE_NEXT_HOP,
+                        entries[1].multicast_router_interface_entry_key,
+                        kNextHopOid2);
+
+  EXPECT_CALL(mock_sai_my_mac_, create_my_mac(_, gSwitchId, Eq(2), _))
+      .WillOnce(DoAll(SetArgPointee<0>(kDefaultMyMacOid),
+                      Return(SAI_STATUS_SUCCESS)));
+  ExpectCreateRouterInterfaces({kRifOid1, kRifOid2, kRifOid3});
+  // Only the first entry is queued for a neighbor entry and next hop.
+  std::vector<sai_status_t> exp_status{SAI_STATUS_SUCCESS};
+  EXPECT_CALL(mock_sai_neighbor_, create_neighbor_entries(Eq(1), _, _, _, _, _))
+      .WillOnce(DoAll(SetArrayArgument<5>(exp_status.begin(), exp_status.end()),
+                      Return(SAI_STATUS_SUCCESS)));
+  std::vector<sai_object_id_t> exp_nh_oids{kNextHopOid1};
+  EXPECT_CALL(mock_sai_next_hop_, create_next_hops(_, Eq(1), _, _, _, _, _))
+      .WillOnce(
+          DoAll(SetArrayArgument<5>(exp_nh_oids.begin(), exp_nh_oids.end()),
+                SetArrayArgument<6>(exp_status.begin(), exp_status.end()),
+                Return(SAI_STATUS_SUCCESS)));
+  // RIFs of the second and third entries are removed.
+  EXPECT_CALL(mock_sai_router_intf_, remove_router_interface(kRifOid2))
+      .WillOnce(Return(SAI_STATUS_SUCCESS));
+  EXPECT_CALL(mock_sai_router_intf_, remove_router_interface(kRifOid3))
+      .WillOnce(Return(SAI_STATUS_SUCCESS));
+
+  std::vector<ReturnCode> statuses =
+      AddMulticastRouterInterfaceEntries(entries);
+  EXPECT_EQ(statuses.size(), 3);
+  EXPECT_TRUE(statuses[0].ok());
+  EXPECT_EQ(statuses[1].code(), StatusCode::SWSS_RC_INTERNAL);
+  EXPECT_EQ(statuses[2].code(), StatusCode::SWSS_RC_NOT_EXECUTED);
+  EXPECT_EQ(GetNextHopOid(&entries[0]), kNextHopOid1);
+  EXPECT_EQ(GetMulticastRouterInterfaceEntry(
+                entries[1].multicast_router_interface_entry_key),
+            nullptr);
+  EXPECT_EQ(GetMulticastRouterInterfaceEntry(
+                entries[2].multicast_router_interface_entry_key),
+            nullptr);
+  EXPECT_EQ(GetRifOid(&entries[1]), SAI_NULL_OBJECT_ID);
+  EXPECT_EQ(GetRifOid(&entries[2]), SAI_NULL_OBJECT_ID);
+}
+
 TEST_F(L3MulticastManagerTest, DeleteMulticastRouterInterfaceEntriesSuccess) {
   auto entry1 = SetupP4MulticastRouterInterfaceEntry(
       "Ethernet1", "0x1", swss::MacAddress(kSrcMac1), kRifOid1);
@@ -7584,9 +7776,8 @@ TEST_F(L3MulticastManagerTest,
           swss::KeyOpFieldsValuesTuple(group_appl_db_key, SET_COMMAND,
                                        group_attributes));
 
-  EXPECT_CALL(mock_sai_router_intf_, create_router_interface(_, _, _, _))
-      .WillOnce(DoAll(SetArgPointee<0>(kRifOid1), Return(SAI_STATUS_SUCCESS)))
-      .WillOnce(DoAll(SetArgPointee<0>(kRifOid2), Return(SAI_STATUS_SUCCESS)));
+  ExpectCreateRouterInterfaces({kRifOid1, kRifOid2});
+;
   EXPECT_CALL(publisher_,
               publish(Eq(APP_P4RT_TABLE_NAME), Eq(mac_appl_db_key),
                       Eq(mac_attributes), Eq(StatusCode::SWSS_RC_SUCCESS),
@@ -7747,11 +7938,8 @@ TEST_F(L3MulticastManagerTest,
           swss::KeyOpFieldsValuesTuple(group_appl_db_key2, SET_COMMAND,
                                        group_attributes2));
 
-  EXPECT_CALL(mock_sai_router_intf_, create_router_interface(_, _, _, _))
-      .WillOnce(DoAll(SetArgPointee<0>(kRifOid1), Return(SAI_STATUS_SUCCESS)))
-      .WillOnce(DoAll(SetArgPointee<0>(kRifOid2), Return(SAI_STATUS_SUCCESS)))
-      .WillOnce(DoAll(SetArgPointee<0>(kRifOid3), Return(SAI_STATUS_SUCCESS)))
-      .WillOnce(DoAll(SetArgPointee<0>(kRifOid4), Return(SAI_STATUS_SUCCESS)));
+  ExpectCreateRouterInterfaces({kRifOid1, kRifOid2, kRifOid3, kRifOid4});
+;
   EXPECT_CALL(publisher_,
               publish(Eq(APP_P4RT_TABLE_NAME), Eq(mac_appl_db_key),
                       Eq(mac_attributes), Eq(StatusCode::SWSS_RC_SUCCESS),
@@ -7961,10 +8149,8 @@ TEST_F(L3MulticastManagerTest,
           swss::KeyOpFieldsValuesTuple(group_appl_db_key2, SET_COMMAND,
                                        group_attributes2));
 
-  EXPECT_CALL(mock_sai_router_intf_, create_router_interface(_, _, _, _))
-      .WillOnce(DoAll(SetArgPointee<0>(kRifOid1), Return(SAI_STATUS_SUCCESS)))
-      .WillOnce(DoAll(SetArgPointee<0>(kRifOid2), Return(SAI_STATUS_SUCCESS)))
-      .WillOnce(DoAll(SetArgPointee<0>(kRifOid3), Return(SAI_STATUS_SUCCESS)));
+  ExpectCreateRouterInterfaces({kRifOid1, kRifOid2, kRifOid3});
+;
   EXPECT_CALL(publisher_,
               publish(Eq(APP_P4RT_TABLE_NAME), Eq(mac_appl_db_key),
                       Eq(mac_attributes), Eq(StatusCode::SWSS_RC_SUCCESS),
@@ -8106,10 +8292,8 @@ TEST_F(L3MulticastManagerTest,
           swss::KeyOpFieldsValuesTuple(group_appl_db_key2, SET_COMMAND,
                                        group_attributes2));
 
-  EXPECT_CALL(mock_sai_router_intf_, create_router_interface(_, _, _, _))
-      .WillOnce(DoAll(SetArgPointee<0>(kRifOid1), Return(SAI_STATUS_SUCCESS)))
-      .WillOnce(DoAll(SetArgPointee<0>(kRifOid2), Return(SAI_STATUS_SUCCESS)))
-      .WillOnce(DoAll(SetArgPointee<0>(kRifOid3), Return(SAI_STATUS_SUCCESS)));
+  ExpectCreateRouterInterfaces({kRifOid1, kRifOid2, kRifOid3});
+;
   EXPECT_CALL(publisher_,
               publish(Eq(APP_P4RT_TABLE_NAME), Eq(mac_appl_db_key),
                       Eq(mac_attributes), Eq(StatusCode::SWSS_RC_SUCCESS),
@@ -46,6 +46,20 @@ sai_status_t remove_acl_entry(sai_object_id_t acl_entry_id)
     return mock_sai_acl->remove_acl_entry(acl_entry_id);
 }
 
+sai_status_t create_acl_entries(sai_object_id_t switch_id, uint32_t object_count, const uint32_t *attr_count,
+                                const sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode,
+                                sai_object_id_t *object_id, sai_status_t *object_statuses)
+{
+    return mock_sai_acl->create_acl_entries(switch_id, object_count, attr_count, attr_list, mode, object_id,
+                                            object_statuses);
+}
+
+sai_status_t remove_acl_entries(uint32_t object_count, const sai_object_id_t *object_id,
+                                sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+{
+    return mock_sai_acl->remove_acl_entries(object_count, object_id, mode, object_statuses);
+}
+
 sai_status_t create_acl_counter(sai_object_id_t *acl_counter_id, sai_object_id_t switch_id, uint32_t attr_count,
                                 const sai_attribute_t *attr_list)
 {
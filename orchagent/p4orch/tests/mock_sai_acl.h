@@ -23,6 +23,12 @@ class SaiAclInterface
     virtual sai_status_t create_acl_entry(sai_object_id_t *acl_entry_id, sai_object_id_t switch_id, uint32_t attr_count,
                                           const sai_attribute_t *attr_list) = 0;
     virtual sai_status_t remove_acl_entry(sai_object_id_t acl_entry_id) = 0;
+    virtual sai_status_t create_acl_entries(sai_object_id_t switch_id, uint32_t object_count,
+                                            const uint32_t *attr_count, const sai_attribute_t **attr_list,
+                                            sai_bulk_op_error_mode_t mode, sai_object_id_t *object_id,
+                                            sai_status_t *object_statuses) = 0;
+    virtual sai_status_t remove_acl_entries(uint32_t object_count, const sai_object_id_t *object_id,
+                                            sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses) = 0;
     virtual sai_status_t create_acl_counter(sai_object_id_t *acl_counter_id, sai_object_id_t switch_id,
                                             uint32_t attr_count, const sai_attribute_t *attr_list) = 0;
     virtual sai_status_t remove_acl_counter(sai_object_id_t acl_counter_id) = 0;
@@ -47,6 +53,12 @@ class MockSaiAcl : public SaiAclInterface
     MOCK_METHOD4(create_acl_entry, sai_status_t(sai_object_id_t *acl_entry_id, sai_object_id_t switch_id,
                                                 uint32_t attr_count, const sai_attribute_t *attr_list));
     MOCK_METHOD1(remove_acl_entry, sai_status_t(sai_object_id_t acl_entry_id));
+    MOCK_METHOD7(create_acl_entries,
+                 sai_status_t(sai_object_id_t switch_id, uint32_t object_count, const uint32_t *attr_count,
+                              const sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode,
+                              sai_object_id_t *object_id, sai_status_t *object_statuses));
+    MOCK_METHOD4(remove_acl_entries, sai_status_t(uint32_t object_count, const sai_object_id_t *object_id,
+                                                  sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses));
     MOCK_METHOD4(create_acl_counter, sai_status_t(sai_object_id_t *acl_counter_id, sai_object_id_t switch_id,
                                                   uint32_t attr_count, const sai_attribute_t *attr_list));
     MOCK_METHOD1(remove_acl_counter, sai_status_t(sai_object_id_t acl_counter_id));
@@ -77,6 +89,13 @@ sai_status_t create_acl_entry(sai_object_id_t *acl_entry_id, sai_object_id_t swi
 
 sai_status_t remove_acl_entry(sai_object_id_t acl_entry_id);
 
+sai_status_t create_acl_entries(sai_object_id_t switch_id, uint32_t object_count, const uint32_t *attr_count,
+                                const sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode,
+                                sai_object_id_t *object_id, sai_status_t *object_statuses);
+
+sai_status_t remove_acl_entries(uint32_t object_count, const sai_object_id_t *object_id,
+                                sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses);
+
 sai_status_t create_acl_counter(sai_object_id_t *acl_counter_id, sai_object_id_t switch_id, uint32_t attr_count,
                                 const sai_attribute_t *attr_list);
 
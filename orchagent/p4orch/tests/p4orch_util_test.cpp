@@ -87,6 +87,54 @@ TEST(P4OrchUtilTest, ParseP4RTKeyTest)
     EXPECT_TRUE(key.empty());
 }
 
+TEST(P4OrchUtilTest, P4KeyDecoderDecodesFlatKey)
+{
+    P4KeyDecoder decoder({"match/vrf_id", "match/ipv4_dst"});
+    P4DecodedKey decoded;
+    ASSERT_TRUE(decoder.decode(R"( {"match/ipv4_dst" : "10.0.0.0/8", "match/vrf_id":"b4-traffic",)"
+                               R"("match/other":"x"} )",
+                               &decoded)
+                    .ok());
+    EXPECT_EQ("b4-traffic", decoded.values[0]);
+    EXPECT_EQ("10.0.0.0/8", decoded.values[1]);
+    EXPECT_TRUE(decoded.found[0]);
+    EXPECT_TRUE(decoded.found[1]);
+    EXPECT_EQ(std::vector<std::string>{"match/other"}, decoded.unknown_fields);
+
+    // Missing fields are not found.
+    ASSERT_TRUE(decoder.decode(R"({"match/vrf_id":""})", &decoded).ok());
+    EXPECT_TRUE(decoded.found[0]);
+    EXPECT_FALSE(decoded.found[1]);
+    EXPECT_TRUE(decoded.unknown_fields.empty());
+
+    ASSERT_TRUE(decoder.decode("{}", &decoded).ok());
+    EXPECT_FALSE(decoded.found[0]);
+    EXPECT_FALSE(decoded.found[1]);
+}
+
+TEST(P4OrchUtilTest, P4KeyDecoderFallsBackToJsonParser)
+{
+    P4KeyDecoder decoder({"match/vrf_id", "match/ipv4_dst"});
+    P4DecodedKey decoded;
+
+    // Escaped strings and non-string values of unknown fields.
+    ASSERT_TRUE(decoder.decode(R"({"match/vrf_id":"a\"bA","priority":10})", &decoded).ok());
+    EXPECT_EQ("a\"bA", decoded.values[0]);
+    EXPECT_TRUE(decoded.found[0]);
+    EXPECT_FALSE(decoded.found[1]);
+    EXPECT_EQ(std::vector<std::string>{"priority"}, decoded.unknown_fields);
+
+    // Non-string value of a decoder field.
+    EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, decoder.decode(R"({"match/vrf_id":1})", &decoded));
+    // Not an object.
+    EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, decoder.decode(R"(["match/vrf_id"])", &decoded));
+    // Malformed keys.
+    EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, decoder.decode(R"({"match/vrf_id":"a")", &decoded));
+    EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, decoder.decode(R"({"match/vrf_id":"a"} x)", &decoded));
+    EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, decoder.decode(R"({"match/vrf_id":"a",})", &decoded));
+    EXPECT_EQ(StatusCode::SWSS_RC_INVALID_PARAM, decoder.decode("", &decoded));
+}
+
 TEST(P4OrchUtilTest, PrependMatchFieldShouldSucceed)
 {
     EXPECT_EQ(prependMatchField("str"), "match/str");
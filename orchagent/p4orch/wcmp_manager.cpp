@@ -152,20 +152,15 @@ ReturnCode WcmpManager::validateWcmpGroupEntry(
 ReturnCodeOr<P4WcmpGroupEntry> WcmpManager::deserializeP4WcmpGroupAppDbEntry(
     const std::string &key, const std::vector<swss::FieldValueTuple> &attributes)
 {
+    static const P4KeyDecoder key_decoder({prependMatchField(kWcmpGroupId)});
+
     P4WcmpGroupEntry app_db_entry = {};
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        if (!j.is_object())
-        {
-            return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Invalid WCMP group key: should be a JSON object.";
-        }
-        app_db_entry.wcmp_group_id = j[prependMatchField(kWcmpGroupId)];
-    }
-    catch (std::exception &ex)
+    P4DecodedKey decoded_key;
+    if (!key_decoder.decode(key, &decoded_key).ok() || !decoded_key.found[0])
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize WCMP group key";
     }
+    app_db_entry.wcmp_group_id = decoded_key.values[0];
 
     for (const auto &it : attributes)
     {
@@ -0,0 +1,28 @@
+-- KEYS - queue IDs
+-- ARGV[1] - counters table name
+-- ARGV[2..n] - PFC watchdog stats fields
+-- return "queue_id|value|..." per queue in the counters table, values in ARGV order,
+-- a missing field has an empty value
+
+local counters_table_name = ARGV[1]
+
+local fields = {}
+for i = 2, #ARGV do
+    fields[#fields + 1] = ARGV[i]
+end
+
+local rets = {}
+
+for i = 1, #KEYS do
+    local key = counters_table_name .. ':' .. KEYS[i]
+    if redis.call('EXISTS', key) == 1 then
+        local values = redis.call('HMGET', key, unpack(fields))
+        local row = KEYS[i]
+        for j = 1, #fields do
+            row = row .. '|' .. (values[j] or '')
+        end
+        rets[#rets + 1] = row
+    end
+end
+
+return rets
@@ -3,6 +3,8 @@
 #include "logger.h"
 #include "sai_serialize.h"
 #include "portsorch.h"
+#include "redisapi.h"
+#include "tokenize.h"
 #include <vector>
 #include <inttypes.h>
 
@@ -90,40 +92,64 @@ void PfcWdActionHandler::commitCounters(bool periodic /* = false */)
 
     auto finalStats = getQueueStats(m_countersTable, sai_serialize_object_id(m_queue));
 
+    if (!applyCounters(finalStats, periodic))
+    {
+        return;
+    }
+
+    updateWdCounters(sai_serialize_object_id(m_queue), finalStats);
+}
+
+bool PfcWdActionHandler::applyCounters(PfcWdQueueStats &stats, bool periodic)
+{
+    SWSS_LOG_ENTER();
+
+    PfcWdHwStats hwStats;
+
+    if (!getHwCounters(hwStats))
+    {
+        return false;
+    }
+
     if (!periodic)
     {
-        finalStats.restoreCount++;
+        stats.restoreCount++;
     }
-    finalStats.operational = !periodic;
+    stats.operational = !periodic;
 
-    finalStats.txPktLast += hwStats.txPkt - m_hwStats.txPkt;
-    finalStats.txDropPktLast += hwStats.txDropPkt - m_hwStats.txDropPkt;
-    finalStats.rxPktLast += hwStats.rxPkt - m_hwStats.rxPkt;
-    finalStats.rxDropPktLast += hwStats.rxDropPkt - m_hwStats.rxDropPkt;
+    stats.txPktLast += hwStats.txPkt - m_hwStats.txPkt;
+    stats.txDropPktLast += hwStats.txDropPkt - m_hwStats.txDropPkt;
+    stats.rxPktLast += hwStats.rxPkt - m_hwStats.rxPkt;
+    stats.rxDropPktLast += hwStats.rxDropPkt - m_hwStats.rxDropPkt;
 
-    finalStats.txPkt += hwStats.txPkt - m_hwStats.txPkt;
-    finalStats.txDropPkt += hwStats.txDropPkt - m_hwStats.txDropPkt;
-    finalStats.rxPkt += hwStats.rxPkt - m_hwStats.rxPkt;
-    finalStats.rxDropPkt += hwStats.rxDropPkt - m_hwStats.rxDropPkt;
+    stats.txPkt += hwStats.txPkt - m_hwStats.txPkt;
+    stats.txDropPkt += hwStats.txDropPkt - m_hwStats.txDropPkt;
+    stats.rxPkt += hwStats.rxPkt - m_hwStats.rxPkt;
+    stats.rxDropPkt += hwStats.rxDropPkt - m_hwStats.rxDropPkt;
 
     m_hwStats = hwStats;
 
-    updateWdCounters(sai_serialize_object_id(m_queue), finalStats);
+    return true;
 }
 
 PfcWdActionHandler::PfcWdQueueStats PfcWdActionHandler::getQueueStats(shared_ptr<Table> countersTable, const string &queueIdStr)
 {
     SWSS_LOG_ENTER();
 
+    vector<FieldValueTuple> fieldValues;
+
+    countersTable->get(queueIdStr, fieldValues);
+
+    return parseQueueStats(fieldValues);
+}
+
+PfcWdActionHandler::PfcWdQueueStats PfcWdActionHandler::parseQueueStats(const vector<FieldValueTuple> &fieldValues)
+{
+    SWSS_LOG_ENTER();
+
     PfcWdQueueStats stats;
     memset(&stats, 0, sizeof(PfcWdQueueStats));
     stats.operational = true;
-    vector<FieldValueTuple> fieldValues;
-
-    if (!countersTable->get(queueIdStr, fieldValues))
-    {
-        return stats;
-    }
 
     for (const auto& fv : fieldValues)
     {
@@ -198,6 +224,13 @@ void PfcWdActionHandler::updateWdCounters(const string& queueIdStr, const PfcWdQ
 {
     SWSS_LOG_ENTER();
 
+    m_countersTable->set(queueIdStr, queueStatsToFvs(stats));
+}
+
+vector<FieldValueTuple> PfcWdActionHandler::queueStatsToFvs(const PfcWdQueueStats &stats)
+{
+    SWSS_LOG_ENTER();
+
     vector<FieldValueTuple> resultFvValues;
 
     resultFvValues.emplace_back(PFC_WD_QUEUE_STATS_DEADLOCK_DETECTED, to_string(stats.detectCount));
@@ -217,7 +250,116 @@ void PfcWdActionHandler::updateWdCounters(const string& queueIdStr, const PfcWdQ
                                                      PFC_WD_QUEUE_STATUS_OPERATIONAL :
                                                      PFC_WD_QUEUE_STATUS_STORMED);
 
-    m_countersTable->set(queueIdStr, resultFvValues);
+    return resultFvValues;
+}
+
+// Order of the values in a pfc_wd_stats.lua reply
+static const vector<string> pfcWdQueueStatsFields =
+{
+    PFC_WD_QUEUE_STATS_DEADLOCK_DETECTED,
+    PFC_WD_QUEUE_STATS_DEADLOCK_RESTORED,
+    PFC_WD_QUEUE_STATUS,
+    PFC_WD_QUEUE_STATS_TX_PACKETS,
+    PFC_WD_QUEUE_STATS_TX_DROPPED_PACKETS,
+    PFC_WD_QUEUE_STATS_RX_PACKETS,
+    PFC_WD_QUEUE_STATS_RX_DROPPED_PACKETS,
+    PFC_WD_QUEUE_STATS_TX_PACKETS_LAST,
+    PFC_WD_QUEUE_STATS_TX_DROPPED_PACKETS_LAST,
+    PFC_WD_QUEUE_STATS_RX_PACKETS_LAST,
+    PFC_WD_QUEUE_STATS_RX_DROPPED_PACKETS_LAST,
+};
+
+PfcWdStatsCollector::PfcWdStatsCollector(DBConnector *countersDb, const string &tableName):
+    m_countersDb(countersDb),
+    m_tableName(tableName),
+    m_pipeline(countersDb),
+    m_pipeTable(&m_pipeline, tableName, true)
+{
+    SWSS_LOG_ENTER();
+
+    try
+    {
+        string statsLuaScript = swss::loadLuaScript("pfc_wd_stats.lua");
+        m_statsSha = swss::loadRedisScript(m_countersDb, statsLuaScript);
+    }
+    catch (...)
+    {
+        SWSS_LOG_WARN("PFC watchdog stats script was not loaded, counters are committed per queue");
+    }
+}
+
+void PfcWdStatsCollector::commitCounters(const vector<shared_ptr<PfcWdActionHandler>> &handlers, bool periodic)
+{
+    SWSS_LOG_ENTER();
+
+    if (handlers.empty())
+    {
+        return;
+    }
+
+    vector<string> queueIdStrs;
+    for (const auto &handler : handlers)
+    {
+        queueIdStrs.push_back(sai_serialize_object_id(handler->getQueue()));
+    }
+
+    // Each reply row is "queue_id|value|...", a missing field has an empty value
+    unordered_map<string, vector<FieldValueTuple>> storedStats;
+    bool batched = !m_statsSha.empty();
+    if (batched)
+    {
+        vector<string> argv = { m_tableName };
+        argv.insert(argv.end(), pfcWdQueueStatsFields.begin(), pfcWdQueueStatsFields.end());
+
+        try
+        {
+            auto rows = swss::runRedisScript(*m_countersDb, m_statsSha, queueIdStrs, argv);
+            for (const auto &row : rows)
+            {
+                auto values = tokenize(row, '|');
+                if (values.empty())
+                {
+                    continue;
+                }
+
+                auto &fieldValues = storedStats[values[0]];
+                for (size_t i = 1; i < values.size() && i <= pfcWdQueueStatsFields.size(); i++)
+                {
+                    if (!values[i].empty())
+                    {
+                        fieldValues.emplace_back(pfcWdQueueStatsFields[i - 1], values[i]);
+                    }
+                }
+            }
+        }
+        catch (const exception &e)
+        {
+            SWSS_LOG_ERROR("Failed to read PFC watchdog stats of %zu queues: %s", handlers.size(), e.what());
+            batched = false;
+        }
+    }
+
+    if (!batched)
+    {
+        for (const auto &handler : handlers)
+        {
+            handler->commitCounters(periodic);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < handlers.size(); i++)
+    {
+        auto stats = PfcWdActionHandler::parseQueueStats(storedStats[queueIdStrs[i]]);
+        if (!handlers[i]->applyCounters(stats, periodic))
+        {
+            continue;
+        }
+
+        m_pipeTable.set(queueIdStrs[i], PfcWdActionHandler::queueStatsToFvs(stats));
+    }
+
+    m_pipeline.flush();
 }
 
 PfcWdSaiDlrInitHandler::PfcWdSaiDlrInitHandler(sai_object_id_t port, sai_object_id_t queue,
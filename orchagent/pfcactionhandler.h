@@ -5,6 +5,7 @@
 #include <memory>
 #include "aclorch.h"
 #include "table.h"
+#include "redispipeline.h"
 
 extern "C" {
 #include "sai.h"
@@ -46,18 +47,6 @@ class PfcWdActionHandler
             return m_queueId;
         }
 
-        static void initWdCounters(shared_ptr<Table> countersTable, const string &queueIdStr);
-        void initCounters(void);
-        void commitCounters(bool periodic = false);
-
-        virtual bool getHwCounters(PfcWdHwStats& counters)
-        {
-            memset(&counters, 0, sizeof(PfcWdHwStats));
-
-            return true;
-        };
-
-    private:
         struct PfcWdQueueStats
         {
             uint64_t detectCount;
@@ -73,6 +62,23 @@ class PfcWdActionHandler
             bool     operational;
         };
 
+        static void initWdCounters(shared_ptr<Table> countersTable, const string &queueIdStr);
+        void initCounters(void);
+        void commitCounters(bool periodic = false);
+        // Adds the hardware counters accumulated since the last commit to stats
+        bool applyCounters(PfcWdQueueStats &stats, bool periodic);
+
+        static PfcWdQueueStats parseQueueStats(const vector<FieldValueTuple> &fieldValues);
+        static vector<FieldValueTuple> queueStatsToFvs(const PfcWdQueueStats &stats);
+
+        virtual bool getHwCounters(PfcWdHwStats& counters)
+        {
+            memset(&counters, 0, sizeof(PfcWdHwStats));
+
+            return true;
+        };
+
+    private:
         static PfcWdQueueStats getQueueStats(shared_ptr<Table> countersTable, const string &queueIdStr);
         void updateWdCounters(const string& queueIdStr, const PfcWdQueueStats& stats);
 
@@ -84,6 +90,24 @@ class PfcWdActionHandler
         PfcWdHwStats m_hwStats;
 };
 
+// Periodic counters commit of all queues in storm at once. The stored counters
+// are read with one script call and the updated ones are written back with one
+// pipeline flush, instead of a read and a write round trip per queue.
+class PfcWdStatsCollector
+{
+    public:
+        PfcWdStatsCollector(DBConnector *countersDb, const string &tableName);
+
+        void commitCounters(const vector<shared_ptr<PfcWdActionHandler>> &handlers, bool periodic = true);
+
+    private:
+        DBConnector *m_countersDb = nullptr;
+        string m_tableName;
+        string m_statsSha;
+        RedisPipeline m_pipeline;
+        Table m_pipeTable;
+};
+
 // Pfc queue that implements forward action by disabling PFC on queue
 class PfcWdLossyHandler: public PfcWdActionHandler
 {
@@ -27,6 +27,9 @@
 #define SAI_PORT_STAT_PFC_PREFIX        "SAI_PORT_STAT_PFC_"
 #define PFC_WD_TC_MAX 8
 #define COUNTER_CHECK_POLL_TIMEOUT_SEC  1
+#define COUNTER_CHECK_POLL_TIMEOUT_MAX_SEC  10
+// Queues in storm per extra second of the counters commit interval
+#define COUNTER_CHECK_STORMS_PER_SEC    128
 
 extern sai_object_id_t gSwitchId;
 extern sai_switch_api_t* sai_switch_api;
@@ -389,6 +392,7 @@ void PfcWdSwOrch<DropHandler, ForwardHandler>::setBigRedSwitchMode(const string
         SWSS_LOG_NOTICE("Unsupported BIG_RED_SWITCH mode set input, please use enable or disable");
     }
 
+    updateCountersPollInterval();
 }
 
 template <typename DropHandler, typename ForwardHandler>
@@ -676,6 +680,7 @@ void PfcWdSwOrch<DropHandler, ForwardHandler>::unregisterFromWdDb(const Port& po
         m_applDb->hdel(instormKey, to_string(i));
     }
 
+    updateCountersPollInterval();
 }
 
 template <typename DropHandler, typename ForwardHandler>
@@ -734,11 +739,13 @@ PfcWdSwOrch<DropHandler, ForwardHandler>::PfcWdSwOrch(
     auto wdNotification = new Notifier(consumer, this, "PFC_WD_ACTION");
     Orch::addExecutor(wdNotification);
 
+    m_statsCollector = make_shared<PfcWdStatsCollector>(this->getCountersDb().get(), COUNTERS_TABLE);
+
+    // Started on the first storm, see updateCountersPollInterval()
     auto interv = timespec { .tv_sec = COUNTER_CHECK_POLL_TIMEOUT_SEC, .tv_nsec = 0 };
-    auto timer = new SelectableTimer(interv);
-    auto executor = new ExecutableTimer(timer, this, "PFC_WD_COUNTERS_POLL");
+    m_countersTimer = new SelectableTimer(interv);
+    auto executor = new ExecutableTimer(m_countersTimer, this, "PFC_WD_COUNTERS_POLL");
     Orch::addExecutor(executor);
-    timer->start();
 
     auto ssTable = new swss::SubscriberStateTable(
             m_applDb.get(), APP_PFC_WD_TABLE_NAME, TableConsumable::DEFAULT_POP_BATCH_SIZE, default_orch_pri);
@@ -928,14 +935,67 @@ void PfcWdSwOrch<DropHandler, ForwardHandler>::doTask(SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
 
+    vector<shared_ptr<PfcWdActionHandler>> handlers;
     for (auto& handlerPair : m_entryMap)
     {
         if (handlerPair.second.handler != nullptr)
         {
-            handlerPair.second.handler->commitCounters(true);
+            handlers.push_back(handlerPair.second.handler);
         }
     }
 
+    m_statsCollector->commitCounters(handlers);
+
+    updateCountersPollInterval();
+}
+
+template <typename DropHandler, typename ForwardHandler>
+void PfcWdSwOrch<DropHandler, ForwardHandler>::updateCountersPollInterval(void)
+{
+    SWSS_LOG_ENTER();
+
+    size_t storms = 0;
+    for (const auto& handlerPair : m_entryMap)
+    {
+        if (handlerPair.second.handler != nullptr)
+        {
+            storms++;
+        }
+    }
+
+    // Commit less often as more queues are in storm, every commit reads and
+    // writes the counters of all of them
+    time_t pollSec = 0;
+    if (storms != 0)
+    {
+        pollSec = min<time_t>(COUNTER_CHECK_POLL_TIMEOUT_SEC + storms / COUNTER_CHECK_STORMS_PER_SEC,
+                              COUNTER_CHECK_POLL_TIMEOUT_MAX_SEC);
+    }
+
+    if (pollSec == m_countersPollSec)
+    {
+        return;
+    }
+
+    if (pollSec == 0)
+    {
+        m_countersTimer->stop();
+    }
+    else
+    {
+        m_countersTimer->setInterval(timespec { .tv_sec = pollSec, .tv_nsec = 0 });
+        if (m_countersPollSec == 0)
+        {
+            m_countersTimer->start();
+        }
+        else
+        {
+            m_countersTimer->reset();
+        }
+    }
+
+    SWSS_LOG_INFO("PFC watchdog counters commit interval %ld sec, %zu queues in storm", pollSec, storms);
+    m_countersPollSec = pollSec;
 }
 
 template <typename DropHandler, typename ForwardHandler>
@@ -1071,6 +1131,8 @@ bool PfcWdSwOrch<DropHandler, ForwardHandler>::startWdActionOnQueue(const string
         return false;
     }
 
+    updateCountersPollInterval();
+
     return true;
 }
 
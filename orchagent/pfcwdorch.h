@@ -133,6 +133,7 @@ private:
     void setBigRedSwitchMode(string value);
 
     void report_pfc_storm(sai_object_id_t id, const PfcWdQueueEntry *, const string&);
+    void updateCountersPollInterval(void);
 
     map<sai_object_id_t, PfcWdQueueEntry> m_entryMap;
     map<sai_object_id_t, PfcWdQueueEntry> m_brsEntryMap;
@@ -147,6 +148,11 @@ private:
     shared_ptr<DBConnector> m_applDb = nullptr;
     // Track queues in storm
     shared_ptr<Table> m_applTable = nullptr;
+
+    // Periodic counters commit of queues in storm, stopped while there are none
+    SelectableTimer *m_countersTimer = nullptr;
+    time_t m_countersPollSec = 0;
+    shared_ptr<PfcWdStatsCollector> m_statsCollector = nullptr;
 };
 
 #endif
@@ -13,6 +13,7 @@
 #include "subintf.h"
 #include "notifications.h"
 #include "stporch.h"
+#include "bulker.h"
 
 #include <inttypes.h>
 #include <cassert>
@@ -54,6 +55,7 @@ extern sai_hostif_api_t* sai_hostif_api;
 extern sai_acl_api_t* sai_acl_api;
 extern sai_queue_api_t *sai_queue_api;
 extern sai_object_id_t gSwitchId;
+extern size_t gMaxBulkSize;
 extern sai_fdb_api_t *sai_fdb_api;
 extern sai_tam_api_t *sai_tam_api;
 extern sai_l2mc_group_api_t *sai_l2mc_group_api;
@@ -3247,6 +3249,11 @@ void PortsOrch::initPortSupportedSpeeds(const std::string& alias, sai_object_id_
     }
     PortSupportedSpeeds supported_speeds;
     getPortSupportedSpeeds(alias, port_id, supported_speeds);
+    setPortSupportedSpeeds(alias, port_id, supported_speeds);
+}
+
+void PortsOrch::setPortSupportedSpeeds(const std::string& alias, sai_object_id_t port_id, const PortSupportedSpeeds &supported_speeds)
+{
     m_portSupportedSpeeds[port_id] = supported_speeds;
     vector<FieldValueTuple> v;
     std::string supported_speeds_str = swss::join(',', supported_speeds.begin(), supported_speeds.end());
@@ -3354,10 +3361,19 @@ void PortsOrch::initPortSupportedFecModes(const std::string& alias, sai_object_i
         return;
     }
 
+    PortSupportedFecModes supported_fecmodes;
+    auto status = getPortSupportedFecModes(supported_fecmodes, port_id);
+    setPortSupportedFecModes(alias, port_id, status, supported_fecmodes);
+}
+
+void PortsOrch::setPortSupportedFecModes(const std::string& alias, sai_object_id_t port_id, sai_status_t status, const PortSupportedFecModes &supported_fecmodes)
+{
+    SWSS_LOG_ENTER();
+
     auto &obj = m_portSupportedFecModes[port_id];
     auto &supported_fec_modes = obj.data;
+    supported_fec_modes = supported_fecmodes;
 
-    auto status = getPortSupportedFecModes(supported_fec_modes, port_id);
     if (status != SAI_STATUS_SUCCESS)
     {
         // Do not expose "supported_fecs" in case fetching FEC modes is not supported by the vendor
@@ -4118,49 +4134,224 @@ bool PortsOrch::initExistingPort(const PortConfig& port)
 {
     SWSS_LOG_ENTER();
 
-    const auto &alias = port.key;
-    const auto &role = port.role.value;
-    const auto &index = port.index.value;
-    const auto &lane_set = port.lanes.value;
+    std::vector<PortConfig> portList = { port };
+    return initExistingPortsBulk(portList);
+}
 
-    /* Determine if the port has already been initialized before */
-    auto it = m_portList.find(alias);
-    if (it != m_portList.end())
+bool PortsOrch::initExistingPortsBulk(const std::vector<PortConfig> &portList)
+{
+    SWSS_LOG_ENTER();
+
+    bool status = true;
+    std::vector<Port> ports;
+
+    for (const auto &port : portList)
     {
-        SWSS_LOG_DEBUG("Port has already been initialized before alias:%s", alias.c_str());
-        return true;
+        const auto &alias = port.key;
+
+        /* Determine if the port has already been initialized before */
+        if (m_portList.find(alias) != m_portList.end())
+        {
+            SWSS_LOG_DEBUG("Port has already been initialized before alias:%s", alias.c_str());
+            continue;
+        }
+
+        /* Determine if the lane combination exists in switch */
+        auto it = m_portListLaneMap.find(port.lanes.value);
+        if (it == m_portListLaneMap.end())
+        {
+            SWSS_LOG_ERROR("Failed to locate port lane combination alias:%s", alias.c_str());
+            status = false;
+            continue;
+        }
+
+        Port p(alias, Port::PHY);
+        p.m_role = port.role.value;
+        p.m_index = port.index.value;
+        p.m_port_id = it->second;
+        ports.push_back(p);
     }
 
-    /* Determine if the lane combination exists in switch */
-    if (m_portListLaneMap.find(lane_set) == m_portListLaneMap.end())
+    if (ports.empty())
     {
-        SWSS_LOG_ERROR("Failed to locate port lane combination alias:%s", alias.c_str());
-        return false;
+        return status;
+    }
+
+    if (!initializePortStateBulk(ports))
+    {
+        status = false;
+    }
+
+    if (!initPortsBulk(ports))
+    {
+        status = false;
     }
 
-    sai_object_id_t id = m_portListLaneMap[lane_set];
+    return status;
+}
+
+// Reads the admin status and, for ports without autoneg, the speed of ports
+// that already exist in the switch. Ports that fail are dropped from the list.
+bool PortsOrch::initializePortStateBulk(std::vector<Port>& ports)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER(__FUNCTION__);
+
+    auto start = std::chrono::steady_clock::now();
 
-    Port p(alias, Port::PHY);
-    p.m_role = role;
-    p.m_index = index;
-    p.m_port_id = id;
+    bool status = true;
+    const auto portCount = static_cast<uint32_t>(ports.size());
+    std::vector<bool> failed(portCount, false);
+    std::vector<bool> readSpeed(portCount, false);
 
-    /* initialize port admin status */
-    if (!getPortAdminStatus(p.m_port_id, p.m_admin_state_up))
+    // Gearbox ports are read on their line side port, which lives on another switch
+    std::vector<bool> gearbox(portCount, false);
+    for (size_t idx = 0; idx < portCount; idx++)
     {
-        SWSS_LOG_ERROR("Failed to get initial port admin status %s", p.m_alias.c_str());
-        return false;
+        sai_object_id_t lineId;
+        gearbox[idx] = getDestPortId(ports[idx].m_port_id, LINE_PORT_TYPE, lineId);
     }
 
-    // Read port speed of an already existing port
-    if (!isAutoNegEnabled(p.m_port_id) && !getPortSpeed(p.m_port_id, p.m_speed))
     {
-        SWSS_LOG_ERROR("Failed to get initial port admin speed %d", p.m_speed);
-        return false;
+        PortBulker adminBulker(portCount);
+        PortBulker anBulker(portCount);
+
+        for (size_t idx = 0; idx < portCount; idx++)
+        {
+            sai_attribute_t attr;
+
+            attr.id = SAI_PORT_ATTR_AUTO_NEG_MODE;
+            anBulker.add(ports[idx].m_port_id, attr);
+
+            if (!gearbox[idx])
+            {
+                attr.id = SAI_PORT_ATTR_ADMIN_STATE;
+                adminBulker.add(ports[idx].m_port_id, attr);
+            }
+        }
+
+        adminBulker.executeGet();
+        anBulker.executeGet();
+
+        for (size_t idx = 0, adminIdx = 0; idx < portCount; idx++)
+        {
+            auto& port = ports[idx];
+
+            if (gearbox[idx])
+            {
+                if (!getPortAdminStatus(port.m_port_id, port.m_admin_state_up))
+                {
+                    failed[idx] = true;
+                }
+            }
+            else
+            {
+                const auto adminStatus = adminBulker.statuses[adminIdx];
+                const auto& attr = adminBulker.attrList[adminIdx];
+                adminIdx++;
+
+                if (adminStatus != SAI_STATUS_SUCCESS)
+                {
+                    SWSS_LOG_ERROR("Failed to get admin status for port pid:%" PRIx64, port.m_port_id);
+                    if (handleSaiGetStatus(SAI_API_PORT, adminStatus) != task_process_status::task_success)
+                    {
+                        failed[idx] = true;
+                    }
+                }
+                else
+                {
+                    port.m_admin_state_up = attr.value.booldata;
+                }
+            }
+
+            if (failed[idx])
+            {
+                SWSS_LOG_ERROR("Failed to get initial port admin status %s", port.m_alias.c_str());
+                continue;
+            }
+
+            // Read port speed of an already existing port
+            if (anBulker.statuses[idx] != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("Failed to get port AutoNeg status for port pid:%" PRIx64, port.m_port_id);
+                readSpeed[idx] = true;
+            }
+            else
+            {
+                readSpeed[idx] = !anBulker.attrList[idx].value.booldata;
+            }
+        }
+    }
+
+    {
+        PortBulker bulker(portCount);
+
+        for (size_t idx = 0; idx < portCount; idx++)
+        {
+            if (readSpeed[idx] && !gearbox[idx])
+            {
+                sai_attribute_t attr;
+                attr.id = SAI_PORT_ATTR_SPEED;
+                attr.value.u32 = 0;
+                bulker.add(ports[idx].m_port_id, attr);
+            }
+        }
+
+        bulker.executeGet();
+
+        for (size_t idx = 0, speedIdx = 0; idx < portCount; idx++)
+        {
+            auto& port = ports[idx];
+
+            if (!readSpeed[idx])
+            {
+                continue;
+            }
+
+            if (gearbox[idx])
+            {
+                failed[idx] = !getPortSpeed(port.m_port_id, port.m_speed);
+            }
+            else
+            {
+                const auto speedStatus = bulker.statuses[speedIdx];
+                const auto& attr = bulker.attrList[speedIdx];
+                speedIdx++;
+
+                if (speedStatus == SAI_STATUS_SUCCESS)
+                {
+                    port.m_speed = attr.value.u32;
+                }
+                else if (handleSaiGetStatus(SAI_API_PORT, speedStatus) != task_process_status::task_success)
+                {
+                    failed[idx] = true;
+                }
+            }
+
+            if (failed[idx])
+            {
+                SWSS_LOG_ERROR("Failed to get initial port admin speed %d", port.m_speed);
+            }
+        }
+    }
+
+    std::vector<Port> initialized;
+    initialized.reserve(portCount);
+    for (size_t idx = 0; idx < portCount; idx++)
+    {
+        if (failed[idx])
+        {
+            status = false;
+            continue;
+        }
+        initialized.push_back(ports[idx]);
     }
+    ports.swap(initialized);
+
+    addPortInitStageTime("port_state", start);
 
-    std::vector<Port> ports = {p};
-    return initPortsBulk(ports);
+    return status;
 }
 
 bool PortsOrch::initPortsBulk(std::vector<Port>& ports)
@@ -4176,23 +4367,72 @@ bool PortsOrch::initPortsBulk(std::vector<Port>& ports)
         status = false;
     }
 
+    auto start = std::chrono::steady_clock::now();
+
     for (auto& p: ports)
     {
-        const auto& alias = p.m_alias;
-
         registerPort(p);
+    }
+
+    addPortInitStageTime("register", start);
+
+    if (!m_isWarmRestoreStage)
+    {
+        initializePortCapabilitiesBulk(ports);
+
+        start = std::chrono::steady_clock::now();
 
-        if (!m_isWarmRestoreStage)
+        for (auto& p: ports)
         {
-            postPortInit(m_portList[alias]);
+            postPortInit(m_portList[p.m_alias]);
         }
 
-        SWSS_LOG_NOTICE("Initialized port %s", alias.c_str());
+        addPortInitStageTime("post_init", start);
+    }
+
+    for (auto& p: ports)
+    {
+        SWSS_LOG_NOTICE("Initialized port %s", p.m_alias.c_str());
     }
 
     return status;
 }
 
+void PortsOrch::addPortInitStageTime(const std::string &stage, const std::chrono::steady_clock::time_point &start)
+{
+    auto usec = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count());
+
+    for (auto &it : m_portInitStageUsec)
+    {
+        if (it.first == stage)
+        {
+            it.second += usec;
+            return;
+        }
+    }
+
+    m_portInitStageUsec.emplace_back(stage, usec);
+}
+
+void PortsOrch::reportPortInitStageTimes(const std::string &context)
+{
+    uint64_t total = 0;
+
+    for (const auto &it : m_portInitStageUsec)
+    {
+        SWSS_LOG_NOTICE("%s: stage %s took %" PRIu64 " usec", context.c_str(), it.first.c_str(), it.second);
+        total += it.second;
+    }
+
+    if (!m_portInitStageUsec.empty())
+    {
+        SWSS_LOG_NOTICE("%s: %zu stages took %" PRIu64 " usec", context.c_str(), m_portInitStageUsec.size(), total);
+    }
+
+    m_portInitStageUsec.clear();
+}
+
 // Registers a newly created and initialized port, adds port to internal maps.
 // Performs the following operations:
 // - Adds port to internal port list and mapping tables
@@ -4811,6 +5051,7 @@ void PortsOrch::doPortTask(Consumer &consumer)
             if (getPortConfigState() == PORT_CONFIG_RECEIVED)
             {
                 std::vector<PortConfig> portsToAddList;
+                std::vector<PortConfig> portsToInitList;
                 std::vector<sai_object_id_t> portsToRemoveList;
 
                 // Port remove comparison logic
@@ -4829,10 +5070,14 @@ void PortsOrch::doPortTask(Consumer &consumer)
                 // Bulk port remove
                 if (!portsToRemoveList.empty())
                 {
+                    auto start = std::chrono::steady_clock::now();
+
                     if (!removePortBulk(portsToRemoveList))
                     {
                         SWSS_LOG_THROW("PortsOrch initialization failure");
                     }
+
+                    addPortInitStageTime("remove", start);
                 }
 
                 // Port add comparison logic
@@ -4845,28 +5090,35 @@ void PortsOrch::doPortTask(Consumer &consumer)
                         continue;
                     }
 
-                    if (!initExistingPort(it->second))
-                    {
-                        // Failure has been recorded in initExistingPort
-                        it++;
-                        continue;
-                    }
-
+                    portsToInitList.push_back(it->second);
                     it++;
                 }
 
+                // Bulk init of the ports the switch already has.
+                // Failures are recorded in initExistingPortsBulk
+                if (!portsToInitList.empty())
+                {
+                    initExistingPortsBulk(portsToInitList);
+                }
+
                 // Bulk port add
                 if (!portsToAddList.empty())
                 {
+                    auto start = std::chrono::steady_clock::now();
+
                     std::vector<Port> addedPorts;
                     if (!addPortBulk(portsToAddList, addedPorts))
                     {
                         SWSS_LOG_THROW("PortsOrch initialization failure");
                     }
 
+                    addPortInitStageTime("create", start);
+
                     initPortsBulk(addedPorts);
                 }
 
+                reportPortInitStageTimes(m_isWarmRestoreStage ? "Warm restore port init" : "Port init");
+
                 setPortConfigState(PORT_CONFIG_DONE);
             }
             else if (getPortConfigState() == PORT_CONFIG_DONE)
@@ -4885,6 +5137,7 @@ void PortsOrch::doPortTask(Consumer &consumer)
                     }
 
                     initPortsBulk(addedPorts);
+                    m_portInitStageUsec.clear();
                 }
             }
             else
@@ -6573,15 +6826,26 @@ void PortsOrch::onWarmBootEnd()
     refreshPortStatus();
 
     // Do post boot port initialization
+    std::vector<Port> phyPorts;
     for (auto& it: m_portList)
     {
-        Port& port = it.second;
-
-        if (port.m_type == Port::PHY)
+        if (it.second.m_type == Port::PHY)
         {
-            postPortInit(it.second);
+            phyPorts.push_back(it.second);
         }
     }
+
+    initializePortCapabilitiesBulk(phyPorts);
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (auto& port: phyPorts)
+    {
+        postPortInit(m_portList[port.m_alias]);
+    }
+
+    addPortInitStageTime("post_init", start);
+    reportPortInitStageTimes("Warm boot port init");
 }
 
 void PortsOrch::postPortInit(Port& p)
@@ -6727,23 +6991,36 @@ bool PortsOrch::initializePorts(std::vector<Port>& ports)
     SWSS_LOG_ENTER();
 
     bool status = true;
+    auto start = std::chrono::steady_clock::now();
 
     if (gMySwitchType != "dpu")
     {
         initializePriorityGroupsBulk(ports);
+        addPortInitStageTime("priority_groups", start);
+
+        start = std::chrono::steady_clock::now();
         initializeQueuesBulk(ports);
+        addPortInitStageTime("queues", start);
+
+        start = std::chrono::steady_clock::now();
         initializeSchedulerGroupsBulk(ports);
+        addPortInitStageTime("scheduler_groups", start);
     }
 
     /* initialize port host_tx_ready value (only for supporting systems) */
     if (m_cmisModuleAsicSyncSupported)
     {
+        start = std::chrono::steady_clock::now();
         initializePortHostTxReadyBulk(ports);
+        addPortInitStageTime("host_tx_ready", start);
     }
 
+    start = std::chrono::steady_clock::now();
     initializePortMtuBulk(ports);
+    addPortInitStageTime("mtu", start);
 
     // Create host interfaces
+    start = std::chrono::steady_clock::now();
     for (auto iter = ports.begin(); iter != ports.end();)
     {
         Port& port = *iter;
@@ -6820,9 +7097,148 @@ bool PortsOrch::initializePorts(std::vector<Port>& ports)
         iter++;
     }
 
+    addPortInitStageTime("host_interfaces", start);
+
     return status;
 }
 
+// Reads the supported speeds, supported FEC modes and autoneg capability of
+// all ports with one bulk call per attribute. Ports the bulk read fails for
+// keep the per port path, which retries and reports the failure in detail.
+void PortsOrch::initializePortCapabilitiesBulk(std::vector<Port>& ports)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER(__FUNCTION__);
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<Port*> speedPorts;
+    std::vector<Port*> fecPorts;
+    std::vector<Port*> anPorts;
+
+    for (auto& port: ports)
+    {
+        if (port.m_type != Port::PHY)
+        {
+            continue;
+        }
+
+        if (!m_portSupportedSpeeds.count(port.m_port_id))
+        {
+            speedPorts.push_back(&port);
+        }
+        if (!m_portSupportedFecModes.count(port.m_port_id))
+        {
+            fecPorts.push_back(&port);
+        }
+        if (m_portList[port.m_alias].m_cap_an < 0)
+        {
+            anPorts.push_back(&port);
+        }
+    }
+
+    // Query supported speeds
+    {
+        const auto portCount = static_cast<uint32_t>(speedPorts.size());
+        std::vector<PortSupportedSpeeds> speeds(portCount, PortSupportedSpeeds(PORT_SPEED_LIST_DEFAULT_SIZE));
+
+        PortBulker bulker(portCount);
+
+        for (size_t idx = 0; idx < portCount; idx++)
+        {
+            sai_attribute_t attr;
+            attr.id = SAI_PORT_ATTR_SUPPORTED_SPEED;
+            attr.value.u32list.count = static_cast<uint32_t>(speeds[idx].size());
+            attr.value.u32list.list = speeds[idx].data();
+            bulker.add(speedPorts[idx]->m_port_id, attr);
+        }
+
+        bulker.executeGet();
+
+        for (size_t idx = 0; idx < portCount; idx++)
+        {
+            const auto& port = *speedPorts[idx];
+
+            if (bulker.statuses[idx] != SAI_STATUS_SUCCESS)
+            {
+                initPortSupportedSpeeds(port.m_alias, port.m_port_id);
+                continue;
+            }
+
+            speeds[idx].resize(bulker.attrList[idx].value.u32list.count);
+            setPortSupportedSpeeds(port.m_alias, port.m_port_id, speeds[idx]);
+        }
+    }
+
+    // Query supported FEC modes
+    {
+        const auto portCount = static_cast<uint32_t>(fecPorts.size());
+        std::vector<std::vector<sai_int32_t>> fecModes(portCount, std::vector<sai_int32_t>(Port::max_fec_modes));
+
+        PortBulker bulker(portCount);
+
+        for (size_t idx = 0; idx < portCount; idx++)
+        {
+            sai_attribute_t attr;
+            attr.id = SAI_PORT_ATTR_SUPPORTED_FEC_MODE;
+            attr.value.s32list.count = static_cast<uint32_t>(fecModes[idx].size());
+            attr.value.s32list.list = fecModes[idx].data();
+            bulker.add(fecPorts[idx]->m_port_id, attr);
+        }
+
+        bulker.executeGet();
+
+        for (size_t idx = 0; idx < portCount; idx++)
+        {
+            const auto& port = *fecPorts[idx];
+
+            if (bulker.statuses[idx] != SAI_STATUS_SUCCESS)
+            {
+                initPortSupportedFecModes(port.m_alias, port.m_port_id);
+                continue;
+            }
+
+            PortSupportedFecModes supported_fecmodes;
+            const auto& attr = bulker.attrList[idx];
+            for (std::uint32_t i = 0; i < attr.value.s32list.count; i++)
+            {
+                supported_fecmodes.insert(static_cast<sai_port_fec_mode_t>(attr.value.s32list.list[i]));
+            }
+            setPortSupportedFecModes(port.m_alias, port.m_port_id, SAI_STATUS_SUCCESS, supported_fecmodes);
+        }
+    }
+
+    // Query autoneg capability. It is otherwise only read once autoneg gets
+    // configured, so a failed bulk read is left to that lazy path.
+    {
+        const auto portCount = static_cast<uint32_t>(anPorts.size());
+
+        PortBulker bulker(portCount);
+
+        for (const auto port: anPorts)
+        {
+            sai_attribute_t attr;
+            attr.id = SAI_PORT_ATTR_SUPPORTED_AUTO_NEG_MODE;
+            bulker.add(port->m_port_id, attr);
+        }
+
+        bulker.executeGet();
+
+        for (size_t idx = 0; idx < portCount; idx++)
+        {
+            if (bulker.statuses[idx] == SAI_STATUS_SUCCESS)
+            {
+                auto& port = m_portList[anPorts[idx]->m_alias];
+                port.m_cap_an = bulker.attrList[idx].value.booldata ? 1 : 0;
+                anPorts[idx]->m_cap_an = port.m_cap_an;
+            }
+        }
+    }
+
+    addPortInitStageTime("capabilities", start);
+}
+
 void PortsOrch::initializePortHostTxReadyBulk(std::vector<Port>& ports)
 {
     SWSS_LOG_ENTER();
@@ -7691,6 +8107,107 @@ bool PortsOrch::addVlanMember(Port &vlan, Port &port, string &tagging_mode, stri
         return addVlanFloodGroups(vlan, port, end_point_ip);
     }
 
+    sai_vlan_tagging_mode_t sai_tagging_mode;
+    vector<sai_attribute_t> attrs = getVlanMemberAttrs(vlan, port, tagging_mode, sai_tagging_mode);
+
+    sai_object_id_t vlan_member_id;
+    sai_status_t status = sai_vlan_api->create_vlan_member(&vlan_member_id, gSwitchId, (uint32_t)attrs.size(), attrs.data());
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("Failed to add member %s to VLAN %s vid:%hu pid:%" PRIx64,
+                port.m_alias.c_str(), vlan.m_alias.c_str(), vlan.m_vlan_info.vlan_id, port.m_port_id);
+        task_process_status handle_status = handleSaiCreateStatus(SAI_API_VLAN, status);
+        if (handle_status != task_success)
+        {
+            return parseHandleSaiStatusFailure(handle_status);
+        }
+    }
+
+    return addVlanMemberPost(vlan, port, vlan_member_id, sai_tagging_mode);
+}
+
+/*
+ * Adds a batch of (vlan alias, port alias) members with a single bulk call.
+ * Both ports must already exist and the port must have a bridge port. Members
+ * with an end point IP go through flood groups and are not handled here.
+ * The status of each failed member goes through handleSaiCreateStatus like
+ * addVlanMember. Returns false if a member can't be located or its failure
+ * needs a retry.
+ */
+bool PortsOrch::addVlanMembers(const vector<pair<string, string>> &members, string &tagging_mode)
+{
+    SWSS_LOG_ENTER();
+
+    ObjectBulker<sai_vlan_api_t> vlanMemberBulker(sai_vlan_api, gSwitchId, gMaxBulkSize);
+
+    vector<sai_object_id_t> member_ids(members.size(), SAI_NULL_OBJECT_ID);
+    vector<sai_status_t> statuses(members.size(), SAI_STATUS_NOT_EXECUTED);
+    vector<sai_vlan_tagging_mode_t> sai_tagging_modes(members.size());
+    vector<bool> queued(members.size(), false);
+
+    for (size_t i = 0; i < members.size(); i++)
+    {
+        Port vlan, port;
+        if (!getPort(members[i].first, vlan) || !getPort(members[i].second, port))
+        {
+            SWSS_LOG_ERROR("Failed to locate VLAN %s or member %s",
+                    members[i].first.c_str(), members[i].second.c_str());
+            continue;
+        }
+
+        vector<sai_attribute_t> attrs = getVlanMemberAttrs(vlan, port, tagging_mode, sai_tagging_modes[i]);
+        vlanMemberBulker.create_entry(&statuses[i], &member_ids[i], (uint32_t)attrs.size(), attrs.data());
+        queued[i] = true;
+    }
+
+    vlanMemberBulker.flush();
+
+    bool success = true;
+    for (size_t i = 0; i < members.size(); i++)
+    {
+        if (!queued[i])
+        {
+            success = false;
+            continue;
+        }
+
+        /* Earlier members of the batch may have updated the VLAN and the port */
+        Port vlan, port;
+        getPort(members[i].first, vlan);
+        getPort(members[i].second, port);
+
+        if (statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to add member %s to VLAN %s vid:%hu pid:%" PRIx64 ": %s",
+                    port.m_alias.c_str(), vlan.m_alias.c_str(), vlan.m_vlan_info.vlan_id, port.m_port_id,
+                    sai_serialize_status(statuses[i]).c_str());
+
+            /* Members after a failure in the same bulk call were not attempted */
+            if (statuses[i] == SAI_STATUS_NOT_EXECUTED)
+            {
+                success = false;
+                continue;
+            }
+
+            task_process_status handle_status = handleSaiCreateStatus(SAI_API_VLAN, statuses[i]);
+            if (handle_status != task_success && !parseHandleSaiStatusFailure(handle_status))
+            {
+                success = false;
+            }
+            continue;
+        }
+
+        if (!addVlanMemberPost(vlan, port, member_ids[i], sai_tagging_modes[i]))
+        {
+            success = false;
+        }
+    }
+
+    return success;
+}
+
+vector<sai_attribute_t> PortsOrch::getVlanMemberAttrs(Port &vlan, Port &port, const string &tagging_mode, sai_vlan_tagging_mode_t &sai_tagging_mode)
+{
     sai_attribute_t attr;
     vector<sai_attribute_t> attrs;
 
@@ -7702,8 +8219,7 @@ bool PortsOrch::addVlanMember(Port &vlan, Port &port, string &tagging_mode, stri
     attr.value.oid = port.m_bridge_port_id;
     attrs.push_back(attr);
 
-
-    sai_vlan_tagging_mode_t sai_tagging_mode = SAI_VLAN_TAGGING_MODE_TAGGED;
+    sai_tagging_mode = SAI_VLAN_TAGGING_MODE_TAGGED;
     attr.id = SAI_VLAN_MEMBER_ATTR_VLAN_TAGGING_MODE;
     if (tagging_mode == "untagged")
         sai_tagging_mode = SAI_VLAN_TAGGING_MODE_UNTAGGED;
@@ -7723,18 +8239,11 @@ bool PortsOrch::addVlanMember(Port &vlan, Port &port, string &tagging_mode, stri
         attrs.push_back(attr);
     }
 
-    sai_object_id_t vlan_member_id;
-    sai_status_t status = sai_vlan_api->create_vlan_member(&vlan_member_id, gSwitchId, (uint32_t)attrs.size(), attrs.data());
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_ERROR("Failed to add member %s to VLAN %s vid:%hu pid:%" PRIx64,
-                port.m_alias.c_str(), vlan.m_alias.c_str(), vlan.m_vlan_info.vlan_id, port.m_port_id);
-        task_process_status handle_status = handleSaiCreateStatus(SAI_API_VLAN, status);
-        if (handle_status != task_success)
-        {
-            return parseHandleSaiStatusFailure(handle_status);
-        }
-    }
+    return attrs;
+}
+
+bool PortsOrch::addVlanMemberPost(Port &vlan, Port &port, sai_object_id_t vlan_member_id, sai_vlan_tagging_mode_t sai_tagging_mode)
+{
     SWSS_LOG_NOTICE("Add member %s to VLAN %s vid:%hu pid%" PRIx64,
             port.m_alias.c_str(), vlan.m_alias.c_str(), vlan.m_vlan_info.vlan_id, port.m_port_id);
 
@@ -8647,6 +9156,7 @@ void PortsOrch::generateQueueMapPerPort(const Port& port, FlexCounterQueueStates
     vector<FieldValueTuple> queueIndexVector;
     vector<FieldValueTuple> queueTypeVector;
     std::vector<sai_object_id_t> queue_ids;
+    std::map<sai_queue_type_t, std::vector<sai_object_id_t>> flexCounterQueueIds;
 
     if (voq)
     {
@@ -8692,7 +9202,7 @@ void PortsOrch::generateQueueMapPerPort(const Port& port, FlexCounterQueueStates
             // Install a flex counter for this voq to track stats. Voq counters do
             // not have buffer queue config. So it does not get enabled through the
             // flexcounter orch logic. Always enabled voq counters.
-            addQueueFlexCountersPerPortPerQueueIndex(port, queueIndex, true, queueType);
+            flexCounterQueueIds[queueType].push_back(queue_ids[queueIndex]);
             queuePortVector.emplace_back(id, sai_serialize_object_id(port.m_system_port_oid));
         }
         else
@@ -8705,12 +9215,14 @@ void PortsOrch::generateQueueMapPerPort(const Port& port, FlexCounterQueueStates
             // counter on voq systems.
             if (gMySwitchType == "voq")
             {
-               addQueueFlexCountersPerPortPerQueueIndex(port, queueIndex, false, queueType);
+               flexCounterQueueIds[queueType].push_back(queue_ids[queueIndex]);
             }
             queuePortVector.emplace_back(id, sai_serialize_object_id(port.m_port_id));
         }
     }
 
+    addQueueFlexCountersPerQueueType(flexCounterQueueIds, voq);
+
     if (voq)
     {
         m_voqTable->set("", queueVector);
@@ -8769,6 +9281,8 @@ void PortsOrch::addQueueFlexCounters(map<string, FlexCounterQueueStates> queuesS
 
 void PortsOrch::addQueueFlexCountersPerPort(const Port& port, FlexCounterQueueStates& queuesState)
 {
+    std::map<sai_queue_type_t, std::vector<sai_object_id_t>> queueIds;
+
     for (size_t queueIndex = 0; queueIndex < port.m_queue_ids.size(); ++queueIndex)
     {
         sai_queue_type_t queueType;
@@ -8780,15 +9294,22 @@ void PortsOrch::addQueueFlexCountersPerPort(const Port& port, FlexCounterQueueSt
                 continue;
             }
             // Install a flex counter for this queue to track stats
-            addQueueFlexCountersPerPortPerQueueIndex(port, queueIndex, false, queueType);
+            queueIds[queueType].push_back(port.m_queue_ids[queueIndex]);
         }
     }
+
+    addQueueFlexCountersPerQueueType(queueIds, false);
 }
 
 void PortsOrch::addQueueFlexCountersPerPortPerQueueIndex(const Port& port, size_t queueIndex, bool voq, sai_queue_type_t queueType)
+{
+    auto queue_id = voq ? m_port_voq_ids[port.m_alias][queueIndex] : port.m_queue_ids[queueIndex];
+    addQueueFlexCountersPerQueueType({{queueType, {queue_id}}}, voq);
+}
+
+void PortsOrch::addQueueFlexCountersPerQueueType(const std::map<sai_queue_type_t, std::vector<sai_object_id_t>>& queueIds, bool voq)
 {
     std::unordered_set<string> counter_stats;
-    std::vector<sai_object_id_t> queue_ids;
 
     for (const auto& it: queue_stat_ids)
     {
@@ -8800,14 +9321,12 @@ void PortsOrch::addQueueFlexCountersPerPortPerQueueIndex(const Port& port, size_
         {
             counter_stats.emplace(sai_serialize_queue_stat(voq_it));
         }
-        queue_ids = m_port_voq_ids[port.m_alias];
     }
-    else
+
+    for (const auto& it: queueIds)
     {
-        queue_ids = port.m_queue_ids;
+        queue_stat_manager.setCounterIdList(it.second, CounterType::QUEUE, counter_stats, it.first);
     }
-
-    queue_stat_manager.setCounterIdList(queue_ids[queueIndex], CounterType::QUEUE, counter_stats, queueType);
 }
 
 
@@ -8854,6 +9373,7 @@ void PortsOrch::addQueueWatermarkFlexCounters(map<string, FlexCounterQueueStates
 void PortsOrch::addQueueWatermarkFlexCountersPerPort(const Port& port, FlexCounterQueueStates& queuesState)
 {
     /* Add stat counters to flex_counter */
+    std::map<sai_queue_type_t, std::vector<sai_object_id_t>> queueIds;
 
     for (size_t queueIndex = 0; queueIndex < port.m_queue_ids.size(); ++queueIndex)
     {
@@ -8865,15 +9385,25 @@ void PortsOrch::addQueueWatermarkFlexCountersPerPort(const Port& port, FlexCount
             {
                 continue;
             }
-            addQueueWatermarkFlexCountersPerPortPerQueueIndex(port, queueIndex, queueType);
+            queueIds[queueType].push_back(port.m_queue_ids[queueIndex]);
         }
     }
+
+    addQueueWatermarkFlexCountersPerQueueType(queueIds);
 }
 
 void PortsOrch::addQueueWatermarkFlexCountersPerPortPerQueueIndex(const Port& port, size_t queueIndex, sai_queue_type_t queueType)
+{
+    addQueueWatermarkFlexCountersPerQueueType({{queueType, {port.m_queue_ids[queueIndex]}}});
+}
+
+void PortsOrch::addQueueWatermarkFlexCountersPerQueueType(const std::map<sai_queue_type_t, std::vector<sai_object_id_t>>& queueIds)
 {
     auto queue_counter_stats = generateCounterStats(queueWatermarkStatIds, sai_serialize_queue_stat);
-    queue_watermark_manager.setCounterIdList(port.m_queue_ids[queueIndex], CounterType::QUEUE, queue_counter_stats, queueType);
+    for (const auto& it: queueIds)
+    {
+        queue_watermark_manager.setCounterIdList(it.second, CounterType::QUEUE, queue_counter_stats, it.first);
+    }
 }
 
 void PortsOrch::createPortBufferQueueCounters(const Port &port, string queues, bool skip_host_tx_queue)
@@ -9175,20 +9705,29 @@ void PortsOrch::addPriorityGroupFlexCounters(map<string, FlexCounterPgStates> pg
 
 void PortsOrch::addPriorityGroupFlexCountersPerPort(const Port& port, FlexCounterPgStates& pgsState)
 {
+    std::vector<sai_object_id_t> pgIds;
+
     for (size_t pgIndex = 0; pgIndex < port.m_priority_group_ids.size(); ++pgIndex)
     {
         if (!pgsState.isPgCounterEnabled(static_cast<uint32_t>(pgIndex)))
         {
             continue;
         }
-        addPriorityGroupFlexCountersPerPortPerPgIndex(port, pgIndex);
+        pgIds.push_back(port.m_priority_group_ids[pgIndex]);
     }
+
+    addPriorityGroupFlexCountersPerPgIds(pgIds);
 }
 
 void PortsOrch::addPriorityGroupFlexCountersPerPortPerPgIndex(const Port& port, size_t pgIndex)
+{
+    addPriorityGroupFlexCountersPerPgIds({port.m_priority_group_ids[pgIndex]});
+}
+
+void PortsOrch::addPriorityGroupFlexCountersPerPgIds(const std::vector<sai_object_id_t>& pgIds)
 {
     auto pg_counter_stats = generateCounterStats(ingressPriorityGroupDropStatIds, sai_serialize_ingress_priority_group_stat);
-    pg_drop_stat_manager.setCounterIdList(port.m_priority_group_ids[pgIndex], CounterType::PRIORITY_GROUP, pg_counter_stats);
+    pg_drop_stat_manager.setCounterIdList(pgIds, CounterType::PRIORITY_GROUP, pg_counter_stats);
 }
 
 void PortsOrch::addPriorityGroupWatermarkFlexCounters(map<string, FlexCounterPgStates> pgsStateVector)
@@ -9231,20 +9770,29 @@ void PortsOrch::addPriorityGroupWatermarkFlexCountersPerPort(const Port& port, F
 {
     /* Add stat counters to flex_counter */
 
+    std::vector<sai_object_id_t> pgIds;
+
     for (size_t pgIndex = 0; pgIndex < port.m_priority_group_ids.size(); ++pgIndex)
     {
         if (!pgsState.isPgCounterEnabled(static_cast<uint32_t>(pgIndex)))
         {
             continue;
         }
-        addPriorityGroupWatermarkFlexCountersPerPortPerPgIndex(port, pgIndex);
+        pgIds.push_back(port.m_priority_group_ids[pgIndex]);
     }
+
+    addPriorityGroupWatermarkFlexCountersPerPgIds(pgIds);
 }
 
 void PortsOrch::addPriorityGroupWatermarkFlexCountersPerPortPerPgIndex(const Port& port, size_t pgIndex)
+{
+    addPriorityGroupWatermarkFlexCountersPerPgIds({port.m_priority_group_ids[pgIndex]});
+}
+
+void PortsOrch::addPriorityGroupWatermarkFlexCountersPerPgIds(const std::vector<sai_object_id_t>& pgIds)
 {
     auto pg_counter_stats = generateCounterStats(ingressPriorityGroupWatermarkStatIds, sai_serialize_ingress_priority_group_stat);
-    pg_watermark_manager.setCounterIdList(port.m_priority_group_ids[pgIndex], CounterType::PRIORITY_GROUP, pg_counter_stats);
+    pg_watermark_manager.setCounterIdList(pgIds, CounterType::PRIORITY_GROUP, pg_counter_stats);
 }
 
 void PortsOrch::removePortBufferPgCounters(const Port& port, string pgs)
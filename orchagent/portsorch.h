@@ -2,6 +2,7 @@
 #define SWSS_PORTSORCH_H
 
 #include <map>
+#include <chrono>
 #include <unordered_set>
 
 #include "acltable.h"
@@ -268,6 +269,7 @@ public:
     bool addBridgePort(Port &port);
     bool removeBridgePort(Port &port);
     bool addVlanMember(Port &vlan, Port &port, string& tagging_mode, string end_point_ip = "");
+    bool addVlanMembers(const vector<pair<string, string>> &members, string &tagging_mode);
     bool removeVlanMember(Port &vlan, Port &port, string end_point_ip = "");
     bool isVlanMember(Port &vlan, Port &port, string end_point_ip = "");
     bool addVlanFloodGroups(Port &vlan, Port &port, string end_point_ip);
@@ -444,6 +446,8 @@ private:
     void removeDefaultBridgePorts();
 
     bool initializePorts(std::vector<Port>& ports);
+    bool initializePortStateBulk(std::vector<Port>& ports);
+    void initializePortCapabilitiesBulk(std::vector<Port>& ports);
     void initializePriorityGroupsBulk(std::vector<Port>& ports);
     void initializeQueuesBulk(std::vector<Port>& ports);
     void initializeSchedulerGroupsBulk(std::vector<Port>& ports);
@@ -460,6 +464,8 @@ private:
 
     bool addVlan(string vlan);
     bool removeVlan(Port vlan);
+    vector<sai_attribute_t> getVlanMemberAttrs(Port &vlan, Port &port, const string &tagging_mode, sai_vlan_tagging_mode_t &sai_tagging_mode);
+    bool addVlanMemberPost(Port &vlan, Port &port, sai_object_id_t vlan_member_id, sai_vlan_tagging_mode_t sai_tagging_mode);
 
     bool addLag(string lag, uint32_t spa_id, int32_t switch_id);
     bool removeLag(Port lag);
@@ -471,6 +477,7 @@ private:
 
     sai_status_t removePort(sai_object_id_t port_id);
     bool initExistingPort(const PortConfig &port);
+    bool initExistingPortsBulk(const std::vector<PortConfig> &portList);
     bool initPortsBulk(std::vector<Port>& ports);
     void registerPort(Port &p);
     
@@ -504,10 +511,12 @@ private:
     bool isSpeedSupported(const std::string& alias, sai_object_id_t port_id, sai_uint32_t speed);
     void getPortSupportedSpeeds(const std::string& alias, sai_object_id_t port_id, PortSupportedSpeeds &supported_speeds);
     void initPortSupportedSpeeds(const std::string& alias, sai_object_id_t port_id);
+    void setPortSupportedSpeeds(const std::string& alias, sai_object_id_t port_id, const PortSupportedSpeeds &supported_speeds);
     // Get supported FEC modes on system side
     bool isFecModeSupported(const Port &port, sai_port_fec_mode_t fec_mode);
     sai_status_t getPortSupportedFecModes(PortSupportedFecModes &supported_fecmodes, sai_object_id_t port_id);
     void initPortSupportedFecModes(const std::string& alias, sai_object_id_t port_id);
+    void setPortSupportedFecModes(const std::string& alias, sai_object_id_t port_id, sai_status_t status, const PortSupportedFecModes &supported_fecmodes);
     task_process_status setPortSpeed(Port &port, sai_uint32_t speed);
     bool getPortSpeed(sai_object_id_t id, sai_uint32_t &speed);
     bool setGearboxPortsAttr(const Port &port, sai_port_attr_t id, void *value, bool override_fec=true);
@@ -524,10 +533,12 @@ private:
     bool m_isQueueFlexCountersAdded = false;
     void addQueueFlexCountersPerPort(const Port& port, FlexCounterQueueStates& queuesState);
     void addQueueFlexCountersPerPortPerQueueIndex(const Port& port, size_t queueIndex, bool voq, sai_queue_type_t queueType);
+    void addQueueFlexCountersPerQueueType(const std::map<sai_queue_type_t, std::vector<sai_object_id_t>>& queueIds, bool voq);
 
     bool m_isQueueWatermarkFlexCountersAdded = false;
     void addQueueWatermarkFlexCountersPerPort(const Port& port, FlexCounterQueueStates& queuesState);
     void addQueueWatermarkFlexCountersPerPortPerQueueIndex(const Port& port, size_t queueIndex, sai_queue_type_t queueType);
+    void addQueueWatermarkFlexCountersPerQueueType(const std::map<sai_queue_type_t, std::vector<sai_object_id_t>>& queueIds);
 
     bool m_isWredQueueCounterMapGenerated = false;
     void addWredQueueFlexCountersPerPort(const Port& port, FlexCounterQueueStates& queuesState, bool voq = false);
@@ -538,10 +549,12 @@ private:
     bool m_isPriorityGroupFlexCountersAdded = false;
     void addPriorityGroupFlexCountersPerPort(const Port& port, FlexCounterPgStates& pgsState);
     void addPriorityGroupFlexCountersPerPortPerPgIndex(const Port& port, size_t pgIndex);
+    void addPriorityGroupFlexCountersPerPgIds(const std::vector<sai_object_id_t>& pgIds);
 
     bool m_isPriorityGroupWatermarkFlexCountersAdded = false;
     void addPriorityGroupWatermarkFlexCountersPerPort(const Port& port, FlexCounterPgStates& pgsState);
     void addPriorityGroupWatermarkFlexCountersPerPortPerPgIndex(const Port& port, size_t pgIndex);
+    void addPriorityGroupWatermarkFlexCountersPerPgIds(const std::vector<sai_object_id_t>& pgIds);
 
     bool m_isPortCounterMapGenerated = false;
     bool m_isPortBufferDropCounterMapGenerated = false;
@@ -665,6 +678,11 @@ private:
     PortHelper m_portHlpr;
     bool m_isWarmRestoreStage = false;
 
+    // Time spent in each port bring-up stage since the last report, in microseconds
+    std::vector<std::pair<std::string, uint64_t>> m_portInitStageUsec;
+    void addPortInitStageTime(const std::string &stage, const std::chrono::steady_clock::time_point &start);
+    void reportPortInitStageTimes(const std::string &context);
+
     // Friend declaration for unit tests
     friend class portphyattr_test::PortAttrTest;
     friend class portphyserdesattr_test::PortSerdesAttrTest;
@@ -0,0 +1,349 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <array>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "ipaddress.h"
+#include "ipprefix.h"
+
+extern "C" {
+#include "sai.h"
+}
+
+/*
+ * Path compressed binary trie (Patricia trie) of IP prefixes.
+ *
+ * Every node stores the bits it covers, so a lookup visits at most one node
+ * per distinct prefix length on its path: longest match, covering prefixes
+ * and more specifics are all O(prefix length), independent of the number of
+ * prefixes stored. IPv4 and IPv6 prefixes live in separate trees.
+ */
+template <typename T>
+class PrefixTrie
+{
+public:
+    PrefixTrie() = default;
+    PrefixTrie(PrefixTrie&&) = default;
+    PrefixTrie& operator=(PrefixTrie&&) = default;
+    PrefixTrie(const PrefixTrie&) = delete;
+    PrefixTrie& operator=(const PrefixTrie&) = delete;
+
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    void clear()
+    {
+        m_roots[0].reset();
+        m_roots[1].reset();
+        m_size = 0;
+    }
+
+    /* Adds the prefix or replaces its value, returns true if it was added */
+    bool insert(const swss::IpPrefix &prefix, const T &value)
+    {
+        Key key = toKey(prefix.getIp());
+        uint8_t len = static_cast<uint8_t>(prefix.getMaskLength());
+        mask(key, len);
+
+        std::unique_ptr<Node> *slot = &m_roots[prefix.isV4() ? 0 : 1];
+        while (true)
+        {
+            Node *node = slot->get();
+            if (!node)
+            {
+                slot->reset(new Node(key, len));
+                (*slot)->setValue(prefix, value);
+                m_size++;
+                return true;
+            }
+
+            uint8_t common = commonLength(node->key, key, std::min(node->len, len));
+            if (common == node->len)
+            {
+                if (len == node->len)
+                {
+                    bool added = !node->has_value;
+                    node->setValue(prefix, value);
+                    m_size += added;
+                    return added;
+                }
+                slot = &node->child[bit(key, node->len)];
+                continue;
+            }
+
+            /* The new prefix and the node diverge, or the new prefix covers the node */
+            Key split_key = key;
+            mask(split_key, common);
+            std::unique_ptr<Node> split(new Node(split_key, common));
+            split->child[bit(node->key, common)] = std::move(*slot);
+            if (common == len)
+            {
+                split->setValue(prefix, value);
+            }
+            else
+            {
+                auto &leaf = split->child[bit(key, common)];
+                leaf.reset(new Node(key, len));
+                leaf->setValue(prefix, value);
+            }
+            *slot = std::move(split);
+            m_size++;
+            return true;
+        }
+    }
+
+    /* Removes the prefix, returns true if it was present */
+    bool erase(const swss::IpPrefix &prefix)
+    {
+        Key key = toKey(prefix.getIp());
+        uint8_t len = static_cast<uint8_t>(prefix.getMaskLength());
+
+        std::vector<std::unique_ptr<Node> *> path;
+        std::unique_ptr<Node> *slot = &m_roots[prefix.isV4() ? 0 : 1];
+        while (*slot && (*slot)->len <= len && commonLength((*slot)->key, key, (*slot)->len) == (*slot)->len)
+        {
+            path.push_back(slot);
+            if ((*slot)->len == len)
+            {
+                break;
+            }
+            slot = &(*slot)->child[bit(key, (*slot)->len)];
+        }
+
+        if (path.empty() || path.back()->get()->len != len || !path.back()->get()->has_value)
+        {
+            return false;
+        }
+
+        path.back()->get()->clearValue();
+        m_size--;
+
+        /* Drop the nodes left without a value and with fewer than two children */
+        while (!path.empty())
+        {
+            slot = path.back();
+            path.pop_back();
+
+            Node *node = slot->get();
+            if (node->has_value || (node->child[0] && node->child[1]))
+            {
+                break;
+            }
+            std::unique_ptr<Node> child = std::move(node->child[node->child[0] ? 0 : 1]);
+            *slot = std::move(child);
+        }
+
+        return true;
+    }
+
+    /* Returns the value stored for exactly this prefix */
+    const T *find(const swss::IpPrefix &prefix) const
+    {
+        Key key = toKey(prefix.getIp());
+        uint8_t len = static_cast<uint8_t>(prefix.getMaskLength());
+
+        const Node *node = m_roots[prefix.isV4() ? 0 : 1].get();
+        while (node && node->len <= len && commonLength(node->key, key, node->len) == node->len)
+        {
+            if (node->len == len)
+            {
+                return node->has_value ? &node->value : nullptr;
+            }
+            node = node->child[bit(key, node->len)].get();
+        }
+        return nullptr;
+    }
+
+    T *find(const swss::IpPrefix &prefix)
+    {
+        return const_cast<T *>(static_cast<const PrefixTrie *>(this)->find(prefix));
+    }
+
+    /* Longest stored prefix that contains the address */
+    const T *longestMatch(const swss::IpAddress &ip, swss::IpPrefix *match = nullptr) const
+    {
+        return longestMatch(ip, ip.isV4() ? 32 : 128, match);
+    }
+
+    /* Longest stored prefix that contains the whole prefix, the prefix itself included */
+    const T *coveringPrefix(const swss::IpPrefix &prefix, swss::IpPrefix *match = nullptr) const
+    {
+        return longestMatch(prefix.getIp(), static_cast<uint8_t>(prefix.getMaskLength()), match);
+    }
+
+    /* Calls fn(prefix, value) for every stored prefix containing the address, shortest first */
+    template <typename Fn>
+    void forEachCovering(const swss::IpAddress &ip, Fn fn) const
+    {
+        forEachNodeCovering(ip, ip.isV4() ? 32 : 128, [&fn](const Node *node) { fn(node->prefix, node->value); });
+    }
+
+    /* Calls fn(prefix, value) for every stored prefix inside the prefix, the prefix itself included */
+    template <typename Fn>
+    void forEachMoreSpecific(const swss::IpPrefix &prefix, Fn fn) const
+    {
+        Key key = toKey(prefix.getIp());
+        uint8_t len = static_cast<uint8_t>(prefix.getMaskLength());
+
+        const Node *node = m_roots[prefix.isV4() ? 0 : 1].get();
+        while (node)
+        {
+            if (node->len >= len)
+            {
+                if (commonLength(node->key, key, len) == len)
+                {
+                    visit(node, fn);
+                }
+                return;
+            }
+            if (commonLength(node->key, key, node->len) != node->len)
+            {
+                return;
+            }
+            node = node->child[bit(key, node->len)].get();
+        }
+    }
+
+private:
+    typedef std::array<uint8_t, 16> Key;
+
+    struct Node
+    {
+        Node(const Key &key, uint8_t len) : key(key), len(len) {}
+
+        void setValue(const swss::IpPrefix &p, const T &v)
+        {
+            prefix = p;
+            value = v;
+            has_value = true;
+        }
+
+        void clearValue()
+        {
+            prefix = swss::IpPrefix();
+            value = T();
+            has_value = false;
+        }
+
+        Key key;
+        uint8_t len;
+        bool has_value = false;
+        swss::IpPrefix prefix;
+        T value = T();
+        std::unique_ptr<Node> child[2];
+    };
+
+    static Key toKey(const swss::IpAddress &ip)
+    {
+        Key key{};
+        if (ip.isV4())
+        {
+            uint32_t addr = ip.getV4Addr();
+            memcpy(key.data(), &addr, sizeof(addr));
+        }
+        else
+        {
+            memcpy(key.data(), ip.getV6Addr(), key.size());
+        }
+        return key;
+    }
+
+    static uint8_t bit(const Key &key, uint8_t pos)
+    {
+        return (key[pos / 8] >> (7 - pos % 8)) & 1;
+    }
+
+    static void mask(Key &key, uint8_t len)
+    {
+        for (size_t i = len / 8; i < key.size(); i++)
+        {
+            key[i] = (i == len / 8) ? static_cast<uint8_t>(key[i] & (0xff << (8 - len % 8))) : 0;
+        }
+    }
+
+    /* Number of leading bits a and b share, at most limit */
+    static uint8_t commonLength(const Key &a, const Key &b, uint8_t limit)
+    {
+        uint8_t len = 0;
+        for (size_t i = 0; len < limit; i++, len += 8)
+        {
+            uint8_t diff = a[i] ^ b[i];
+            if (diff)
+            {
+                len = static_cast<uint8_t>(len + __builtin_clz(diff) - 24);
+                break;
+            }
+        }
+        return std::min(len, limit);
+    }
+
+    const T *longestMatch(const swss::IpAddress &ip, uint8_t len, swss::IpPrefix *match) const
+    {
+        const Node *best = nullptr;
+        forEachNodeCovering(ip, len, [&best](const Node *node) { best = node; });
+        if (!best)
+        {
+            return nullptr;
+        }
+        if (match)
+        {
+            *match = best->prefix;
+        }
+        return &best->value;
+    }
+
+    template <typename Fn>
+    void forEachNodeCovering(const swss::IpAddress &ip, uint8_t len, Fn fn) const
+    {
+        Key key = toKey(ip);
+
+        const Node *node = m_roots[ip.isV4() ? 0 : 1].get();
+        while (node && node->len <= len && commonLength(node->key, key, node->len) == node->len)
+        {
+            if (node->has_value)
+            {
+                fn(node);
+            }
+            if (node->len == len)
+            {
+                break;
+            }
+            node = node->child[bit(key, node->len)].get();
+        }
+    }
+
+    template <typename Fn>
+    static void visit(const Node *node, Fn &fn)
+    {
+        if (node->has_value)
+        {
+            fn(node->prefix, node->value);
+        }
+        for (const auto &child : node->child)
+        {
+            if (child)
+            {
+                visit(child.get(), fn);
+            }
+        }
+    }
+
+    std::unique_ptr<Node> m_roots[2];
+    size_t m_size = 0;
+};
+
+/* One trie per virtual router */
+template <typename T>
+using VrfPrefixTrie = std::map<sai_object_id_t, PrefixTrie<T>>;
@@ -16,6 +16,90 @@ using namespace std;
 using namespace swss;
 
 
+void Request::compileDescription()
+{
+    size_t counts[REQ_T_STRING_LIST + 1] = {};
+
+    for (const auto& item: request_description_.attr_item_types)
+    {
+        attr_slots_[item.first] = { item.second, counts[item.second]++, attr_slot_names_.size() };
+        attr_slot_names_.push_back(&item.first);
+    }
+    number_of_attrs_ = attr_slot_names_.size();
+    attr_present_.assign(number_of_attrs_, false);
+
+    attr_item_strings_.resize(counts[REQ_T_STRING]);
+    attr_item_bools_.resize(counts[REQ_T_BOOL]);
+    attr_item_bool_list_.resize(counts[REQ_T_BOOL_LIST]);
+    attr_item_mac_addresses_.resize(counts[REQ_T_MAC_ADDRESS]);
+    attr_item_packet_actions_.resize(counts[REQ_T_PACKET_ACTION]);
+    attr_item_vlan_.resize(counts[REQ_T_VLAN]);
+    attr_item_ip_.resize(counts[REQ_T_IP]);
+    attr_item_ip_prefix_.resize(counts[REQ_T_IP_PREFIX]);
+    attr_item_uint_.resize(counts[REQ_T_UINT]);
+    attr_item_set_.resize(counts[REQ_T_SET]);
+    attr_item_ip_list_.resize(counts[REQ_T_IP_LIST]);
+    attr_item_mac_addresses_list_.resize(counts[REQ_T_MAC_ADDRESS_LIST]);
+    attr_item_uint_list_.resize(counts[REQ_T_UINT_LIST]);
+    attr_item_string_list_.resize(counts[REQ_T_STRING_LIST]);
+
+    key_item_strings_.resize(number_of_key_items_);
+    key_item_mac_addresses_.resize(number_of_key_items_);
+    key_item_ip_addresses_.resize(number_of_key_items_);
+    key_item_ip_prefix_.resize(number_of_key_items_);
+    key_item_uint_.resize(number_of_key_items_);
+}
+
+size_t Request::getAttrSlot(const std::string& attr_name, request_types_t type) const
+{
+    const auto slot = attr_slots_.find(attr_name);
+    if (slot == attr_slots_.end() || slot->second.type != type || !attr_present_[slot->second.id])
+    {
+        throw std::out_of_range(std::string("Attribute not found: ") + attr_name);
+    }
+
+    return slot->second.index;
+}
+
+size_t Request::getKeySlot(int position, request_types_t type) const
+{
+    if (position < 0 || static_cast<size_t>(position) >= number_of_key_items_ ||
+        request_description_.key_item_types[position] != type)
+    {
+        throw std::out_of_range(std::string("Key item not found at position ") + std::to_string(position));
+    }
+
+    return static_cast<size_t>(position);
+}
+
+const std::unordered_set<std::string>& Request::getAttrFieldNames() const
+{
+    assert(is_parsed_);
+
+    if (!attr_names_valid_)
+    {
+        attr_names_.clear();
+        for (size_t id = 0; id < number_of_attrs_; id++)
+        {
+            if (attr_present_[id])
+            {
+                attr_names_.insert(*attr_slot_names_[id]);
+            }
+        }
+        attr_names_valid_ = true;
+    }
+
+    return attr_names_;
+}
+
+bool Request::hasAttr(const std::string& attr_name) const
+{
+    assert(is_parsed_);
+
+    const auto slot = attr_slots_.find(attr_name);
+    return slot != attr_slots_.end() && attr_present_[slot->second.id];
+}
+
 void Request::parse(const KeyOpFieldsValuesTuple& request)
 {
     if (is_parsed_)
@@ -23,6 +107,15 @@ void Request::parse(const KeyOpFieldsValuesTuple& request)
         throw std::logic_error("The parser already has a parsed request");
     }
 
+    if (!is_compiled_)
+    {
+        compileDescription();
+        is_compiled_ = true;
+    }
+    // a request which failed to parse may have left attributes behind
+    attr_present_.assign(number_of_attrs_, false);
+    attr_names_valid_ = false;
+
     parseOperation(request);
     parseKey(request);
     parseAttrs(request);
@@ -34,14 +127,8 @@ void Request::clear()
 {
     operation_.clear();
     full_key_.clear();
-    attr_names_.clear();
-    key_item_strings_.clear();
-    key_item_mac_addresses_.clear();
-    attr_item_strings_.clear();
-    attr_item_bools_.clear();
-    attr_item_mac_addresses_.clear();
-    attr_item_packet_actions_.clear();
-    attr_item_string_list_.clear();
+    attr_present_.assign(number_of_attrs_, false);
+    attr_names_valid_ = false;
 
     is_parsed_ = false;
 }
@@ -59,17 +146,25 @@ void Request::parseKey(const KeyOpFieldsValuesTuple& request)
 {
     full_key_ = kfvKey(request);
 
-    // split the key by separator
-    std::vector<std::string> key_items;
+    // split the key by separator, reusing the item buffers of the previous request
+    size_t key_item_count = 0;
+    auto add_key_item = [&](size_t start, size_t end) {
+        if (key_item_count == key_items_.size())
+        {
+            key_items_.emplace_back();
+        }
+        key_items_[key_item_count++].assign(full_key_, start, end - start);
+    };
+
     size_t key_item_start = 0;
     size_t key_item_end = full_key_.find(key_separator_);
     while (key_item_end != std::string::npos)
     {
-        key_items.push_back(full_key_.substr(key_item_start, key_item_end - key_item_start));
+        add_key_item(key_item_start, key_item_end);
         key_item_start = key_item_end + 1;
         key_item_end = full_key_.find(key_separator_, key_item_start);
     }
-    key_items.push_back(full_key_.substr(key_item_start, full_key_.length()));
+    add_key_item(key_item_start, full_key_.length());
 
     /*
      * Attempt to parse an IPv6/MAC address only if the following conditions are met:
@@ -85,25 +180,21 @@ void Request::parseKey(const KeyOpFieldsValuesTuple& request)
      *     - This runs under the assumption that an IPv6 address, if present, will always be the last key item
      */
     if (key_separator_ == ':' and 
-        key_items.size() > number_of_key_items_ and 
+        number_of_key_items_ > 0 and
+        key_item_count > number_of_key_items_ and 
         (request_description_.key_item_types.back() == REQ_T_IP or request_description_.key_item_types.back() == REQ_T_IP_PREFIX
         or request_description_.key_item_types.back() == REQ_T_MAC_ADDRESS or request_description_.key_item_types.back() == REQ_T_STRING))
     {
-        // Remove key_items so that key_items.size() is correct, then assemble the removed items into an IPv6 address
-        std::vector<std::string> ip_addr_groups(--key_items.begin() + number_of_key_items_, key_items.end());
-        key_items.erase(--key_items.begin() + number_of_key_items_, key_items.end());
-
-        std::string ip_string;
-
-        for (const auto &i : ip_addr_groups)
+        // Join the trailing items back into the last expected key item
+        std::string& ip_string = key_items_[number_of_key_items_ - 1];
+        for (size_t i = number_of_key_items_; i < key_item_count; i++)
         {
-            ip_string += i + ":";
+            ip_string += ':';
+            ip_string += key_items_[i];
         }
-        ip_string.pop_back(); // remove extra ":" from end of string
-
-        key_items.push_back(ip_string);
+        key_item_count = number_of_key_items_;
     }
-    if (key_items.size() != number_of_key_items_)
+    if (key_item_count != number_of_key_items_)
     {
         throw std::invalid_argument(std::string("Wrong number of key items. Expected ")
                                   + std::to_string(number_of_key_items_)
@@ -118,32 +209,33 @@ void Request::parseKey(const KeyOpFieldsValuesTuple& request)
         switch(request_description_.key_item_types[i])
         {
             case REQ_T_STRING:
-                key_item_strings_[i] = key_items[i];
+                key_item_strings_[i] = key_items_[i];
                 break;
             case REQ_T_MAC_ADDRESS:
-                key_item_mac_addresses_[i] = parseMacAddress(key_items[i]);
+                key_item_mac_addresses_[i] = parseMacAddress(key_items_[i]);
                 break;
             case REQ_T_IP:
-                key_item_ip_addresses_[i] = parseIpAddress(key_items[i]);
+                key_item_ip_addresses_[i] = parseIpAddress(key_items_[i]);
                 break;
             case REQ_T_IP_PREFIX:
-                key_item_ip_prefix_[i] = parseIpPrefix(key_items[i]);
+                key_item_ip_prefix_[i] = parseIpPrefix(key_items_[i]);
                 break;
             case REQ_T_UINT:
-                key_item_uint_[i] = parseUint(key_items[i]);
+                key_item_uint_[i] = parseUint(key_items_[i]);
                 break;
             default:
                 throw std::logic_error(std::string("Not implemented key type parser. Key '")
                                      + full_key_
                                      + std::string("'. Key item:")
-                                     + key_items[i]);
+                                     + key_items_[i]);
         }
     }
 }
 
 void Request::parseAttrs(const KeyOpFieldsValuesTuple& request)
 {
-    const auto not_found = std::end(request_description_.attr_item_types);
+    const auto not_found = std::end(attr_slots_);
+    size_t number_of_parsed_attrs = 0;
 
     for (auto i = kfvFieldsValues(request).begin();
          i != kfvFieldsValues(request).end(); i++)
@@ -154,7 +246,7 @@ void Request::parseAttrs(const KeyOpFieldsValuesTuple& request)
             // it's used when we don't have any attributes, but we have to provide one for redis
             continue;
         }
-        const auto item = request_description_.attr_item_types.find(fvField(*i));
+        const auto item = attr_slots_.find(fvField(*i));
         if (item == not_found)
         {
             if (!relaxed_attr_parsing_)
@@ -167,57 +259,62 @@ void Request::parseAttrs(const KeyOpFieldsValuesTuple& request)
             }
         }
 
-        attr_names_.insert(fvField(*i));
-        switch(item->second)
+        const AttrSlot& slot = item->second;
+        if (!attr_present_[slot.id])
+        {
+            attr_present_[slot.id] = true;
+            number_of_parsed_attrs++;
+        }
+        switch(slot.type)
         {
             case REQ_T_STRING:
-                attr_item_strings_[fvField(*i)] = fvValue(*i);
+                attr_item_strings_[slot.index] = fvValue(*i);
                 break;
             case REQ_T_BOOL:
-                attr_item_bools_[fvField(*i)] = parseBool(fvValue(*i));
+                attr_item_bools_[slot.index] = parseBool(fvValue(*i));
                 break;
             case REQ_T_MAC_ADDRESS:
-                attr_item_mac_addresses_[fvField(*i)] = parseMacAddress(fvValue(*i));
+                attr_item_mac_addresses_[slot.index] = parseMacAddress(fvValue(*i));
                 break;
             case REQ_T_PACKET_ACTION:
-                attr_item_packet_actions_[fvField(*i)] = parsePacketAction(fvValue(*i));
+                attr_item_packet_actions_[slot.index] = parsePacketAction(fvValue(*i));
                 break;
             case REQ_T_VLAN:
-                attr_item_vlan_[fvField(*i)] = parseVlan(fvValue(*i));
+                attr_item_vlan_[slot.index] = parseVlan(fvValue(*i));
                 break;
             case REQ_T_IP:
-                attr_item_ip_[fvField(*i)] = parseIpAddress(fvValue(*i));
+                attr_item_ip_[slot.index] = parseIpAddress(fvValue(*i));
                 break;
             case REQ_T_IP_PREFIX:
-                attr_item_ip_prefix_[fvField(*i)] = parseIpPrefix(fvValue(*i));
+                attr_item_ip_prefix_[slot.index] = parseIpPrefix(fvValue(*i));
                 break;
             case REQ_T_UINT:
-                attr_item_uint_[fvField(*i)] = parseUint(fvValue(*i));
+                attr_item_uint_[slot.index] = parseUint(fvValue(*i));
                 break;
             case REQ_T_SET:
-                attr_item_set_[fvField(*i)] = parseSet(fvValue(*i));
+                attr_item_set_[slot.index] = parseSet(fvValue(*i));
                 break;
             case REQ_T_MAC_ADDRESS_LIST:
-                attr_item_mac_addresses_list_[fvField(*i)] = parseMacAddressList(fvValue(*i));
+                attr_item_mac_addresses_list_[slot.index] = parseMacAddressList(fvValue(*i));
                 break;
             case REQ_T_IP_LIST:
-                attr_item_ip_list_[fvField(*i)] = parseIpAddressList(fvValue(*i));
+                attr_item_ip_list_[slot.index] = parseIpAddressList(fvValue(*i));
                 break;
             case REQ_T_UINT_LIST:
-                attr_item_uint_list_[fvField(*i)] = parseUintList(fvValue(*i));
+                attr_item_uint_list_[slot.index] = parseUintList(fvValue(*i));
                 break;
             case REQ_T_BOOL_LIST:
-                attr_item_bool_list_[fvField(*i)] = parseBoolList(fvValue(*i));
+                attr_item_bool_list_[slot.index] = parseBoolList(fvValue(*i));
                 break;
             case REQ_T_STRING_LIST:
-                attr_item_string_list_[fvField(*i)] = parseStringList(fvValue(*i));
+                attr_item_string_list_[slot.index] = parseStringList(fvValue(*i));
                 break;
             default:
                 throw std::logic_error(std::string("Not implemented attribute type parser for attribute:") + fvField(*i));
         }
     }
 
-    if (operation_ == DEL_COMMAND && attr_names_.size() > 0)
+    if (operation_ == DEL_COMMAND && number_of_parsed_attrs > 0)
     {
         throw std::invalid_argument("Delete operation request contains attributes");
     }
@@ -226,7 +323,8 @@ void Request::parseAttrs(const KeyOpFieldsValuesTuple& request)
     {
         for (const auto& attr: request_description_.mandatory_attr_items)
         {
-            if (attr_names_.find(attr) == std::end(attr_names_))
+            const auto item = attr_slots_.find(attr);
+            if (item == not_found || !attr_present_[item->second.id])
             {
                 throw std::invalid_argument(std::string("Mandatory attribute '") + attr + std::string("' not found"));
             }
@@ -358,7 +456,7 @@ uint16_t Request::parseVlan(const std::string& str)
 
 sai_packet_action_t Request::parsePacketAction(const std::string& str)
 {
-    std::unordered_map<std::string, sai_packet_action_t> m = {
+    static const std::unordered_map<std::string, sai_packet_action_t> m = {
         {"drop", SAI_PACKET_ACTION_DROP},
         {"forward", SAI_PACKET_ACTION_FORWARD},
         {"copy", SAI_PACKET_ACTION_COPY},
@@ -5,6 +5,8 @@
 #include "ipprefix.h"
 #include <sstream>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 typedef enum _request_types_t
@@ -54,91 +56,89 @@ public:
     const std::string& getKeyString(int position) const
     {
         assert(is_parsed_);
-        return key_item_strings_.at(position);
+        return key_item_strings_.at(getKeySlot(position, REQ_T_STRING));
     }
 
     const swss::MacAddress& getKeyMacAddress(int position) const
     {
         assert(is_parsed_);
-        return key_item_mac_addresses_.at(position);
+        return key_item_mac_addresses_.at(getKeySlot(position, REQ_T_MAC_ADDRESS));
     }
 
     const swss::IpAddress& getKeyIpAddress(int position) const
     {
         assert(is_parsed_);
-        return key_item_ip_addresses_.at(position);
+        return key_item_ip_addresses_.at(getKeySlot(position, REQ_T_IP));
     }
 
     const swss::IpPrefix& getKeyIpPrefix(int position) const
     {
         assert(is_parsed_);
-        return key_item_ip_prefix_.at(position);
+        return key_item_ip_prefix_.at(getKeySlot(position, REQ_T_IP_PREFIX));
     }
 
     const uint64_t& getKeyUint(int position) const
     {
         assert(is_parsed_);
-        return key_item_uint_.at(position);
+        return key_item_uint_.at(getKeySlot(position, REQ_T_UINT));
     }
 
-    const std::unordered_set<std::string>& getAttrFieldNames() const
-    {
-        assert(is_parsed_);
-        return attr_names_;
-    }
+    const std::unordered_set<std::string>& getAttrFieldNames() const;
+
+    bool hasAttr(const std::string& attr_name) const;
 
     const std::string& getAttrString(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_strings_.at(attr_name);
+        return attr_item_strings_[getAttrSlot(attr_name, REQ_T_STRING)];
     }
 
     bool getAttrBool(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_bools_.at(attr_name);
+        return attr_item_bools_[getAttrSlot(attr_name, REQ_T_BOOL)];
     }
 
     const swss::MacAddress& getAttrMacAddress(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_mac_addresses_.at(attr_name);
+        return attr_item_mac_addresses_[getAttrSlot(attr_name, REQ_T_MAC_ADDRESS)];
     }
 
     sai_packet_action_t getAttrPacketAction(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_packet_actions_.at(attr_name);
+        return attr_item_packet_actions_[getAttrSlot(attr_name, REQ_T_PACKET_ACTION)];
     }
 
     uint16_t getAttrVlan(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_vlan_.at(attr_name);
+        return attr_item_vlan_[getAttrSlot(attr_name, REQ_T_VLAN)];
     }
 
     swss::IpAddress getAttrIP(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_ip_.at(attr_name);
+        return attr_item_ip_[getAttrSlot(attr_name, REQ_T_IP)];
     }
 
     swss::IpPrefix getAttrIpPrefix(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_ip_prefix_.at(attr_name);
+        return attr_item_ip_prefix_[getAttrSlot(attr_name, REQ_T_IP_PREFIX)];
     }
 
     const uint64_t& getAttrUint(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_uint_.at(attr_name);
+        return attr_item_uint_[getAttrSlot(attr_name, REQ_T_UINT)];
     }
 
     const std::set<std::string>& getAttrSet(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_set_.at(attr_name);
+        return attr_item_set_[getAttrSlot(attr_name, REQ_T_SET)];
     }
 
     void setTableName(std::string& table_name)
@@ -155,31 +155,31 @@ public:
     const std::vector<swss::IpAddress>& getAttrIPList(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_ip_list_.at(attr_name);
+        return attr_item_ip_list_[getAttrSlot(attr_name, REQ_T_IP_LIST)];
     }
 
     const std::vector<swss::MacAddress>& getAttrMacAddressList(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_mac_addresses_list_.at(attr_name);
+        return attr_item_mac_addresses_list_[getAttrSlot(attr_name, REQ_T_MAC_ADDRESS_LIST)];
     }
 
     const std::vector<uint64_t>& getAttrUintList(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_uint_list_.at(attr_name);
+        return attr_item_uint_list_[getAttrSlot(attr_name, REQ_T_UINT_LIST)];
     }
 
     const std::vector<bool> getAttrBoolList(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_bool_list_.at(attr_name);
+        return attr_item_bool_list_[getAttrSlot(attr_name, REQ_T_BOOL_LIST)];
     }
 
     const std::vector<std::string>& getAttrStringList(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_string_list_.at(attr_name);
+        return attr_item_string_list_[getAttrSlot(attr_name, REQ_T_STRING_LIST)];
     }
 
 protected:
@@ -187,13 +187,33 @@ protected:
         : request_description_(request_description),
           key_separator_(key_separator),
           is_parsed_(false),
-          relaxed_attr_parsing_(relaxed_attr_parsing),
-          number_of_key_items_(request_description.key_item_types.size())
+          number_of_key_items_(request_description.key_item_types.size()),
+          relaxed_attr_parsing_(relaxed_attr_parsing)
     {
     }
 
 
 private:
+    /*
+     * The request description is compiled on the first parse into a slot per
+     * attribute.
+     * Parsed values live in per type arrays indexed by the slot, which keep
+     * their storage between requests, so parsing a request does not allocate
+     * besides growing strings and list values.
+     */
+    struct AttrSlot
+    {
+        request_types_t type;
+        // index into the value array of the type
+        size_t index;
+        // index into attr_present_
+        size_t id;
+    };
+
+    void compileDescription();
+    size_t getAttrSlot(const std::string& attr_name, request_types_t type) const;
+    size_t getKeySlot(int position, request_types_t type) const;
+
     void parseOperation(const swss::KeyOpFieldsValuesTuple& request);
     void parseKey(const swss::KeyOpFieldsValuesTuple& request);
     void parseAttrs(const swss::KeyOpFieldsValuesTuple& request);
@@ -219,30 +239,39 @@ private:
     // Enable if only interested in only a subset of attributes
     bool relaxed_attr_parsing_;
 
+    bool is_compiled_ = false;
+    std::unordered_map<std::string, AttrSlot> attr_slots_;
+    std::vector<const std::string *> attr_slot_names_;
+    std::vector<bool> attr_present_;
+    size_t number_of_attrs_ = 0;
+    mutable std::unordered_set<std::string> attr_names_;
+    mutable bool attr_names_valid_ = false;
+
     std::string table_name_;
     std::string operation_;
     std::string full_key_;
-    std::unordered_map<int, std::string> key_item_strings_;
-    std::unordered_map<int, swss::MacAddress> key_item_mac_addresses_;
-    std::unordered_map<int, swss::IpAddress> key_item_ip_addresses_;
-    std::unordered_map<int, swss::IpPrefix> key_item_ip_prefix_;
-    std::unordered_map<int, uint64_t> key_item_uint_;
-    std::unordered_set<std::string> attr_names_;
-    // FIXME: Make one union with all the values, except string
-    std::unordered_map<std::string, std::string> attr_item_strings_;
-    std::unordered_map<std::string, bool> attr_item_bools_;
-    std::unordered_map<std::string, std::vector<bool>> attr_item_bool_list_;
-    std::unordered_map<std::string, swss::MacAddress> attr_item_mac_addresses_;
-    std::unordered_map<std::string, sai_packet_action_t> attr_item_packet_actions_;
-    std::unordered_map<std::string, uint16_t> attr_item_vlan_;
-    std::unordered_map<std::string, swss::IpAddress> attr_item_ip_;
-    std::unordered_map<std::string, swss::IpPrefix> attr_item_ip_prefix_;
-    std::unordered_map<std::string, uint64_t> attr_item_uint_;
-    std::unordered_map<std::string, std::set<std::string>> attr_item_set_;
-    std::unordered_map<std::string, std::vector<swss::IpAddress>> attr_item_ip_list_;
-    std::unordered_map<std::string, std::vector<swss::MacAddress>> attr_item_mac_addresses_list_;
-    std::unordered_map<std::string, std::vector<uint64_t>> attr_item_uint_list_;
-    std::unordered_map<std::string, std::vector<std::string>> attr_item_string_list_;
+    std::vector<std::string> key_items_;
+    // Key values are indexed by the key position
+    std::vector<std::string> key_item_strings_;
+    std::vector<swss::MacAddress> key_item_mac_addresses_;
+    std::vector<swss::IpAddress> key_item_ip_addresses_;
+    std::vector<swss::IpPrefix> key_item_ip_prefix_;
+    std::vector<uint64_t> key_item_uint_;
+    // Attribute values are indexed by AttrSlot::index
+    std::vector<std::string> attr_item_strings_;
+    std::vector<bool> attr_item_bools_;
+    std::vector<std::vector<bool>> attr_item_bool_list_;
+    std::vector<swss::MacAddress> attr_item_mac_addresses_;
+    std::vector<sai_packet_action_t> attr_item_packet_actions_;
+    std::vector<uint16_t> attr_item_vlan_;
+    std::vector<swss::IpAddress> attr_item_ip_;
+    std::vector<swss::IpPrefix> attr_item_ip_prefix_;
+    std::vector<uint64_t> attr_item_uint_;
+    std::vector<std::set<std::string>> attr_item_set_;
+    std::vector<std::vector<swss::IpAddress>> attr_item_ip_list_;
+    std::vector<std::vector<swss::MacAddress>> attr_item_mac_addresses_list_;
+    std::vector<std::vector<uint64_t>> attr_item_uint_list_;
+    std::vector<std::vector<std::string>> attr_item_string_list_;
 };
 
 #endif // __REQUEST_PARSER_H
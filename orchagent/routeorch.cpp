@@ -142,6 +142,7 @@ RouteOrch::RouteOrch(DBConnector *db, vector<table_name_with_pri_t> &tableNames,
 
     /* Add default IPv4 route into the m_syncdRoutes */
     m_syncdRoutes[gVirtualRouterId][default_ip_prefix] = RouteNhg();
+    m_syncdRoutePrefixes[gVirtualRouterId].insert(default_ip_prefix, true);
 
     SWSS_LOG_NOTICE("Create IPv4 default route with packet action drop");
 
@@ -162,6 +163,7 @@ RouteOrch::RouteOrch(DBConnector *db, vector<table_name_with_pri_t> &tableNames,
 
     /* Add default IPv6 route into the m_syncdRoutes */
     m_syncdRoutes[gVirtualRouterId][v6_default_ip_prefix] = RouteNhg();
+    m_syncdRoutePrefixes[gVirtualRouterId].insert(v6_default_ip_prefix, true);
 
     SWSS_LOG_NOTICE("Create IPv6 default route with packet action drop");
 
@@ -318,18 +320,21 @@ void RouteOrch::attach(Observer *observer, const IpAddress& dstAddr, sai_object_
         observerEntry = m_nextHopObservers.find(host);
 
         /* Find the prefixes that cover the destination IP */
-        if (m_syncdRoutes.find(vrf_id) != m_syncdRoutes.end())
+        auto route_table = m_syncdRoutes.find(vrf_id);
+        auto route_prefixes = m_syncdRoutePrefixes.find(vrf_id);
+        if (route_table != m_syncdRoutes.end() && route_prefixes != m_syncdRoutePrefixes.end())
         {
-            for (auto route : m_syncdRoutes.at(vrf_id))
-            {
-                if (route.first.isAddressInSubnet(dstAddr))
+            route_prefixes->second.forEachCovering(dstAddr, [&](const IpPrefix &prefix, bool) {
+                auto route = route_table->second.find(prefix);
+                if (route == route_table->second.end())
                 {
-                    SWSS_LOG_INFO("Prefix %s covers destination address",
-                            route.first.to_string().c_str());
-                    observerEntry->second.routeTable.emplace(
-                            route.first, route.second);
+                    return;
                 }
-            }
+                SWSS_LOG_INFO("Prefix %s covers destination address",
+                        route->first.to_string().c_str());
+                observerEntry->second.routeTable.emplace(
+                        route->first, route->second);
+            });
         }
     }
 
@@ -2585,6 +2590,7 @@ bool RouteOrch::addRoutePost(const RouteBulkContext& ctx, const NextHopGroupKey
                 // This can happen in dualtor when a tunnel route is removed that matches a learned route
                 // remove the entry from the cache and retry route creation
                 m_syncdRoutes.at(vrf_id).erase(ipPrefix);
+                m_syncdRoutePrefixes[vrf_id].erase(ipPrefix);
                 return false;
             }
             SWSS_LOG_ERROR("Failed to set route %s with next hop(s) %s",
@@ -2716,6 +2722,7 @@ bool RouteOrch::addRoutePost(const RouteBulkContext& ctx, const NextHopGroupKey
     }
 
     m_syncdRoutes[vrf_id][ipPrefix] = RouteNhg(nextHops, ctx.nhg_index, ctx.context_index);
+    m_syncdRoutePrefixes[vrf_id].insert(ipPrefix, true);
 
     /* If this was a temp route, record the original desired NHG key
      * so the guard in addRoute can detect NHG membership changes. */
@@ -2784,6 +2791,7 @@ bool RouteOrch::removeRoute(RouteBulkContext& ctx)
         if (it_route_table->second.size() == 0 && gRouteBulker.creating_entries_count() == 0)
         {
             m_syncdRoutes.erase(vrf_id);
+            m_syncdRoutePrefixes.erase(vrf_id);
             m_vrfOrch->decreaseVrfRefCount(vrf_id);
         }
         SWSS_LOG_INFO("Failed to find route entry, vrf_id 0x%" PRIx64 ", prefix %s\n", vrf_id,
@@ -2997,6 +3005,7 @@ bool RouteOrch::removeRoutePost(const RouteBulkContext& ctx)
     else
     {
         it_route_table->second.erase(ipPrefix);
+        m_syncdRoutePrefixes[vrf_id].erase(ipPrefix);
 
         /* Notify about the route next hop removal */
         notifyNextHopChangeObservers(vrf_id, ipPrefix, NextHopGroupKey(), false);
@@ -3004,6 +3013,7 @@ bool RouteOrch::removeRoutePost(const RouteBulkContext& ctx)
         if (it_route_table->second.size() == 0)
         {
             m_syncdRoutes.erase(vrf_id);
+            m_syncdRoutePrefixes.erase(vrf_id);
             m_vrfOrch->decreaseVrfRefCount(vrf_id);
         }
 
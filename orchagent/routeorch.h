@@ -14,6 +14,7 @@
 #include "ipprefix.h"
 #include "nexthopgroupkey.h"
 #include "bulker.h"
+#include "prefixtrie.h"
 #include "fgnhgorch.h"
 #include <map>
 #include "zmqorch.h"
@@ -301,6 +302,8 @@ private:
     unique_ptr<swss::Table> m_stateDefaultRouteTb;
 
     RouteTables m_syncdRoutes;
+    /* Prefixes of m_syncdRoutes, for covering prefix lookups */
+    VrfPrefixTrie<bool> m_syncdRoutePrefixes;
     LabelRouteTables m_syncdLabelRoutes;
     NextHopGroupTable m_syncdNextHopGroups;
     NextHopRouteTable m_nextHops;
@@ -31,6 +31,7 @@ extern sai_object_id_t gSwitchId;
 extern sai_object_id_t  gVirtualRouterId;
 extern sai_object_id_t  gUnderlayIfId;
 extern sai_srv6_api_t* sai_srv6_api;
+extern size_t gMaxBulkSize;
 extern sai_tunnel_api_t* sai_tunnel_api;
 extern sai_next_hop_api_t* sai_next_hop_api;
 extern sai_router_interface_api_t* sai_router_intfs_api;
@@ -106,6 +107,8 @@ Srv6Orch::Srv6Orch(DBConnector *cfgDb, DBConnector *applDb, const vector<TableCo
     m_piccontextTable(applDb, APP_PIC_CONTEXT_TABLE_NAME),
     m_mysidCfgTable(cfgDb, CFG_SRV6_MY_SID_TABLE_NAME),
     m_locatorCfgTable(cfgDb, CFG_SRV6_MY_LOCATOR_TABLE_NAME),
+    m_sidListBulker(sai_srv6_api, gSwitchId, gMaxBulkSize),
+    m_mySidBulker(sai_srv6_api, gMaxBulkSize),
     m_counter_manager(SRV6_STAT_COUNTER_FLEX_COUNTER_GROUP, StatsMode::READ, SRV6_STAT_COUNTER_POLLING_INTERVAL_MS, false)
 {
     m_neighOrch->attach(this);
@@ -1090,13 +1093,13 @@ bool Srv6Orch::createUpdateSidList(const string sid_name, const string sid_list,
             attr.value.s32 = sidlist_type_map.at(sidlist_type);
         }
         attributes.push_back(attr);
-        status = sai_srv6_api->create_srv6_sidlist(&segment_oid, gSwitchId, (uint32_t) attributes.size(), attributes.data());
-        if (status != SAI_STATUS_SUCCESS)
-        {
-            SWSS_LOG_ERROR("Failed to create srv6 sidlist object, rv %d", status);
-            return false;
-        }
-        sid_table_[sid_name].sid_object_id = segment_oid;
+
+        /* The object is created by flushSidLists() */
+        m_pendingSidLists.emplace_back();
+        auto &ctx = m_pendingSidLists.back();
+        ctx.sid_name = sid_name;
+        ctx.segments = std::move(segment_buf);
+        m_sidListBulker.create_entry(&ctx.sid_object_id, (uint32_t) attributes.size(), attributes.data());
     }
     else
     {
@@ -1117,6 +1120,30 @@ bool Srv6Orch::createUpdateSidList(const string sid_name, const string sid_list,
     return true;
 }
 
+void Srv6Orch::flushSidLists()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_pendingSidLists.empty())
+    {
+        return;
+    }
+
+    m_sidListBulker.flush();
+
+    for (const auto &ctx : m_pendingSidLists)
+    {
+        if (ctx.sid_object_id == SAI_NULL_OBJECT_ID)
+        {
+            SWSS_LOG_ERROR("Failed to create srv6 sidlist object %s", ctx.sid_name.c_str());
+            continue;
+        }
+        sid_table_[ctx.sid_name].sid_object_id = ctx.sid_object_id;
+    }
+
+    m_pendingSidLists.clear();
+}
+
 task_process_status Srv6Orch::deleteSidList(const string sid_name)
 {
     SWSS_LOG_ENTER();
@@ -1259,6 +1286,8 @@ void Srv6Orch::updateNeighbor(const NeighborUpdate& update)
         {
             m_pendingSRv6MySIDEntries.erase(nexthop_key);
         }
+
+        flushMySidEntries();
     }
     else
     {
@@ -1587,31 +1616,39 @@ bool Srv6Orch::createUpdateMysidEntry(string my_sid_string, const string dt_vrf,
         attributes.push_back(attr);
     }
 
+    MySidBulkContext ctx;
+    ctx.key_string = key_string;
+    ctx.entry = my_sid_entry;
+    ctx.status = SAI_STATUS_NOT_EXECUTED;
+    ctx.counter = SAI_NULL_OBJECT_ID;
+    ctx.end_behavior = end_behavior;
+    ctx.vrf_update = vrf_update;
+    ctx.dt_vrf = dt_vrf;
+    ctx.nh_update = nh_update;
+    ctx.nexthop = nexthop;
+    ctx.adj = adj;
+
     sai_status_t status = SAI_STATUS_SUCCESS;
     if (!entry_exists)
     {
-        sai_object_id_t counter_oid = SAI_NULL_OBJECT_ID;
         if (getMySidCountersSupported() && getMySidCountersEnabled())
         {
-            auto ok = addMySidCounter(my_sid_entry, counter_oid);
+            auto ok = addMySidCounter(my_sid_entry, ctx.counter);
             if (!ok)
             {
                 return false;
             }
 
             attr.id = SAI_MY_SID_ENTRY_ATTR_COUNTER_ID;
-            attr.value.oid = counter_oid;
+            attr.value.oid = ctx.counter;
             attributes.push_back(attr);
         }
 
-        status = sai_srv6_api->create_my_sid_entry(&my_sid_entry, (uint32_t) attributes.size(), attributes.data());
-        if (status != SAI_STATUS_SUCCESS)
-        {
-          SWSS_LOG_ERROR("Failed to create my_sid entry %s, rv %d", key_string.c_str(), status);
-          return false;
-        }
-        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_SRV6_MY_SID_ENTRY);
-        srv6_my_sid_table_[key_string].counter = counter_oid;
+        /* The entry is created and bookkept by flushMySidEntries() */
+        m_pendingMySidEntries.push_back(ctx);
+        auto &pending = m_pendingMySidEntries.back();
+        m_mySidBulker.create_entry(&pending.status, &pending.entry, (uint32_t) attributes.size(), attributes.data());
+        return true;
     }
     else
     {
@@ -1634,25 +1671,63 @@ bool Srv6Orch::createUpdateMysidEntry(string my_sid_string, const string dt_vrf,
             }
         }
     }
+
+    createUpdateMysidEntryPost(ctx, false);
+
+    return true;
+}
+
+void Srv6Orch::createUpdateMysidEntryPost(const MySidBulkContext& ctx, bool created)
+{
+    const string &key_string = ctx.key_string;
+
+    if (created)
+    {
+        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_SRV6_MY_SID_ENTRY);
+        srv6_my_sid_table_[key_string].counter = ctx.counter;
+    }
+
     SWSS_LOG_INFO("Store keystring %s in cache", key_string.c_str());
-    if(vrf_update)
+    if(ctx.vrf_update)
     {
-        m_vrfOrch->increaseVrfRefCount(dt_vrf);
-        srv6_my_sid_table_[key_string].endVrfString = dt_vrf;
+        m_vrfOrch->increaseVrfRefCount(ctx.dt_vrf);
+        srv6_my_sid_table_[key_string].endVrfString = ctx.dt_vrf;
     }
-    if(nh_update)
+    if(ctx.nh_update)
     {
-        m_neighOrch->increaseNextHopRefCount(nexthop, 1);
+        m_neighOrch->increaseNextHopRefCount(ctx.nexthop, 1);
 
         SWSS_LOG_INFO("Increasing refcount to %d for Nexthop %s",
-          m_neighOrch->getNextHopRefCount(nexthop), nexthop.to_string(false,true).c_str());
+          m_neighOrch->getNextHopRefCount(ctx.nexthop), ctx.nexthop.to_string(false,true).c_str());
 
-        srv6_my_sid_table_[key_string].endAdjString = adj;
+        srv6_my_sid_table_[key_string].endAdjString = ctx.adj;
     }
-    srv6_my_sid_table_[key_string].endBehavior = end_behavior;
-    srv6_my_sid_table_[key_string].entry = my_sid_entry;
+    srv6_my_sid_table_[key_string].endBehavior = ctx.end_behavior;
+    srv6_my_sid_table_[key_string].entry = ctx.entry;
+}
 
-    return true;
+void Srv6Orch::flushMySidEntries()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_pendingMySidEntries.empty())
+    {
+        return;
+    }
+
+    m_mySidBulker.flush();
+
+    for (const auto &ctx : m_pendingMySidEntries)
+    {
+        if (ctx.status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to create my_sid entry %s, rv %d", ctx.key_string.c_str(), ctx.status);
+            continue;
+        }
+        createUpdateMysidEntryPost(ctx, true);
+    }
+
+    m_pendingMySidEntries.clear();
 }
 
 bool Srv6Orch::deleteMysidEntry(const string my_sid_string)
@@ -2236,6 +2311,7 @@ void Srv6Orch::doTaskMySidTable(const KeyOpFieldsValuesTuple & tuple)
     }
     else if(op == DEL_COMMAND)
     {
+        flushMySidEntries();
         if(!deleteMysidEntry(keyString))
         {
           SWSS_LOG_ERROR("Failed to delete my_sid entry for sid %s", keyString.c_str());
@@ -2362,6 +2438,10 @@ void Srv6Orch::doTask(Consumer &consumer)
         SWSS_LOG_INFO("table name : %s",table_name.c_str());
         if (table_name == APP_SRV6_SID_LIST_TABLE_NAME)
         {
+            if (kfvOp(t) == DEL_COMMAND)
+            {
+                flushSidLists();
+            }
             status = doTaskSidTable(t);
             if (status == task_process_status::task_need_retry)
             {
@@ -2392,4 +2472,7 @@ void Srv6Orch::doTask(Consumer &consumer)
         }
         consumer.m_toSync.erase(it++);
     }
+
+    flushSidLists();
+    flushMySidEntries();
 }
@@ -5,6 +5,8 @@
 #include <string>
 #include <set>
 #include <unordered_map>
+#include <deque>
+#include <memory>
 #include <boost/optional.hpp>
 
 #include "dbconnector.h"
@@ -19,6 +21,7 @@
 #include "nexthopkey.h"
 #include "neighorch.h"
 #include "producerstatetable.h"
+#include "bulker.h"
 
 #include "ipaddress.h"
 #include "ipaddresses.h"
@@ -135,6 +138,29 @@ struct Srv6PicContextInfo
     uint32_t ref_count;
 };
 
+/* SID list creation waiting for the SID list bulker to be flushed */
+struct SidListBulkContext
+{
+    string sid_name;
+    sai_object_id_t sid_object_id;
+    unique_ptr<sai_ip6_t[]> segments;   // Referenced by the queued segment list attribute
+};
+
+/* MySID entry creation or update waiting to be bookkept */
+struct MySidBulkContext
+{
+    string key_string;
+    sai_my_sid_entry_t entry;
+    sai_status_t status;
+    sai_object_id_t counter;
+    sai_my_sid_entry_endpoint_behavior_t end_behavior;
+    bool vrf_update;
+    string dt_vrf;
+    bool nh_update;
+    NextHopKey nexthop;
+    string adj;
+};
+
 typedef unordered_map<string, SidTableEntry> SidTable;
 typedef unordered_map<string, SidTunnelEntry> Srv6TunnelTable;
 typedef map<NextHopKey, sai_object_id_t> Srv6NextHopTable;
@@ -181,12 +207,15 @@ class Srv6Orch : public Orch, public Observer
         task_process_status doTaskPicContextTable(const KeyOpFieldsValuesTuple &tuple);
         void doTaskCfgMySidTable(const KeyOpFieldsValuesTuple &tuple);
         bool createUpdateSidList(const string seg_name, const string ips, const string sidlist_type);
+        void flushSidLists();
         task_process_status deleteSidList(const string seg_name);
         bool createSrv6Tunnel(const string srv6_source);
         bool createSrv6Nexthop(const NextHopKey &nh);
         bool deleteSrv6Nexthop(const NextHopKey &nh);
         bool srv6NexthopExists(const NextHopKey &nh);
         bool createUpdateMysidEntry(string my_sid_string, const string vrf, const string adj, const string end_action);
+        void createUpdateMysidEntryPost(const MySidBulkContext& ctx, bool created);
+        void flushMySidEntries();
         bool deleteMysidEntry(const string my_sid_string);
         bool sidEntryEndpointBehavior(const string action, sai_my_sid_entry_endpoint_behavior_t &end_behavior,
                                       sai_my_sid_entry_endpoint_behavior_flavor_t &end_flavor);
@@ -253,6 +282,16 @@ class Srv6Orch : public Orch, public Observer
         MySidIpInIpTunnels my_sid_ipinip_tunnels_{};
         Srv6MySidDscpCfg my_sid_dscp_cfg_cache_;
 
+        /*
+         * New SID lists and MySID entries of a consumer batch are created in
+         * bulk at the end of the batch, or before a deletion in the same table.
+         * Contexts live in deques since the bulkers keep pointers into them.
+         */
+        ObjectBulker<sai_srv6_api_t> m_sidListBulker;
+        deque<SidListBulkContext> m_pendingSidLists;
+        EntityBulker<sai_srv6_api_t> m_mySidBulker;
+        deque<MySidBulkContext> m_pendingMySidEntries;
+
         VRFOrch *m_vrfOrch;
         SwitchOrch *m_switchOrch;
         NeighOrch *m_neighOrch;
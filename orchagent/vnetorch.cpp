@@ -1899,19 +1899,21 @@ void VNetRouteOrch::attach(Observer* observer, const IpAddress& dstAddr)
     if (insert_result.second)
     {
         /* Find the prefixes that cover the destination IP */
-        for (auto route : syncd_routes_)
-        {
-            if (route.first.isAddressInSubnet(dstAddr))
+        syncd_route_prefixes_.forEachCovering(dstAddr, [&](const IpPrefix &prefix, bool) {
+            auto route = syncd_routes_.find(prefix);
+            if (route == syncd_routes_.end())
             {
-                SWSS_LOG_INFO("Prefix %s covers destination address",
-                    route.first.to_string().c_str());
-
-                observerEntry->second.routeTable.emplace(
-                    route.first,
-                    route.second
-                );
+                return;
             }
-        }
+
+            SWSS_LOG_INFO("Prefix %s covers destination address",
+                route->first.to_string().c_str());
+
+            observerEntry->second.routeTable.emplace(
+                route->first,
+                route->second
+            );
+        });
     }
 
     observerEntry->second.observers.push_back(observer);
@@ -2018,6 +2020,7 @@ void VNetRouteOrch::addRoute(const std::string& vnet, const IpPrefix& ipPrefix,
         }
     }
     syncd_routes_.emplace(ipPrefix, VNetEntry()).first->second[vnet] = nh;
+    syncd_route_prefixes_.insert(ipPrefix, true);
 }
 
 void VNetRouteOrch::delRoute(const IpPrefix& ipPrefix)
@@ -2071,6 +2074,7 @@ void VNetRouteOrch::delRoute(const IpPrefix& ipPrefix)
         next_hop_observer++;
     }
     syncd_routes_.erase(route_itr);
+    syncd_route_prefixes_.erase(ipPrefix);
 }
 
 void VNetRouteOrch::createBfdSession(const string& vnet, const NextHopKey& endpoint, const IpAddress& monitor_addr, const int32_t rx_monitor_timer, const int32_t tx_monitor_timer)
@@ -2688,10 +2692,13 @@ void VNetRouteOrch::update(SubjectType type, void *cntx)
     assert(cntx);
 
     switch(type) {
-    case SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE:
+    case SUBJECT_TYPE_BFD_SESSION_STATE_CHANGES:
     {
-        BfdUpdate *update = static_cast<BfdUpdate *>(cntx);
-        updateVnetTunnel(*update);
+        BfdUpdates *updates = static_cast<BfdUpdates *>(cntx);
+        for (const auto &update : *updates)
+        {
+            updateVnetTunnel(update);
+        }
         break;
     }
     default:
@@ -16,6 +16,7 @@
 #include "nexthopgroupkey.h"
 #include "bfdorch.h"
 #include "tunneltermhelper.h"
+#include "prefixtrie.h"
 
 #define VNET_BITMAP_SIZE 32
 #define VNET_TUNNEL_SIZE 40960
@@ -593,6 +594,8 @@ private:
     handler_map handler_map_;
 
     VNetRouteTable syncd_routes_;
+    /* Prefixes of syncd_routes_, for covering prefix lookups */
+    PrefixTrie<bool> syncd_route_prefixes_;
     VNetNextHopObserverTable next_hop_observers_;
     std::map<std::string, VNetNextHopGroupInfoTable> syncd_nexthop_groups_;
     std::map<std::string, VNetTunnelRouteTable> syncd_tunnel_routes_;
@@ -1632,8 +1632,7 @@ bool VxlanTunnelOrch::addOperation(const Request& request)
     auto src_ip = request.getAttrIP("src_ip");
 
     IpAddress dst_ip;
-    auto attr_names = request.getAttrFieldNames();
-    if (attr_names.count("dst_ip") == 0)
+    if (!request.hasAttr("dst_ip"))
     {
         if (src_ip.isV4()) {
             dst_ip = IpAddress("0.0.0.0");
@@ -1652,7 +1651,7 @@ bool VxlanTunnelOrch::addOperation(const Request& request)
     }
     const auto& tunnel_name = request.getKeyString(0);
     VxlanTunnelTTLMode ttl_mode = VxlanTunnelTTLMode::NOT_SET;
-    if (attr_names.find("ttl_mode") != attr_names.end())
+    if (request.hasAttr("ttl_mode"))
     {
         string ttl_mode_str = request.getAttrString("ttl_mode");
         if (ttl_mode_str == "uniform")
@@ -2558,7 +2557,8 @@ bool EvpnRemoteVnip2pOrch::addOperation(const Request& request)
     {
         SWSS_LOG_INFO("Vxlan tunnelPort exists: %s", remote_vtep.c_str());
 
-        if (gPortsOrch->isVlanMember(vlanPort, tunnelPort))
+        if (gPortsOrch->isVlanMember(vlanPort, tunnelPort) ||
+            pending_vlan_member_set_.count({ vlanPort.m_alias, tunnelPort.m_alias }))
         {
             SWSS_LOG_WARN("tunnelPort %s already member of vid %d", 
                           remote_vtep.c_str(),vlan_id);
@@ -2575,10 +2575,9 @@ bool EvpnRemoteVnip2pOrch::addOperation(const Request& request)
         return false;
     }
 
-    // SAI Call to add tunnel to the VLAN flood domain
-    // NOTE: does 'untagged' make the most sense here?
-    string tagging_mode = "untagged";
-    gPortsOrch->addVlanMember(vlanPort, tunnelPort, tagging_mode);
+    // The tunnel is added to the VLAN flood domain by flushVlanMembers()
+    pending_vlan_members_.emplace_back(vlanPort.m_alias, tunnelPort.m_alias);
+    pending_vlan_member_set_.emplace(vlanPort.m_alias, tunnelPort.m_alias);
 
     SWSS_LOG_INFO("remote_vtep=%s vni=%d vlanid=%d ",
                    remote_vtep.c_str(), vni_id, vlan_id);
@@ -2586,12 +2585,45 @@ bool EvpnRemoteVnip2pOrch::addOperation(const Request& request)
     return true;
 }
 
+void EvpnRemoteVnip2pOrch::doTask(Consumer& consumer)
+{
+    SWSS_LOG_ENTER();
+
+    Orch2::doTask(consumer);
+    flushVlanMembers();
+}
+
+void EvpnRemoteVnip2pOrch::flushVlanMembers()
+{
+    SWSS_LOG_ENTER();
+
+    if (pending_vlan_members_.empty())
+    {
+        return;
+    }
+
+    // SAI Call to add tunnels to the VLAN flood domain
+    // NOTE: does 'untagged' make the most sense here?
+    string tagging_mode = "untagged";
+    if (!gPortsOrch->addVlanMembers(pending_vlan_members_, tagging_mode))
+    {
+        SWSS_LOG_WARN("Failed to add some of %zu remote VTEPs to their VLANs",
+                      pending_vlan_members_.size());
+    }
+
+    pending_vlan_members_.clear();
+    pending_vlan_member_set_.clear();
+}
+
 bool EvpnRemoteVnip2pOrch::delOperation(const Request& request)
 {
     bool ret;
 
     SWSS_LOG_ENTER();
 
+    // The removed member may still be waiting to be created
+    flushVlanMembers();
+
     // Extract DIP and tunnel
     auto remote_vtep = request.getKeyString(1);
 
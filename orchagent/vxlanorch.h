@@ -506,10 +506,18 @@ public:
 
 
 private:
+    virtual void doTask(Consumer& consumer);
     virtual bool addOperation(const Request& request);
     virtual bool delOperation(const Request& request);
+    void flushVlanMembers();
 
     EvpnRemoteVniRequest request_;
+    /*
+     * Remote VTEP tunnel ports join the VLAN flood domain in one bulk call at
+     * the end of each batch, once their tunnels and bridge ports exist.
+     */
+    std::vector<std::pair<std::string, std::string>> pending_vlan_members_;
+    std::set<std::pair<std::string, std::string>> pending_vlan_member_set_;
 };
 
 class EvpnRemoteVnip2mpOrch : public Orch2
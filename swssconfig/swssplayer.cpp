@@ -1,5 +1,17 @@
+#include <fcntl.h>
+#include <getopt.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
 #include <fstream>
 #include <iostream>
+#include <set>
+#include <thread>
+#include <unordered_map>
 
 #include <dbconnector.h>
 #include <producerstatetable.h>
@@ -8,46 +20,57 @@
 #include "orch_zmq_config.h"
 #include <schema.h>
 #include <tokenize.h>
+#include "recformat.h"
 
 using namespace std;
 using namespace swss;
 
+#define DEFAULT_BATCH_SIZE 128
+
 static int line_index = 0;
 static DBConnector db("APPL_DB", 0, true);
 
-void usage()
+struct PlayerOptions
 {
-	cout << "Usage: swssplayer <file>" << endl;
-	/* TODO: Add sample input file */
-}
+    /* Playback speed factor relative to the recording, 0 replays at max rate */
+    double speed = 0;
+    /* Entries queued in the redis pipeline before it is flushed */
+    size_t batchSize = DEFAULT_BATCH_SIZE;
+    /* Tables to replay, all tables when empty */
+    set<string> includeTables;
+    set<string> excludeTables;
+};
 
-vector<FieldValueTuple> processFieldsValuesTuple(string s)
+struct PlayerStats
 {
-	vector<FieldValueTuple> result;
-
-	auto tuples = tokenize(s, '|');
-	for (auto tuple : tuples)
-	{
-		auto v_tuple = tokenize(tuple, ':', 1);
-		auto field = v_tuple[0];
-		auto value = v_tuple.size() == 1 ? "" : v_tuple[1];
-		result.push_back(FieldValueTuple(field, value));
-	}
+    uint64_t ops = 0;
+    uint64_t filtered = 0;
+    uint64_t invalid = 0;
+};
 
-	return result;
+void usage()
+{
+	cout << "Usage: swssplayer [-s speed] [-b batch_size] [-t tables] [-x tables] <file>" << endl;
+	cout << "    file: swss.rec recording, text or binary format" << endl;
+	cout << "    -s speed: 0 or max replays as fast as possible (default), 1 replays with the recorded" << endl;
+	cout << "              timing and N replays N times faster than recorded" << endl;
+	cout << "    -b batch_size: entries written per redis pipeline flush. Default: " << DEFAULT_BATCH_SIZE << endl;
+	cout << "    -t tables: comma separated list of tables to replay" << endl;
+	cout << "    -x tables: comma separated list of tables to skip" << endl;
+	/* TODO: Add sample input file */
 }
 
-shared_ptr<ProducerStateTable> get_table(unordered_map<string, shared_ptr<ProducerStateTable>>& table_map, string table_name, set<string>  zmq_tables, std::shared_ptr<ZmqClient> zmq_client)
+shared_ptr<ProducerStateTable> get_table(unordered_map<string, shared_ptr<ProducerStateTable>>& table_map, RedisPipeline &pipeline, const string &table_name, set<string> &zmq_tables, std::shared_ptr<ZmqClient> zmq_client)
 {
     shared_ptr<ProducerStateTable> p_table= nullptr;
     auto findResult = table_map.find(table_name);
     if (findResult == table_map.end())
     {
         if ((zmq_tables.find(table_name) != zmq_tables.end()) && (zmq_client != nullptr)) {
-            p_table = make_shared<ZmqProducerStateTable>(&db, table_name, *zmq_client, true);
+            p_table = make_shared<ZmqProducerStateTable>(&pipeline, table_name, *zmq_client, true);
         }
         else {
-            p_table = make_shared<ProducerStateTable>(&db, table_name);
+            p_table = make_shared<ProducerStateTable>(&pipeline, table_name, true);
         }
 
         table_map.emplace(table_name, p_table);
@@ -60,41 +83,185 @@ shared_ptr<ProducerStateTable> get_table(unordered_map<string, shared_ptr<Produc
     return p_table;
 }
 
-void processTokens(vector<string> tokens, unordered_map<string, shared_ptr<ProducerStateTable>>& table_map, set<string>  zmq_tables, std::shared_ptr<ZmqClient> zmq_client)
+static bool isTableReplayed(const PlayerOptions &options, const string &table_name)
 {
-	auto key = tokens[1];
+    if (!options.includeTables.empty() && options.includeTables.find(table_name) == options.includeTables.end())
+    {
+        return false;
+    }
+    return options.excludeTables.find(table_name) == options.excludeTables.end();
+}
 
-	/* Process the key */
-	auto v_key = tokenize(key, ':', 1);
-	auto table_name = v_key[0];
-	auto key_name = v_key[1];
+/*
+ * Delays the replay so the entry recorded at rec_usec is written at the
+ * recorded offset from the first entry, scaled by the playback speed.
+ * Pending entries are flushed first so they are not held back by the wait.
+ */
+static void pace(const PlayerOptions &options, RedisPipeline &pipeline, int64_t rec_usec,
+                 int64_t &rec_start, chrono::steady_clock::time_point &play_start)
+{
+    if (options.speed <= 0 || rec_usec < 0)
+    {
+        return;
+    }
 
-	auto p_producer= get_table(table_map, table_name, zmq_tables, zmq_client);
+    if (rec_start < 0)
+    {
+        rec_start = rec_usec;
+        play_start = chrono::steady_clock::now();
+        return;
+    }
+
+    auto offset = chrono::microseconds(static_cast<int64_t>(static_cast<double>(rec_usec - rec_start) / options.speed));
+    auto due = play_start + offset;
+    if (due > chrono::steady_clock::now())
+    {
+        pipeline.flush();
+        this_thread::sleep_until(due);
+    }
+}
 
-	/* Process the operation */
-	auto op = tokens[2];
-	if (op == SET_COMMAND)
+/* Replays one recorded entry, read from either a text or a binary recording */
+bool processEntry(const RecEntry &entry, const PlayerOptions &options, PlayerStats &stats,
+                  unordered_map<string, shared_ptr<ProducerStateTable>>& table_map, RedisPipeline &pipeline,
+                  set<string> &zmq_tables, std::shared_ptr<ZmqClient> zmq_client,
+                  int64_t &rec_start, chrono::steady_clock::time_point &play_start)
+{
+	if (entry.prefix.empty())
+	{
+		return false;
+	}
+	/* The prefix ends with the table name separator */
+	string table_name = entry.prefix.substr(0, entry.prefix.size() - 1);
+
+	const auto &op = kfvOp(entry.tuple);
+	bool is_set = op == SET_COMMAND;
+	if (!is_set && op != DEL_COMMAND)
+	{
+		return false;
+	}
+
+	if (!isTableReplayed(options, table_name))
+	{
+		stats.filtered++;
+		return true;
+	}
+
+	pace(options, pipeline, static_cast<int64_t>(entry.usec), rec_start, play_start);
+
+	auto p_producer = get_table(table_map, pipeline, table_name, zmq_tables, zmq_client);
+	if (is_set)
+	{
+		p_producer->set(kfvKey(entry.tuple), kfvFieldsValues(entry.tuple), SET_COMMAND);
+	}
+	else
+	{
+		p_producer->del(kfvKey(entry.tuple), DEL_COMMAND);
+	}
+
+	if (++stats.ops % options.batchSize == 0)
+	{
+		pipeline.flush();
+	}
+
+	return true;
+}
+
+/* Replays a recording written in the binary format */
+static void replayBinary(const string &file_name, const PlayerOptions &options, PlayerStats &stats,
+                         set<string> &zmq_tables, std::shared_ptr<ZmqClient> zmq_client)
+{
+	RecBinaryReader reader;
+	if (!reader.open(file_name))
 	{
-		auto tuples = processFieldsValuesTuple(tokens[3]);
-		p_producer->set(key_name, tuples, SET_COMMAND);
+		cerr << "Failed to open binary recording " << file_name << endl;
+		exit(EXIT_FAILURE);
 	}
-	else if (op == DEL_COMMAND)
+
+	int64_t rec_start = -1;
+	auto play_start = chrono::steady_clock::now();
+
+	// Tables are destroyed before the pipeline they write to
+	RedisPipeline pipeline(&db, options.batchSize);
+	unordered_map<string, shared_ptr<ProducerStateTable>> table_map;
+
+	RecEntry entry;
+	while (reader.next(entry))
 	{
-		p_producer->del(key_name, DEL_COMMAND);
+		if (!processEntry(entry, options, stats, table_map, pipeline, zmq_tables, zmq_client, rec_start, play_start))
+		{
+			stats.invalid++;
+		}
+		line_index++;
 	}
+
+	pipeline.flush();
+}
+
+static void printSummary(const PlayerStats &stats, chrono::steady_clock::time_point start)
+{
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "Replayed " << stats.ops << " entries from " << line_index << " records in " << seconds << " s ("
+         << (seconds > 0 ? static_cast<double>(stats.ops) / seconds : 0) << " ops/sec), "
+         << stats.filtered << " filtered, " << stats.invalid << " skipped" << endl;
+}
+
+static bool parseOptions(int argc, char **argv, PlayerOptions &options, string &file)
+{
+    int opt;
+    while ((opt = getopt(argc, argv, "s:b:t:x:h")) != -1)
+    {
+        switch (opt)
+        {
+        case 's':
+            options.speed = string(optarg) == "max" ? 0 : atof(optarg);
+            if (options.speed < 0)
+            {
+                return false;
+            }
+            break;
+        case 'b':
+            if (atoi(optarg) <= 0)
+            {
+                return false;
+            }
+            options.batchSize = static_cast<size_t>(atoi(optarg));
+            break;
+        case 't':
+            for (const auto &table : tokenize(optarg, ','))
+            {
+                options.includeTables.insert(table);
+            }
+            break;
+        case 'x':
+            for (const auto &table : tokenize(optarg, ','))
+            {
+                options.excludeTables.insert(table);
+            }
+            break;
+        default:
+            return false;
+        }
+    }
+
+    if (optind != argc - 1)
+    {
+        return false;
+    }
+    file = argv[optind];
+    return true;
 }
 
 int main(int argc, char **argv)
 {
-	if (argc != 2)
+	PlayerOptions options;
+	string file_name;
+	if (!parseOptions(argc, argv, options, file_name))
 	{
 		usage();
 		exit(EXIT_FAILURE);
 	}
 
-	ifstream file(argv[1]);
-	string line;
-
     auto zmq_tables = load_zmq_tables();
     std::shared_ptr<ZmqClient> zmq_client = nullptr;
     if (zmq_tables.size() > 0)
@@ -102,12 +269,86 @@ int main(int argc, char **argv)
         zmq_client = create_zmq_client(ZMQ_LOCAL_ADDRESS);
     }
 
-    unordered_map<string, shared_ptr<ProducerStateTable>> table_map;
-	while (getline(file, line))
+    PlayerStats stats;
+    auto start = chrono::steady_clock::now();
+
+    if (RecBinaryReader::isBinary(file_name))
+    {
+        replayBinary(file_name, options, stats, zmq_tables, zmq_client);
+        printSummary(stats, start);
+        return EXIT_SUCCESS;
+    }
+
+	int fd = open(file_name.c_str(), O_RDONLY);
+	if (fd < 0)
 	{
-		auto tokens = tokenize(line, '|', 3);
-		processTokens(tokens, table_map, zmq_tables, zmq_client);
+		cerr << "Failed to open " << file_name << ": " << strerror(errno) << endl;
+		exit(EXIT_FAILURE);
+	}
 
-		line_index++;
+	struct stat st;
+	if (fstat(fd, &st) != 0)
+	{
+		cerr << "Failed to stat " << file_name << ": " << strerror(errno) << endl;
+		close(fd);
+		exit(EXIT_FAILURE);
 	}
+
+	size_t size = static_cast<size_t>(st.st_size);
+	const char *data = nullptr;
+	if (size > 0)
+	{
+		void *addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (addr == MAP_FAILED)
+		{
+			cerr << "Failed to map " << file_name << ": " << strerror(errno) << endl;
+			close(fd);
+			exit(EXIT_FAILURE);
+		}
+		madvise(addr, size, MADV_SEQUENTIAL);
+		data = static_cast<const char *>(addr);
+	}
+	close(fd);
+
+    int64_t rec_start = -1;
+    auto play_start = chrono::steady_clock::now();
+
+    {
+        // Tables are destroyed before the pipeline they write to
+        RedisPipeline pipeline(&db, options.batchSize);
+        unordered_map<string, shared_ptr<ProducerStateTable>> table_map;
+
+        const char *pos = data;
+        const char *end = data + size;
+        while (pos < end)
+        {
+            const char *eol = static_cast<const char *>(memchr(pos, '\n', end - pos));
+            const char *line_end = eol ? eol : end;
+
+            if (line_end > pos)
+            {
+                RecEntry entry;
+                if (!parseRecTextLine(boost::string_view(pos, line_end - pos), entry) ||
+                    !processEntry(entry, options, stats, table_map, pipeline, zmq_tables, zmq_client,
+                                  rec_start, play_start))
+                {
+                    stats.invalid++;
+                }
+            }
+
+            line_index++;
+            pos = line_end + 1;
+        }
+
+        pipeline.flush();
+    }
+
+    printSummary(stats, start);
+
+    if (data != nullptr)
+    {
+        munmap(const_cast<char *>(data), size);
+    }
+
+    return EXIT_SUCCESS;
 }
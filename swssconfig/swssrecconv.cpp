@@ -0,0 +1,140 @@
+#include <getopt.h>
+
+#include <fstream>
+#include <iostream>
+
+#include "recformat.h"
+
+using namespace std;
+using namespace swss;
+
+void usage()
+{
+    cout << "Usage: swssrecconv <input> <output>" << endl;
+    cout << "       swssrecconv -l <input>" << endl;
+    cout << "    Converts a swss.rec recording between the text and the binary format." << endl;
+    cout << "    The direction follows the format of the input file." << endl;
+    cout << "    -l: list the block index of a binary recording instead of converting it" << endl;
+}
+
+static int listIndex(const string &input)
+{
+    RecBinaryReader reader;
+    if (!reader.open(input))
+    {
+        cerr << "Failed to open binary recording " << input << endl;
+        return EXIT_FAILURE;
+    }
+
+    uint64_t total = 0;
+    for (const auto &block : reader.index())
+    {
+        cout << block.offset << " " << formatRecTimestamp(block.firstUsec) << " "
+             << formatRecTimestamp(block.lastUsec) << " " << block.count << endl;
+        total += block.count;
+    }
+    cout << reader.index().size() << " blocks, " << total << " entries" << endl;
+    return EXIT_SUCCESS;
+}
+
+static int binaryToText(const string &input, const string &output)
+{
+    RecBinaryReader reader;
+    if (!reader.open(input))
+    {
+        cerr << "Failed to open binary recording " << input << endl;
+        return EXIT_FAILURE;
+    }
+
+    ofstream ofs(output);
+    if (!ofs.is_open())
+    {
+        cerr << "Failed to open " << output << endl;
+        return EXIT_FAILURE;
+    }
+
+    uint64_t count = 0;
+    RecEntry entry;
+    while (reader.next(entry))
+    {
+        ofs << formatRecTextLine(entry) << "\n";
+        count++;
+    }
+
+    cout << "Converted " << count << " entries" << endl;
+    return ofs.good() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static int textToBinary(const string &input, const string &output)
+{
+    ifstream ifs(input);
+    if (!ifs.is_open())
+    {
+        cerr << "Failed to open " << input << endl;
+        return EXIT_FAILURE;
+    }
+
+    RecBinaryWriter writer;
+    if (!writer.open(output, true))
+    {
+        cerr << "Failed to open " << output << endl;
+        return EXIT_FAILURE;
+    }
+
+    uint64_t count = 0, skipped = 0;
+    string line;
+    RecEntry entry;
+    while (getline(ifs, line))
+    {
+        /* "recording started" markers and malformed lines carry no entry */
+        if (!parseRecTextLine(line, entry))
+        {
+            skipped++;
+            continue;
+        }
+        writer.append(entry);
+        count++;
+    }
+    writer.close();
+
+    cout << "Converted " << count << " entries, " << skipped << " lines skipped" << endl;
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char **argv)
+{
+    bool list = false;
+    int opt;
+    while ((opt = getopt(argc, argv, "lh")) != -1)
+    {
+        switch (opt)
+        {
+        case 'l':
+            list = true;
+            break;
+        default:
+            usage();
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (list && optind == argc - 1)
+    {
+        return listIndex(argv[optind]);
+    }
+
+    if (list || optind != argc - 2)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    string input = argv[optind];
+    string output = argv[optind + 1];
+
+    if (RecBinaryReader::isBinary(input))
+    {
+        return binaryToText(input, output);
+    }
+    return textToBinary(input, output);
+}
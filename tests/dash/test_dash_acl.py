@@ -380,7 +380,8 @@ class TestAcl(object):
                             priority=3, action=Action.ACTION_PERMIT, terminating=False,
                             src_addr=["192.168.0.1/32", "192.168.1.2/30"], dst_addr=["192.168.0.1/32", "192.168.1.2/30"],
                             src_port=[PortRange(0,1)], dst_port=[PortRange(0,1)])
-        ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=4)
+        # Setting an existing rule replaces it
+        ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=3)
 
     def test_acl_group(self, ctx):
         ctx.create_acl_group(ACL_GROUP_1, IpVersion.IP_VERSION_IPV6)
@@ -506,8 +507,8 @@ class TestAcl(object):
         ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)
 
 
-    # @pytest.mark.parametrize("bind_group", [True, False])
-    def test_prefix_single_tag(self, ctx):
+    @pytest.mark.parametrize("bind_group", [True, False])
+    def test_prefix_single_tag(self, ctx, bind_group):
         tag1_prefixes = {"1.1.1.0/24", "2.2.0.0/16"}
         ctx.create_prefix_tag(TAG_1, IpVersion.IP_VERSION_IPV4, tag1_prefixes)
         tag2_prefixes = {"192.168.1.0/30", "192.168.2.0/30", "192.168.3.0/30"}
@@ -527,40 +528,42 @@ class TestAcl(object):
         assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes
         assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == tag2_prefixes
 
-        # Updating tags will not be supported until full tag support is implemented in SAI
-        # if bind_group:
-            # self.bind_acl_group(ctx, ACL_STAGE_1, ACL_GROUP_1, group1_id)
+        if bind_group:
+            self.bind_acl_group(ctx, ACL_STAGE_1, ACL_GROUP_1, group1_id)
 
-        # tag1_prefixes = {"1.1.2.0/24", "2.3.0.0/16"}
-        # ctx.create_prefix_tag(TAG_1, IpVersion.IP_VERSION_IPV4, tag1_prefixes)
+        tag1_prefixes = {"1.1.2.0/24", "2.3.0.0/16"}
+        ctx.create_prefix_tag(TAG_1, IpVersion.IP_VERSION_IPV4, tag1_prefixes)
 
-        # time.sleep(3)
+        time.sleep(3)
 
-        # rule1_id= ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)[0]
-        # rule1_attr = ctx.asic_dash_acl_rule_table[rule1_id]
+        rule1_id= ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)[0]
+        rule1_attr = ctx.asic_dash_acl_rule_table[rule1_id]
 
-        # if bind_group:
-        #     new_group1_id = ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=1)[0]
-        #     assert new_group1_id != group1_id
-        #     self.verify_group_is_bound_to_eni(ctx, ACL_STAGE_1, new_group1_id)
+        if bind_group:
+            new_group1_id = ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=1)[0]
+            assert new_group1_id != group1_id
+            self.verify_group_is_bound_to_eni(ctx, ACL_STAGE_1, new_group1_id)
 
-        # assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes
-        # assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == tag2_prefixes
+        assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes
+        assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == tag2_prefixes
 
-        # tag2_prefixes = {"192.168.2.0/30", "192.168.3.0/30"}
-        # ctx.create_prefix_tag(TAG_2, IpVersion.IP_VERSION_IPV4, tag2_prefixes)
+        tag2_prefixes = {"192.168.2.0/30", "192.168.3.0/30"}
+        ctx.create_prefix_tag(TAG_2, IpVersion.IP_VERSION_IPV4, tag2_prefixes)
 
-        # time.sleep(3)
+        time.sleep(3)
 
-        # ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=1)
-        # rule1_id = ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)[0]
-        # rule1_attr = ctx.asic_dash_acl_rule_table[rule1_id]
+        group1_id = ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=1)[0]
+        rule1_id = ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)[0]
+        rule1_attr = ctx.asic_dash_acl_rule_table[rule1_id]
 
-        # assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes
-        # assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == tag2_prefixes
+        if bind_group:
+            self.verify_group_is_bound_to_eni(ctx, ACL_STAGE_1, group1_id)
 
-        # if bind_group:
-        #     ctx.unbind_acl_in(self.eni_name, ACL_STAGE_1)
+        assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes
+        assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == tag2_prefixes
+
+        if bind_group:
+            ctx.unbind_acl_in(self.eni_name, ACL_STAGE_1)
 
     # @pytest.mark.parametrize("bind_group", [True, False])
     def test_multiple_tags(self, ctx):
@@ -1,3 +1,6 @@
+#define private public // make Directory::m_values available to clean it.
+#include "directory.h"
+#undef private
 #include "ut_helper.h"
 #include "flowcounterrouteorch.h"
 
@@ -1903,6 +1906,504 @@ namespace aclorch_test
         ASSERT_TRUE(orch->m_aclOrch->removeAclRule(tableId, ruleId));
     }
 
+    sai_acl_api_t *old_sai_acl_api;
+
+    // Points sai_acl_api to a copy of the ACL API for the lifetime of the
+    // hook, so that a test can override functions of the copy and the API
+    // is restored even when an assertion ends the test early
+    struct AclApiHook
+    {
+        AclApiHook() : api(*sai_acl_api)
+        {
+            old_sai_acl_api = sai_acl_api;
+            sai_acl_api = &api;
+        }
+
+        ~AclApiHook()
+        {
+            sai_acl_api = old_sai_acl_api;
+        }
+
+        sai_acl_api_t api;
+    };
+
+    uint32_t _ut_create_acl_entries_calls;
+    uint32_t _ut_create_acl_entries_objects;
+    uint32_t _ut_create_acl_entries_fail_index;
+
+    // Bulk create on top of the single create of the virtual switch, fails
+    // the entry at _ut_create_acl_entries_fail_index of the first call
+    sai_status_t createAclEntries(_In_ sai_object_id_t switch_id, _In_ uint32_t object_count,
+                                  _In_ const uint32_t *attr_count, _In_ const sai_attribute_t **attr_list,
+                                  _In_ sai_bulk_op_error_mode_t mode, _Out_ sai_object_id_t *object_id,
+                                  _Out_ sai_status_t *object_statuses)
+    {
+        _ut_create_acl_entries_calls++;
+        _ut_create_acl_entries_objects += object_count;
+
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_id[i] = SAI_NULL_OBJECT_ID;
+            if (status != SAI_STATUS_SUCCESS)
+            {
+                object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+                continue;
+            }
+            if (_ut_create_acl_entries_calls == 1 && i == _ut_create_acl_entries_fail_index)
+            {
+                object_statuses[i] = SAI_STATUS_FAILURE;
+            }
+            else
+            {
+                object_statuses[i] = old_sai_acl_api->create_acl_entry(&object_id[i], switch_id, attr_count[i], attr_list[i]);
+            }
+            if (object_statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                status = SAI_STATUS_FAILURE;
+            }
+        }
+        return status;
+    }
+
+    TEST_F(AclOrchTest, AclRule_BulkCreate)
+    {
+        AclApiHook hook;
+        sai_acl_api->create_acl_entries = createAclEntries;
+        _ut_create_acl_entries_calls = 0;
+        _ut_create_acl_entries_objects = 0;
+        _ut_create_acl_entries_fail_index = 2;
+
+        string tableId = "acl_table_1";
+        const size_t ruleCount = 8;
+
+        auto orch = createAclOrch();
+
+        auto kvfAclTable = deque<KeyOpFieldsValuesTuple>({{
+            tableId,
+            SET_COMMAND,
+            {
+                { ACL_TABLE_DESCRIPTION, "L3 table" },
+                { ACL_TABLE_TYPE, TABLE_TYPE_L3 },
+                { ACL_TABLE_STAGE, STAGE_INGRESS },
+                { ACL_TABLE_PORTS, "1,2" }
+            }
+        }});
+
+        orch->doAclTableTask(kvfAclTable);
+
+        auto tableOid = orch->getTableById(tableId);
+        ASSERT_NE(tableOid, SAI_NULL_OBJECT_ID);
+
+        // all rules of one drain cycle go to the SAI in one bulk call
+        deque<KeyOpFieldsValuesTuple> kvfAclRule;
+        for (size_t i = 0; i < ruleCount; i++)
+        {
+            kvfAclRule.push_back({
+                tableId + "|rule_" + to_string(i),
+                SET_COMMAND,
+                {
+                    { ACTION_PACKET_ACTION, PACKET_ACTION_FORWARD },
+                    { MATCH_SRC_IP, "1.2.3." + to_string(i) },
+                    { MATCH_L4_DST_PORT_RANGE, "100-200" }
+                }
+            });
+        }
+
+        orch->doAclRuleTask(kvfAclRule);
+
+        ASSERT_EQ(_ut_create_acl_entries_calls, 1);
+        ASSERT_EQ(_ut_create_acl_entries_objects, ruleCount);
+
+        // the failed entry and the ones after it were created one by one
+        auto tableIt = orch->getAclTables().find(tableOid);
+        ASSERT_NE(tableIt, orch->getAclTables().end());
+        ASSERT_EQ(tableIt->second.rules.size(), ruleCount);
+        for (const auto &ruleIt : tableIt->second.rules)
+        {
+            ASSERT_NE(ruleIt.second->getOid(), SAI_NULL_OBJECT_ID);
+            ASSERT_NE(ruleIt.second->getCounterOid(), SAI_NULL_OBJECT_ID);
+
+            // the range list handed to the bulk call outlives the drain loop
+            sai_object_id_t rangeOid = SAI_NULL_OBJECT_ID;
+            sai_attribute_t attr;
+            attr.id = SAI_ACL_ENTRY_ATTR_FIELD_ACL_RANGE_TYPE;
+            attr.value.aclfield.data.objlist.count = 1;
+            attr.value.aclfield.data.objlist.list = &rangeOid;
+            ASSERT_EQ(sai_acl_api->get_acl_entry_attribute(ruleIt.second->getOid(), 1, &attr), SAI_STATUS_SUCCESS);
+            ASSERT_EQ(attr.value.aclfield.data.objlist.count, 1);
+            ASSERT_NE(rangeOid, SAI_NULL_OBJECT_ID);
+        }
+        ASSERT_TRUE(validateResourceCountWithCrm(orch->m_aclOrch, gCrmOrch));
+
+        // replacing an existing rule keeps the single object path
+        kvfAclRule = deque<KeyOpFieldsValuesTuple>({{
+            tableId + "|rule_0",
+            SET_COMMAND,
+            {
+                { ACTION_PACKET_ACTION, PACKET_ACTION_DROP },
+                { MATCH_SRC_IP, "1.2.3.0" }
+            }
+        }});
+
+        orch->doAclRuleTask(kvfAclRule);
+
+        ASSERT_EQ(_ut_create_acl_entries_calls, 1);
+        ASSERT_TRUE(validateResourceCountWithCrm(orch->m_aclOrch, gCrmOrch));
+
+        for (size_t i = 0; i < ruleCount; i++)
+        {
+            kvfAclRule = deque<KeyOpFieldsValuesTuple>({{
+                tableId + "|rule_" + to_string(i),
+                DEL_COMMAND,
+                {}
+            }});
+            orch->doAclRuleTask(kvfAclRule);
+        }
+
+        tableIt = orch->getAclTables().find(tableOid);
+        ASSERT_NE(tableIt, orch->getAclTables().end());
+        ASSERT_TRUE(tableIt->second.rules.empty());
+    }
+
+    uint32_t _ut_set_acl_entries_calls;
+
+    sai_status_t setAclEntriesAttribute(_In_ uint32_t object_count, _In_ const sai_object_id_t *object_id,
+                                        _In_ const sai_attribute_t *attr_list, _In_ sai_bulk_op_error_mode_t mode,
+                                        _Out_ sai_status_t *object_statuses)
+    {
+        _ut_set_acl_entries_calls++;
+
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = old_sai_acl_api->set_acl_entry_attribute(object_id[i], &attr_list[i]);
+            if (object_statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                status = SAI_STATUS_FAILURE;
+            }
+        }
+        return status;
+    }
+
+    // Entries created and removed one by one, in call order
+    vector<pair<string, sai_object_id_t>> _ut_acl_entry_ops;
+    uint32_t _ut_create_acl_entry_table_full;
+
+    // Single create that records the entry, and fails with a full table
+    // _ut_create_acl_entry_table_full times first
+    sai_status_t createAclEntry(_Out_ sai_object_id_t *acl_entry_id, _In_ sai_object_id_t switch_id,
+                                _In_ uint32_t attr_count, _In_ const sai_attribute_t *attr_list)
+    {
+        if (_ut_create_acl_entry_table_full > 0)
+        {
+            _ut_create_acl_entry_table_full--;
+            return SAI_STATUS_TABLE_FULL;
+        }
+
+        auto status = old_sai_acl_api->create_acl_entry(acl_entry_id, switch_id, attr_count, attr_list);
+        if (status == SAI_STATUS_SUCCESS)
+        {
+            _ut_acl_entry_ops.emplace_back("create", *acl_entry_id);
+        }
+        return status;
+    }
+
+    sai_status_t removeAclEntry(_In_ sai_object_id_t acl_entry_id)
+    {
+        auto status = old_sai_acl_api->remove_acl_entry(acl_entry_id);
+        if (status == SAI_STATUS_SUCCESS)
+        {
+            _ut_acl_entry_ops.emplace_back("remove", acl_entry_id);
+        }
+        return status;
+    }
+
+    TEST_F(AclOrchTest, AclRule_DeltaUpdate)
+    {
+        AclApiHook hook;
+        sai_acl_api->create_acl_entries = createAclEntries;
+        sai_acl_api->set_acl_entries_attribute = setAclEntriesAttribute;
+        sai_acl_api->create_acl_entry = createAclEntry;
+        sai_acl_api->remove_acl_entry = removeAclEntry;
+        _ut_acl_entry_ops.clear();
+        _ut_create_acl_entry_table_full = 0;
+        _ut_create_acl_entries_calls = 0;
+        _ut_create_acl_entries_objects = 0;
+        _ut_create_acl_entries_fail_index = UINT32_MAX;
+        _ut_set_acl_entries_calls = 0;
+
+        string tableId = "acl_table_1";
+        const size_t ruleCount = 4;
+
+        auto orch = createAclOrch();
+
+        auto kvfAclTable = deque<KeyOpFieldsValuesTuple>({{
+            tableId,
+            SET_COMMAND,
+            {
+                { ACL_TABLE_DESCRIPTION, "L3 table" },
+                { ACL_TABLE_TYPE, TABLE_TYPE_L3 },
+                { ACL_TABLE_STAGE, STAGE_INGRESS },
+                { ACL_TABLE_PORTS, "1,2" }
+            }
+        }});
+
+        orch->doAclTableTask(kvfAclTable);
+
+        deque<KeyOpFieldsValuesTuple> kvfAclRule;
+        for (size_t i = 0; i < ruleCount; i++)
+        {
+            kvfAclRule.push_back({
+                tableId + "|rule_" + to_string(i),
+                SET_COMMAND,
+                {
+                    { RULE_PRIORITY, "100" },
+                    { ACTION_PACKET_ACTION, PACKET_ACTION_FORWARD },
+                    { MATCH_SRC_IP, "1.2.3." + to_string(i) }
+                }
+            });
+        }
+
+        orch->doAclRuleTask(kvfAclRule);
+
+        vector<sai_object_id_t> ruleOids;
+        for (size_t i = 0; i < ruleCount; i++)
+        {
+            auto rule = orch->m_aclOrch->getAclRule(tableId, "rule_" + to_string(i));
+            ASSERT_NE(rule, nullptr);
+            ruleOids.push_back(rule->getOid());
+        }
+
+        // the same priority and destination change on every rule is set in
+        // place, one bulk call per attribute
+        kvfAclRule.clear();
+        for (size_t i = 0; i < ruleCount; i++)
+        {
+            kvfAclRule.push_back({
+                tableId + "|rule_" + to_string(i),
+                SET_COMMAND,
+                {
+                    { RULE_PRIORITY, "200" },
+                    { ACTION_PACKET_ACTION, PACKET_ACTION_FORWARD },
+                    { MATCH_SRC_IP, "1.2.3." + to_string(i) },
+                    { MATCH_DST_IP, "4.3.2.1" }
+                }
+            });
+        }
+
+        orch->doAclRuleTask(kvfAclRule);
+
+        ASSERT_EQ(_ut_set_acl_entries_calls, 2);
+        for (size_t i = 0; i < ruleCount; i++)
+        {
+            auto rule = orch->m_aclOrch->getAclRule(tableId, "rule_" + to_string(i));
+            ASSERT_NE(rule, nullptr);
+            ASSERT_EQ(rule->getOid(), ruleOids[i]);
+            ASSERT_EQ(getAclRuleSaiAttribute(*rule, SAI_ACL_ENTRY_ATTR_PRIORITY), "200");
+            ASSERT_EQ(getAclRuleSaiAttribute(*rule, SAI_ACL_ENTRY_ATTR_FIELD_DST_IP), "4.3.2.1&mask:255.255.255.255");
+        }
+        ASSERT_TRUE(validateResourceCountWithCrm(orch->m_aclOrch, gCrmOrch));
+
+        // a dropped match is disabled in place
+        kvfAclRule = deque<KeyOpFieldsValuesTuple>({{
+            tableId + "|rule_0",
+            SET_COMMAND,
+            {
+                { RULE_PRIORITY, "200" },
+                { ACTION_PACKET_ACTION, PACKET_ACTION_FORWARD },
+                { MATCH_SRC_IP, "1.2.3.0" }
+            }
+        }});
+
+        orch->doAclRuleTask(kvfAclRule);
+
+        auto rule = orch->m_aclOrch->getAclRule(tableId, "rule_0");
+        ASSERT_NE(rule, nullptr);
+        ASSERT_EQ(rule->getOid(), ruleOids[0]);
+        ASSERT_EQ(getAclRuleSaiAttribute(*rule, SAI_ACL_ENTRY_ATTR_FIELD_DST_IP), "disabled");
+
+        // a new range can only be applied with a new entry, which is created
+        // before the old one is removed
+        kvfAclRule = deque<KeyOpFieldsValuesTuple>({{
+            tableId + "|rule_1",
+            SET_COMMAND,
+            {
+                { RULE_PRIORITY, "200" },
+                { ACTION_PACKET_ACTION, PACKET_ACTION_FORWARD },
+                { MATCH_SRC_IP, "1.2.3.1" },
+                { MATCH_L4_DST_PORT_RANGE, "100-200" }
+            }
+        }});
+
+        auto setCalls = _ut_set_acl_entries_calls;
+        _ut_acl_entry_ops.clear();
+        orch->doAclRuleTask(kvfAclRule);
+
+        ASSERT_EQ(_ut_set_acl_entries_calls, setCalls);
+        rule = orch->m_aclOrch->getAclRule(tableId, "rule_1");
+        ASSERT_NE(rule, nullptr);
+        ASSERT_NE(rule->getOid(), SAI_NULL_OBJECT_ID);
+        ASSERT_NE(rule->getOid(), ruleOids[1]);
+        ASSERT_EQ(_ut_acl_entry_ops, (vector<pair<string, sai_object_id_t>>{
+            { "create", rule->getOid() },
+            { "remove", ruleOids[1] }
+        }));
+        sai_attribute_t attr;
+        attr.id = SAI_ACL_ENTRY_ATTR_PRIORITY;
+        ASSERT_NE(old_sai_acl_api->get_acl_entry_attribute(ruleOids[1], 1, &attr), SAI_STATUS_SUCCESS);
+        ASSERT_TRUE(validateResourceCountWithCrm(orch->m_aclOrch, gCrmOrch));
+
+        for (size_t i = 0; i < ruleCount; i++)
+        {
+            ASSERT_TRUE(orch->m_aclOrch->removeAclRule(tableId, "rule_" + to_string(i)));
+        }
+    }
+
+    // Registers a MuxOrch and a redirect target next hop for the test and
+    // restores gDirectory and NeighOrch on every exit
+    struct RedirectNextHopGuard
+    {
+        RedirectNextHopGuard(TunnelDecapOrch *tunnelDecapOrch, DBConnector *configDb,
+                             const vector<string>& muxTables, const NextHopKey& nh) :
+            nh(nh),
+            tunnelDecapOrch(tunnelDecapOrch)
+        {
+            auto it = gDirectory.m_values.find(typeid(MuxOrch*).name());
+            if (it != gDirectory.m_values.end())
+            {
+                oldMuxOrch = it->second;
+                gDirectory.m_values.erase(it);
+            }
+            muxOrch = new MuxOrch(configDb, muxTables, tunnelDecapOrch, gNeighOrch, gFdbOrch);
+            gDirectory.set(muxOrch);
+
+            // Backed by an object the switch accepts as a redirect destination
+            Port cpuPort;
+            gPortsOrch->getCpuPort(cpuPort);
+            gNeighOrch->m_syncdNextHops[nh] = { cpuPort.m_port_id, 0, 0 };
+        }
+
+        ~RedirectNextHopGuard()
+        {
+            gNeighOrch->m_syncdNextHops.erase(nh);
+            gDirectory.m_values.erase(typeid(MuxOrch*).name());
+            if (oldMuxOrch != nullptr)
+            {
+                gDirectory.m_values[typeid(MuxOrch*).name()] = oldMuxOrch;
+            }
+            // MuxOrch observes NeighOrch and FdbOrch and never detaches itself
+            gNeighOrch->detach(muxOrch);
+            gFdbOrch->detach(muxOrch);
+            delete muxOrch;
+            delete tunnelDecapOrch;
+        }
+
+        NextHopKey nh;
+        TunnelDecapOrch *tunnelDecapOrch;
+        MuxOrch *muxOrch = nullptr;
+        Orch *oldMuxOrch = nullptr;
+    };
+
+    TEST_F(AclOrchTest, AclRule_ReplaceRedirectOnTableFull)
+    {
+        AclApiHook hook;
+        sai_acl_api->create_acl_entries = nullptr;
+        sai_acl_api->create_acl_entry = createAclEntry;
+        sai_acl_api->remove_acl_entry = removeAclEntry;
+        _ut_acl_entry_ops.clear();
+        _ut_create_acl_entry_table_full = 0;
+
+        string tableId = "acl_table_1";
+        string ruleId = "rule_1";
+
+        // NeighOrch looks next hops up in MuxOrch first
+        vector<string> tunnel_tables = {
+            APP_TUNNEL_DECAP_TABLE_NAME,
+            APP_TUNNEL_DECAP_TERM_TABLE_NAME
+        };
+        vector<string> mux_tables = {
+            CFG_MUX_CABLE_TABLE_NAME,
+            CFG_PEER_SWITCH_TABLE_NAME
+        };
+        RedirectNextHopGuard guard(
+            new TunnelDecapOrch(m_app_db.get(), m_state_db.get(), m_config_db.get(), tunnel_tables),
+            m_config_db.get(), mux_tables, NextHopKey("10.0.0.1@Ethernet0"));
+        const NextHopKey& nh = guard.nh;
+
+        auto orch = createAclOrch();
+
+        auto kvfAclTable = deque<KeyOpFieldsValuesTuple>({{
+            tableId,
+            SET_COMMAND,
+            {
+                { ACL_TABLE_DESCRIPTION, "L3 table" },
+                { ACL_TABLE_TYPE, TABLE_TYPE_L3 },
+                { ACL_TABLE_STAGE, STAGE_INGRESS },
+                { ACL_TABLE_PORTS, "1,2" }
+            }
+        }});
+
+        orch->doAclTableTask(kvfAclTable);
+
+        auto redirectRule = [&](const string& srcIp)
+        {
+            return deque<KeyOpFieldsValuesTuple>({{
+                tableId + "|" + ruleId,
+                SET_COMMAND,
+                {
+                    { RULE_PRIORITY, "100" },
+                    { ACTION_REDIRECT_ACTION, nh.to_string() },
+                    { MATCH_SRC_IP, srcIp }
+                }
+            }});
+        };
+
+        auto kvfAclRule = redirectRule("1.2.3.4");
+        orch->doAclRuleTask(kvfAclRule);
+
+        auto rule = orch->m_aclOrch->getAclRule(tableId, ruleId);
+        ASSERT_NE(rule, nullptr);
+        auto oldOid = rule->getOid();
+        ASSERT_NE(oldOid, SAI_NULL_OBJECT_ID);
+        ASSERT_EQ(gNeighOrch->getNextHopRefCount(nh), 1);
+
+        // With room for both entries the new one is created first
+        _ut_acl_entry_ops.clear();
+        kvfAclRule = redirectRule("1.2.3.5");
+        orch->doAclRuleTask(kvfAclRule);
+
+        rule = orch->m_aclOrch->getAclRule(tableId, ruleId);
+        ASSERT_NE(rule, nullptr);
+        ASSERT_EQ(_ut_acl_entry_ops, (vector<pair<string, sai_object_id_t>>{
+            { "create", rule->getOid() },
+            { "remove", oldOid }
+        }));
+        ASSERT_EQ(gNeighOrch->getNextHopRefCount(nh), 1);
+        oldOid = rule->getOid();
+
+        // A full table falls back to remove then create, the new entry
+        // takes the next hop reference again
+        _ut_acl_entry_ops.clear();
+        _ut_create_acl_entry_table_full = 1;
+        kvfAclRule = redirectRule("1.2.3.6");
+        orch->doAclRuleTask(kvfAclRule);
+
+        rule = orch->m_aclOrch->getAclRule(tableId, ruleId);
+        ASSERT_NE(rule, nullptr);
+        ASSERT_NE(rule->getOid(), SAI_NULL_OBJECT_ID);
+        ASSERT_EQ(_ut_acl_entry_ops, (vector<pair<string, sai_object_id_t>>{
+            { "remove", oldOid },
+            { "create", rule->getOid() }
+        }));
+        ASSERT_EQ(getAclRuleSaiAttribute(*rule, SAI_ACL_ENTRY_ATTR_FIELD_SRC_IP), "1.2.3.6&mask:255.255.255.255");
+        ASSERT_EQ(gNeighOrch->getNextHopRefCount(nh), 1);
+        ASSERT_TRUE(validateResourceCountWithCrm(orch->m_aclOrch, gCrmOrch));
+
+        ASSERT_TRUE(orch->m_aclOrch->removeAclRule(tableId, ruleId));
+        ASSERT_EQ(gNeighOrch->getNextHopRefCount(nh), 0);
+    }
+
     sai_switch_api_t *old_sai_switch_api;
 
     // The following function is used to override SAI API get_switch_attribute to request passing
@@ -0,0 +1,167 @@
+#define private public
+#include "neighorch.h"
+#undef private
+#include "mock_orch_test.h"
+#include "mock_table.h"
+#include "notifier.h"
+#include "sai_serialize.h"
+
+extern redisReply *mockReply;
+
+namespace bfdorch_test
+{
+    using namespace std;
+    using namespace mock_orch_test;
+
+    static const string PEER1_KEY = "default|default|10.0.0.1";
+    static const string PEER2_KEY = "default|default|10.0.0.2";
+    static const sai_object_id_t PEER1_SESSION_ID = 0x5a00000001;
+    static const sai_object_id_t PEER2_SESSION_ID = 0x5a00000002;
+
+    /* Records every batch of BFD session state updates published by BfdOrch */
+    class BfdUpdateRecorder : public Observer
+    {
+    public:
+        void update(SubjectType type, void *cntx) override
+        {
+            if (type == SUBJECT_TYPE_BFD_SESSION_STATE_CHANGES)
+            {
+                batches.push_back(*static_cast<BfdUpdates *>(cntx));
+            }
+        }
+
+        vector<BfdUpdates> batches;
+    };
+
+    class BfdOrchTest : public MockOrchTest
+    {
+    protected:
+        BfdOrch *m_bfdOrch;
+        BfdUpdateRecorder m_recorder;
+
+        void PostSetUp() override
+        {
+            m_bfdOrch = new BfdOrch(m_app_db.get(), APP_BFD_SESSION_TABLE_NAME,
+                                    TableConnector(m_state_db.get(), STATE_BFD_SESSION_TABLE_NAME));
+            m_bfdOrch->attach(&m_recorder);
+
+            m_bfdOrch->bfd_session_lookup[PEER1_SESSION_ID] = { PEER1_KEY, SAI_BFD_SESSION_STATE_DOWN };
+            m_bfdOrch->bfd_session_lookup[PEER2_SESSION_ID] = { PEER2_KEY, SAI_BFD_SESSION_STATE_DOWN };
+        }
+
+        void PreTearDown() override
+        {
+            m_bfdOrch->detach(&m_recorder);
+            delete m_bfdOrch;
+            m_bfdOrch = nullptr;
+        }
+
+        /* Reads one bfd_session_state_change message, as published by syncd, into the notification consumer */
+        void readStateNotification(const vector<sai_bfd_session_state_notification_t> &states)
+        {
+            auto exec = static_cast<Notifier *>(m_bfdOrch->getExecutor("BFD_STATE_NOTIFICATIONS"));
+            auto consumer = exec->getNotificationConsumer();
+
+            mockReply = (redisReply *)calloc(1, sizeof(redisReply));
+            mockReply->type = REDIS_REPLY_ARRAY;
+            mockReply->elements = 3; // REDIS_PUBLISH_MESSAGE_ELEMNTS
+            mockReply->element = (redisReply **)calloc(mockReply->elements, sizeof(redisReply *));
+            mockReply->element[2] = (redisReply *)calloc(1, sizeof(redisReply));
+            mockReply->element[2]->type = REDIS_REPLY_STRING;
+
+            std::string data = sai_serialize_bfd_session_state_ntf((uint32_t)states.size(), states.data());
+            std::vector<FieldValueTuple> notifyValues;
+            FieldValueTuple opdata("bfd_session_state_change", data);
+            notifyValues.push_back(opdata);
+            std::string msg = swss::JSon::buildJson(notifyValues);
+            mockReply->element[2]->str = (char*)calloc(1, msg.length() + 1);
+            memcpy(mockReply->element[2]->str, msg.c_str(), msg.length());
+
+            consumer->readData();
+            mockReply = nullptr;
+        }
+
+        void doStateNotificationTask()
+        {
+            auto exec = static_cast<Notifier *>(m_bfdOrch->getExecutor("BFD_STATE_NOTIFICATIONS"));
+            m_bfdOrch->doTask(*exec->getNotificationConsumer());
+        }
+    };
+
+    /*
+     * A flap of peer1 and a state change of peer2 arriving in one burst are
+     * coalesced: peer1 ends where it started and is not published, peer2 is
+     * published once with its last state.
+     */
+    TEST_F(BfdOrchTest, StateNotificationFlapIsCoalesced)
+    {
+        readStateNotification({ { PEER1_SESSION_ID, SAI_BFD_SESSION_STATE_UP },
+                                { PEER2_SESSION_ID, SAI_BFD_SESSION_STATE_UP } });
+        readStateNotification({ { PEER1_SESSION_ID, SAI_BFD_SESSION_STATE_DOWN } });
+        doStateNotificationTask();
+
+        ASSERT_EQ(m_recorder.batches.size(), 1);
+        ASSERT_EQ(m_recorder.batches[0].size(), 1);
+        EXPECT_EQ(m_recorder.batches[0][0].peer, PEER2_KEY);
+        EXPECT_EQ(m_recorder.batches[0][0].state, SAI_BFD_SESSION_STATE_UP);
+
+        EXPECT_EQ(m_bfdOrch->bfd_session_lookup[PEER1_SESSION_ID].state, SAI_BFD_SESSION_STATE_DOWN);
+        EXPECT_EQ(m_bfdOrch->bfd_session_lookup[PEER2_SESSION_ID].state, SAI_BFD_SESSION_STATE_UP);
+
+        Table stateBfdSessionTable(m_state_db.get(), STATE_BFD_SESSION_TABLE_NAME);
+        string state;
+        EXPECT_FALSE(stateBfdSessionTable.hget(PEER1_KEY, "state", state));
+        ASSERT_TRUE(stateBfdSessionTable.hget(PEER2_KEY, "state", state));
+        EXPECT_EQ(state, "Up");
+    }
+
+    /* Every session that changed in a burst is published in a single notify, in first change order */
+    TEST_F(BfdOrchTest, StateNotificationsAreBatched)
+    {
+        readStateNotification({ { PEER2_SESSION_ID, SAI_BFD_SESSION_STATE_UP } });
+        readStateNotification({ { PEER1_SESSION_ID, SAI_BFD_SESSION_STATE_INIT } });
+        readStateNotification({ { PEER1_SESSION_ID, SAI_BFD_SESSION_STATE_UP },
+                                { 0x5a000000ff, SAI_BFD_SESSION_STATE_UP } });
+        doStateNotificationTask();
+
+        ASSERT_EQ(m_recorder.batches.size(), 1);
+        ASSERT_EQ(m_recorder.batches[0].size(), 2);
+        EXPECT_EQ(m_recorder.batches[0][0].peer, PEER2_KEY);
+        EXPECT_EQ(m_recorder.batches[0][0].state, SAI_BFD_SESSION_STATE_UP);
+        EXPECT_EQ(m_recorder.batches[0][1].peer, PEER1_KEY);
+        EXPECT_EQ(m_recorder.batches[0][1].state, SAI_BFD_SESSION_STATE_UP);
+
+        /* Nothing changed, nothing is published */
+        readStateNotification({ { PEER1_SESSION_ID, SAI_BFD_SESSION_STATE_UP } });
+        doStateNotificationTask();
+        EXPECT_EQ(m_recorder.batches.size(), 1);
+    }
+
+    /* NeighOrch applies the last state of every default VRF peer in a batch to its next hop */
+    TEST_F(BfdOrchTest, NeighOrchAppliesLastStateOfBatch)
+    {
+        NextHopKey nh1(IpAddress("10.0.0.1"), ETHERNET0);
+        NextHopKey nh2(IpAddress("10.0.0.2"), ETHERNET4);
+        gNeighOrch->m_syncdNextHops[nh1] = { (sai_object_id_t)0x4001, 0, 0 };
+        gNeighOrch->m_syncdNextHops[nh2] = { (sai_object_id_t)0x4002, 0, 0 };
+
+        BfdUpdates updates = {
+            { PEER1_KEY, SAI_BFD_SESSION_STATE_DOWN },
+            { PEER2_KEY, SAI_BFD_SESSION_STATE_DOWN },
+            { PEER1_KEY, SAI_BFD_SESSION_STATE_UP },
+            { "Vrf1|default|10.0.0.2", SAI_BFD_SESSION_STATE_UP },
+        };
+        gNeighOrch->update(SUBJECT_TYPE_BFD_SESSION_STATE_CHANGES, &updates);
+
+        EXPECT_EQ(gNeighOrch->m_syncdNextHops[nh1].nh_flags & NHFLAGS_IFDOWN, 0);
+        EXPECT_EQ(gNeighOrch->m_syncdNextHops[nh2].nh_flags & NHFLAGS_IFDOWN, NHFLAGS_IFDOWN);
+
+        updates = { { PEER2_KEY, SAI_BFD_SESSION_STATE_UP } };
+        gNeighOrch->update(SUBJECT_TYPE_BFD_SESSION_STATE_CHANGES, &updates);
+
+        EXPECT_EQ(gNeighOrch->m_syncdNextHops[nh2].nh_flags & NHFLAGS_IFDOWN, 0);
+
+        gNeighOrch->m_syncdNextHops.erase(nh1);
+        gNeighOrch->m_syncdNextHops.erase(nh2);
+    }
+}
@@ -14,6 +14,7 @@ namespace bulker_test
     using ::testing::SetArrayArgument;
     using ::testing::Return;
     using ::testing::DoAll;
+    using ::testing::Invoke;
 
     DEFINE_SAI_GENERIC_API_OBJECT_BULK_MOCK_WITH_SET(next_hop, next_hop);
 
@@ -289,6 +290,39 @@ namespace bulker_test
         gNextHopBulker.flush();
     }
 
+    TEST_F(BulkerTest, ObjectBulkSetStatus)
+    {
+        ObjectBulker<sai_next_hop_api_t> gNextHopBulker(sai_next_hop_api, 0x0, 1000);
+        sai_attribute_t next_hop_attr;
+        next_hop_attr.id = SAI_NEXT_HOP_ATTR_IP;
+        next_hop_attr.value.ipaddr.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+
+        // Two attributes on the first next hop, one on the second
+        next_hop_attr.value.ipaddr.addr.ip4 = 0x10000003;
+        gNextHopBulker.set_entry_attribute(0x101, &next_hop_attr);
+        next_hop_attr.value.ipaddr.addr.ip4 = 0x10000004;
+        gNextHopBulker.set_entry_attribute(0x101, &next_hop_attr);
+        next_hop_attr.value.ipaddr.addr.ip4 = 0x10000005;
+        gNextHopBulker.set_entry_attribute(0x102, &next_hop_attr);
+
+        // All of them go in one bulk call, the second next hop fails
+        EXPECT_CALL(*mock_sai_next_hop_api, set_next_hops_attribute)
+            .WillOnce(Invoke([](uint32_t object_count, const sai_object_id_t *object_id, const sai_attribute_t *,
+                                sai_bulk_op_error_mode_t, sai_status_t *object_statuses) {
+                EXPECT_EQ(object_count, 3u);
+                for (uint32_t i = 0; i < object_count; i++)
+                {
+                    object_statuses[i] = object_id[i] == 0x102 ? SAI_STATUS_FAILURE : SAI_STATUS_SUCCESS;
+                }
+                return SAI_STATUS_FAILURE;
+            }));
+        gNextHopBulker.flush();
+
+        ASSERT_EQ(gNextHopBulker.set_status(0x101), SAI_STATUS_SUCCESS);
+        ASSERT_EQ(gNextHopBulker.set_status(0x102), SAI_STATUS_FAILURE);
+        ASSERT_EQ(gNextHopBulker.setting_entries_count(), 0u);
+    }
+
     TEST_F(BulkerTest, BulkerPendingRemovalOrSet_OnlyRemoval)
     {
         // Create bulker
@@ -0,0 +1,125 @@
+#define private public
+#include "crmorch.h"
+#undef private
+
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_table.h"
+
+namespace crmorch_test
+{
+    using namespace std;
+
+    struct CrmOrchTest : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_config_db;
+        shared_ptr<swss::DBConnector> m_counters_db;
+        CrmOrch *m_crmOrch = nullptr;
+
+        void SetUp() override
+        {
+            ::testing_db::reset();
+
+            m_config_db = make_shared<swss::DBConnector>("CONFIG_DB", 0);
+            m_counters_db = make_shared<swss::DBConnector>("COUNTERS_DB", 0);
+            m_crmOrch = new CrmOrch(m_config_db.get(), CFG_CRM_TABLE_NAME);
+        }
+
+        void TearDown() override
+        {
+            delete m_crmOrch;
+            m_crmOrch = nullptr;
+
+            ::testing_db::reset();
+        }
+
+        string getCounter(const string &field)
+        {
+            swss::Table table(m_counters_db.get(), COUNTERS_CRM_TABLE);
+            string value;
+            table.hget("STATS", field, value);
+            return value;
+        }
+
+        void setCounter(const string &field, const string &value)
+        {
+            swss::Table table(m_counters_db.get(), COUNTERS_CRM_TABLE);
+            table.hset("STATS", field, value);
+        }
+    };
+
+    TEST_F(CrmOrchTest, PublishUsedCounterOnlyOnChange)
+    {
+        m_crmOrch->incCrmResUsedCounter(CrmResourceType::CRM_FDB_ENTRY);
+        m_crmOrch->updateCrmCountersTable();
+        ASSERT_EQ(getCounter("crm_stats_fdb_entry_used"), "1");
+
+        // Unchanged counters are not written again
+        setCounter("crm_stats_fdb_entry_used", "stale");
+        m_crmOrch->updateCrmCountersTable();
+        ASSERT_EQ(getCounter("crm_stats_fdb_entry_used"), "stale");
+
+        m_crmOrch->incCrmResUsedCounter(CrmResourceType::CRM_FDB_ENTRY);
+        m_crmOrch->updateCrmCountersTable();
+        ASSERT_EQ(getCounter("crm_stats_fdb_entry_used"), "2");
+    }
+
+    TEST_F(CrmOrchTest, AvailabilityQueryBackoff)
+    {
+        m_crmOrch->m_availPollBackoff = 6;
+
+        auto &res = m_crmOrch->m_resourcesMap.at(CrmResourceType::CRM_FDB_ENTRY);
+        auto &cnt = res.countersMap["STATS"];
+        cnt.availableCounter = 1000;
+
+        // Never queried counters are always due
+        ASSERT_TRUE(m_crmOrch->isResAvailabilityQueryDue(res));
+
+        // Low utilization backs off for the full interval
+        m_crmOrch->scheduleResAvailabilityQuery(res);
+        ASSERT_EQ(res.availPollSkip, 6);
+        ASSERT_FALSE(m_crmOrch->isResAvailabilityQueryDue(res));
+        ASSERT_EQ(res.availPollSkip, 5);
+
+        // A change of the "used" counter forces the query
+        m_crmOrch->incCrmResUsedCounter(CrmResourceType::CRM_FDB_ENTRY);
+        ASSERT_TRUE(m_crmOrch->isResAvailabilityQueryDue(res));
+
+        // Utilization above the low threshold is queried on every interval
+        cnt.usedCounter = 800;
+        cnt.availableCounter = 200;
+        m_crmOrch->scheduleResAvailabilityQuery(res);
+        ASSERT_EQ(res.availPollSkip, 0);
+        ASSERT_TRUE(m_crmOrch->isResAvailabilityQueryDue(res));
+
+        // Disabled backoff always queries
+        m_crmOrch->m_availPollBackoff = 0;
+        cnt.usedCounter = 0;
+        m_crmOrch->scheduleResAvailabilityQuery(res);
+        ASSERT_TRUE(m_crmOrch->isResAvailabilityQueryDue(res));
+    }
+
+    TEST_F(CrmOrchTest, ThresholdCheckOnDelta)
+    {
+        auto &res = m_crmOrch->m_resourcesMap.at(CrmResourceType::CRM_FDB_ENTRY);
+        auto &cnt = res.countersMap["STATS"];
+        cnt.usedCounter = 90;
+        cnt.availableCounter = 10;
+
+        m_crmOrch->checkCrmThresholds();
+        ASSERT_EQ(cnt.exceededLogCounter, 1);
+
+        // Unchanged counters are not evaluated again
+        m_crmOrch->checkCrmThresholds();
+        ASSERT_EQ(cnt.exceededLogCounter, 1);
+
+        cnt.usedCounter++;
+        m_crmOrch->checkCrmThresholds();
+        ASSERT_EQ(cnt.exceededLogCounter, 2);
+
+        // Threshold configuration change forces the evaluation
+        m_crmOrch->resetCrmThresholdCheck(res);
+        m_crmOrch->checkCrmThresholds();
+        ASSERT_EQ(cnt.exceededLogCounter, 3);
+    }
+}
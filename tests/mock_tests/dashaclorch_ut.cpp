@@ -0,0 +1,412 @@
+#define private public
+#include "directory.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_sai_api.h"
+#include "mock_dash_orch_test.h"
+#define private public
+#include "dash/dashaclorch.h"
+#undef private
+#include "dash_api/acl_group.pb.h"
+#include "dash_api/acl_in.pb.h"
+#include "dash_api/acl_rule.pb.h"
+#include "dash_api/prefix_tag.pb.h"
+#include "dash_api/types.pb.h"
+
+#include <deque>
+#include <map>
+
+EXTERN_MOCK_FNS
+
+namespace dashaclorch_test
+{
+    DEFINE_SAI_GENERIC_API_OBJECT_BULK_MOCK(dash_acl, dash_acl_rule)
+
+    using namespace mock_orch_test;
+    using ::testing::_;
+    using ::testing::Invoke;
+    using ::testing::Return;
+
+    sai_dash_eni_api_t *old_sai_dash_eni_api;
+
+    /* ACL group bound to each ENI by the successful ENI attribute updates */
+    std::map<sai_object_id_t, sai_object_id_t> _ut_eni_acl_groups;
+    uint32_t _ut_set_eni_attribute_calls;
+    /* 1-based call that fails with SAI_STATUS_INSUFFICIENT_RESOURCES, 0 never fails */
+    uint32_t _ut_set_eni_attribute_fail_call;
+
+    sai_status_t setEniAttribute(_In_ sai_object_id_t eni_id, _In_ const sai_attribute_t *attr)
+    {
+        if (++_ut_set_eni_attribute_calls == _ut_set_eni_attribute_fail_call)
+        {
+            return SAI_STATUS_INSUFFICIENT_RESOURCES;
+        }
+
+        _ut_eni_acl_groups[eni_id] = attr->value.oid;
+        return SAI_STATUS_SUCCESS;
+    }
+
+    struct EniApiHook
+    {
+        EniApiHook() : api(*sai_dash_eni_api)
+        {
+            old_sai_dash_eni_api = sai_dash_eni_api;
+            api.set_eni_attribute = setEniAttribute;
+            sai_dash_eni_api = &api;
+            _ut_eni_acl_groups.clear();
+            _ut_set_eni_attribute_calls = 0;
+            _ut_set_eni_attribute_fail_call = 0;
+        }
+
+        ~EniApiHook()
+        {
+            sai_dash_eni_api = old_sai_dash_eni_api;
+        }
+
+        sai_dash_eni_api_t api;
+    };
+
+    class DashAclOrchTest : public MockDashOrchTest
+    {
+    protected:
+        DashAclOrch *m_dashAclOrch = nullptr;
+        sai_object_id_t m_nextRuleOid = 0x8000000000001;
+
+        std::string group1 = "GROUP_1";
+        std::string tag1 = "TAG_1";
+        std::string eni2 = "ENI_2";
+
+        void ApplySaiMock() override
+        {
+            INIT_SAI_API_MOCK(dash_acl);
+            MockSaiApis();
+        }
+
+        void PostSetUp() override
+        {
+            std::vector<std::string> dash_acl_tables = {
+                APP_DASH_PREFIX_TAG_TABLE_NAME,
+                APP_DASH_ACL_IN_TABLE_NAME,
+                APP_DASH_ACL_OUT_TABLE_NAME,
+                APP_DASH_ACL_GROUP_TABLE_NAME,
+                APP_DASH_ACL_RULE_TABLE_NAME
+            };
+            m_dashAclOrch = new DashAclOrch(m_app_db.get(), dash_acl_tables, m_DashOrch, m_dpu_app_state_db.get(), nullptr);
+            gDirectory.set(m_dashAclOrch);
+            for (const auto &table : dash_acl_tables)
+            {
+                dash_table_orch_map[table] = (Orch **)&m_dashAclOrch;
+            }
+
+            /* Rule objects are only tracked by the orch, hand out fake ids */
+            ON_CALL(*mock_sai_dash_acl_api, create_dash_acl_rules)
+                .WillByDefault(Invoke([this](sai_object_id_t, uint32_t count, const uint32_t *, const sai_attribute_t **,
+                                             sai_bulk_op_error_mode_t, sai_object_id_t *ids, sai_status_t *statuses) {
+                    for (uint32_t i = 0; i < count; i++)
+                    {
+                        ids[i] = m_nextRuleOid++;
+                        statuses[i] = SAI_STATUS_SUCCESS;
+                    }
+                    return SAI_STATUS_SUCCESS;
+                }));
+            ON_CALL(*mock_sai_dash_acl_api, remove_dash_acl_rules)
+                .WillByDefault(Invoke([](uint32_t count, const sai_object_id_t *, sai_bulk_op_error_mode_t,
+                                         sai_status_t *statuses) {
+                    for (uint32_t i = 0; i < count; i++)
+                    {
+                        statuses[i] = SAI_STATUS_SUCCESS;
+                    }
+                    return SAI_STATUS_SUCCESS;
+                }));
+        }
+
+        void PreTearDown() override
+        {
+            delete m_dashAclOrch;
+            m_dashAclOrch = nullptr;
+            RestoreSaiApis();
+            DEINIT_SAI_API_MOCK(dash_acl);
+        }
+
+        void ProcessDashEntries(const std::string &table_name, const std::deque<swss::KeyOpFieldsValuesTuple> &entries,
+                                bool expect_empty = true)
+        {
+            auto consumer = std::make_unique<Consumer>(
+                new swss::ConsumerStateTable(m_app_db.get(), table_name),
+                m_dashAclOrch, table_name);
+            consumer->addToSync(entries);
+            static_cast<Orch *>(m_dashAclOrch)->doTask(*consumer.get());
+            EXPECT_EQ(consumer->m_toSync.empty(), expect_empty);
+        }
+
+        void CreateAclGroup(const std::string &group_id)
+        {
+            dash::acl_group::AclGroup group;
+            group.set_ip_version(dash::types::IP_VERSION_IPV4);
+            SetDashTable(APP_DASH_ACL_GROUP_TABLE_NAME, group_id, group);
+        }
+
+        dash::acl_rule::AclRule BuildAclRule(uint32_t priority, const std::string &src_tag = "")
+        {
+            dash::acl_rule::AclRule rule;
+            rule.set_priority(priority);
+            rule.set_action(dash::acl_rule::ACTION_PERMIT);
+            rule.set_terminating(true);
+            if (src_tag.empty())
+            {
+                auto *prefix = rule.add_src_addr();
+                prefix->mutable_ip()->set_ipv4(swss::IpAddress("10.0.0.0").getV4Addr());
+                prefix->mutable_mask()->set_ipv4(swss::IpAddress("255.255.255.0").getV4Addr());
+            }
+            else
+            {
+                rule.add_src_tag(src_tag);
+            }
+            return rule;
+        }
+
+        void SetPrefixTag(const std::string &tag_id, const std::string &prefix, bool expect_empty = true)
+        {
+            dash::tag::PrefixTag tag;
+            tag.set_ip_version(dash::types::IP_VERSION_IPV4);
+            swss::IpPrefix ip_prefix(prefix);
+            auto *pb_prefix = tag.add_prefix_list();
+            pb_prefix->mutable_ip()->set_ipv4(ip_prefix.getIp().getV4Addr());
+            pb_prefix->mutable_mask()->set_ipv4(ip_prefix.getMask().getV4Addr());
+            SetDashTable(APP_DASH_PREFIX_TAG_TABLE_NAME, tag_id, tag, true, expect_empty);
+        }
+
+        void CreateEni(const std::string &eni_id, const std::string &mac)
+        {
+            dash::eni::Eni eni = BuildEniEntry();
+            eni.set_eni_id(eni_id);
+            eni.set_mac_address(mac);
+            SetDashTable(APP_DASH_ENI_TABLE_NAME, eni_id, eni);
+        }
+
+        void BindAclIn(const std::string &eni_id, const std::string &group_id)
+        {
+            dash::acl_in::AclIn acl_in;
+            acl_in.set_v4_acl_group_id(group_id);
+            SetDashTable(APP_DASH_ACL_IN_TABLE_NAME, eni_id + ":1", acl_in);
+        }
+
+        sai_object_id_t GetEniOid(const std::string &eni_id)
+        {
+            return m_DashOrch->getEni(eni_id)->eni_id;
+        }
+
+        /* Group with a tagged and a plain rule bound to ENI_1 and ENI_2 */
+        void CreateBoundGroup()
+        {
+            CreateApplianceEntry();
+            CreateVnet();
+            CreateEni(eni1, "f4:93:9f:ef:c4:7e");
+            CreateEni(eni2, "f4:93:9f:ef:c4:7f");
+
+            SetPrefixTag(tag1, "10.1.0.0/24");
+            CreateAclGroup(group1);
+            ProcessDashEntries(APP_DASH_ACL_RULE_TABLE_NAME, {
+                AclRuleEntry("RULE_1", BuildAclRule(1, tag1)),
+                AclRuleEntry("RULE_2", BuildAclRule(2)),
+            });
+            BindAclIn(eni1, group1);
+            BindAclIn(eni2, group1);
+        }
+
+        swss::KeyOpFieldsValuesTuple AclRuleEntry(const std::string &rule_id, const dash::acl_rule::AclRule &rule)
+        {
+            return swss::KeyOpFieldsValuesTuple(group1 + ":" + rule_id, SET_COMMAND,
+                                                { { "pb", rule.SerializeAsString() } });
+        }
+
+        const DashAclGroup &GetGroup(const std::string &group_id)
+        {
+            return m_dashAclOrch->getDashAclGroupMgr().m_groups_table.at(group_id);
+        }
+    };
+
+    /* Rules received in one batch are created with a single bulk call */
+    TEST_F(DashAclOrchTest, RulesAreBulkCreated)
+    {
+        CreateAclGroup(group1);
+
+        EXPECT_CALL(*mock_sai_dash_acl_api, create_dash_acl_rule).Times(0);
+        EXPECT_CALL(*mock_sai_dash_acl_api, create_dash_acl_rules(_, 3, _, _, _, _, _)).Times(1);
+
+        ProcessDashEntries(APP_DASH_ACL_RULE_TABLE_NAME, {
+            AclRuleEntry("RULE_1", BuildAclRule(1)),
+            AclRuleEntry("RULE_2", BuildAclRule(2)),
+            AclRuleEntry("RULE_3", BuildAclRule(3)),
+        });
+
+        const auto &group = GetGroup(group1);
+        EXPECT_EQ(group.m_dash_acl_rule_table.size(), 3);
+        EXPECT_EQ(group.m_rule_count, 3);
+    }
+
+    /* Setting an existing rule replaces its SAI object instead of leaking a second one */
+    TEST_F(DashAclOrchTest, ExistingRuleIsReplaced)
+    {
+        CreateAclGroup(group1);
+        ProcessDashEntries(APP_DASH_ACL_RULE_TABLE_NAME, { AclRuleEntry("RULE_1", BuildAclRule(1)) });
+        sai_object_id_t oldOid = GetGroup(group1).m_dash_acl_rule_table.at("RULE_1").m_dash_acl_rule_id;
+
+        EXPECT_CALL(*mock_sai_dash_acl_api, remove_dash_acl_rules(1, _, _, _)).Times(1);
+        EXPECT_CALL(*mock_sai_dash_acl_api, create_dash_acl_rules(_, 1, _, _, _, _, _)).Times(1);
+
+        ProcessDashEntries(APP_DASH_ACL_RULE_TABLE_NAME, { AclRuleEntry("RULE_1", BuildAclRule(10)) });
+
+        const auto &group = GetGroup(group1);
+        ASSERT_EQ(group.m_dash_acl_rule_table.size(), 1);
+        EXPECT_NE(group.m_dash_acl_rule_table.at("RULE_1").m_dash_acl_rule_id, oldOid);
+        EXPECT_EQ(group.m_dash_acl_rule_table.at("RULE_1").m_rule.m_priority, 10);
+        EXPECT_EQ(group.m_rule_count, 1);
+    }
+
+    /* When the old rule can't be removed, the replacement created by the same bulk is dropped */
+    TEST_F(DashAclOrchTest, FailedReplaceRemovesNewRule)
+    {
+        CreateAclGroup(group1);
+        ProcessDashEntries(APP_DASH_ACL_RULE_TABLE_NAME, { AclRuleEntry("RULE_1", BuildAclRule(1)) });
+        sai_object_id_t oldOid = GetGroup(group1).m_dash_acl_rule_table.at("RULE_1").m_dash_acl_rule_id;
+        sai_object_id_t newOid = m_nextRuleOid;
+
+        EXPECT_CALL(*mock_sai_dash_acl_api, remove_dash_acl_rules(1, _, _, _))
+            .WillOnce(Invoke([](uint32_t, const sai_object_id_t *, sai_bulk_op_error_mode_t, sai_status_t *statuses) {
+                statuses[0] = SAI_STATUS_OBJECT_IN_USE;
+                return SAI_STATUS_FAILURE;
+            }));
+        EXPECT_CALL(*mock_sai_dash_acl_api, remove_dash_acl_rule(newOid)).WillOnce(Return(SAI_STATUS_SUCCESS));
+
+        ProcessDashEntries(APP_DASH_ACL_RULE_TABLE_NAME, { AclRuleEntry("RULE_1", BuildAclRule(10)) }, false);
+
+        const auto &group = GetGroup(group1);
+        ASSERT_EQ(group.m_dash_acl_rule_table.size(), 1);
+        EXPECT_EQ(group.m_dash_acl_rule_table.at("RULE_1").m_dash_acl_rule_id, oldOid);
+        EXPECT_EQ(group.m_dash_acl_rule_table.at("RULE_1").m_rule.m_priority, 1);
+        EXPECT_EQ(group.m_rule_count, 1);
+    }
+
+    /* Removing a group bulk removes its remaining rules first */
+    TEST_F(DashAclOrchTest, GroupRemovalBulkRemovesRules)
+    {
+        CreateAclGroup(group1);
+        ProcessDashEntries(APP_DASH_ACL_RULE_TABLE_NAME, {
+            AclRuleEntry("RULE_1", BuildAclRule(1)),
+            AclRuleEntry("RULE_2", BuildAclRule(2)),
+        });
+
+        EXPECT_CALL(*mock_sai_dash_acl_api, remove_dash_acl_rule).Times(0);
+        EXPECT_CALL(*mock_sai_dash_acl_api, remove_dash_acl_rules(2, _, _, _)).Times(1);
+
+        SetDashTable(APP_DASH_ACL_GROUP_TABLE_NAME, group1, dash::acl_group::AclGroup(), false);
+
+        EXPECT_FALSE(m_dashAclOrch->getDashAclGroupMgr().exists(group1));
+    }
+
+    /* A tag update only reprograms the rules whose expanded prefixes changed */
+    TEST_F(DashAclOrchTest, TagUpdateReplacesAffectedRulesOnly)
+    {
+        SetPrefixTag(tag1, "10.1.0.0/24");
+        CreateAclGroup(group1);
+        ProcessDashEntries(APP_DASH_ACL_RULE_TABLE_NAME, {
+            AclRuleEntry("RULE_1", BuildAclRule(1, tag1)),
+            AclRuleEntry("RULE_2", BuildAclRule(2)),
+        });
+        sai_object_id_t rule1Oid = GetGroup(group1).m_dash_acl_rule_table.at("RULE_1").m_dash_acl_rule_id;
+        sai_object_id_t rule2Oid = GetGroup(group1).m_dash_acl_rule_table.at("RULE_2").m_dash_acl_rule_id;
+
+        EXPECT_CALL(*mock_sai_dash_acl_api, remove_dash_acl_rules(1, _, _, _)).Times(1);
+        EXPECT_CALL(*mock_sai_dash_acl_api, create_dash_acl_rules(_, 1, _, _, _, _, _)).Times(1);
+
+        SetPrefixTag(tag1, "10.2.0.0/24");
+
+        const auto &group = GetGroup(group1);
+        EXPECT_NE(group.m_dash_acl_rule_table.at("RULE_1").m_dash_acl_rule_id, rule1Oid);
+        EXPECT_EQ(group.m_dash_acl_rule_table.at("RULE_2").m_dash_acl_rule_id, rule2Oid);
+        EXPECT_EQ(group.m_rule_count, 2);
+        ::testing::Mock::VerifyAndClearExpectations(mock_sai_dash_acl_api);
+
+        /* Setting the tag again with the same prefixes touches no rule */
+        EXPECT_CALL(*mock_sai_dash_acl_api, remove_dash_acl_rules).Times(0);
+        EXPECT_CALL(*mock_sai_dash_acl_api, create_dash_acl_rules).Times(0);
+
+        SetPrefixTag(tag1, "10.2.0.0/24");
+    }
+
+    /* A tag update of a bound group moves every ENI to a rebuilt group in one attribute update each */
+    TEST_F(DashAclOrchTest, TagUpdateRebuildsBoundGroup)
+    {
+        EniApiHook hook;
+        CreateBoundGroup();
+        sai_object_id_t oldGroupOid = GetGroup(group1).m_dash_acl_group_id;
+        ASSERT_EQ(_ut_eni_acl_groups[GetEniOid(eni1)], oldGroupOid);
+        ASSERT_EQ(_ut_eni_acl_groups[GetEniOid(eni2)], oldGroupOid);
+        _ut_set_eni_attribute_calls = 0;
+
+        /* Both rules are recreated in the shadow group and the old ones removed */
+        EXPECT_CALL(*mock_sai_dash_acl_api, create_dash_acl_rules(_, 2, _, _, _, _, _)).Times(1);
+        EXPECT_CALL(*mock_sai_dash_acl_api, remove_dash_acl_rules(2, _, _, _)).Times(1);
+
+        SetPrefixTag(tag1, "10.2.0.0/24");
+
+        const auto &group = GetGroup(group1);
+        EXPECT_NE(group.m_dash_acl_group_id, oldGroupOid);
+        EXPECT_EQ(_ut_set_eni_attribute_calls, 2);
+        EXPECT_EQ(_ut_eni_acl_groups[GetEniOid(eni1)], group.m_dash_acl_group_id);
+        EXPECT_EQ(_ut_eni_acl_groups[GetEniOid(eni2)], group.m_dash_acl_group_id);
+        EXPECT_EQ(group.m_dash_acl_rule_table.size(), 2);
+        EXPECT_EQ(group.m_rule_count, 2);
+    }
+
+    /* A failed rebind moves the ENIs already rebound back and drops the shadow group */
+    TEST_F(DashAclOrchTest, FailedRebindRestoresBoundGroup)
+    {
+        EniApiHook hook;
+        CreateBoundGroup();
+        const auto &group = GetGroup(group1);
+        sai_object_id_t oldGroupOid = group.m_dash_acl_group_id;
+        sai_object_id_t rule1Oid = group.m_dash_acl_rule_table.at("RULE_1").m_dash_acl_rule_id;
+        sai_object_id_t rule2Oid = group.m_dash_acl_rule_table.at("RULE_2").m_dash_acl_rule_id;
+        sai_object_id_t shadowRule1Oid = m_nextRuleOid;
+
+        /* The first ENI moves to the shadow group, the second one fails */
+        _ut_set_eni_attribute_calls = 0;
+        _ut_set_eni_attribute_fail_call = 2;
+
+        EXPECT_CALL(*mock_sai_dash_acl_api, create_dash_acl_rules(_, 2, _, _, _, _, _)).Times(1);
+        EXPECT_CALL(*mock_sai_dash_acl_api, remove_dash_acl_rules(2, _, _, _))
+            .WillOnce(Invoke([shadowRule1Oid](uint32_t count, const sai_object_id_t *ids, sai_bulk_op_error_mode_t,
+                                              sai_status_t *statuses) {
+                for (uint32_t i = 0; i < count; i++)
+                {
+                    EXPECT_GE(ids[i], shadowRule1Oid);
+                    statuses[i] = SAI_STATUS_SUCCESS;
+                }
+                return SAI_STATUS_SUCCESS;
+            }));
+
+        SetPrefixTag(tag1, "10.2.0.0/24", false);
+
+        EXPECT_EQ(_ut_set_eni_attribute_calls, 3);
+        EXPECT_EQ(_ut_eni_acl_groups[GetEniOid(eni1)], oldGroupOid);
+        EXPECT_EQ(_ut_eni_acl_groups[GetEniOid(eni2)], oldGroupOid);
+        EXPECT_EQ(group.m_dash_acl_group_id, oldGroupOid);
+        EXPECT_EQ(group.m_dash_acl_rule_table.at("RULE_1").m_dash_acl_rule_id, rule1Oid);
+        EXPECT_EQ(group.m_dash_acl_rule_table.at("RULE_2").m_dash_acl_rule_id, rule2Oid);
+        EXPECT_EQ(group.m_rule_count, 2);
+        ::testing::Mock::VerifyAndClearExpectations(mock_sai_dash_acl_api);
+
+        /* The retry rebuilds the group once the ENIs accept it */
+        SetPrefixTag(tag1, "10.2.0.0/24");
+
+        EXPECT_NE(group.m_dash_acl_group_id, oldGroupOid);
+        EXPECT_EQ(_ut_eni_acl_groups[GetEniOid(eni1)], group.m_dash_acl_group_id);
+        EXPECT_EQ(_ut_eni_acl_groups[GetEniOid(eni2)], group.m_dash_acl_group_id);
+    }
+}
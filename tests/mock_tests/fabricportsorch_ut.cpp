@@ -0,0 +1,114 @@
+#define private public
+#include "fabricportsorch.h"
+#undef private
+#include "mock_orch_test.h"
+#include "mock_table.h"
+#include "sai_serialize.h"
+
+namespace fabricportsorch_test
+{
+    using namespace std;
+    using namespace mock_orch_test;
+
+    static const sai_object_id_t FABRIC_PORT1_ID = 0x1000000000001;
+    static const sai_object_id_t FABRIC_PORT2_ID = 0x1000000000002;
+
+    class FabricPortsOrchTest : public MockOrchTest
+    {
+    protected:
+        FabricPortsOrch *m_fabricPortsOrch;
+        shared_ptr<DBConnector> m_counters_db;
+
+        void PostSetUp() override
+        {
+            vector<table_name_with_pri_t> tables = {
+                { APP_FABRIC_MONITOR_PORT_TABLE_NAME, 30 },
+                { APP_FABRIC_MONITOR_DATA_TABLE_NAME, 30 }
+            };
+            m_fabricPortsOrch = new FabricPortsOrch(m_app_db.get(), tables, false, false);
+            m_counters_db = make_shared<DBConnector>("COUNTERS_DB", 0);
+
+            Table stateTable(m_state_db.get(), APP_FABRIC_PORT_TABLE_NAME);
+            stateTable.set("PORT1", { { "STATUS", "up" }, { "ISOLATED", "0" } });
+            stateTable.set("PORT2", { { "STATUS", "up" }, { "ISOLATED", "0" } });
+
+            Table counterTable(m_counters_db.get(), COUNTERS_TABLE);
+            vector<FieldValueTuple> counters = {
+                { "SAI_PORT_STAT_IF_IN_ERRORS", "0" },
+                { "SAI_PORT_STAT_IF_IN_FABRIC_DATA_UNITS", "1000" },
+                { "SAI_PORT_STAT_IF_IN_FEC_NOT_CORRECTABLE_FRAMES", "0" }
+            };
+            counterTable.set(sai_serialize_object_id(FABRIC_PORT1_ID), counters);
+            counterTable.set(sai_serialize_object_id(FABRIC_PORT2_ID), counters);
+
+            /* Lane 1 is isolated by configuration */
+            Table applTable(m_app_db.get(), APP_FABRIC_MONITOR_PORT_TABLE_NAME);
+            applTable.set("Fabric1", { { "isolateStatus", "True" } });
+        }
+
+        void PreTearDown() override
+        {
+            delete m_fabricPortsOrch;
+            m_fabricPortsOrch = nullptr;
+        }
+
+        FabricPortsOrch::FabricMonitorResult doMonitorPoll()
+        {
+            FabricPortsOrch::FabricMonitorJob job;
+            job.type = FabricPortsOrch::FabricMonitorJob::POLL;
+            job.lanes = { { 1, FABRIC_PORT1_ID }, { 2, FABRIC_PORT2_ID } };
+
+            FabricPortsOrch::FabricMonitorResult result;
+            result.poll = true;
+            m_fabricPortsOrch->doMonitorPoll(job, result);
+            return result;
+        }
+
+        string getState(const string &table, const string &key, const string &field)
+        {
+            Table stateTable(m_state_db.get(), table);
+            string value;
+            stateTable.hget(key, field, value);
+            return value;
+        }
+    };
+
+    /*
+     * A poll reads every link once, posts the isolation of the configured
+     * link back to the main loop and updates the link state, the capacity
+     * and the monitor stats in STATE_DB.
+     */
+    TEST_F(FabricPortsOrchTest, MonitorPollIsolatesConfiguredLink)
+    {
+        auto result = doMonitorPoll();
+
+        ASSERT_EQ(result.isolations.size(), 1);
+        EXPECT_EQ(result.isolations[0].first, 1);
+        EXPECT_TRUE(result.isolations[0].second);
+
+        EXPECT_EQ(getState(APP_FABRIC_PORT_TABLE_NAME, "PORT1", "CONFIG_ISOLATED"), "1");
+        EXPECT_EQ(getState(APP_FABRIC_PORT_TABLE_NAME, "PORT1", "ISOLATED"), "1");
+        EXPECT_EQ(getState(APP_FABRIC_PORT_TABLE_NAME, "PORT2", "ISOLATED"), "0");
+        EXPECT_EQ(getState(APP_FABRIC_PORT_TABLE_NAME, "PORT2", "RX_CELLS"), "1000");
+
+        EXPECT_EQ(getState(STATE_FABRIC_CAPACITY_TABLE_NAME, "FABRIC_CAPACITY_DATA", "number_of_links"), "2");
+        EXPECT_EQ(getState(STATE_FABRIC_CAPACITY_TABLE_NAME, "FABRIC_CAPACITY_DATA", "operating_links"), "1");
+
+        EXPECT_EQ(getState(STATE_FABRIC_CAPACITY_TABLE_NAME, STATE_FABRIC_MONITOR_STATS_KEY, "links"), "2");
+        EXPECT_EQ(getState(STATE_FABRIC_CAPACITY_TABLE_NAME, STATE_FABRIC_MONITOR_STATS_KEY, "polls"), "1");
+    }
+
+    /* Each poll starts from the state written by the previous one */
+    TEST_F(FabricPortsOrchTest, MonitorPollReadsPreviousPollState)
+    {
+        doMonitorPoll();
+        EXPECT_EQ(getState(APP_FABRIC_PORT_TABLE_NAME, "PORT2", "SKIP_CRC_ERR_ON_LNKUP_CNT"), "1");
+
+        auto result = doMonitorPoll();
+
+        /* Lane 1 is already isolated, nothing to apply */
+        EXPECT_TRUE(result.isolations.empty());
+        EXPECT_EQ(getState(APP_FABRIC_PORT_TABLE_NAME, "PORT2", "SKIP_CRC_ERR_ON_LNKUP_CNT"), "2");
+        EXPECT_EQ(getState(STATE_FABRIC_CAPACITY_TABLE_NAME, STATE_FABRIC_MONITOR_STATS_KEY, "polls"), "2");
+    }
+}
@@ -9,6 +9,7 @@
 #include "fdbsyncd/neighbour.h"
 #include "fdbsyncd/fdbsync.h"
 #include "macaddress.h"
+#include "ipaddress.h"
 #undef private
 
 #ifndef RTPROT_HW
@@ -2256,3 +2257,154 @@ TEST_F(FdbSyncdEvpnMhTest, TestMixedNhgAndVtepMacs)
 
     ASSERT_TRUE(true);
 }
+
+TEST_F(FdbSyncdEvpnMhTest, TestLocalMacQueuesNetlinkRequests)
+{
+    m_mockFdbSync.m_isFdbProtoSupported = true;
+    m_mockFdbSync.m_fdbWriter.m_pending.clear();
+
+    struct m_fdb_info info;
+    info.mac = "aa:bb:cc:dd:ee:10";
+    info.vid = "Vlan100";
+    info.port_name = "Ethernet4";
+    info.type = FDB_TYPE_DYNAMIC;
+    info.op_type = FDB_OPER_ADD;
+    m_mockFdbSync.updateLocalMac(&info);
+
+    info.mac = "aa:bb:cc:dd:ee:11";
+    info.type = FDB_TYPE_STATIC;
+    m_mockFdbSync.updateLocalMac(&info);
+    info.op_type = FDB_OPER_DEL;
+    m_mockFdbSync.updateLocalMac(&info);
+
+    // Nothing reaches the kernel before the flush
+    const auto &reqs = m_mockFdbSync.m_fdbWriter.pending();
+    ASSERT_EQ(3u, reqs.size());
+
+    EXPECT_EQ(RTM_NEWNEIGH, reqs[0].msgType);
+    EXPECT_EQ(NLM_F_CREATE | NLM_F_REPLACE, reqs[0].msgFlags);
+    EXPECT_EQ("Ethernet4", reqs[0].ifname);
+    EXPECT_EQ("aa:bb:cc:dd:ee:10", reqs[0].mac);
+    EXPECT_EQ(100, reqs[0].vlan);
+    EXPECT_EQ(NTF_MASTER | NTF_EXT_LEARNED, reqs[0].ndmFlags);
+    EXPECT_EQ(NUD_REACHABLE, reqs[0].state);
+    EXPECT_EQ(RTPROT_HW, reqs[0].protocol);
+
+    EXPECT_EQ(RTM_NEWNEIGH, reqs[1].msgType);
+    EXPECT_EQ(NTF_MASTER, reqs[1].ndmFlags);
+    EXPECT_EQ(NUD_NOARP, reqs[1].state);
+    EXPECT_EQ(RTPROT_UNSPEC, reqs[1].protocol);
+
+    EXPECT_EQ(RTM_DELNEIGH, reqs[2].msgType);
+    EXPECT_EQ(0, reqs[2].msgFlags);
+    EXPECT_EQ("Ethernet4", reqs[2].ifname);
+
+    // None of the ports exist here, the requests fail without being sent
+    EXPECT_EQ(3u, m_mockFdbSync.m_fdbWriter.flush());
+    EXPECT_TRUE(m_mockFdbSync.m_fdbWriter.pending().empty());
+}
+
+TEST_F(FdbSyncdEvpnMhTest, TestMacDelVxlanEntryQueuesSelfDelete)
+{
+    m_mockFdbSync.m_fdbWriter.m_pending.clear();
+
+    std::string vtep_key = "Vlan200:cc:dd:ee:ff:00:01";
+    m_mockFdbSync.m_mac[vtep_key].ifname = "Vxlan-200";
+    m_mockFdbSync.m_mac[vtep_key].nhtype = FdbDest::VTEP;
+    m_mockFdbSync.m_mac[vtep_key].nexthop_value = "10.0.0.2";
+
+    std::string nhg_key = "Vlan200:cc:dd:ee:ff:00:02";
+    m_mockFdbSync.m_mac[nhg_key].ifname = "Vxlan-200";
+    m_mockFdbSync.m_mac[nhg_key].nhtype = FdbDest::NEXTHOPGROUP;
+    m_mockFdbSync.m_mac[nhg_key].nexthop_value = "536870913";
+
+    struct m_fdb_info info;
+    info.vid = "Vlan200";
+    info.op_type = FDB_OPER_DEL;
+    info.mac = "cc:dd:ee:ff:00:01";
+    m_mockFdbSync.macDelVxlanEntry(&info);
+    info.mac = "cc:dd:ee:ff:00:02";
+    m_mockFdbSync.macDelVxlanEntry(&info);
+
+    const auto &reqs = m_mockFdbSync.m_fdbWriter.pending();
+    ASSERT_EQ(2u, reqs.size());
+
+    EXPECT_EQ(RTM_DELNEIGH, reqs[0].msgType);
+    EXPECT_EQ(NTF_SELF, reqs[0].ndmFlags);
+    EXPECT_EQ("Vxlan-200", reqs[0].ifname);
+    EXPECT_EQ(200, reqs[0].vlan);
+    EXPECT_EQ("10.0.0.2", reqs[0].dst);
+    EXPECT_EQ(0u, reqs[0].nhid);
+
+    EXPECT_EQ(RTM_DELNEIGH, reqs[1].msgType);
+    EXPECT_TRUE(reqs[1].dst.empty());
+    EXPECT_EQ(536870913u, reqs[1].nhid);
+
+    m_mockFdbSync.m_fdbWriter.m_pending.clear();
+}
+
+TEST(FdbNlWriterTest, EncodeBridgeFdbRequest)
+{
+    FdbNlRequest req;
+    req.msgType = RTM_NEWNEIGH;
+    req.msgFlags = NLM_F_CREATE | NLM_F_REPLACE;
+    req.ifname = "Vxlan-100";
+    req.mac = "00:11:22:33:44:55";
+    req.vlan = 100;
+    req.ndmFlags = NTF_SELF;
+    req.state = NUD_NOARP;
+    req.dst = "10.1.1.1";
+    req.protocol = RTPROT_ZEBRA;
+
+    std::vector<char> buf;
+    ASSERT_TRUE(FdbNlWriter::encode(req, 7, 42, buf));
+    ASSERT_TRUE(FdbNlWriter::encode(req, 7, 43, buf));
+
+    struct nlmsghdr *nlh = reinterpret_cast<struct nlmsghdr *>(buf.data());
+    ASSERT_EQ(2 * NLMSG_ALIGN(nlh->nlmsg_len), buf.size());
+    EXPECT_EQ(RTM_NEWNEIGH, nlh->nlmsg_type);
+    EXPECT_EQ(NLM_F_REQUEST | NLM_F_ACK | NLM_F_CREATE | NLM_F_REPLACE, nlh->nlmsg_flags);
+    EXPECT_EQ(42u, nlh->nlmsg_seq);
+
+    struct ndmsg *ndm = static_cast<struct ndmsg *>(NLMSG_DATA(nlh));
+    EXPECT_EQ(AF_BRIDGE, ndm->ndm_family);
+    EXPECT_EQ(7, ndm->ndm_ifindex);
+    EXPECT_EQ(NTF_SELF, ndm->ndm_flags);
+    EXPECT_EQ(NUD_NOARP, ndm->ndm_state);
+
+    bool lladdr = false, vlan = false, dst = false, proto = false;
+    int len = static_cast<int>(nlh->nlmsg_len - NLMSG_LENGTH(sizeof(struct ndmsg)));
+    for (struct rtattr *rta = NDA_RTA(ndm); RTA_OK(rta, len); rta = RTA_NEXT(rta, len))
+    {
+        switch (rta->rta_type)
+        {
+        case NDA_LLADDR:
+            lladdr = (swss::MacAddress(static_cast<uint8_t *>(RTA_DATA(rta))).to_string() == req.mac);
+            break;
+        case NDA_VLAN:
+            vlan = (*static_cast<uint16_t *>(RTA_DATA(rta)) == 100);
+            break;
+        case NDA_DST:
+            dst = (RTA_PAYLOAD(rta) == sizeof(struct in_addr) &&
+                   swss::IpAddress(*static_cast<uint32_t *>(RTA_DATA(rta))).to_string() == req.dst);
+            break;
+        case NDA_PROTOCOL:
+            proto = (*static_cast<uint8_t *>(RTA_DATA(rta)) == RTPROT_ZEBRA);
+            break;
+        case NDA_NH_ID:
+            ADD_FAILURE() << "unexpected NDA_NH_ID";
+            break;
+        }
+    }
+    EXPECT_TRUE(lladdr);
+    EXPECT_TRUE(vlan);
+    EXPECT_TRUE(dst);
+    EXPECT_TRUE(proto);
+
+    struct nlmsghdr *next = reinterpret_cast<struct nlmsghdr *>(buf.data() + NLMSG_ALIGN(nlh->nlmsg_len));
+    EXPECT_EQ(43u, next->nlmsg_seq);
+
+    req.mac = "not-a-mac";
+    EXPECT_FALSE(FdbNlWriter::encode(req, 7, 44, buf));
+    EXPECT_EQ(2 * NLMSG_ALIGN(nlh->nlmsg_len), buf.size());
+}
@@ -1251,4 +1251,111 @@ namespace flexcounter_test
                                          }
                                      }));
     }
+
+    TEST_F(StandaloneFCTest, TestVectorRegistration)
+    {
+        bool traditionalFlexCounter = gTraditionalFlexCounter;
+        gTraditionalFlexCounter = false;
+
+        FlexCounterTaggedCachedManager<sai_queue_type_t> queue_stat_manager("TEST_QUEUE_STAT_COUNTER", StatsMode::READ, 10000, false);
+        std::unordered_set<string> queue_stats = {
+            "SAI_QUEUE_STAT_PACKETS",
+            "SAI_QUEUE_STAT_BYTES"
+        };
+
+        std::vector<sai_object_id_t> queue_oids;
+        for (sai_object_id_t oid = 0x15000000000100; oid < 0x15000000000110; oid++)
+        {
+            queue_oids.push_back(oid);
+        }
+        std::vector<sai_object_id_t> first_half(queue_oids.begin(), queue_oids.begin() + queue_oids.size() / 2);
+        std::vector<sai_object_id_t> second_half(queue_oids.begin() + queue_oids.size() / 2, queue_oids.end());
+
+        /* Objects registered one by one and as a list merge into the same pending entry */
+        mockFlexCounterOperationCallCount = 0;
+        for (auto oid : first_half)
+        {
+            queue_stat_manager.setCounterIdList(oid, CounterType::QUEUE, queue_stats, SAI_QUEUE_TYPE_UNICAST);
+        }
+        queue_stat_manager.setCounterIdList(second_half, CounterType::QUEUE, queue_stats, SAI_QUEUE_TYPE_UNICAST);
+        queue_stat_manager.flush();
+
+        ASSERT_EQ(mockFlexCounterOperationCallCount, 1);
+        for (auto oid : queue_oids)
+        {
+            ASSERT_TRUE(checkFlexCounter("TEST_QUEUE_STAT_COUNTER", oid,
+                                         {
+                                             {QUEUE_COUNTER_ID_LIST,
+                                              "SAI_QUEUE_STAT_PACKETS,"
+                                              "SAI_QUEUE_STAT_BYTES"
+                                             }
+                                         }));
+        }
+
+        /* The uncached manager installs the whole list with one operation */
+        mockFlexCounterOperationCallCount = 0;
+        FlexCounterManager pg_stat_manager("TEST_PG_DROP_STAT_COUNTER", StatsMode::READ, 10000, false);
+        pg_stat_manager.setCounterIdList(queue_oids, CounterType::PRIORITY_GROUP, { "SAI_INGRESS_PRIORITY_GROUP_STAT_DROPPED_PACKETS" });
+        ASSERT_EQ(mockFlexCounterOperationCallCount, 1);
+        ASSERT_TRUE(checkFlexCounter("TEST_PG_DROP_STAT_COUNTER", queue_oids.back(),
+                                     {
+                                         {PG_COUNTER_ID_LIST,
+                                          "SAI_INGRESS_PRIORITY_GROUP_STAT_DROPPED_PACKETS"
+                                         }
+                                     }));
+
+        pg_stat_manager.clearCounterIdList(queue_oids.back());
+        ASSERT_FALSE(checkFlexCounter("TEST_PG_DROP_STAT_COUNTER", queue_oids.back(), PG_COUNTER_ID_LIST));
+
+        gTraditionalFlexCounter = traditionalFlexCounter;
+    }
+
+    TEST_F(StandaloneFCTest, BootRegistrationOperationCount)
+    {
+        /* Queue counters of a large VOQ chassis, registered the way PortsOrch does at boot */
+        const size_t ports = 512;
+        const size_t queues = 64;
+
+        bool traditionalFlexCounter = gTraditionalFlexCounter;
+        gTraditionalFlexCounter = false;
+
+        std::unordered_set<string> queue_stats = {
+            "SAI_QUEUE_STAT_PACKETS",
+            "SAI_QUEUE_STAT_BYTES",
+            "SAI_QUEUE_STAT_DROPPED_PACKETS",
+            "SAI_QUEUE_STAT_DROPPED_BYTES"
+        };
+
+        std::vector<std::vector<sai_object_id_t>> port_queues(ports);
+        sai_object_id_t oid = 0x15000000010000;
+        for (auto &port : port_queues)
+        {
+            for (size_t q = 0; q < queues; q++)
+            {
+                port.push_back(oid++);
+            }
+        }
+
+        FlexCounterManager per_object_manager("TEST_QUEUE_STAT_COUNTER", StatsMode::READ, 10000, false);
+        mockFlexCounterOperationCallCount = 0;
+        for (const auto &port : port_queues)
+        {
+            for (auto queue : port)
+            {
+                per_object_manager.setCounterIdList(queue, CounterType::QUEUE, queue_stats);
+            }
+        }
+        ASSERT_EQ(mockFlexCounterOperationCallCount, ports * queues);
+
+        FlexCounterTaggedCachedManager<sai_queue_type_t> vector_manager("TEST_QUEUE_WATERMARK_STAT_COUNTER", StatsMode::READ, 10000, false);
+        mockFlexCounterOperationCallCount = 0;
+        for (const auto &port : port_queues)
+        {
+            vector_manager.setCounterIdList(port, CounterType::QUEUE, queue_stats, SAI_QUEUE_TYPE_UNICAST);
+        }
+        vector_manager.flush();
+        ASSERT_EQ(mockFlexCounterOperationCallCount, 1);
+
+        gTraditionalFlexCounter = traditionalFlexCounter;
+    }
 }
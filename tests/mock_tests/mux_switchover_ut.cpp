@@ -0,0 +1,283 @@
+#define private public
+#include "directory.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#include "ut_helper.h"
+#define private public
+#define protected public
+#include "neighorch.h"
+#include "muxorch.h"
+#include "fdborch.h"
+#undef protected
+#undef private
+#include "mock_orchagent_main.h"
+#include "mock_sai_api.h"
+#include "mock_orch_test.h"
+#include "nexthopkey.h"
+#include "ipaddress.h"
+#include "gtest/gtest.h"
+#include <string>
+
+EXTERN_MOCK_FNS
+
+namespace mux_switchover_test
+{
+    DEFINE_SAI_API_MOCK(neighbor);
+    DEFINE_SAI_API_MOCK_SPECIFY_ENTRY_WITH_SET(route, route);
+    DEFINE_SAI_GENERIC_API_MOCK(acl, acl_entry);
+    DEFINE_SAI_GENERIC_API_OBJECT_BULK_MOCK(next_hop, next_hop);
+    using ::testing::_;
+    using namespace std;
+    using namespace mock_orch_test;
+    using ::testing::Return;
+    using ::testing::Throw;
+
+    static const vector<string> TEST_INTERFACES = { ETHERNET4, ETHERNET8 };
+    static const vector<string> TEST_SERVER_IPS = { SERVER_IP1, SERVER_IP2 };
+    static const vector<string> TEST_MACS = { MAC4, MAC5 };
+
+    sai_bulk_create_neighbor_entry_fn old_create_neighbor_entries;
+    sai_bulk_remove_neighbor_entry_fn old_remove_neighbor_entries;
+    sai_bulk_create_route_entry_fn old_create_route_entries;
+    sai_bulk_remove_route_entry_fn old_remove_route_entries;
+    sai_bulk_object_create_fn old_object_create;
+    sai_bulk_object_remove_fn old_object_remove;
+
+    // Two host route mux cables, each with one neighbor, switched together
+    class MuxSwitchoverTest : public MockOrchTest
+    {
+    protected:
+        void SetMuxStatesFromAppDb(const string& state)
+        {
+            Table mux_cable_table = Table(m_app_db.get(), APP_MUX_CABLE_TABLE_NAME);
+            for (const auto& intf : TEST_INTERFACES)
+            {
+                mux_cable_table.set(intf, { { STATE, state } });
+            }
+            m_MuxCableOrch->addExistingData(&mux_cable_table);
+            static_cast<Orch *>(m_MuxCableOrch)->doTask();
+        }
+
+        void AssertMuxStates(const string& state)
+        {
+            for (const auto& intf : TEST_INTERFACES)
+            {
+                EXPECT_EQ(state, m_MuxOrch->getMuxCable(intf)->getState());
+            }
+        }
+
+        void ApplyInitialConfigs()
+        {
+            Table peer_switch_table = Table(m_config_db.get(), CFG_PEER_SWITCH_TABLE_NAME);
+            Table decap_tunnel_table = Table(m_app_db.get(), APP_TUNNEL_DECAP_TABLE_NAME);
+            Table decap_term_table = Table(m_app_db.get(), APP_TUNNEL_DECAP_TERM_TABLE_NAME);
+            Table mux_cable_table = Table(m_config_db.get(), CFG_MUX_CABLE_TABLE_NAME);
+            Table port_table = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+            Table vlan_table = Table(m_app_db.get(), APP_VLAN_TABLE_NAME);
+            Table vlan_member_table = Table(m_app_db.get(), APP_VLAN_MEMBER_TABLE_NAME);
+            Table neigh_table = Table(m_app_db.get(), APP_NEIGH_TABLE_NAME);
+            Table intf_table = Table(m_app_db.get(), APP_INTF_TABLE_NAME);
+
+            auto ports = ut_helper::getInitialSaiPorts();
+            for (const auto& intf : TEST_INTERFACES)
+            {
+                port_table.set(intf, ports[intf]);
+            }
+            port_table.set("PortConfigDone", { { "count", to_string(TEST_INTERFACES.size()) } });
+            port_table.set("PortInitDone", { {} });
+
+            for (size_t i = 0; i < TEST_SERVER_IPS.size(); i++)
+            {
+                neigh_table.set(
+                    VLAN_1000 + neigh_table.getTableNameSeparator() + TEST_SERVER_IPS[i], { { "neigh", TEST_MACS[i] },
+                                                                                           { "family", "IPv4" } });
+            }
+
+            vlan_table.set(VLAN_1000, { { "admin_status", "up" },
+                                        { "mtu", "9100" },
+                                        { "mac", "00:aa:bb:cc:dd:ee" } });
+            for (const auto& intf : TEST_INTERFACES)
+            {
+                vlan_member_table.set(
+                    VLAN_1000 + vlan_member_table.getTableNameSeparator() + intf,
+                    { { "tagging_mode", "untagged" } });
+            }
+
+            intf_table.set(VLAN_1000, { { "grat_arp", "enabled" },
+                                        { "proxy_arp", "enabled" },
+                                        { "mac_addr", "00:00:00:00:00:00" } });
+            intf_table.set(
+                VLAN_1000 + neigh_table.getTableNameSeparator() + "192.168.0.1/21", {
+                                                                                        { "scope", "global" },
+                                                                                        { "family", "IPv4" },
+                                                                                    });
+
+            decap_term_table.set(
+                MUX_TUNNEL + neigh_table.getTableNameSeparator() + "2.2.2.2", { { "src_ip", "1.1.1.1" },
+                                                                                { "term_type", "P2P" } });
+
+            decap_tunnel_table.set(MUX_TUNNEL, { { "dscp_mode", "uniform" },
+                                                 { "src_ip", "1.1.1.1" },
+                                                 { "ecn_mode", "copy_from_outer" },
+                                                 { "encap_ecn_mode", "standard" },
+                                                 { "ttl_mode", "pipe" },
+                                                 { "tunnel_type", "IPINIP" } });
+
+            peer_switch_table.set(PEER_SWITCH_HOSTNAME, { { "address_ipv4", PEER_IPV4_ADDRESS } });
+
+            mux_cable_table.set(ETHERNET4, { { "server_ipv4", SERVER_IP1 + "/32" },
+                                             { "server_ipv6", "a::a/128" },
+                                             { "neighbor_mode", "host-route" },
+                                             { "state", "auto" } });
+            mux_cable_table.set(ETHERNET8, { { "server_ipv4", SERVER_IP2 + "/32" },
+                                             { "server_ipv6", "a::b/128" },
+                                             { "neighbor_mode", "host-route" },
+                                             { "state", "auto" } });
+
+            gPortsOrch->addExistingData(&port_table);
+            gPortsOrch->addExistingData(&vlan_table);
+            gPortsOrch->addExistingData(&vlan_member_table);
+            static_cast<Orch *>(gPortsOrch)->doTask();
+
+            gIntfsOrch->addExistingData(&intf_table);
+            static_cast<Orch *>(gIntfsOrch)->doTask();
+
+            m_TunnelDecapOrch->addExistingData(&decap_tunnel_table);
+            m_TunnelDecapOrch->addExistingData(&decap_term_table);
+            static_cast<Orch *>(m_TunnelDecapOrch)->doTask();
+
+            m_MuxOrch->addExistingData(&peer_switch_table);
+            static_cast<Orch *>(m_MuxOrch)->doTask();
+
+            m_MuxOrch->addExistingData(&mux_cable_table);
+            static_cast<Orch *>(m_MuxOrch)->doTask();
+
+            gNeighOrch->addExistingData(&neigh_table);
+            static_cast<Orch *>(gNeighOrch)->doTask();
+
+            m_MuxCable = m_MuxOrch->getMuxCable(ETHERNET4);
+
+            AssertMuxStates(STANDBY_STATE);
+        }
+
+        void PostSetUp() override
+        {
+            INIT_SAI_API_MOCK(neighbor);
+            INIT_SAI_API_MOCK(route);
+            INIT_SAI_API_MOCK(acl);
+            INIT_SAI_API_MOCK(next_hop);
+            MockSaiApis();
+            old_create_neighbor_entries = gNeighOrch->gNeighBulker.create_entries;
+            old_remove_neighbor_entries = gNeighOrch->gNeighBulker.remove_entries;
+            old_object_create = gNeighOrch->gNextHopBulker.create_entries;
+            old_object_remove = gNeighOrch->gNextHopBulker.remove_entries;
+            old_create_route_entries = m_MuxOrch->switchover_route_bulker_.create_entries;
+            old_remove_route_entries = m_MuxOrch->switchover_route_bulker_.remove_entries;
+            gNeighOrch->gNeighBulker.create_entries = mock_create_neighbor_entries;
+            gNeighOrch->gNeighBulker.remove_entries = mock_remove_neighbor_entries;
+            gNeighOrch->gNextHopBulker.create_entries = mock_create_next_hops;
+            gNeighOrch->gNextHopBulker.remove_entries = mock_remove_next_hops;
+            m_MuxOrch->switchover_route_bulker_.create_entries = mock_create_route_entries;
+            m_MuxOrch->switchover_route_bulker_.remove_entries = mock_remove_route_entries;
+        }
+
+        void PreTearDown() override
+        {
+            RestoreSaiApis();
+            DEINIT_SAI_API_MOCK(next_hop);
+            DEINIT_SAI_API_MOCK(acl);
+            DEINIT_SAI_API_MOCK(route);
+            DEINIT_SAI_API_MOCK(neighbor);
+            gNeighOrch->gNeighBulker.create_entries = old_create_neighbor_entries;
+            gNeighOrch->gNeighBulker.remove_entries = old_remove_neighbor_entries;
+            gNeighOrch->gNextHopBulker.create_entries = old_object_create;
+            gNeighOrch->gNextHopBulker.remove_entries = old_object_remove;
+            m_MuxOrch->switchover_route_bulker_.create_entries = old_create_route_entries;
+            m_MuxOrch->switchover_route_bulker_.remove_entries = old_remove_route_entries;
+        }
+    };
+
+    TEST_F(MuxSwitchoverTest, StandbyToActiveOneBulkCallPerStage)
+    {
+        EXPECT_CALL(*mock_sai_neighbor_api, create_neighbor_entries(2, _, _, _, _, _)).Times(1);
+        EXPECT_CALL(*mock_sai_next_hop_api, create_next_hops(_, 2, _, _, _, _, _)).Times(1);
+        EXPECT_CALL(*mock_sai_route_api, remove_route_entries(2, _, _, _)).Times(1);
+
+        SetMuxStatesFromAppDb(ACTIVE_STATE);
+        AssertMuxStates(ACTIVE_STATE);
+
+        // The failover time is reported for every cable of the batch
+        Table mux_metric_table = Table(m_state_db.get(), STATE_MUX_METRICS_TABLE_NAME);
+        for (const auto& intf : TEST_INTERFACES)
+        {
+            string cables, usec;
+            ASSERT_TRUE(mux_metric_table.hget(intf, "orch_switchover_cables", cables));
+            EXPECT_EQ("2", cables);
+            ASSERT_TRUE(mux_metric_table.hget(intf, "orch_switchover_usec", usec));
+        }
+    }
+
+    TEST_F(MuxSwitchoverTest, ActiveToStandbyOneBulkCallPerStage)
+    {
+        SetMuxStatesFromAppDb(ACTIVE_STATE);
+        AssertMuxStates(ACTIVE_STATE);
+
+        EXPECT_CALL(*mock_sai_route_api, create_route_entries(2, _, _, _, _, _)).Times(1);
+        EXPECT_CALL(*mock_sai_neighbor_api, remove_neighbor_entries(2, _, _, _)).Times(1);
+        EXPECT_CALL(*mock_sai_next_hop_api, remove_next_hops(2, _, _, _)).Times(1);
+
+        SetMuxStatesFromAppDb(STANDBY_STATE);
+        AssertMuxStates(STANDBY_STATE);
+    }
+
+    TEST_F(MuxSwitchoverTest, StandbyToActiveBatchFailureFallsBackPerCable)
+    {
+        EXPECT_CALL(*mock_sai_route_api, remove_route_entries(2, _, _, _))
+            .WillOnce(Throw(runtime_error("Mock runtime error")));
+
+        // The cables roll back together and then switch one by one
+        SetMuxStatesFromAppDb(ACTIVE_STATE);
+        AssertMuxStates(ACTIVE_STATE);
+        for (const auto& intf : TEST_INTERFACES)
+        {
+            EXPECT_FALSE(m_MuxOrch->getMuxCable(intf)->isStateChangeInProgress());
+        }
+    }
+
+    TEST_F(MuxSwitchoverTest, StandbyToActiveFailureRollsBackOnlyFailedCable)
+    {
+        // Route removals of Ethernet4 on its own go through the SAI mock too
+        m_MuxCable->nbr_handler_->gRouteBulker.remove_entries = mock_remove_route_entries;
+
+        EXPECT_CALL(*mock_sai_route_api, remove_route_entries(2, _, _, _))
+            .WillOnce(Throw(runtime_error("Mock runtime error")));
+        EXPECT_CALL(*mock_sai_route_api, remove_route_entries(1, _, _, _))
+            .WillOnce(Throw(runtime_error("Mock runtime error")));
+
+        SetMuxStatesFromAppDb(ACTIVE_STATE);
+        EXPECT_EQ(STANDBY_STATE, m_MuxOrch->getMuxCable(ETHERNET4)->getState());
+        EXPECT_EQ(ACTIVE_STATE, m_MuxOrch->getMuxCable(ETHERNET8)->getState());
+        for (const auto& intf : TEST_INTERFACES)
+        {
+            EXPECT_FALSE(m_MuxOrch->getMuxCable(intf)->isStateChangeInProgress());
+        }
+    }
+
+    TEST_F(MuxSwitchoverTest, NeighborUpdateRebuildsSwitchoverPlan)
+    {
+        auto handler = m_MuxCable->nbr_handler_.get();
+        ASSERT_EQ(1u, handler->getSwitchoverPlan().size());
+        EXPECT_TRUE(handler->plan_valid_);
+
+        NextHopKey nh(IpAddress(SERVER_IP1), VLAN_1000);
+        m_MuxCable->updateNeighbor(nh, false);
+        EXPECT_FALSE(handler->plan_valid_);
+        EXPECT_EQ(0u, handler->getSwitchoverPlan().size());
+
+        m_MuxCable->updateNeighbor(nh, true);
+        ASSERT_EQ(1u, handler->getSwitchoverPlan().size());
+        EXPECT_EQ(nh, handler->getSwitchoverPlan()[0].nh);
+    }
+}
@@ -0,0 +1,173 @@
+#include <chrono>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+#include <linux/neighbour.h>
+#include <netlink/route/link.h>
+#include <netlink/route/neighbour.h>
+
+#include "mock_table.h"
+#include "linkcache.h"
+#define private public
+#include "neighsync.h"
+#undef private
+
+/*
+ * NeighSync opens its own netlink socket and link cache, which are only used
+ * for the EVPN master lookup. They are replaced by fake handles here.
+ */
+extern "C" {
+
+struct nl_sock *__wrap_nl_socket_alloc(void)
+{
+    static char fake_sock_mem[256];
+    return reinterpret_cast<struct nl_sock *>(fake_sock_mem);
+}
+
+int __wrap_nl_connect(struct nl_sock *sk, int protocol)
+{
+    return 0;
+}
+
+void __wrap_nl_close(struct nl_sock *sk)
+{
+}
+
+void __wrap_nl_socket_free(struct nl_sock *sk)
+{
+}
+
+int __wrap_rtnl_link_alloc_cache(struct nl_sock *sk, int family, struct nl_cache **result)
+{
+    static char fake_cache_mem[256];
+    *result = reinterpret_cast<struct nl_cache *>(fake_cache_mem);
+    return 0;
+}
+
+void __wrap_nl_cache_free(struct nl_cache *cache)
+{
+}
+
+}
+
+namespace neighsyncd_ut
+{
+    /* Loopback always has ifindex 1 */
+    const int IFINDEX = 1;
+
+    struct NeighSyncdTest : public ::testing::Test
+    {
+        std::shared_ptr<swss::DBConnector> m_config_db;
+        std::shared_ptr<swss::DBConnector> m_app_db;
+        std::shared_ptr<swss::DBConnector> m_state_db;
+        std::shared_ptr<swss::RedisPipeline> m_pipeline;
+        std::string m_ifname;
+
+        void SetUp() override
+        {
+            testing_db::reset();
+            m_config_db = std::make_shared<swss::DBConnector>("CONFIG_DB", 0);
+            m_app_db = std::make_shared<swss::DBConnector>("APPL_DB", 0);
+            m_state_db = std::make_shared<swss::DBConnector>("STATE_DB", 0);
+            m_pipeline = std::make_shared<swss::RedisPipeline>(m_app_db.get());
+            m_ifname = swss::LinkCache::getInstance().ifindexToName(IFINDEX);
+        }
+
+        void TearDown() override
+        {
+            testing_db::reset();
+        }
+
+        /* Hands a neighbor netlink message to neighsyncd */
+        void sendNeigh(swss::NeighSync &sync, int nlmsg_type, int family, const std::string &ip,
+                       const std::string &mac, int state = NUD_REACHABLE)
+        {
+            struct rtnl_neigh *neigh = rtnl_neigh_alloc();
+            rtnl_neigh_set_ifindex(neigh, IFINDEX);
+            rtnl_neigh_set_family(neigh, family);
+
+            struct nl_addr *dst = nullptr;
+            ASSERT_EQ(nl_addr_parse(ip.c_str(), family, &dst), 0);
+            rtnl_neigh_set_dst(neigh, dst);
+            nl_addr_put(dst);
+
+            struct nl_addr *lladdr = nullptr;
+            ASSERT_EQ(nl_addr_parse(mac.c_str(), AF_LLC, &lladdr), 0);
+            rtnl_neigh_set_lladdr(neigh, lladdr);
+            nl_addr_put(lladdr);
+
+            rtnl_neigh_set_state(neigh, state);
+
+            sync.onMsg(nlmsg_type, reinterpret_cast<struct nl_object *>(neigh));
+            rtnl_neigh_put(neigh);
+        }
+
+        bool getNeighMac(const std::string &ip, std::string &mac)
+        {
+            swss::Table neighTable(m_app_db.get(), APP_NEIGH_TABLE_NAME);
+            return neighTable.hget(m_ifname + ":" + ip, "neigh", mac);
+        }
+    };
+
+    TEST_F(NeighSyncdTest, UpdatesAreCoalescedUntilFlush)
+    {
+        swss::NeighSync sync(m_pipeline.get(), m_state_db.get(), m_config_db.get(), m_app_db.get());
+        std::string mac;
+
+        sendNeigh(sync, RTM_NEWNEIGH, AF_INET, "10.0.0.1", "00:00:00:00:00:01");
+        sendNeigh(sync, RTM_NEWNEIGH, AF_INET, "10.0.0.1", "00:00:00:00:00:02");
+        sendNeigh(sync, RTM_NEWNEIGH, AF_INET, "10.0.0.2", "00:00:00:00:00:03");
+        sendNeigh(sync, RTM_DELNEIGH, AF_INET, "10.0.0.2", "00:00:00:00:00:03");
+
+        /* Nothing is written before the flush */
+        EXPECT_FALSE(getNeighMac("10.0.0.1", mac));
+        EXPECT_EQ(sync.m_pendingNeighs.size(), 2);
+
+        sync.flush();
+
+        /* The last update of every neighbor wins */
+        ASSERT_TRUE(getNeighMac("10.0.0.1", mac));
+        EXPECT_EQ(mac, "00:00:00:00:00:02");
+        EXPECT_FALSE(getNeighMac("10.0.0.2", mac));
+        EXPECT_TRUE(sync.m_pendingNeighs.empty());
+        EXPECT_EQ(sync.m_updates, 4);
+        EXPECT_EQ(sync.m_writes, 2);
+
+        /* A delete in a later batch removes the written entry */
+        sendNeigh(sync, RTM_DELNEIGH, AF_INET, "10.0.0.1", "00:00:00:00:00:02");
+        sync.flush();
+        EXPECT_FALSE(getNeighMac("10.0.0.1", mac));
+    }
+
+    TEST_F(NeighSyncdTest, CachedConfigIsUsed)
+    {
+        swss::NeighSync sync(m_pipeline.get(), m_state_db.get(), m_config_db.get(), m_app_db.get());
+        std::string mac;
+
+        /* Without a peer switch an unresolved neighbor is removed */
+        sendNeigh(sync, RTM_NEWNEIGH, AF_INET, "10.0.0.1", "00:00:00:00:00:01", NUD_FAILED);
+        ASSERT_EQ(sync.m_pendingNeighs.size(), 1);
+        EXPECT_TRUE(sync.m_pendingNeighs.begin()->second.del);
+
+        /* On dual ToR it is kept with a zero MAC and link local neighbors are ignored */
+        sync.m_peerSwitches.insert("peer_switch_hostname");
+        sendNeigh(sync, RTM_NEWNEIGH, AF_INET, "10.0.0.1", "00:00:00:00:00:01", NUD_FAILED);
+        sendNeigh(sync, RTM_NEWNEIGH, AF_INET, "169.254.0.1", "00:00:00:00:00:02");
+        sync.flush();
+
+        ASSERT_TRUE(getNeighMac("10.0.0.1", mac));
+        EXPECT_EQ(mac, "00:00:00:00:00:00");
+        EXPECT_FALSE(getNeighMac("169.254.0.1", mac));
+
+        /* ipv6_use_link_local_only is read from the cache */
+        EXPECT_FALSE(sync.isLinkLocalEnabled("Ethernet0"));
+        sync.m_linkLocalEnabled["Ethernet0"] = true;
+        sync.m_linkLocalEnabled["Ethernet4"] = false;
+        EXPECT_TRUE(sync.isLinkLocalEnabled("Ethernet0"));
+        EXPECT_FALSE(sync.isLinkLocalEnabled("Ethernet4"));
+    }
+}
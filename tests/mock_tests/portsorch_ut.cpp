@@ -140,6 +140,35 @@ namespace portsorch_test
         return status;
     }
 
+    // Bulk gets per attribute id, the first attribute of each call counts
+    std::map<sai_attr_id_t, uint32_t> _sai_get_ports_attribute_count;
+
+    sai_status_t _ut_stub_sai_get_ports_attribute(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ const uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        if (object_count > 0)
+        {
+            _sai_get_ports_attribute_count[attr_list[0][0].id]++;
+        }
+
+        // Serve each object from the single get stub so the mocks above apply to bulk reads too
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t idx = 0; idx < object_count; idx++)
+        {
+            object_statuses[idx] = _ut_stub_sai_get_port_attribute(object_id[idx], attr_count[idx], attr_list[idx]);
+            if (object_statuses[idx] != SAI_STATUS_SUCCESS)
+            {
+                status = SAI_STATUS_FAILURE;
+            }
+        }
+        return status;
+    }
+
     uint32_t _sai_set_pfc_mode_count;
     uint32_t _sai_set_admin_state_up_count;
     uint32_t _sai_set_admin_state_down_count;
@@ -429,6 +458,7 @@ namespace portsorch_test
         ut_sai_port_api = *sai_port_api;
         pold_sai_port_api = sai_port_api;
         ut_sai_port_api.get_port_attribute = _ut_stub_sai_get_port_attribute;
+        ut_sai_port_api.get_ports_attribute = _ut_stub_sai_get_ports_attribute;
         ut_sai_port_api.set_port_attribute = _ut_stub_sai_set_port_attribute;
         ut_sai_port_api.create_port_serdes = _ut_stub_sai_create_port_serdes;
         ut_sai_port_api.remove_port_serdes = _ut_stub_sai_remove_port_serdes;
@@ -3015,6 +3045,174 @@ namespace portsorch_test
         _unhook_sai_bridge_api();
     }
 
+    /*
+     * Replaces sai_vlan_api with a copy of it for the lifetime of the hook, so
+     * tests can override its functions without touching the shared table
+     */
+    struct VlanApiHook
+    {
+        VlanApiHook() : api(*sai_vlan_api), old_api(sai_vlan_api)
+        {
+            sai_vlan_api = &api;
+        }
+
+        ~VlanApiHook()
+        {
+            sai_vlan_api = old_api;
+        }
+
+        sai_vlan_api_t api;
+        sai_vlan_api_t *old_api;
+    };
+
+    /* Creates the ports and Vlan10, and the bridge ports of the members */
+    static void _setup_vlan_members(swss::DBConnector *app_db, const vector<pair<string, string>> &members)
+    {
+        Table portTable = Table(app_db, APP_PORT_TABLE_NAME);
+        Table vlanTable = Table(app_db, APP_VLAN_TABLE_NAME);
+
+        // Get SAI default ports to populate DB
+        auto ports = ut_helper::getInitialSaiPorts();
+
+        // Populate port table with SAI ports
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+
+        // Set PortConfigDone, PortInitDone
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+        portTable.set("PortInitDone", { { "lanes", "0" } });
+        vlanTable.set("Vlan10", { { "admin_status", "up" } });
+
+        // refill consumer
+        gPortsOrch->addExistingData(&portTable);
+        gPortsOrch->addExistingData(&vlanTable);
+        // Apply configuration : create ports and VLAN
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        for (const auto &member : members)
+        {
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(member.second, port));
+            ASSERT_TRUE(gPortsOrch->addBridgePort(port));
+        }
+    }
+
+    TEST_F(PortsOrchTest, AddVlanMembersBulk)
+    {
+        vector<pair<string, string>> members = { { "Vlan10", "Ethernet0" }, { "Vlan10", "Ethernet4" } };
+        _setup_vlan_members(m_app_db.get(), members);
+
+        // Both members are created by one bulk call
+        VlanApiHook hook;
+
+        uint32_t bulkCalls = 0;
+        uint32_t singleCalls = 0;
+        auto bulkSpy = SpyOn<SAI_API_VLAN, SAI_OBJECT_TYPE_VLAN_MEMBER>(&sai_vlan_api->create_vlan_members);
+        bulkSpy->callFake([&](sai_object_id_t swoid, uint32_t count, const uint32_t *attr_count, const sai_attribute_t **attrs,
+                              sai_bulk_op_error_mode_t mode, sai_object_id_t *oids, sai_status_t *statuses) -> sai_status_t {
+                bulkCalls++;
+                return hook.old_api->create_vlan_members(swoid, count, attr_count, attrs, mode, oids, statuses);
+            }
+        );
+        auto singleSpy = SpyOn<SAI_API_VLAN, SAI_OBJECT_TYPE_VLAN_MEMBER>(&sai_vlan_api->create_vlan_member);
+        singleSpy->callFake([&](sai_object_id_t *oid, sai_object_id_t swoid, uint32_t count, const sai_attribute_t *attrs) -> sai_status_t {
+                singleCalls++;
+                return hook.old_api->create_vlan_member(oid, swoid, count, attrs);
+            }
+        );
+
+        string tagging_mode = "tagged";
+        ASSERT_TRUE(gPortsOrch->addVlanMembers(members, tagging_mode));
+        ASSERT_EQ(bulkCalls, 1u);
+        ASSERT_EQ(singleCalls, 0u);
+
+        Port vlan;
+        ASSERT_TRUE(gPortsOrch->getPort("Vlan10", vlan));
+        ASSERT_EQ(vlan.m_members.size(), 2u);
+        for (const auto &member : members)
+        {
+            Port port;
+            gPortsOrch->getPort(member.second, port);
+            ASSERT_TRUE(gPortsOrch->isVlanMember(vlan, port));
+        }
+    }
+
+    TEST_F(PortsOrchTest, AddVlanMembersBulkMemberFailure)
+    {
+        vector<pair<string, string>> members = { { "Vlan10", "Ethernet0" }, { "Vlan10", "Ethernet4" } };
+        _setup_vlan_members(m_app_db.get(), members);
+
+        // The first member is created, the table is full for the second one
+        VlanApiHook hook;
+        auto bulkSpy = SpyOn<SAI_API_VLAN, SAI_OBJECT_TYPE_VLAN_MEMBER>(&sai_vlan_api->create_vlan_members);
+        bulkSpy->callFake([&](sai_object_id_t swoid, uint32_t count, const uint32_t *attr_count, const sai_attribute_t **attrs,
+                              sai_bulk_op_error_mode_t mode, sai_object_id_t *oids, sai_status_t *statuses) -> sai_status_t {
+                EXPECT_EQ(count, 2u);
+                hook.old_api->create_vlan_members(swoid, 1, attr_count, attrs, mode, oids, statuses);
+                oids[1] = SAI_NULL_OBJECT_ID;
+                statuses[1] = SAI_STATUS_TABLE_FULL;
+                return SAI_STATUS_FAILURE;
+            }
+        );
+
+        string tagging_mode = "tagged";
+        ASSERT_FALSE(gPortsOrch->addVlanMembers(members, tagging_mode));
+
+        Port vlan, port;
+        ASSERT_TRUE(gPortsOrch->getPort("Vlan10", vlan));
+        ASSERT_EQ(vlan.m_members.size(), 1u);
+        gPortsOrch->getPort("Ethernet0", port);
+        ASSERT_TRUE(gPortsOrch->isVlanMember(vlan, port));
+        gPortsOrch->getPort("Ethernet4", port);
+        ASSERT_FALSE(gPortsOrch->isVlanMember(vlan, port));
+    }
+
+    /*
+     * Remote VTEP members queued by a remote VNI batch are added with one bulk
+     * call when the batch completes
+     */
+    TEST_F(PortsOrchTest, VxlanRemoteVniFlushesVlanMembers)
+    {
+        vector<pair<string, string>> members = { { "Vlan10", "Ethernet0" }, { "Vlan10", "Ethernet4" } };
+        _setup_vlan_members(m_app_db.get(), members);
+
+        VlanApiHook hook;
+        uint32_t bulkCalls = 0;
+        auto bulkSpy = SpyOn<SAI_API_VLAN, SAI_OBJECT_TYPE_VLAN_MEMBER>(&sai_vlan_api->create_vlan_members);
+        bulkSpy->callFake([&](sai_object_id_t swoid, uint32_t count, const uint32_t *attr_count, const sai_attribute_t **attrs,
+                              sai_bulk_op_error_mode_t mode, sai_object_id_t *oids, sai_status_t *statuses) -> sai_status_t {
+                bulkCalls++;
+                EXPECT_EQ(count, 2u);
+                return hook.old_api->create_vlan_members(swoid, count, attr_count, attrs, mode, oids, statuses);
+            }
+        );
+
+        EvpnRemoteVnip2pOrch remoteVniOrch(m_app_db.get(), APP_VXLAN_REMOTE_VNI_TABLE_NAME);
+        for (const auto &member : members)
+        {
+            remoteVniOrch.pending_vlan_members_.push_back(member);
+            remoteVniOrch.pending_vlan_member_set_.insert(member);
+        }
+
+        auto consumer = dynamic_cast<Consumer *>(remoteVniOrch.getExecutor(APP_VXLAN_REMOTE_VNI_TABLE_NAME));
+        ASSERT_NE(consumer, nullptr);
+        static_cast<Orch *>(&remoteVniOrch)->doTask(*consumer);
+
+        ASSERT_EQ(bulkCalls, 1u);
+        ASSERT_TRUE(remoteVniOrch.pending_vlan_members_.empty());
+        ASSERT_TRUE(remoteVniOrch.pending_vlan_member_set_.empty());
+
+        Port vlan;
+        ASSERT_TRUE(gPortsOrch->getPort("Vlan10", vlan));
+        ASSERT_EQ(vlan.m_members.size(), 2u);
+
+        // Nothing is left to flush on the next batch
+        static_cast<Orch *>(&remoteVniOrch)->doTask(*consumer);
+        ASSERT_EQ(bulkCalls, 1u);
+    }
+
     TEST_F(PortsOrchTest, SupportedLinkEventDampingAlgorithmSuccess)
     {
         _hook_sai_port_api();
@@ -3391,6 +3589,53 @@ namespace portsorch_test
         _unhook_sai_port_api();
     }
 
+    /*
+     * Test case: port capabilities are read with one bulk call per attribute at bring-up
+     **/
+    TEST_F(PortsOrchTest, PortCapabilitiesBulkInit)
+    {
+        _hook_sai_port_api();
+        _sai_get_ports_attribute_count.clear();
+        not_support_fetching_fec = false;
+
+        Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+        Table statePortTable = Table(m_state_db.get(), STATE_PORT_TABLE_NAME);
+
+        auto ports = ut_helper::getInitialSaiPorts();
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+        gPortsOrch->addExistingData(&portTable);
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        EXPECT_EQ(_sai_get_ports_attribute_count[SAI_PORT_ATTR_ADMIN_STATE], 1u);
+        EXPECT_EQ(_sai_get_ports_attribute_count[SAI_PORT_ATTR_AUTO_NEG_MODE], 1u);
+        EXPECT_EQ(_sai_get_ports_attribute_count[SAI_PORT_ATTR_SUPPORTED_SPEED], 1u);
+        EXPECT_EQ(_sai_get_ports_attribute_count[SAI_PORT_ATTR_SUPPORTED_FEC_MODE], 1u);
+        EXPECT_EQ(_sai_get_ports_attribute_count[SAI_PORT_ATTR_SUPPORTED_AUTO_NEG_MODE], 1u);
+
+        for (const auto &it : ports)
+        {
+            Port p;
+            ASSERT_TRUE(gPortsOrch->getPort(it.first, p));
+            EXPECT_EQ(p.m_cap_an, 1);
+            EXPECT_EQ(gPortsOrch->m_portSupportedSpeeds.count(p.m_port_id), 1u);
+            ASSERT_EQ(gPortsOrch->m_portSupportedFecModes.count(p.m_port_id), 1u);
+            EXPECT_TRUE(gPortsOrch->m_portSupportedFecModes[p.m_port_id].supported);
+
+            std::string fecs;
+            ASSERT_TRUE(statePortTable.hget(it.first, "supported_fecs", fecs));
+            EXPECT_NE(fecs.find("rs"), std::string::npos);
+        }
+
+        // The stage timings were reported and reset once the ports were up
+        EXPECT_TRUE(gPortsOrch->m_portInitStageUsec.empty());
+
+        _unhook_sai_port_api();
+    }
+
     TEST_F(PortsOrchTest, PortSupportedFecModes)
     {
         _hook_sai_port_api();
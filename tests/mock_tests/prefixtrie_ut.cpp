@@ -0,0 +1,253 @@
+#include "ut_helper.h"
+#include "prefixtrie.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <set>
+
+namespace prefixtrie_test
+{
+    using namespace std;
+    using namespace swss;
+
+    static string randomV4Prefix(mt19937 &gen, int min_len, int max_len)
+    {
+        uniform_int_distribution<uint32_t> addr;
+        uniform_int_distribution<int> len(min_len, max_len);
+        uint32_t a = addr(gen);
+        return IpPrefix(to_string(a >> 24) + "." + to_string((a >> 16) & 0xff) + "." +
+                        to_string((a >> 8) & 0xff) + "." + to_string(a & 0xff) + "/" +
+                        to_string(len(gen))).getSubnet().to_string();
+    }
+
+    /* Small address space so that the random prefixes nest */
+    static string randomNestedV4Prefix(mt19937 &gen)
+    {
+        uniform_int_distribution<int> octet(0, 3);
+        uniform_int_distribution<int> len(0, 32);
+        return IpPrefix("10." + to_string(octet(gen)) + "." + to_string(octet(gen)) + "." +
+                        to_string(octet(gen) * 64) + "/" + to_string(len(gen))).getSubnet().to_string();
+    }
+
+    TEST(PrefixTrieTest, InsertFindErase)
+    {
+        PrefixTrie<int> trie;
+
+        ASSERT_TRUE(trie.insert(IpPrefix("10.0.0.0/8"), 1));
+        ASSERT_TRUE(trie.insert(IpPrefix("10.1.0.0/16"), 2));
+        ASSERT_TRUE(trie.insert(IpPrefix("10.1.2.0/24"), 3));
+        ASSERT_TRUE(trie.insert(IpPrefix("10.2.0.0/16"), 4));
+        ASSERT_TRUE(trie.insert(IpPrefix("fc00::/7"), 5));
+        ASSERT_FALSE(trie.insert(IpPrefix("10.1.0.0/16"), 6));
+        ASSERT_EQ(trie.size(), 5u);
+
+        ASSERT_EQ(*trie.find(IpPrefix("10.1.0.0/16")), 6);
+        ASSERT_EQ(trie.find(IpPrefix("10.0.0.0/16")), nullptr);
+        ASSERT_EQ(trie.find(IpPrefix("10.1.2.0/23")), nullptr);
+        ASSERT_EQ(trie.find(IpPrefix("fc00::/8")), nullptr);
+        ASSERT_EQ(*trie.find(IpPrefix("fc00::/7")), 5);
+
+        /* Removing a prefix keeps the prefixes below and above it */
+        ASSERT_TRUE(trie.erase(IpPrefix("10.1.0.0/16")));
+        ASSERT_FALSE(trie.erase(IpPrefix("10.1.0.0/16")));
+        ASSERT_FALSE(trie.erase(IpPrefix("10.3.0.0/16")));
+        ASSERT_EQ(trie.size(), 4u);
+        ASSERT_EQ(*trie.find(IpPrefix("10.0.0.0/8")), 1);
+        ASSERT_EQ(*trie.find(IpPrefix("10.1.2.0/24")), 3);
+        ASSERT_EQ(*trie.find(IpPrefix("10.2.0.0/16")), 4);
+
+        ASSERT_TRUE(trie.erase(IpPrefix("10.0.0.0/8")));
+        ASSERT_TRUE(trie.erase(IpPrefix("10.1.2.0/24")));
+        ASSERT_TRUE(trie.erase(IpPrefix("10.2.0.0/16")));
+        ASSERT_TRUE(trie.erase(IpPrefix("fc00::/7")));
+        ASSERT_TRUE(trie.empty());
+        ASSERT_EQ(trie.find(IpPrefix("10.2.0.0/16")), nullptr);
+    }
+
+    TEST(PrefixTrieTest, DefaultAndHostRoutes)
+    {
+        PrefixTrie<string> trie;
+        IpPrefix match;
+
+        trie.insert(IpPrefix("0.0.0.0/0"), "v4 default");
+        trie.insert(IpPrefix("::/0"), "v6 default");
+        trie.insert(IpPrefix("192.168.0.1/32"), "host");
+        trie.insert(IpPrefix("2001:db8::1/128"), "v6 host");
+
+        ASSERT_EQ(*trie.longestMatch(IpAddress("192.168.0.1"), &match), "host");
+        ASSERT_EQ(match, IpPrefix("192.168.0.1/32"));
+        ASSERT_EQ(*trie.longestMatch(IpAddress("192.168.0.2"), &match), "v4 default");
+        ASSERT_EQ(match, IpPrefix("0.0.0.0/0"));
+        ASSERT_EQ(*trie.longestMatch(IpAddress("2001:db8::1")), "v6 host");
+        ASSERT_EQ(*trie.longestMatch(IpAddress("2001:db8::2")), "v6 default");
+
+        /* IPv4 and IPv6 never match each other */
+        trie.erase(IpPrefix("::/0"));
+        ASSERT_EQ(trie.longestMatch(IpAddress("::1")), nullptr);
+    }
+
+    TEST(PrefixTrieTest, CoveringAndMoreSpecifics)
+    {
+        PrefixTrie<int> trie;
+        trie.insert(IpPrefix("10.0.0.0/8"), 8);
+        trie.insert(IpPrefix("10.1.0.0/16"), 16);
+        trie.insert(IpPrefix("10.1.1.0/24"), 24);
+        trie.insert(IpPrefix("10.1.1.128/25"), 25);
+        trie.insert(IpPrefix("10.2.0.0/16"), 16);
+
+        IpPrefix match;
+        ASSERT_EQ(*trie.coveringPrefix(IpPrefix("10.1.1.0/26"), &match), 24);
+        ASSERT_EQ(match, IpPrefix("10.1.1.0/24"));
+        ASSERT_EQ(*trie.coveringPrefix(IpPrefix("10.1.0.0/16")), 16);
+        ASSERT_EQ(*trie.coveringPrefix(IpPrefix("10.3.0.0/16")), 8);
+        ASSERT_EQ(trie.coveringPrefix(IpPrefix("10.0.0.0/7")), nullptr);
+
+        vector<IpPrefix> covering;
+        trie.forEachCovering(IpAddress("10.1.1.200"), [&](const IpPrefix &prefix, int) { covering.push_back(prefix); });
+        ASSERT_EQ(covering, vector<IpPrefix>({ IpPrefix("10.0.0.0/8"), IpPrefix("10.1.0.0/16"),
+                                               IpPrefix("10.1.1.0/24"), IpPrefix("10.1.1.128/25") }));
+
+        set<IpPrefix> specifics;
+        trie.forEachMoreSpecific(IpPrefix("10.1.0.0/16"), [&](const IpPrefix &prefix, int) { specifics.insert(prefix); });
+        ASSERT_EQ(specifics, set<IpPrefix>({ IpPrefix("10.1.0.0/16"), IpPrefix("10.1.1.0/24"), IpPrefix("10.1.1.128/25") }));
+
+        specifics.clear();
+        trie.forEachMoreSpecific(IpPrefix("10.1.1.0/25"), [&](const IpPrefix &prefix, int) { specifics.insert(prefix); });
+        ASSERT_TRUE(specifics.empty());
+
+        specifics.clear();
+        trie.forEachMoreSpecific(IpPrefix("0.0.0.0/0"), [&](const IpPrefix &prefix, int) { specifics.insert(prefix); });
+        ASSERT_EQ(specifics.size(), trie.size());
+    }
+
+    TEST(PrefixTrieTest, MatchesLinearScan)
+    {
+        mt19937 gen(2024);
+        PrefixTrie<int> trie;
+        set<IpPrefix> prefixes;
+
+        for (int i = 0; i < 2000; i++)
+        {
+            IpPrefix prefix(randomNestedV4Prefix(gen));
+            if (i % 3 == 2 && !prefixes.empty())
+            {
+                /* Interleave removals with the insertions */
+                auto victim = prefixes.begin();
+                advance(victim, gen() % prefixes.size());
+                ASSERT_TRUE(trie.erase(*victim));
+                prefixes.erase(victim);
+                continue;
+            }
+            ASSERT_EQ(trie.insert(prefix, prefix.getMaskLength()), prefixes.insert(prefix).second);
+        }
+        ASSERT_EQ(trie.size(), prefixes.size());
+
+        for (int i = 0; i < 500; i++)
+        {
+            IpPrefix query(randomNestedV4Prefix(gen));
+
+            const IpPrefix *expected_cover = nullptr;
+            set<IpPrefix> expected_specifics;
+            for (const auto &prefix : prefixes)
+            {
+                if (prefix.getMaskLength() <= query.getMaskLength() && prefix.isAddressInSubnet(query.getIp()) &&
+                    (!expected_cover || expected_cover->getMaskLength() < prefix.getMaskLength()))
+                {
+                    expected_cover = &prefix;
+                }
+                if (prefix.getMaskLength() >= query.getMaskLength() && query.isAddressInSubnet(prefix.getIp()))
+                {
+                    expected_specifics.insert(prefix);
+                }
+            }
+
+            IpPrefix match;
+            auto cover = trie.coveringPrefix(query, &match);
+            if (expected_cover)
+            {
+                ASSERT_NE(cover, nullptr) << query.to_string();
+                ASSERT_EQ(match, *expected_cover) << query.to_string();
+                ASSERT_EQ(*cover, expected_cover->getMaskLength());
+            }
+            else
+            {
+                ASSERT_EQ(cover, nullptr) << query.to_string();
+            }
+
+            set<IpPrefix> specifics;
+            trie.forEachMoreSpecific(query, [&](const IpPrefix &prefix, int) { specifics.insert(prefix); });
+            ASSERT_EQ(specifics, expected_specifics) << query.to_string();
+        }
+    }
+
+    TEST(PrefixTrieTest, PerVrf)
+    {
+        VrfPrefixTrie<string> tries;
+        tries[0x3000000000001].insert(IpPrefix("10.0.0.0/24"), "Ethernet0");
+        tries[0x3000000000002].insert(IpPrefix("10.0.0.0/24"), "Ethernet4");
+
+        ASSERT_EQ(*tries[0x3000000000001].longestMatch(IpAddress("10.0.0.1")), "Ethernet0");
+        ASSERT_EQ(*tries[0x3000000000002].longestMatch(IpAddress("10.0.0.1")), "Ethernet4");
+        ASSERT_EQ(tries[0x3000000000003].longestMatch(IpAddress("10.0.0.1")), nullptr);
+    }
+
+    /*
+     * Microbenchmark at a full table scale. It is disabled by default, run it with
+     * --gtest_also_run_disabled_tests --gtest_filter=PrefixTrieTest.DISABLED_Benchmark1M
+     */
+    TEST(PrefixTrieTest, DISABLED_Benchmark1M)
+    {
+        const size_t count = 1000000;
+        mt19937 gen(1);
+
+        vector<IpPrefix> prefixes;
+        prefixes.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            prefixes.emplace_back(randomV4Prefix(gen, 16, 32));
+        }
+        vector<IpAddress> addresses;
+        for (size_t i = 0; i < count; i++)
+        {
+            addresses.push_back(IpPrefix(randomV4Prefix(gen, 32, 32)).getIp());
+        }
+
+        PrefixTrie<size_t> trie;
+        auto start = chrono::steady_clock::now();
+        for (size_t i = 0; i < count; i++)
+        {
+            trie.insert(prefixes[i], i);
+        }
+        auto insert_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+
+        size_t found = 0;
+        start = chrono::steady_clock::now();
+        for (const auto &ip : addresses)
+        {
+            found += trie.longestMatch(ip) != nullptr;
+        }
+        auto lookup_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+
+        size_t specifics = 0;
+        start = chrono::steady_clock::now();
+        for (size_t i = 0; i < count; i += 100)
+        {
+            trie.forEachMoreSpecific(prefixes[i], [&specifics](const IpPrefix &, size_t) { specifics++; });
+        }
+        auto specifics_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+
+        start = chrono::steady_clock::now();
+        for (const auto &prefix : prefixes)
+        {
+            trie.erase(prefix);
+        }
+        auto erase_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+        ASSERT_TRUE(trie.empty());
+
+        cout << count << " prefixes: insert " << insert_ms << " ms, "
+             << count << " longest matches (" << found << " found) " << lookup_ms << " ms, "
+             << count / 100 << " more specific walks " << specifics_ms << " ms, "
+             << "erase " << erase_ms << " ms" << endl;
+    }
+}
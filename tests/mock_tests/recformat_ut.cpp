@@ -0,0 +1,254 @@
+#include "recformat.h"
+
+#include <cstdio>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+namespace recformat_test
+{
+    using namespace std;
+    using namespace swss;
+
+    class RecFormatTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            char dir_template[] = "/tmp/swss-recformat-ut-XXXXXX";
+            auto dir = mkdtemp(dir_template);
+            ASSERT_NE(dir, nullptr);
+            m_dir = dir;
+            m_path = m_dir + "/swss.rec";
+        }
+
+        void TearDown() override
+        {
+            remove(m_path.c_str());
+            rmdir(m_dir.c_str());
+        }
+
+        static RecEntry makeEntry(uint64_t usec, const string &prefix, const string &key, const string &op)
+        {
+            RecEntry entry;
+            entry.usec = usec;
+            entry.prefix = prefix;
+            vector<FieldValueTuple> fvs;
+            if (op == SET_COMMAND)
+            {
+                fvs = { { "nexthop", "10.0.0.1" }, { "ifname", "Ethernet0" }, { "empty", "" } };
+            }
+            entry.tuple = KeyOpFieldsValuesTuple(key, op, fvs);
+            return entry;
+        }
+
+        static void expectEqual(const RecEntry &expected, const RecEntry &actual)
+        {
+            EXPECT_EQ(expected.usec, actual.usec);
+            EXPECT_EQ(expected.prefix, actual.prefix);
+            EXPECT_EQ(kfvKey(expected.tuple), kfvKey(actual.tuple));
+            EXPECT_EQ(kfvOp(expected.tuple), kfvOp(actual.tuple));
+            EXPECT_EQ(kfvFieldsValues(expected.tuple), kfvFieldsValues(actual.tuple));
+        }
+
+        string m_dir;
+        string m_path;
+    };
+
+    TEST_F(RecFormatTest, BinaryRoundTripAcrossBlocks)
+    {
+        const uint64_t base = 1700000000000000ULL;
+        vector<RecEntry> entries;
+        for (uint64_t i = 0; i < 500; i++)
+        {
+            const string prefix = i % 3 ? "ROUTE_TABLE:" : "NEIGH_TABLE:";
+            entries.push_back(makeEntry(base + i * 10, prefix, "10.0." + to_string(i) + ".0/24",
+                                        i % 5 ? SET_COMMAND : DEL_COMMAND));
+        }
+        entries.push_back(makeEntry(base + 5000, "ROUTE_TABLE:", "custom", "bulkop"));
+
+        RecBinaryWriter writer(1024);
+        ASSERT_TRUE(writer.open(m_path));
+        for (const auto &entry : entries)
+        {
+            writer.append(entry);
+        }
+        writer.close();
+
+        ASSERT_TRUE(RecBinaryReader::isBinary(m_path));
+
+        RecBinaryReader reader;
+        ASSERT_TRUE(reader.open(m_path));
+        ASSERT_GT(reader.index().size(), 1u);
+
+        uint64_t indexed = 0;
+        for (const auto &block : reader.index())
+        {
+            EXPECT_LE(block.firstUsec, block.lastUsec);
+            indexed += block.count;
+        }
+        EXPECT_EQ(indexed, entries.size());
+
+        RecEntry entry;
+        for (const auto &expected : entries)
+        {
+            ASSERT_TRUE(reader.next(entry));
+            expectEqual(expected, entry);
+        }
+        EXPECT_FALSE(reader.next(entry));
+    }
+
+    TEST_F(RecFormatTest, SeekSkipsOlderEntries)
+    {
+        RecBinaryWriter writer(256);
+        ASSERT_TRUE(writer.open(m_path));
+        for (uint64_t i = 0; i < 200; i++)
+        {
+            writer.append(makeEntry(i * 100, "ROUTE_TABLE:", "key" + to_string(i), SET_COMMAND));
+        }
+        writer.close();
+
+        RecBinaryReader reader;
+        ASSERT_TRUE(reader.open(m_path));
+
+        reader.seek(12345);
+        RecEntry entry;
+        ASSERT_TRUE(reader.next(entry));
+        EXPECT_EQ(entry.usec, 12400u);
+        EXPECT_EQ(kfvKey(entry.tuple), "key124");
+
+        reader.seek(0);
+        ASSERT_TRUE(reader.next(entry));
+        EXPECT_EQ(kfvKey(entry.tuple), "key0");
+
+        reader.seek(1000000);
+        EXPECT_FALSE(reader.next(entry));
+    }
+
+    TEST_F(RecFormatTest, ReadsAppendedAndUnterminatedSegments)
+    {
+        {
+            RecBinaryWriter writer;
+            ASSERT_TRUE(writer.open(m_path));
+            writer.append(makeEntry(100, "ROUTE_TABLE:", "first", SET_COMMAND));
+            writer.close();
+        }
+
+        // A second segment which has not been closed yet has no footer
+        RecBinaryWriter writer;
+        ASSERT_TRUE(writer.open(m_path));
+        writer.append(makeEntry(200, "VLAN_TABLE:", "second", DEL_COMMAND));
+        writer.flush();
+
+        RecBinaryReader reader;
+        ASSERT_TRUE(reader.open(m_path));
+        EXPECT_EQ(reader.index().size(), 2u);
+
+        RecEntry entry;
+        ASSERT_TRUE(reader.next(entry));
+        EXPECT_EQ(kfvKey(entry.tuple), "first");
+        ASSERT_TRUE(reader.next(entry));
+        EXPECT_EQ(kfvKey(entry.tuple), "second");
+        EXPECT_EQ(entry.prefix, "VLAN_TABLE:");
+        EXPECT_FALSE(reader.next(entry));
+
+        writer.close();
+    }
+
+    TEST_F(RecFormatTest, TruncateDropsPreviousSegments)
+    {
+        {
+            RecBinaryWriter writer;
+            ASSERT_TRUE(writer.open(m_path));
+            writer.append(makeEntry(100, "ROUTE_TABLE:", "first", SET_COMMAND));
+            writer.close();
+        }
+
+        RecBinaryWriter writer;
+        ASSERT_TRUE(writer.open(m_path, true));
+        writer.append(makeEntry(200, "VLAN_TABLE:", "second", DEL_COMMAND));
+        writer.close();
+
+        RecBinaryReader reader;
+        ASSERT_TRUE(reader.open(m_path));
+        EXPECT_EQ(reader.index().size(), 1u);
+
+        RecEntry entry;
+        ASSERT_TRUE(reader.next(entry));
+        EXPECT_EQ(kfvKey(entry.tuple), "second");
+        EXPECT_FALSE(reader.next(entry));
+    }
+
+    TEST_F(RecFormatTest, AgedBlockIsFlushed)
+    {
+        RecBinaryWriter writer;
+        ASSERT_TRUE(writer.open(m_path));
+        EXPECT_EQ(writer.flushAged(0), 0u);
+
+        writer.append(makeEntry(1000, "ROUTE_TABLE:", "key", SET_COMMAND));
+        ASSERT_TRUE(writer.hasPending());
+
+        // Not due yet, the time left is returned
+        EXPECT_EQ(writer.flushAged(1000 + RecBinaryWriter::MAX_BLOCK_AGE_USEC - 10), 10u);
+        EXPECT_TRUE(writer.hasPending());
+
+        EXPECT_EQ(writer.flushAged(1000 + RecBinaryWriter::MAX_BLOCK_AGE_USEC), 0u);
+        EXPECT_FALSE(writer.hasPending());
+
+        RecBinaryReader reader;
+        ASSERT_TRUE(reader.open(m_path));
+        EXPECT_EQ(reader.index().size(), 1u);
+
+        writer.close();
+    }
+
+    TEST_F(RecFormatTest, OversizedBlockIsRejected)
+    {
+        auto putVarint = [](string &buf, uint64_t value) {
+            while (value >= 0x80)
+            {
+                buf.push_back(static_cast<char>((value & 0x7f) | 0x80));
+                value >>= 7;
+            }
+            buf.push_back(static_cast<char>(value));
+        };
+
+        // A block header claiming a 1 TB payload must not be allocated
+        string data("SWSSRECB\x01B", 10);
+        putVarint(data, 1ULL << 40);
+        putVarint(data, 1);
+        putVarint(data, 0);
+        putVarint(data, 0);
+        putVarint(data, 1);
+        data.push_back('\0');
+
+        FILE *file = fopen(m_path.c_str(), "wb");
+        ASSERT_NE(file, nullptr);
+        ASSERT_EQ(fwrite(data.data(), 1, data.size(), file), data.size());
+        fclose(file);
+
+        RecBinaryReader reader;
+        ASSERT_TRUE(reader.open(m_path));
+        RecEntry entry;
+        EXPECT_FALSE(reader.next(entry));
+    }
+
+    TEST_F(RecFormatTest, TextLineRoundTrip)
+    {
+        uint64_t usec;
+        ASSERT_TRUE(parseRecTimestamp("2024-05-01.12:34:56.000789", usec));
+        EXPECT_EQ(formatRecTimestamp(usec), "2024-05-01.12:34:56.000789");
+
+        // Config DB keys carry the '|' separator as well
+        auto expected = makeEntry(usec, "ACL_RULE|", "DATAACL|RULE_1", SET_COMMAND);
+        string line = formatRecTextLine(expected);
+        EXPECT_EQ(line, "2024-05-01.12:34:56.000789|ACL_RULE|DATAACL|RULE_1|SET"
+                        "|nexthop:10.0.0.1|ifname:Ethernet0|empty:");
+
+        RecEntry entry;
+        ASSERT_TRUE(parseRecTextLine(line, entry));
+        expectEqual(expected, entry);
+
+        EXPECT_FALSE(parseRecTextLine("2024-05-01.12:34:56.000789|recording started", entry));
+    }
+}
@@ -1733,4 +1733,239 @@ namespace routeorch_test
         (void)gRouteOrch->removeRoutePrefix(IpPrefix("7.7.7.0/24"));
         ASSERT_TRUE(gRouteOrch->removeRoutePrefix(IpPrefix("7.7.7.0/24")));
     }
+
+    int nhgm_create_count = 0;
+    int nhgm_remove_count = 0;
+    int nhgm_set_count = 0;
+    uint32_t nhgm_object_count = 0;
+
+    sai_bulk_object_create_fn old_create_nhgms;
+    sai_bulk_object_remove_fn old_remove_nhgms;
+    sai_bulk_object_set_attribute_fn old_set_nhgms_attribute;
+
+    sai_status_t _ut_stub_sai_create_next_hop_group_members(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+    {
+        nhgm_create_count++;
+        nhgm_object_count += object_count;
+        return old_create_nhgms(switch_id, object_count, attr_count, attr_list, mode, object_id, object_statuses);
+    }
+
+    sai_status_t _ut_stub_sai_remove_next_hop_group_members(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        nhgm_remove_count++;
+        nhgm_object_count += object_count;
+        return old_remove_nhgms(object_count, object_id, mode, object_statuses);
+    }
+
+    sai_status_t _ut_stub_sai_set_next_hop_group_members_attribute(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        nhgm_set_count++;
+        nhgm_object_count += object_count;
+        return old_set_nhgms_attribute(object_count, object_id, attr_list, mode, object_statuses);
+    }
+
+    // Counts the bulk member calls for the lifetime of the hook, the original
+    // functions are restored even when an assertion ends the test early
+    struct NhgMemberBulkHook
+    {
+        NhgMemberBulkHook()
+        {
+            old_create_nhgms = sai_next_hop_group_api->create_next_hop_group_members;
+            old_remove_nhgms = sai_next_hop_group_api->remove_next_hop_group_members;
+            old_set_nhgms_attribute = sai_next_hop_group_api->set_next_hop_group_members_attribute;
+            sai_next_hop_group_api->create_next_hop_group_members = _ut_stub_sai_create_next_hop_group_members;
+            sai_next_hop_group_api->remove_next_hop_group_members = _ut_stub_sai_remove_next_hop_group_members;
+            sai_next_hop_group_api->set_next_hop_group_members_attribute = _ut_stub_sai_set_next_hop_group_members_attribute;
+        }
+
+        ~NhgMemberBulkHook()
+        {
+            sai_next_hop_group_api->create_next_hop_group_members = old_create_nhgms;
+            sai_next_hop_group_api->remove_next_hop_group_members = old_remove_nhgms;
+            sai_next_hop_group_api->set_next_hop_group_members_attribute = old_set_nhgms_attribute;
+        }
+    };
+
+    TEST_F(RouteOrchTest, NhgOrchNextHopChangeBulkAcrossGroups)
+    {
+        Table neighborTable(m_app_db.get(), APP_NEIGH_TABLE_NAME);
+        neighborTable.set("Ethernet0:10.0.0.4", {{"neigh", "00:00:0a:00:00:04"}, {"family", "IPv4"}});
+        gNeighOrch->addExistingData(&neighborTable);
+        static_cast<Orch *>(gNeighOrch)->doTask();
+
+        // Three groups, each pair of them sharing a next hop
+        Table nhgTable(m_app_db.get(), APP_NEXTHOP_GROUP_TABLE_NAME);
+        nhgTable.set("nhg_a", {{"nexthop", "10.0.0.2,10.0.0.3"}, {"ifname", "Ethernet0,Ethernet0"}});
+        nhgTable.set("nhg_b", {{"nexthop", "10.0.0.2,10.0.0.4"}, {"ifname", "Ethernet0,Ethernet0"}});
+        nhgTable.set("nhg_c", {{"nexthop", "10.0.0.3,10.0.0.4"}, {"ifname", "Ethernet0,Ethernet0"}});
+        gNhgOrch->addExistingData(&nhgTable);
+        static_cast<Orch *>(gNhgOrch)->doTask();
+        ASSERT_TRUE(gNhgOrch->hasNhg("nhg_a"));
+        ASSERT_TRUE(gNhgOrch->hasNhg("nhg_b"));
+        ASSERT_TRUE(gNhgOrch->hasNhg("nhg_c"));
+
+        NhgMemberBulkHook hook;
+
+        // Losing a next hop removes its members from both groups in one call
+        nhgm_create_count = nhgm_remove_count = nhgm_set_count = 0;
+        nhgm_object_count = 0;
+        ASSERT_TRUE(gNhgOrch->invalidateNextHop(NextHopKey("10.0.0.2", "Ethernet0")));
+        ASSERT_EQ(nhgm_remove_count, 1);
+        ASSERT_EQ(nhgm_create_count, 0);
+        ASSERT_EQ(nhgm_object_count, 2u);
+
+        // Getting it back creates them again in one call
+        nhgm_create_count = nhgm_remove_count = nhgm_set_count = 0;
+        nhgm_object_count = 0;
+        ASSERT_TRUE(gNhgOrch->validateNextHop(NextHopKey("10.0.0.2", "Ethernet0")));
+        ASSERT_EQ(nhgm_create_count, 1);
+        ASSERT_EQ(nhgm_remove_count, 0);
+        ASSERT_EQ(nhgm_object_count, 2u);
+
+        // A next hop no group uses does not touch the SAI
+        nhgm_create_count = nhgm_remove_count = nhgm_set_count = 0;
+        ASSERT_TRUE(gNhgOrch->invalidateNextHop(NextHopKey("10.0.0.9", "Ethernet0")));
+        ASSERT_EQ(nhgm_remove_count, 0);
+
+        // Updating a group removes, reweights and adds its members with one call each
+        nhgm_create_count = nhgm_remove_count = nhgm_set_count = 0;
+        nhgm_object_count = 0;
+        nhgTable.set("nhg_a", {{"nexthop", "10.0.0.3,10.0.0.4"}, {"ifname", "Ethernet0,Ethernet0"}, {"weight", "2,3"}});
+        gNhgOrch->addExistingData(&nhgTable);
+        static_cast<Orch *>(gNhgOrch)->doTask();
+        ASSERT_EQ(nhgm_remove_count, 1);
+        ASSERT_EQ(nhgm_set_count, 1);
+        ASSERT_EQ(nhgm_create_count, 1);
+        ASSERT_EQ(nhgm_object_count, 3u);
+
+        // The updated group no longer follows 10.0.0.2, but follows 10.0.0.4
+        nhgm_create_count = nhgm_remove_count = nhgm_set_count = 0;
+        nhgm_object_count = 0;
+        ASSERT_TRUE(gNhgOrch->invalidateNextHop(NextHopKey("10.0.0.2", "Ethernet0")));
+        ASSERT_EQ(nhgm_object_count, 1u);
+
+        nhgm_object_count = 0;
+        ASSERT_TRUE(gNhgOrch->invalidateNextHop(NextHopKey("10.0.0.4", "Ethernet0")));
+        ASSERT_EQ(nhgm_remove_count, 2);
+        ASSERT_EQ(nhgm_object_count, 3u);
+    }
+
+    sai_object_id_t fg_fail_member;
+
+    // Bulk set of the member next hops, stopping at fg_fail_member with a
+    // full table, without touching the switch
+    sai_status_t _ut_stub_sai_set_fg_next_hop_group_members_attribute(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            if (status != SAI_STATUS_SUCCESS)
+            {
+                object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+            }
+            else if (object_id[i] == fg_fail_member)
+            {
+                object_statuses[i] = status = SAI_STATUS_TABLE_FULL;
+            }
+            else
+            {
+                object_statuses[i] = SAI_STATUS_SUCCESS;
+            }
+        }
+        return status;
+    }
+
+    struct FgNhgMemberSetHook
+    {
+        FgNhgMemberSetHook()
+        {
+            old_set_nhgms_attribute = sai_next_hop_group_api->set_next_hop_group_members_attribute;
+            sai_next_hop_group_api->set_next_hop_group_members_attribute = _ut_stub_sai_set_fg_next_hop_group_members_attribute;
+        }
+
+        ~FgNhgMemberSetHook()
+        {
+            sai_next_hop_group_api->set_next_hop_group_members_attribute = old_set_nhgms_attribute;
+        }
+    };
+
+    TEST_F(RouteOrchTest, FgNhgBucketSetFailureRestoresBuckets)
+    {
+        FgNhgMemberSetHook hook;
+
+        NextHopKey nh_a("10.0.0.2", "Ethernet0");
+        NextHopKey nh_b("10.0.0.3", "Ethernet0");
+        IpPrefix prefix("2.2.2.0/24");
+
+        FgNhgEntry fgNhgEntry;
+        fgNhgEntry.hash_bucket_indices = { { 0, 5 } };
+
+        // Six buckets of one bank, split between two next hops
+        auto makeRouteEntry = [&]()
+        {
+            FGNextHopGroupEntry entry;
+            entry.next_hop_group_id = 0x5000;
+            entry.nhopgroup_members = { 0x6000, 0x6001, 0x6002, 0x6003, 0x6004, 0x6005 };
+            entry.syncd_fgnhg_map = { { { nh_a, { 0, 1, 2 } }, { nh_b, { 3, 4, 5 } } } };
+            entry.active_nexthops = { nh_a, nh_b };
+            entry.points_to_rif = false;
+            return entry;
+        };
+
+        // nh_b goes down, its buckets move to nh_a
+        auto removeNhB = [&](FGNextHopGroupEntry &entry)
+        {
+            std::vector<BankMemberChanges> changes(1);
+            changes[0].active_nhs = { nh_a };
+            changes[0].nhs_to_del = { nh_b };
+            std::map<NextHopKey, sai_object_id_t> members_set = { { nh_a, 0x7000 } };
+            return gFgNhgOrch->computeAndSetHashBucketChanges(&entry, &fgNhgEntry, changes, members_set, prefix);
+        };
+
+        // All the buckets fail, the route entry is left as it was
+        auto entry = makeRouteEntry();
+        fg_fail_member = 0x6003;
+        ASSERT_FALSE(removeNhB(entry));
+        ASSERT_EQ(entry.syncd_fgnhg_map[0][nh_a], HashBuckets({ 0, 1, 2 }));
+        ASSERT_EQ(entry.syncd_fgnhg_map[0][nh_b], HashBuckets({ 3, 4, 5 }));
+        ASSERT_EQ(entry.active_nexthops, ActiveNextHops({ nh_a, nh_b }));
+        ASSERT_TRUE(gFgNhgOrch->m_pendingBucketChanges.empty());
+
+        // Only the buckets from the failed one on go back to nh_b
+        entry = makeRouteEntry();
+        fg_fail_member = 0x6004;
+        ASSERT_FALSE(removeNhB(entry));
+        ASSERT_EQ(entry.syncd_fgnhg_map[0][nh_a], HashBuckets({ 0, 1, 2, 3 }));
+        ASSERT_EQ(entry.syncd_fgnhg_map[0][nh_b], HashBuckets({ 4, 5 }));
+        ASSERT_EQ(entry.active_nexthops, ActiveNextHops({ nh_a, nh_b }));
+
+        // Without failure nh_b is gone
+        entry = makeRouteEntry();
+        fg_fail_member = SAI_NULL_OBJECT_ID;
+        ASSERT_TRUE(removeNhB(entry));
+        ASSERT_EQ(entry.syncd_fgnhg_map[0][nh_a], HashBuckets({ 0, 1, 2, 3, 4, 5 }));
+        ASSERT_EQ(entry.syncd_fgnhg_map[0].count(nh_b), 0u);
+        ASSERT_EQ(entry.active_nexthops, ActiveNextHops({ nh_a }));
+    }
 }
@@ -15,16 +15,18 @@ namespace srv6orch_test
 {
 
 DEFINE_SAI_GENERIC_API_MOCK(tunnel, tunnel);
-DEFINE_SAI_API_MOCK(srv6, my_sid);
+DEFINE_SAI_API_COMBINED_MOCK(srv6, srv6_sidlist, my_sid);
 
 using ::testing::_;
 using ::testing::AtLeast;
+using ::testing::InSequence;
 using namespace mock_orch_test;
 
 class Srv6OrchMySidTest : public MockOrchTest
 {
 protected:
-    void PostSetUp() override
+    // Applied before the orchs are created, so that the SRv6 bulkers pick up the mocked bulk APIs
+    void ApplySaiMock() override
     {
         INIT_SAI_API_MOCK(tunnel);
         INIT_SAI_API_MOCK(srv6);
@@ -77,6 +79,16 @@ protected:
         consumer->addToSync(entries);
         static_cast<Orch*>(gSrv6Orch)->doTask(*consumer);
     }
+
+    void runSidListTask(const deque<KeyOpFieldsValuesTuple>& entries)
+    {
+        auto* executor = static_cast<Orch*>(gSrv6Orch)->getExecutor(APP_SRV6_SID_LIST_TABLE_NAME);
+        auto* consumer = dynamic_cast<Consumer*>(executor);
+        ASSERT_NE(consumer, nullptr);
+        consumer->addToSync(entries);
+        static_cast<Orch*>(gSrv6Orch)->doTask(*consumer);
+        EXPECT_TRUE(consumer->m_toSync.empty());
+    }
 };
 
 TEST_F(Srv6OrchMySidTest, MySidEntryCreation_WithDecapDscpMode)
@@ -113,4 +125,83 @@ TEST_F(Srv6OrchMySidTest, MySidEntryCreation_WithoutDecapDscpMode)
     runAppMySidTask(app_key, "un", "default", "");
 }
 
+TEST_F(Srv6OrchMySidTest, MySidEntryCreation_Bulk)
+{
+    ASSERT_NE(gSrv6Orch, nullptr);
+
+    auto* executor = static_cast<Orch*>(gSrv6Orch)->getExecutor(APP_SRV6_MY_SID_TABLE_NAME);
+    auto* consumer = dynamic_cast<Consumer*>(executor);
+    ASSERT_NE(consumer, nullptr);
+
+    // Both entries of the batch are created by one bulk call
+    EXPECT_CALL(*mock_sai_srv6_api, create_my_sid_entries(2, _, _, _, _, _)).Times(1);
+    EXPECT_CALL(*mock_sai_srv6_api, create_my_sid_entry(_, _, _)).Times(0);
+
+    deque<KeyOpFieldsValuesTuple> entries;
+    entries.push_back({"32:16:16:0:fc00:0:1:1::", SET_COMMAND, {{"action", "un"}}});
+    entries.push_back({"32:16:16:0:fc00:0:1:2::", SET_COMMAND, {{"action", "un"}}});
+    consumer->addToSync(entries);
+    static_cast<Orch*>(gSrv6Orch)->doTask(*consumer);
+
+    // Removing an entry goes through the single entry API
+    EXPECT_CALL(*mock_sai_srv6_api, remove_my_sid_entry(_)).Times(2);
+
+    entries.clear();
+    entries.push_back({"32:16:16:0:fc00:0:1:1::", DEL_COMMAND, {}});
+    entries.push_back({"32:16:16:0:fc00:0:1:2::", DEL_COMMAND, {}});
+    consumer->addToSync(entries);
+    static_cast<Orch*>(gSrv6Orch)->doTask(*consumer);
+}
+
+TEST_F(Srv6OrchMySidTest, SidListCreation_Bulk)
+{
+    ASSERT_NE(gSrv6Orch, nullptr);
+
+    // All new SID lists of the batch are created by one bulk call
+    EXPECT_CALL(*mock_sai_srv6_api, create_srv6_sidlists(_, 2, _, _, _, _, _)).Times(1);
+    EXPECT_CALL(*mock_sai_srv6_api, create_srv6_sidlist(_, _, _, _)).Times(0);
+
+    runSidListTask({
+        {"seg1", SET_COMMAND, {{"path", "fc00:0:1:1::,fc00:0:1:2::"}}},
+        {"seg2", SET_COMMAND, {{"path", "fc00:0:2:1::"}, {"type", "insert.red"}}},
+    });
+
+    // An existing SID list is updated in place
+    EXPECT_CALL(*mock_sai_srv6_api, set_srv6_sidlist_attribute(_, _)).Times(1);
+    EXPECT_CALL(*mock_sai_srv6_api, create_srv6_sidlists(_, _, _, _, _, _, _)).Times(0);
+
+    runSidListTask({{"seg1", SET_COMMAND, {{"path", "fc00:0:1:3::"}}}});
+
+    // Removing an entry goes through the single object API
+    EXPECT_CALL(*mock_sai_srv6_api, remove_srv6_sidlist(_)).Times(2);
+
+    runSidListTask({
+        {"seg1", DEL_COMMAND, {}},
+        {"seg2", DEL_COMMAND, {}},
+    });
+}
+
+TEST_F(Srv6OrchMySidTest, SidListCreation_FlushedBeforeRemoval)
+{
+    ASSERT_NE(gSrv6Orch, nullptr);
+
+    runSidListTask({{"seg2", SET_COMMAND, {{"path", "fc00:0:2:1::"}}}});
+
+    // The queued creation of seg1 goes out before seg2 is removed
+    {
+        InSequence seq;
+        EXPECT_CALL(*mock_sai_srv6_api, create_srv6_sidlists(_, 1, _, _, _, _, _)).Times(1);
+        EXPECT_CALL(*mock_sai_srv6_api, remove_srv6_sidlist(_)).Times(1);
+    }
+
+    runSidListTask({
+        {"seg1", SET_COMMAND, {{"path", "fc00:0:1:1::"}}},
+        {"seg2", DEL_COMMAND, {}},
+    });
+
+    EXPECT_CALL(*mock_sai_srv6_api, remove_srv6_sidlist(_)).Times(1);
+
+    runSidListTask({{"seg1", DEL_COMMAND, {}}});
+}
+
 } // namespace srv6orch_test
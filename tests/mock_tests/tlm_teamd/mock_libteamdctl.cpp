@@ -0,0 +1,58 @@
+#include <string>
+
+#include "mock_libteamdctl.h"
+
+namespace mock_libteamdctl
+{
+    bool dump_status = true;
+    std::string dump;
+    int dump_calls = 0;
+
+    void reset()
+    {
+        dump_status = true;
+        dump.clear();
+        dump_calls = 0;
+    }
+}
+
+extern "C"
+{
+
+static char tdc_handle;
+
+struct teamdctl *teamdctl_alloc(void)
+{
+    return reinterpret_cast<struct teamdctl *>(&tdc_handle);
+}
+
+void teamdctl_free(struct teamdctl *)
+{
+}
+
+void teamdctl_set_log_fn(struct teamdctl *,
+                         void (*)(struct teamdctl *, int, const char *, int, const char *, const char *, va_list))
+{
+}
+
+int teamdctl_connect(struct teamdctl *, const char *, const char *, const char *)
+{
+    return 0;
+}
+
+void teamdctl_disconnect(struct teamdctl *)
+{
+}
+
+int teamdctl_state_get_raw_direct(struct teamdctl *, char **p_cfg)
+{
+    mock_libteamdctl::dump_calls++;
+    if (!mock_libteamdctl::dump_status)
+    {
+        return -1;
+    }
+    *p_cfg = const_cast<char *>(mock_libteamdctl::dump.c_str());
+    return 0;
+}
+
+}
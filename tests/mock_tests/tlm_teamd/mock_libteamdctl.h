@@ -0,0 +1,16 @@
+#pragma once
+
+#include <string>
+
+#include <teamdctl.h>
+
+namespace mock_libteamdctl
+{
+    // Result of the next teamdctl_state_get_raw_direct() calls
+    extern bool dump_status;
+    extern std::string dump;
+    // Number of teamdctl_state_get_raw_direct() calls
+    extern int dump_calls;
+
+    void reset();
+}
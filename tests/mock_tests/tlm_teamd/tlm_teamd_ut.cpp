@@ -0,0 +1,174 @@
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+#define private public
+#include "values_store.h"
+#include "teamdctl_mgr.h"
+#undef private
+#include "mock_table.h"
+#include "mock_libteamdctl.h"
+
+namespace tlm_teamd_ut
+{
+    const std::string LAG_NAME = "PortChannel1";
+
+    // A teamd state dump of a LAG with a single member Ethernet0
+    std::string buildDump(int pid, const std::string & member_state)
+    {
+        return "{"
+            "\"setup\": {\"kernel_team_mode_name\": \"loadbalance\", \"pid\": " + std::to_string(pid) + "},"
+            "\"runner\": {\"active\": true, \"fallback\": false, \"fast_rate\": false},"
+            "\"team_device\": {\"ifinfo\": {\"dev_addr\": \"00:11:22:33:44:55\", \"ifindex\": 10}},"
+            "\"ports\": {\"Ethernet0\": {"
+                "\"ifinfo\": {\"dev_addr\": \"00:11:22:33:44:55\", \"ifindex\": 11},"
+                "\"link\": {\"up\": true},"
+                "\"link_watches\": {\"list\": {\"link_watch_0\": {\"up\": true}}},"
+                "\"runner\": {"
+                    "\"actor_lacpdu_info\": {\"port\": 1, \"state\": 61, \"system\": \"00:11:22:33:44:55\"},"
+                    "\"partner_lacpdu_info\": {\"port\": 1, \"state\": 61, \"system\": \"66:77:88:99:aa:bb\"},"
+                    "\"aggregator\": {\"id\": 11, \"selected\": true},"
+                    "\"selected\": true,"
+                    "\"state\": \"" + member_state + "\""
+                "}"
+            "}}"
+        "}";
+    }
+
+    struct TlmTeamdTest : public ::testing::Test
+    {
+        std::shared_ptr<swss::DBConnector> m_state_db;
+
+        void SetUp() override
+        {
+            testing_db::reset();
+            mock_libteamdctl::reset();
+            m_state_db = std::make_shared<swss::DBConnector>("STATE_DB", 0);
+        }
+
+        void TearDown() override
+        {
+            mock_libteamdctl::reset();
+            testing_db::reset();
+        }
+
+        std::string getStateField(const std::string & table_name, const std::string & key, const std::string & field)
+        {
+            swss::Table table(m_state_db.get(), table_name);
+            std::string value;
+            table.hget(key, field, value);
+            return value;
+        }
+
+        void setStateField(const std::string & table_name, const std::string & key, const std::string & field, const std::string & value)
+        {
+            swss::Table table(m_state_db.get(), table_name);
+            table.hset(key, field, value);
+        }
+    };
+
+    TEST_F(TlmTeamdTest, UnchangedDumpIsNotWritten)
+    {
+        ValuesStore store(m_state_db.get());
+        const std::string member_key = LAG_NAME + "|Ethernet0";
+
+        auto changed = store.update({ { LAG_NAME, buildDump(100, "current") } });
+        EXPECT_EQ(changed.count(LAG_NAME), 1);
+        EXPECT_EQ(getStateField("LAG_TABLE", LAG_NAME, "setup.pid"), "100");
+        EXPECT_EQ(getStateField("LAG_MEMBER_TABLE", member_key, "runner.state"), "current");
+
+        // The same dump is neither parsed nor written again
+        setStateField("LAG_MEMBER_TABLE", member_key, "runner.state", "sentinel");
+        changed = store.update({ { LAG_NAME, buildDump(100, "current") } });
+        EXPECT_TRUE(changed.empty());
+        EXPECT_EQ(getStateField("LAG_MEMBER_TABLE", member_key, "runner.state"), "sentinel");
+
+        // Only the fields which value changed are written
+        setStateField("LAG_TABLE", LAG_NAME, "setup.pid", "sentinel");
+        changed = store.update({ { LAG_NAME, buildDump(100, "expired") } });
+        EXPECT_EQ(changed.count(LAG_NAME), 1);
+        EXPECT_EQ(getStateField("LAG_MEMBER_TABLE", member_key, "runner.state"), "expired");
+        EXPECT_EQ(getStateField("LAG_TABLE", LAG_NAME, "setup.pid"), "sentinel");
+    }
+
+    TEST_F(TlmTeamdTest, RemovedLagMembersAreDeleted)
+    {
+        ValuesStore store(m_state_db.get());
+        const std::string member_key = LAG_NAME + "|Ethernet0";
+
+        store.update({ { LAG_NAME, buildDump(100, "current") } });
+        EXPECT_EQ(getStateField("LAG_MEMBER_TABLE", member_key, "runner.state"), "current");
+
+        auto changed = store.update({});
+        EXPECT_TRUE(changed.empty());
+        EXPECT_EQ(getStateField("LAG_MEMBER_TABLE", member_key, "runner.state"), "");
+        // LAG_TABLE entries are owned by teamsyncd
+        EXPECT_EQ(getStateField("LAG_TABLE", LAG_NAME, "setup.pid"), "100");
+
+        // A re-added LAG is parsed and written again
+        changed = store.update({ { LAG_NAME, buildDump(100, "current") } });
+        EXPECT_EQ(changed.count(LAG_NAME), 1);
+        EXPECT_EQ(getStateField("LAG_MEMBER_TABLE", member_key, "runner.state"), "current");
+    }
+
+    TEST_F(TlmTeamdTest, StableLagIsPolledLessOften)
+    {
+        TeamdCtlMgr mgr;
+        mock_libteamdctl::dump = buildDump(100, "current");
+        ASSERT_TRUE(mgr.add_lag(LAG_NAME));
+
+        auto dumps = mgr.get_dumps(false);
+        ASSERT_EQ(dumps.size(), 1);
+        EXPECT_EQ(mock_libteamdctl::dump_calls, 1);
+
+        // A changed LAG is queried on the next call
+        mgr.update_poll_intervals({ LAG_NAME });
+        EXPECT_EQ(mgr.m_poll_states[LAG_NAME].interval, mgr.min_poll_interval);
+        dumps = mgr.get_dumps(false);
+        EXPECT_EQ(mock_libteamdctl::dump_calls, 2);
+
+        // A stable LAG backs off, the last dump is handed out meanwhile
+        mgr.update_poll_intervals({});
+        EXPECT_EQ(mgr.m_poll_states[LAG_NAME].interval, 2 * mgr.min_poll_interval);
+        dumps = mgr.get_dumps(false);
+        EXPECT_EQ(mock_libteamdctl::dump_calls, 2);
+        ASSERT_EQ(dumps.size(), 1);
+        EXPECT_EQ(dumps[0].second, mock_libteamdctl::dump);
+
+        // The interval is capped
+        for (int i = 0; i < 10; i++)
+        {
+            mgr.m_poll_states[LAG_NAME].next_poll = std::chrono::steady_clock::now() - std::chrono::seconds(1);
+            mgr.get_dumps(false);
+            mgr.update_poll_intervals({});
+        }
+        EXPECT_EQ(mgr.m_poll_states[LAG_NAME].interval, mgr.max_poll_interval);
+    }
+
+    TEST_F(TlmTeamdTest, FailedDumpIsRetriedOnNextCall)
+    {
+        TeamdCtlMgr mgr;
+        mock_libteamdctl::dump = buildDump(100, "current");
+        ASSERT_TRUE(mgr.add_lag(LAG_NAME));
+
+        mgr.get_dumps(false);
+        mgr.update_poll_intervals({});
+        EXPECT_EQ(mock_libteamdctl::dump_calls, 1);
+
+        // Once due, a failed query drops the LAG from the dumps and resets its interval
+        mgr.m_poll_states[LAG_NAME].next_poll = std::chrono::steady_clock::now() - std::chrono::seconds(1);
+        mock_libteamdctl::dump_status = false;
+        auto dumps = mgr.get_dumps(false);
+        EXPECT_TRUE(dumps.empty());
+        EXPECT_EQ(mock_libteamdctl::dump_calls, 2);
+        EXPECT_EQ(mgr.m_poll_states[LAG_NAME].interval, mgr.min_poll_interval);
+
+        // No dump is kept for the LAG, so it is queried before it is due
+        mgr.m_poll_states[LAG_NAME].next_poll = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        mock_libteamdctl::dump_status = true;
+        dumps = mgr.get_dumps(false);
+        ASSERT_EQ(dumps.size(), 1);
+        EXPECT_EQ(mock_libteamdctl::dump_calls, 3);
+    }
+}
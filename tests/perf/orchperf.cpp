@@ -0,0 +1,366 @@
+#include "orchperf.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+
+#include <nlohmann/json.hpp>
+
+using namespace std;
+using namespace mock_orch_test;
+using json = nlohmann::json;
+
+static atomic<uint64_t> g_allocations(0);
+
+/*
+ * Count every heap allocation of the process. Allocation counts are far more
+ * stable between runs than timings, which makes them the better signal for
+ * catching regressions in the orch hot paths.
+ */
+void *operator new(size_t size)
+{
+    g_allocations.fetch_add(1, memory_order_relaxed);
+
+    void *ptr = malloc(size ? size : 1);
+    if (ptr == nullptr)
+    {
+        throw bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+namespace orchperf
+{
+    PerfOptions gPerfOptions;
+
+    uint64_t allocationCount()
+    {
+        return g_allocations.load(memory_order_relaxed);
+    }
+
+    RssSample sampleRss()
+    {
+        RssSample sample;
+        ifstream status("/proc/self/status");
+        string line;
+        while (getline(status, line))
+        {
+            if (line.compare(0, 6, "VmRSS:") == 0)
+            {
+                sample.rssKb = strtol(line.c_str() + 6, nullptr, 10);
+            }
+            else if (line.compare(0, 6, "VmHWM:") == 0)
+            {
+                sample.hwmKb = strtol(line.c_str() + 6, nullptr, 10);
+            }
+        }
+        return sample;
+    }
+
+    bool resetPeakRss()
+    {
+        // Supported since Linux 4.0
+        ofstream clearRefs("/proc/self/clear_refs");
+        clearRefs << "5";
+        clearRefs.flush();
+        return clearRefs.good();
+    }
+
+    static uint64_t percentile(const vector<uint64_t> &sorted, double pct)
+    {
+        if (sorted.empty())
+        {
+            return 0;
+        }
+        size_t idx = static_cast<size_t>(pct * static_cast<double>(sorted.size() - 1) + 0.5);
+        return sorted[min(idx, sorted.size() - 1)];
+    }
+
+    PerfReport &PerfReport::instance()
+    {
+        static PerfReport report;
+        return report;
+    }
+
+    TableStats &PerfReport::table(const string &workload, const string &table)
+    {
+        return m_workloads[workload].tables[table];
+    }
+
+    void PerfReport::setRss(const string &workload, const RssSample &start, const RssSample &end)
+    {
+        Workload &w = m_workloads[workload];
+        w.rssDeltaKb = end.rssKb - start.rssKb;
+        w.peakRssDeltaKb = max(end.hwmKb - start.rssKb, 0L);
+        m_peakRssKb = max(m_peakRssKb, end.hwmKb);
+    }
+
+    bool PerfReport::write(const string &path) const
+    {
+        json report = json::object();
+        report["batch_size"] = gPerfOptions.batchSize;
+        report["scale"] = gPerfOptions.scale;
+        report["peak_rss_kb"] = max(m_peakRssKb, sampleRss().hwmKb);
+
+        json workloads = json::object();
+        for (const auto &wit : m_workloads)
+        {
+            json tables = json::object();
+            for (const auto &tit : wit.second.tables)
+            {
+                const TableStats &stats = tit.second;
+
+                vector<uint64_t> sorted(stats.batchNs);
+                sort(sorted.begin(), sorted.end());
+
+                double seconds = static_cast<double>(stats.totalNs) / 1e9;
+
+                json t = json::object();
+                t["entries"] = stats.entries();
+                t["set"] = stats.sets;
+                t["del"] = stats.dels;
+                t["pending"] = stats.pending;
+                t["batches"] = stats.batchNs.size();
+                t["total_ms"] = static_cast<double>(stats.totalNs) / 1e6;
+                t["throughput_eps"] = seconds > 0 ? static_cast<double>(stats.entries()) / seconds : 0.0;
+                t["batch_p50_us"] = static_cast<double>(percentile(sorted, 0.50)) / 1e3;
+                t["batch_p99_us"] = static_cast<double>(percentile(sorted, 0.99)) / 1e3;
+                t["batch_max_us"] = sorted.empty() ? 0.0 : static_cast<double>(sorted.back()) / 1e3;
+                t["allocations"] = stats.allocations;
+                t["allocations_per_entry"] = stats.entries() ?
+                    static_cast<double>(stats.allocations) / static_cast<double>(stats.entries()) : 0.0;
+                tables[tit.first] = t;
+            }
+
+            json w = json::object();
+            w["tables"] = tables;
+            w["rss_delta_kb"] = wit.second.rssDeltaKb;
+            w["peak_rss_delta_kb"] = wit.second.peakRssDeltaKb;
+            workloads[wit.first] = w;
+        }
+        report["workloads"] = workloads;
+
+        ofstream ofs(path);
+        if (!ofs.is_open())
+        {
+            return false;
+        }
+        ofs << report.dump(4) << endl;
+        return ofs.good();
+    }
+
+    void OrchPerfTest::ApplyInitialConfigs()
+    {
+        Table port_table = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+        Table vlan_table = Table(m_app_db.get(), APP_VLAN_TABLE_NAME);
+        Table vlan_member_table = Table(m_app_db.get(), APP_VLAN_MEMBER_TABLE_NAME);
+        Table intf_table = Table(m_app_db.get(), APP_INTF_TABLE_NAME);
+
+        auto ports = ut_helper::getInitialSaiPorts();
+        for (const auto &it : ports)
+        {
+            port_table.set(it.first, it.second);
+            port_table.set(it.first, { { "oper_status", "up" } });
+        }
+        port_table.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+        port_table.set("PortInitDone", { {} });
+
+        vlan_table.set(VLAN_1000, { { "admin_status", "up" },
+                                    { "mtu", "9100" },
+                                    { "mac", "00:aa:bb:cc:dd:ee" } });
+        vlan_member_table.set(
+            VLAN_1000 + vlan_member_table.getTableNameSeparator() + ETHERNET12,
+            { { "tagging_mode", "untagged" } });
+
+        gPortsOrch->addExistingData(&port_table);
+        gPortsOrch->addExistingData(&vlan_table);
+        gPortsOrch->addExistingData(&vlan_member_table);
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        intf_table.set(ETHERNET0, { { "NULL", "NULL" },
+                                    { "mac_addr", "00:00:00:00:00:00" } });
+        intf_table.set(ETHERNET0 + ":10.0.0.1/16", { { "scope", "global" },
+                                                     { "family", "IPv4" } });
+        intf_table.set(ETHERNET4, { { "NULL", "NULL" },
+                                    { "mac_addr", "00:00:00:00:00:00" } });
+        intf_table.set(ETHERNET4 + ":10.1.0.1/16", { { "scope", "global" },
+                                                     { "family", "IPv4" } });
+        intf_table.set(VLAN_1000, { { "NULL", "NULL" },
+                                    { "mac_addr", "00:00:00:00:00:00" } });
+        intf_table.set(VLAN_1000 + ":192.168.0.1/21", { { "scope", "global" },
+                                                        { "family", "IPv4" } });
+        gIntfsOrch->addExistingData(&intf_table);
+        static_cast<Orch *>(gIntfsOrch)->doTask();
+    }
+
+    ConsumerBase *OrchPerfTest::findConsumer(const string &table)
+    {
+        auto it = m_consumers.find(table);
+        if (it != m_consumers.end())
+        {
+            return it->second;
+        }
+
+        ConsumerBase *consumer = nullptr;
+        for (auto orch : ut_orch_list)
+        {
+            if (*orch == nullptr)
+            {
+                continue;
+            }
+            consumer = dynamic_cast<ConsumerBase *>((*orch)->getExecutor(table));
+            if (consumer != nullptr)
+            {
+                break;
+            }
+        }
+
+        m_consumers[table] = consumer;
+        return consumer;
+    }
+
+    void OrchPerfTest::drainBatch(ConsumerBase *consumer, const string &table,
+                                  const deque<KeyOpFieldsValuesTuple> &batch)
+    {
+        TableStats &stats = PerfReport::instance().table(workloadName(), table);
+
+        for (const auto &entry : batch)
+        {
+            if (kfvOp(entry) == DEL_COMMAND)
+            {
+                stats.dels++;
+            }
+            else
+            {
+                stats.sets++;
+            }
+        }
+
+        uint64_t allocations = allocationCount();
+        auto start = chrono::steady_clock::now();
+
+        consumer->addToSync(batch);
+        consumer->drain();
+
+        uint64_t ns = static_cast<uint64_t>(
+            chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+
+        stats.allocations += allocationCount() - allocations;
+        stats.totalNs += ns;
+        stats.batchNs.push_back(ns);
+        stats.pending = consumer->m_toSync.size();
+    }
+
+    void OrchPerfTest::measure(const string &table, uint64_t entries, const function<void()> &fn)
+    {
+        TableStats &stats = PerfReport::instance().table(workloadName(), table);
+        stats.sets += entries;
+
+        uint64_t allocations = allocationCount();
+        auto start = chrono::steady_clock::now();
+
+        fn();
+
+        uint64_t ns = static_cast<uint64_t>(
+            chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+
+        stats.allocations += allocationCount() - allocations;
+        stats.totalNs += ns;
+        stats.batchNs.push_back(ns);
+    }
+
+    void OrchPerfTest::run(const string &table, const deque<KeyOpFieldsValuesTuple> &entries)
+    {
+        ConsumerBase *consumer = findConsumer(table);
+        ASSERT_NE(consumer, nullptr) << "No consumer for table " << table;
+
+        deque<KeyOpFieldsValuesTuple> batch;
+        for (const auto &entry : entries)
+        {
+            batch.push_back(entry);
+            if (batch.size() >= gPerfOptions.batchSize)
+            {
+                drainBatch(consumer, table, batch);
+                batch.clear();
+            }
+        }
+        if (!batch.empty())
+        {
+            drainBatch(consumer, table, batch);
+        }
+    }
+
+    void OrchPerfTest::replay(const vector<swss::RecEntry> &entries)
+    {
+        string table;
+        deque<KeyOpFieldsValuesTuple> batch;
+
+        auto flush = [&]() {
+            if (batch.empty())
+            {
+                return;
+            }
+            ConsumerBase *consumer = findConsumer(table);
+            if (consumer != nullptr)
+            {
+                drainBatch(consumer, table, batch);
+            }
+            else
+            {
+                PerfReport::instance().table(workloadName(), table).pending += batch.size();
+            }
+            batch.clear();
+        };
+
+        for (const auto &entry : entries)
+        {
+            if (entry.prefix.empty())
+            {
+                continue;
+            }
+
+            // The prefix ends with the table name separator
+            string name = entry.prefix.substr(0, entry.prefix.size() - 1);
+            if (name != table || batch.size() >= gPerfOptions.batchSize)
+            {
+                flush();
+                table = move(name);
+            }
+            batch.push_back(entry.tuple);
+        }
+        flush();
+    }
+
+    void OrchPerfTest::PostSetUp()
+    {
+        if (!resetPeakRss())
+        {
+            cerr << "VmHWM can't be reset, peak_rss_delta_kb includes earlier workloads" << endl;
+        }
+        m_rssStart = sampleRss();
+    }
+
+    void OrchPerfTest::finish()
+    {
+        PerfReport::instance().setRss(workloadName(), m_rssStart, sampleRss());
+    }
+
+    string OrchPerfTest::workloadName() const
+    {
+        return ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    }
+}
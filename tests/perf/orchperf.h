@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "mock_dash_orch_test.h"
+#include "recformat.h"
+
+namespace orchperf
+{
+    struct PerfOptions
+    {
+        // swss.rec trace to replay, the replay workload is skipped when empty
+        std::string recFile;
+        // Report location
+        std::string output = "orchperf.json";
+        // Multiplier applied to the synthetic workload sizes
+        uint32_t scale = 1;
+        // Entries handed to a consumer per drain, mirrors orchagent -b
+        uint32_t batchSize = 128;
+    };
+
+    extern PerfOptions gPerfOptions;
+
+    // Number of heap allocations made by the process so far
+    uint64_t allocationCount();
+
+    struct RssSample
+    {
+        // VmRSS and VmHWM of the process in KB
+        long rssKb = 0;
+        long hwmKb = 0;
+    };
+
+    // Reads the resident set size of the process from /proc/self/status
+    RssSample sampleRss();
+
+    // Resets VmHWM to the current VmRSS, so the peak of each workload is
+    // measured on its own. Returns false on kernels without support for it.
+    bool resetPeakRss();
+
+    struct TableStats
+    {
+        uint64_t sets = 0;
+        uint64_t dels = 0;
+        uint64_t allocations = 0;
+        uint64_t totalNs = 0;
+        // Remaining entries in the consumer once the workload completed
+        uint64_t pending = 0;
+        std::vector<uint64_t> batchNs;
+
+        uint64_t entries() const
+        {
+            return sets + dels;
+        }
+    };
+
+    // Collects per table statistics for every workload and writes them as a
+    // single JSON document, so two runs can be compared entry by entry.
+    class PerfReport
+    {
+    public:
+        static PerfReport &instance();
+
+        TableStats &table(const std::string &workload, const std::string &table);
+        void setRss(const std::string &workload, const RssSample &start, const RssSample &end);
+
+        bool write(const std::string &path) const;
+
+    private:
+        struct Workload
+        {
+            std::map<std::string, TableStats> tables;
+            // VmRSS growth over the workload and peak above the VmRSS at its start
+            long rssDeltaKb = 0;
+            long peakRssDeltaKb = 0;
+        };
+
+        std::map<std::string, Workload> m_workloads;
+        long m_peakRssKb = 0;
+    };
+
+    class OrchPerfTest : public mock_orch_test::MockDashOrchTest
+    {
+    protected:
+        void ApplyInitialConfigs() override;
+        void PostSetUp() override;
+
+        // Returns the consumer of table owned by any of the orchs under test
+        ConsumerBase *findConsumer(const std::string &table);
+
+        // Feeds entries to the consumer of table in batches of
+        // gPerfOptions.batchSize and accounts the time and allocations spent
+        // in each drain to the table.
+        void run(const std::string &table, const std::deque<swss::KeyOpFieldsValuesTuple> &entries);
+
+        // Replays entries in order, batching consecutive entries of the same
+        // table like a select loop would.
+        void replay(const std::vector<swss::RecEntry> &entries);
+
+        // Accounts the time and allocations spent in fn as one batch of
+        // entries set on table, for work that doesn't go through a consumer.
+        void measure(const std::string &table, uint64_t entries, const std::function<void()> &fn);
+
+        void finish();
+
+        std::string workloadName() const;
+
+    private:
+        void drainBatch(ConsumerBase *consumer, const std::string &table,
+                        const std::deque<swss::KeyOpFieldsValuesTuple> &batch);
+
+        std::map<std::string, ConsumerBase *> m_consumers;
+        RssSample m_rssStart;
+    };
+}
@@ -0,0 +1,53 @@
+#include "orchperf.h"
+
+#include <iostream>
+#include <getopt.h>
+
+using namespace std;
+
+static void usage()
+{
+    cout << "usage: tests_perf [gtest options] [-r swss_rec] [-o report] [-s scale] [-b batch_size]" << endl;
+    cout << "    -r swss_rec: replay the given swss.rec, text or binary, in addition to the synthetic workloads" << endl;
+    cout << "    -o report: JSON report location. Default: orchperf.json" << endl;
+    cout << "    -s scale: multiplier applied to the synthetic workload sizes. Default: 1" << endl;
+    cout << "    -b batch_size: entries handed to a consumer per drain. Default: 128" << endl;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    int opt;
+    while ((opt = getopt(argc, argv, "r:o:s:b:h")) != -1)
+    {
+        switch (opt)
+        {
+        case 'r':
+            orchperf::gPerfOptions.recFile = optarg;
+            break;
+        case 'o':
+            orchperf::gPerfOptions.output = optarg;
+            break;
+        case 's':
+            orchperf::gPerfOptions.scale = static_cast<uint32_t>(max(1, atoi(optarg)));
+            break;
+        case 'b':
+            orchperf::gPerfOptions.batchSize = static_cast<uint32_t>(max(1, atoi(optarg)));
+            break;
+        default:
+            usage();
+            return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    int rc = RUN_ALL_TESTS();
+
+    if (!orchperf::PerfReport::instance().write(orchperf::gPerfOptions.output))
+    {
+        cerr << "Failed to write " << orchperf::gPerfOptions.output << endl;
+        return EXIT_FAILURE;
+    }
+
+    return rc;
+}
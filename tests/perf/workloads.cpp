@@ -0,0 +1,319 @@
+#include "orchperf.h"
+
+#include <arpa/inet.h>
+#include <cstdio>
+#include <fstream>
+#include <unordered_set>
+
+#include "aclorch.h"
+#include "flex_counter_manager.h"
+#include "sairedis.h"
+#include "dash_api/appliance.pb.h"
+#include "dash_api/route_type.pb.h"
+#include "dash_api/vnet.pb.h"
+#include "dash_api/vnet_mapping.pb.h"
+
+using namespace std;
+using namespace mock_orch_test;
+
+/*
+ * Synthetic workloads scale with gPerfOptions.scale. Every workload programs
+ * its objects and removes them again, so both directions of the orch and
+ * bulker paths are covered.
+ */
+namespace orchperf
+{
+    static const uint32_t ROUTE_COUNT = 10000;
+    static const uint32_t NEIGHBOR_COUNT = 2000;
+    static const uint32_t FDB_COUNT = 4000;
+    static const uint32_t ACL_RULE_COUNT = 1000;
+    static const uint32_t DASH_VNET_MAPPING_COUNT = 2000;
+
+    static string ipv4(uint32_t base, uint32_t index)
+    {
+        return IpAddress(htonl(base + index)).to_string();
+    }
+
+    static string mac(uint32_t index)
+    {
+        char buf[18];
+        snprintf(buf, sizeof(buf), "52:54:00:%02x:%02x:%02x",
+                 (index >> 16) & 0xff, (index >> 8) & 0xff, index & 0xff);
+        return buf;
+    }
+
+    static sai_switch_api_t *old_sai_switch_api;
+
+    // Flex counter operations are accepted without reaching the switch, so
+    // only the orchagent side of the registration is measured
+    static sai_status_t setSwitchAttribute(sai_object_id_t switch_id, const sai_attribute_t *attr)
+    {
+        if (attr->id == SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER ||
+            attr->id == SAI_REDIS_SWITCH_ATTR_FLEX_COUNTER_GROUP)
+        {
+            return SAI_STATUS_SUCCESS;
+        }
+        return old_sai_switch_api->set_switch_attribute(switch_id, attr);
+    }
+
+    struct FlexCounterApiHook
+    {
+        FlexCounterApiHook() : api(*sai_switch_api)
+        {
+            old_sai_switch_api = sai_switch_api;
+            api.set_switch_attribute = setSwitchAttribute;
+            sai_switch_api = &api;
+        }
+
+        ~FlexCounterApiHook()
+        {
+            sai_switch_api = old_sai_switch_api;
+        }
+
+        sai_switch_api_t api;
+    };
+
+    static deque<KeyOpFieldsValuesTuple> removals(const deque<KeyOpFieldsValuesTuple> &entries)
+    {
+        deque<KeyOpFieldsValuesTuple> dels;
+        for (const auto &entry : entries)
+        {
+            dels.emplace_back(kfvKey(entry), DEL_COMMAND, vector<FieldValueTuple>());
+        }
+        return dels;
+    }
+
+    class OrchPerf : public OrchPerfTest
+    {
+    protected:
+        deque<KeyOpFieldsValuesTuple> neighbors(uint32_t count)
+        {
+            // 10.0.0.0/16 on Ethernet0, skipping the interface address
+            deque<KeyOpFieldsValuesTuple> entries;
+            for (uint32_t i = 0; i < count; i++)
+            {
+                entries.emplace_back(ETHERNET0 + ":" + ipv4(0x0a000002, i), SET_COMMAND,
+                                     vector<FieldValueTuple>({ { "neigh", mac(i) },
+                                                               { "family", "IPv4" } }));
+            }
+            return entries;
+        }
+    };
+
+    TEST_F(OrchPerf, Neighbors)
+    {
+        auto entries = neighbors(NEIGHBOR_COUNT * gPerfOptions.scale);
+
+        run(APP_NEIGH_TABLE_NAME, entries);
+        run(APP_NEIGH_TABLE_NAME, removals(entries));
+
+        finish();
+    }
+
+    TEST_F(OrchPerf, Routes)
+    {
+        const uint32_t nexthops = 16;
+        run(APP_NEIGH_TABLE_NAME, neighbors(nexthops));
+
+        // One in four routes is ECMP over two next hops
+        deque<KeyOpFieldsValuesTuple> entries;
+        for (uint32_t i = 0; i < ROUTE_COUNT * gPerfOptions.scale; i++)
+        {
+            string nh = ipv4(0x0a000002, i % nexthops);
+            string ifname = ETHERNET0;
+            if (i % 4 == 0)
+            {
+                nh += "," + ipv4(0x0a000002, (i + 1) % nexthops);
+                ifname += "," + ETHERNET0;
+            }
+            entries.emplace_back(ipv4(0x64000000, i << 8) + "/24", SET_COMMAND,
+                                 vector<FieldValueTuple>({ { "nexthop", nh },
+                                                           { "ifname", ifname } }));
+        }
+
+        run(APP_ROUTE_TABLE_NAME, entries);
+        run(APP_ROUTE_TABLE_NAME, removals(entries));
+
+        finish();
+    }
+
+    TEST_F(OrchPerf, Fdb)
+    {
+        deque<KeyOpFieldsValuesTuple> entries;
+        for (uint32_t i = 0; i < FDB_COUNT * gPerfOptions.scale; i++)
+        {
+            entries.emplace_back(VLAN_1000 + ":" + mac(i), SET_COMMAND,
+                                 vector<FieldValueTuple>({ { "port", ETHERNET12 },
+                                                           { "type", "dynamic" } }));
+        }
+
+        run(APP_FDB_TABLE_NAME, entries);
+        run(APP_FDB_TABLE_NAME, removals(entries));
+
+        finish();
+    }
+
+    TEST_F(OrchPerf, AclRules)
+    {
+        const string acl_table = "PERF_ACL";
+        run(CFG_ACL_TABLE_TABLE_NAME, { { acl_table, SET_COMMAND, { { ACL_TABLE_TYPE, TABLE_TYPE_L3 },
+                                                                    { ACL_TABLE_STAGE, STAGE_INGRESS },
+                                                                    { ACL_TABLE_PORTS, ETHERNET4 } } } });
+
+        deque<KeyOpFieldsValuesTuple> entries;
+        for (uint32_t i = 0; i < ACL_RULE_COUNT * gPerfOptions.scale; i++)
+        {
+            entries.emplace_back(acl_table + "|RULE_" + to_string(i), SET_COMMAND,
+                                 vector<FieldValueTuple>({ { RULE_PRIORITY, to_string(1000 + i) },
+                                                           { MATCH_SRC_IP, ipv4(0x14000000, i) + "/32" },
+                                                           { ACTION_PACKET_ACTION, PACKET_ACTION_DROP } }));
+        }
+
+        run(CFG_ACL_RULE_TABLE_NAME, entries);
+        run(CFG_ACL_RULE_TABLE_NAME, removals(entries));
+        run(CFG_ACL_TABLE_TABLE_NAME, { { acl_table, DEL_COMMAND, {} } });
+
+        finish();
+    }
+
+    TEST_F(OrchPerf, DashVnetMappings)
+    {
+        CreateApplianceEntry();
+        AddVnetEncapRoutingType(dash::route_type::ENCAP_TYPE_VXLAN);
+        CreateVnet();
+
+        deque<KeyOpFieldsValuesTuple> entries;
+        for (uint32_t i = 0; i < DASH_VNET_MAPPING_COUNT * gPerfOptions.scale; i++)
+        {
+            dash::vnet_mapping::VnetMapping vnet_map;
+            vnet_map.set_routing_type(dash::route_type::ROUTING_TYPE_VNET_ENCAP);
+            vnet_map.mutable_underlay_ip()->set_ipv4(htonl(0x07000000 + (i % 64)));
+            entries.emplace_back(vnet1 + ":" + ipv4(0x1e000000, i), SET_COMMAND,
+                                 vector<FieldValueTuple>({ { "pb", vnet_map.SerializeAsString() } }));
+        }
+
+        run(APP_DASH_VNET_MAPPING_TABLE_NAME, entries);
+        run(APP_DASH_VNET_MAPPING_TABLE_NAME, removals(entries));
+
+        finish();
+    }
+
+    TEST_F(OrchPerf, FlexCounterRegistration)
+    {
+        FlexCounterApiHook hook;
+
+        // Port, queue and PG counters of every front panel port, the way
+        // PortsOrch registers them at boot
+        vector<vector<sai_object_id_t>> ports(1), queues, pgs;
+        for (const auto &it : gPortsOrch->getAllPorts())
+        {
+            if (it.second.m_type != Port::PHY)
+            {
+                continue;
+            }
+            ports[0].push_back(it.second.m_port_id);
+            queues.push_back(it.second.m_queue_ids);
+            pgs.push_back(it.second.m_priority_group_ids);
+        }
+        ASSERT_FALSE(ports[0].empty());
+
+        const unordered_set<string> port_stats = {
+            "SAI_PORT_STAT_IF_IN_OCTETS",
+            "SAI_PORT_STAT_IF_IN_UCAST_PKTS",
+            "SAI_PORT_STAT_IF_OUT_OCTETS",
+            "SAI_PORT_STAT_IF_OUT_UCAST_PKTS"
+        };
+        const unordered_set<string> queue_stats = {
+            "SAI_QUEUE_STAT_PACKETS",
+            "SAI_QUEUE_STAT_BYTES",
+            "SAI_QUEUE_STAT_DROPPED_PACKETS",
+            "SAI_QUEUE_STAT_DROPPED_BYTES"
+        };
+        const unordered_set<string> pg_stats = {
+            "SAI_INGRESS_PRIORITY_GROUP_STAT_DROPPED_PACKETS"
+        };
+
+        // Each group of objects is one batch, the flush is timed as a last
+        // batch of the same table
+        auto perObject = [&](const string &group, CounterType type,
+                             const vector<vector<sai_object_id_t>> &objects,
+                             const unordered_set<string> &stats)
+        {
+            FlexCounterTaggedCachedManager<void> manager("PERF_" + group, StatsMode::READ, 10000, false);
+            for (const auto &oids : objects)
+            {
+                measure(group + "|per_object", oids.size(), [&]() {
+                    for (auto oid : oids)
+                    {
+                        manager.setCounterIdList(oid, type, stats);
+                    }
+                });
+            }
+            measure(group + "|per_object", 0, [&]() { manager.flush(); });
+        };
+
+        auto asList = [&](const string &group, CounterType type,
+                          const vector<vector<sai_object_id_t>> &objects,
+                          const unordered_set<string> &stats)
+        {
+            FlexCounterTaggedCachedManager<void> manager("PERF_" + group, StatsMode::READ, 10000, false);
+            for (const auto &oids : objects)
+            {
+                measure(group + "|list", oids.size(), [&]() {
+                    manager.setCounterIdList(oids, type, stats);
+                });
+            }
+            measure(group + "|list", 0, [&]() { manager.flush(); });
+        };
+
+        for (uint32_t round = 0; round < gPerfOptions.scale; round++)
+        {
+            perObject("PORT_STAT_COUNTER", CounterType::PORT, ports, port_stats);
+            asList("PORT_STAT_COUNTER", CounterType::PORT, ports, port_stats);
+            perObject("QUEUE_STAT_COUNTER", CounterType::QUEUE, queues, queue_stats);
+            asList("QUEUE_STAT_COUNTER", CounterType::QUEUE, queues, queue_stats);
+            perObject("PG_DROP_STAT_COUNTER", CounterType::PRIORITY_GROUP, pgs, pg_stats);
+            asList("PG_DROP_STAT_COUNTER", CounterType::PRIORITY_GROUP, pgs, pg_stats);
+        }
+
+        finish();
+    }
+
+    TEST_F(OrchPerf, Replay)
+    {
+        if (gPerfOptions.recFile.empty())
+        {
+            GTEST_SKIP() << "No swss.rec given";
+        }
+
+        vector<swss::RecEntry> entries;
+        swss::RecEntry entry;
+        if (swss::RecBinaryReader::isBinary(gPerfOptions.recFile))
+        {
+            swss::RecBinaryReader reader;
+            ASSERT_TRUE(reader.open(gPerfOptions.recFile)) << "Failed to open " << gPerfOptions.recFile;
+            while (reader.next(entry))
+            {
+                entries.push_back(move(entry));
+            }
+        }
+        else
+        {
+            ifstream file(gPerfOptions.recFile);
+            ASSERT_TRUE(file.is_open()) << "Failed to open " << gPerfOptions.recFile;
+
+            string line;
+            while (getline(file, line))
+            {
+                if (swss::parseRecTextLine(line, entry))
+                {
+                    entries.push_back(move(entry));
+                }
+            }
+        }
+
+        replay(entries);
+
+        finish();
+    }
+}
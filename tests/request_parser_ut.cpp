@@ -2024,3 +2024,47 @@ TEST(request_parser, string_list_clear_test)
         FAIL() << "Got unexpected exception";
     }
 }
+
+TEST(request_parser, attrSlotsResetOnClear)
+{
+    KeyOpFieldsValuesTuple t1 {"key1|02:03:04:05:06:07|key2", "SET",
+                                {
+                                    { "just_string", "first" },
+                                    { "vlan", "Vlan10" },
+                                }
+                            };
+
+    KeyOpFieldsValuesTuple t2 {"key3|02:03:04:05:06:08|key4", "SET",
+                                {
+                                    { "just_string", "second" },
+                                }
+                            };
+
+    try
+    {
+        TestRequest2 request;
+
+        EXPECT_NO_THROW(request.parse(t1));
+        EXPECT_TRUE(request.hasAttr("vlan"));
+        EXPECT_EQ(request.getAttrVlan("vlan"), 10);
+        EXPECT_THROW(request.getAttrBool("just_string"), std::out_of_range);
+        EXPECT_THROW(request.getKeyString(1), std::out_of_range);
+
+        EXPECT_NO_THROW(request.clear());
+
+        // Values of the previous request must not leak into the next one
+        EXPECT_NO_THROW(request.parse(t2));
+        EXPECT_STREQ(request.getAttrString("just_string").c_str(), "second");
+        EXPECT_FALSE(request.hasAttr("vlan"));
+        EXPECT_THROW(request.getAttrVlan("vlan"), std::out_of_range);
+        EXPECT_TRUE(request.getAttrFieldNames() == (std::unordered_set<std::string>{"just_string"}));
+    }
+    catch (const std::exception& e)
+    {
+        FAIL() << "Got unexpected exception " << e.what();
+    }
+    catch (...)
+    {
+        FAIL() << "Got unexpected exception";
+    }
+}
@@ -45,6 +45,12 @@ class TestVirtualChassis(object):
                fvs = sdb.wait_for_fields("FABRIC_CAPACITY_TABLE", "FABRIC_CAPACITY_DATA",['operating_links'], polling_config=max_poll)
                capacity = fvs['operating_links']
 
+               # the monitor reports how long each poll took
+               fvs = sdb.wait_for_fields("FABRIC_CAPACITY_TABLE", "FABRIC_MONITOR_STATS",
+                                         ['links', 'polls', 'last_poll_usec', 'max_poll_usec'], polling_config=max_poll)
+               assert int(fvs['links']) == 16
+               assert int(fvs['max_poll_usec']) >= int(fvs['last_poll_usec'])
+
                fvs = sdb.wait_for_fields("FABRIC_PORT_TABLE", sdb_port, ['STATUS'], polling_config=max_poll)
                link_status = fvs['STATUS']
                if link_status == 'up':
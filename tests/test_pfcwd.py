@@ -295,6 +295,52 @@ class TestPfcwdFunc(object):
             self.reset_pfcwd_counters(test_queues)
             self.stop_pfcwd_on_ports()
 
+    def test_pfcwd_software_periodic_counters(self, dvs, setup_teardown_test):
+        try:
+            # enable PFC on queues
+            test_queues = [3, 4]
+            self.set_ports_pfc(pfc_queues=test_queues)
+
+            # verify in asic db
+            self.verify_ports_pfc(test_queues)
+
+            # start pfcwd
+            self.start_pfcwd_on_ports()
+
+            # start pfc storm
+            self.set_storm_state(test_queues)
+
+            # verify pfcwd is triggered
+            self.verify_pfcwd_state(test_queues)
+            self.verify_pfcwd_counters(test_queues)
+
+            # the periodic commit of queues in storm writes the packet counters back
+            fields = ["PFC_WD_QUEUE_STATS_TX_PACKETS", "PFC_WD_QUEUE_STATS_TX_PACKETS_LAST"]
+            for port in self.test_ports:
+                for queue in test_queues:
+                    queue_oid = self.queue_oids[port + ":" + str(queue)]
+                    for field in fields:
+                        self.counters_db.delete_field("COUNTERS", queue_oid, field)
+            for port in self.test_ports:
+                for queue in test_queues:
+                    queue_oid = self.queue_oids[port + ":" + str(queue)]
+                    self.counters_db.wait_for_fields("COUNTERS", queue_oid, fields)
+
+            # the commit keeps the queues stormed and does not count a new storm
+            self.verify_pfcwd_state(test_queues)
+            self.verify_pfcwd_counters(test_queues)
+
+            # stop storm
+            self.set_storm_state(test_queues, state="disabled")
+
+            # verify pfcwd state is restored
+            self.verify_pfcwd_state(test_queues, state="operational")
+            self.verify_pfcwd_counters(test_queues, restore="1")
+
+        finally:
+            self.reset_pfcwd_counters(test_queues)
+            self.stop_pfcwd_on_ports()
+
 #
 # Add Dummy always-pass test at end as workaroud
 # for issue when Flaky fail on final test it invokes module tear-down before retrying
@@ -104,7 +104,8 @@ int main()
             if (res == swss::Select::OBJECT)
             {
                 update_interfaces(sst_lag, teamdctl_mgr);
-                values_store.update(teamdctl_mgr.get_dumps(false));
+                const auto & changed_lags = values_store.update(teamdctl_mgr.get_dumps(false));
+                teamdctl_mgr.update_poll_intervals(changed_lags);
             }
             else if (res == swss::Select::ERROR)
             {
@@ -117,7 +118,8 @@ int main()
                 // In the case of lag removal, there is a scenario where the select::TIMEOUT
                 // occurs, it triggers get_dumps incorrectly for resource which was in process of 
                 // getting deleted. The fix here is to retry and check if this is a real failure.
-                values_store.update(teamdctl_mgr.get_dumps(true));
+                const auto & changed_lags = values_store.update(teamdctl_mgr.get_dumps(true));
+                teamdctl_mgr.update_poll_intervals(changed_lags);
             }
             else
             {
@@ -108,6 +108,7 @@ bool TeamdCtlMgr::try_add_lag(const std::string & lag_name)
 
     m_handlers.emplace(lag_name, tdc);
     m_lags_to_add.erase(lag_name);
+    m_poll_states[lag_name] = { min_poll_interval, Clock::now(), "", false };
     SWSS_LOG_NOTICE("The LAG '%s' has been added.", lag_name.c_str());
 
     return true;
@@ -127,6 +128,7 @@ bool TeamdCtlMgr::remove_lag(const std::string & lag_name)
         teamdctl_disconnect(tdc);
         teamdctl_free(tdc);
         m_handlers.erase(lag_name);
+        m_poll_states.erase(lag_name);
         SWSS_LOG_NOTICE("The LAG '%s' has been removed.", lag_name.c_str());
     }
     else if (m_lags_to_add.find(lag_name) != m_lags_to_add.end())
@@ -237,24 +239,77 @@ TeamdCtlDump TeamdCtlMgr::get_dump(const std::string & lag_name, bool to_retry)
 
 ///
 /// Get dumps for all registered LAG interfaces
+/// Only the LAGs which poll interval has expired are queried from teamd.
+/// For the rest the last dump is returned.
 /// @return vector of pairs. Each pair first value is a name of LAG, second value is a dump
 ///
 TeamdCtlDumps TeamdCtlMgr::get_dumps(bool to_retry)
 {
     TeamdCtlDumps res;
+    const auto now = Clock::now();
 
     for (const auto & p: m_handlers)
     {
         const auto & lag_name = p.first;
+        auto & poll_state = m_poll_states[lag_name];
+        poll_state.polled = false;
+        if (now < poll_state.next_poll && !poll_state.last_dump.empty())
+        {
+            res.push_back({ lag_name, poll_state.last_dump });
+            continue;
+        }
+
         const auto & result = get_dump(lag_name, to_retry);
         const auto & status = result.first;
         const auto & dump = result.second;
         if (status)
         {
+            poll_state.last_dump = dump;
+            poll_state.polled = true;
             res.push_back({ lag_name, dump });
         }
+        else
+        {
+            // Query the LAG again on the next call
+            poll_state.last_dump.clear();
+            poll_state.interval = min_poll_interval;
+        }
     }
 
     return res;
 }
 
+///
+/// Schedule the next poll of the LAGs queried in the last get_dumps() call.
+/// A LAG which dump has changed is polled again as soon as possible, while
+/// the polling interval of a stable LAG is doubled.
+/// @param changed_lags names of the LAGs which dump has changed
+///
+void TeamdCtlMgr::update_poll_intervals(const std::unordered_set<std::string> & changed_lags)
+{
+    const auto now = Clock::now();
+
+    for (auto & p: m_poll_states)
+    {
+        const auto & lag_name = p.first;
+        auto & poll_state = p.second;
+        if (!poll_state.polled)
+        {
+            continue;
+        }
+
+        if (changed_lags.find(lag_name) != changed_lags.end())
+        {
+            poll_state.interval = min_poll_interval;
+        }
+        else
+        {
+            poll_state.interval = std::min(poll_state.interval * 2, max_poll_interval);
+        }
+        // get_dumps() is called at least every min_poll_interval, so a LAG with
+        // the minimal interval is due on every call
+        poll_state.next_poll = now + poll_state.interval - min_poll_interval;
+        poll_state.polled = false;
+    }
+}
+
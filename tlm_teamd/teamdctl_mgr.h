@@ -2,7 +2,9 @@
 
 #include <string>
 #include <vector>
+#include <chrono>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <teamdctl.h>
 
@@ -21,14 +23,31 @@ public:
     // Retry logic added to prevent incorrect error reporting in dump API's
     TeamdCtlDump get_dump(const std::string & lag_name, bool to_retry);
     TeamdCtlDumps get_dumps(bool to_retry);
+    // Adapt polling intervals to the LAGs which state has changed in the last dumps
+    void update_poll_intervals(const std::unordered_set<std::string> & changed_lags);
 
 private:
+    using Clock = std::chrono::steady_clock;
+
+    struct PollState
+    {
+        std::chrono::milliseconds interval;
+        Clock::time_point next_poll;
+        std::string last_dump; // handed out again until the LAG is due
+        bool polled;           // the dump was taken in the last get_dumps()
+    };
+
     bool has_key(const std::string & lag_name) const;
     bool try_add_lag(const std::string & lag_name);
 
     std::unordered_map<std::string, struct teamdctl*> m_handlers;
     std::unordered_map<std::string, int> m_lags_to_add;
     std::unordered_map<std::string, int> m_lags_err_retry;
+    std::unordered_map<std::string, PollState> m_poll_states;
 
     const int max_attempts_to_add = 10;
+    // A LAG which state changes is polled on every get_dumps() call. The interval
+    // doubles with every dump without changes, up to the max_poll_interval
+    const std::chrono::milliseconds min_poll_interval = std::chrono::milliseconds(1000);
+    const std::chrono::milliseconds max_poll_interval = std::chrono::milliseconds(16000);
 };
@@ -1,3 +1,5 @@
+#include <functional>
+
 #include <jansson.h>
 
 #include <logger.h>
@@ -203,23 +205,52 @@ json_t * ValuesStore::load_json(const std::string & data)
 
 ///
 /// Convert json input from all teamds to the temporary storage
+/// A dump is parsed only when its hash differs from the hash of the previous
+/// dump of the same LAG. Otherwise the values extracted last time are reused.
 /// @param dumps dumps from all teamds. It is a vector of pairs. Each pair
 ///              has a first element - name of the LAG and a second element
 ///              - json dump
+/// @param changed_lags names of the LAGs which dump had to be parsed
 /// @return temporary storage
 ///
-HashOfRecords ValuesStore::from_json(const std::vector<StringPair> & dumps)
+HashOfRecords ValuesStore::from_json(const std::vector<StringPair> & dumps, std::unordered_set<std::string> & changed_lags)
 {
     HashOfRecords storage;
+    std::unordered_map<std::string, LagDump> lag_dumps;
     for (const auto & p: dumps)
     {
         const auto & lag_name = p.first;
         const auto & json_dump = p.second;
-        json_t * root = load_json(json_dump);
-        extract_values(lag_name, root, storage);
-        json_decref(root);
+        const size_t hash = std::hash<std::string>()(json_dump);
+
+        auto it = m_lag_dumps.find(lag_name);
+        if (it == m_lag_dumps.end() || it->second.hash != hash)
+        {
+            LagDump lag_dump = { hash, HashOfRecords() };
+            json_t * root = load_json(json_dump);
+            try
+            {
+                extract_values(lag_name, root, lag_dump.records);
+            }
+            catch (...)
+            {
+                json_decref(root);
+                throw;
+            }
+            json_decref(root);
+            it = lag_dumps.emplace(lag_name, std::move(lag_dump)).first;
+            changed_lags.insert(lag_name);
+        }
+        else
+        {
+            it = lag_dumps.emplace(lag_name, std::move(it->second)).first;
+        }
+        storage.insert(it->second.records.begin(), it->second.records.end());
     }
 
+    // LAGs without a dump are dropped, so a dump of a re-added LAG is parsed again
+    m_lag_dumps.swap(lag_dumps);
+
     return storage;
 }
 
@@ -289,78 +320,83 @@ void ValuesStore::remove_keys_db(const std::vector<std::string> & keys)
         // to connect to teamdctl and if it fails we do not delete State Db entry.
         if (table_name == "LAG_TABLE")
             continue;
-        swss::Table table(m_db, table_name);
-        table.del(table_key);
+        get_table(table_name).del(table_key);
     }
 }
 
+///
+/// Get a buffered table on the pipeline. All writes of an update are flushed together.
+/// @param table_name a name of the table
+/// @return a reference to the table
+///
+swss::Table & ValuesStore::get_table(const std::string & table_name)
+{
+    auto it = m_tables.find(table_name);
+    if (it == m_tables.end())
+    {
+        it = m_tables.emplace(table_name, std::unique_ptr<swss::Table>(new swss::Table(m_pipeline.get(), table_name, true))).first;
+    }
+
+    return *it->second;
+}
+
 ///
 /// Update the storage with values from the temporary storage
 /// The update is the following:
 /// 1. For each key in the temporary storage we check that we have that key in the storage
-/// 2. if not, we insert the key and value to the storage
-/// 3. if yes, we check that value of the key is not changed. If the value is changed we
-///    replace that value with the value from the temporary storage
-/// This method returns a list of keys which should be updated in the database
+/// 2. if not, we insert the key and value to the storage, and all its fields are changed
+/// 3. if yes, we compare every field of the key, and replace the fields which value
+///    has changed
+/// This method returns only the changed fields, which should be updated in the database
 /// @param storage the temporary storage
-/// @retorun a list of keys which must be updated in the storage
+/// @retorun changed fields for every key which must be updated in the database
 ///
-std::vector<std::string> ValuesStore::update_storage(const HashOfRecords & storage)
+HashOfRecords ValuesStore::update_storage(const HashOfRecords & storage)
 {
-    std::vector<std::string> to_update;
+    HashOfRecords changes;
 
     for (const auto & entry_pair: storage)
     {
         const auto & entry_key    = entry_pair.first;
         const auto & entry_values = entry_pair.second;
-        if (m_storage.find(entry_key) == m_storage.end())
+        auto it = m_storage.find(entry_key);
+        if (it == m_storage.end())
         {
             m_storage.emplace(entry_pair);
-            to_update.emplace_back(entry_key);
+            changes.emplace(entry_pair);
         }
         else
         {
-            bool is_changed = false;
+            auto & stored_values = it->second;
             for (const auto & row_pair: entry_values)
             {
                 const auto & row_key   = row_pair.first;
                 const auto & row_value = row_pair.second;
-                if (m_storage[entry_key][row_key] != row_value)
+                auto & stored_value = stored_values[row_key];
+                if (stored_value != row_value)
                 {
-                    is_changed = true;
-                    break;
+                    stored_value = row_value;
+                    changes[entry_key].emplace(row_pair);
                 }
             }
-
-            if (is_changed)
-            {
-                m_storage.erase(entry_key);
-                m_storage.emplace(entry_pair);
-                to_update.emplace_back(entry_key);
-            }
         }
     }
 
-    return to_update;
+    return changes;
 }
 
 ///
-/// Update values in the db with values from the temporary storage
-/// @param storage a reference to the temporary storage
-/// @param keys_to_refresh a list of keys which must be refreshed in the db
+/// Write the changed fields to the db. Only the changed fields of every key are
+/// written, and all of them go out in a single pipelined batch
+/// @param changes changed fields for every key
 ///
-void ValuesStore::update_db(const HashOfRecords & storage, const std::vector<std::string> & keys_to_refresh)
+void ValuesStore::update_db(const HashOfRecords & changes)
 {
-    for (const auto & key: keys_to_refresh)
+    for (const auto & change: changes)
     {
-        std::vector<swss::FieldValueTuple> fvp;
-        for (const auto & row_pair: storage.at(key))
-        {
-            fvp.emplace_back(row_pair);
-        }
-        const auto & table_pair = split_key(key);
-        swss::Table table(m_db, table_pair.first);
-        table.set(table_pair.second, fvp);
+        std::vector<swss::FieldValueTuple> fvp(change.second.begin(), change.second.end());
+        const auto & table_pair = split_key(change.first);
+        get_table(table_pair.first).set(table_pair.second, fvp);
     }
 }
 
@@ -368,19 +404,30 @@ void ValuesStore::update_db(const HashOfRecords & storage, const std::vector<std
 ///
 /// Update the storage with json dumps for every registered LAG interface.
 ///
-void ValuesStore::update(const std::vector<StringPair> & dumps)
+std::unordered_set<std::string> ValuesStore::update(const std::vector<StringPair> & dumps)
 {
+    std::unordered_set<std::string> changed_lags;
     try
     {
-        const auto & storage = from_json(dumps);
+        const size_t lags_before = m_lag_dumps.size();
+        const auto & storage = from_json(dumps, changed_lags);
+        if (changed_lags.empty() && lags_before == m_lag_dumps.size())
+        {
+            // Same LAGs with the same dumps, nothing to write
+            return changed_lags;
+        }
         const auto & old_keys = get_old_keys(storage);
         remove_keys_db(old_keys);
         remove_keys_storage(old_keys);
-        const auto & keys_to_refresh = update_storage(storage);
-        update_db(storage, keys_to_refresh);
+        const auto & changes = update_storage(storage);
+        update_db(changes);
+        m_pipeline->flush();
     }
     catch (const std::exception & e)
     {
         SWSS_LOG_WARN("Exception '%s' had been thrown in ValuesStore", e.what());
+        m_lag_dumps.clear();
     }
+
+    return changed_lags;
 }
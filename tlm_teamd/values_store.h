@@ -2,10 +2,14 @@
 
 #include <string>
 #include <vector>
+#include <memory>
+#include <unordered_set>
 
 #include <jansson.h>
 
 #include <dbconnector.h>
+#include <redispipeline.h>
+#include <table.h>
 
 using StringPair = std::pair<std::string, std::string>;
 using Records = std::unordered_map<std::string, std::string>;
@@ -14,8 +18,9 @@ using HashOfRecords = std::unordered_map<std::string, Records>;
 class ValuesStore
 {
 public:
-    ValuesStore(const swss::DBConnector * db) : m_db(db) {};
-    void update(const std::vector<StringPair> & dumps);
+    ValuesStore(const swss::DBConnector * db) : m_db(db), m_pipeline(new swss::RedisPipeline(db)) {};
+    // Returns names of the LAGs which dump has changed since the previous update
+    std::unordered_set<std::string> update(const std::vector<StringPair> & dumps);
 
 private:
     enum class json_type
@@ -33,17 +38,27 @@ private:
     std::string unpack_boolean(json_t * root, const std::string & key, const std::string & path);
     std::string unpack_integer(json_t * root, const std::string & key, const std::string & path);
     std::string get_value(json_t * root, const std::string & path, ValuesStore::json_type type);
-    HashOfRecords from_json(const std::vector<StringPair> & dumps);
+    HashOfRecords from_json(const std::vector<StringPair> & dumps, std::unordered_set<std::string> & changed_lags);
     std::vector<std::string> get_old_keys(const HashOfRecords & storage);
     void remove_keys_storage(const std::vector<std::string> & keys);
     void remove_keys_db(const std::vector<std::string> & keys);
     StringPair split_key(const std::string & key);
-    std::vector<std::string> update_storage(const HashOfRecords & storage);
-    void update_db(const HashOfRecords & storage, const std::vector<std::string> & keys_to_refresh);
+    HashOfRecords update_storage(const HashOfRecords & storage);
+    void update_db(const HashOfRecords & changes);
     void extract_values(const std::string & lag_name, json_t * root, HashOfRecords & storage);
+    swss::Table & get_table(const std::string & table_name);
+
+    struct LagDump
+    {
+        size_t hash;           // hash of the raw teamd dump
+        HashOfRecords records; // values extracted from that dump
+    };
 
     HashOfRecords m_storage;  // our main storage
+    std::unordered_map<std::string, LagDump> m_lag_dumps; // last parsed dump for every LAG
     const swss::DBConnector * m_db;
+    std::unique_ptr<swss::RedisPipeline> m_pipeline;
+    std::unordered_map<std::string, std::unique_ptr<swss::Table>> m_tables;
 
     const std::vector<std::pair<std::string, ValuesStore::json_type>> m_lag_paths = {
         { "setup.kernel_team_mode_name", ValuesStore::json_type::string  },